@@ -5,7 +5,11 @@
 #include <map>
 
 #include "../lib/reader/hlsl/parser.h"
+#include "../lib/util/trace.h"
 #include "../lib/visitor/print_visitor.h"
+#include "../lib/visitor/prune_tree.h"
+#include "../lib/visitor/reflect_bindings.h"
+#include "../lib/visitor/visitor.h"
 
 typedef std::map<std::string, size_t> BufferFieldSizeMap;
 typedef std::map<std::string, BufferFieldSizeMap> BufferMap;
@@ -26,6 +30,9 @@ public:
   }
 
   void visitBufferField(ast::Field* node) override {
+    if (!isVisible(node)) {
+      return;
+    }
     (*_fieldSizeMap)[std::string(node->name)] = 0; // calculate field size, offset, etc.
   }
 };
@@ -112,39 +119,120 @@ int main(int argc, char** argv) {
 #endif // 0
   
 #if 1
-  if (argc < 2) {
-    std::cerr << "Usage: hlsl_reflect <file>" << std::endl;
-    return 1;
+  const char* path = nullptr;
+  const char* tracePath = nullptr;
+  const char* entryPoint = nullptr;
+  const char* jsonPath = nullptr;
+  const char* blobPath = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--trace" && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else if (arg == "--entry" && i + 1 < argc) {
+      entryPoint = argv[++i];
+    } else if (arg == "--json" && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (arg == "--blob" && i + 1 < argc) {
+      blobPath = argv[++i];
+    } else {
+      path = argv[i];
+    }
   }
 
-  std::ifstream fp(argv[1], std::ios::binary);
-
-  if (!fp) {
-    std::cerr << "Unable to open file: " << argv[1] << std::endl;
+  if (path == nullptr) {
+    std::cerr << "Usage: hlsl_reflect [--trace <file.json>] [--entry <function>] "
+              << "[--json <bindings.json>] [--blob <bindings.bin>] <file>" << std::endl;
     return 1;
   }
 
+  util::TraceFile traceFile(tracePath);
+
   std::string hlsl;
-  std::getline(fp, hlsl, '\0');
-  fp.close();
+  {
+    HLSL_TRACE_SCOPE("load", path);
+    std::ifstream fp(path, std::ios::binary);
+
+    if (!fp) {
+      std::cerr << "Unable to open file: " << path << std::endl;
+      return 1;
+    }
+
+    std::getline(fp, hlsl, '\0');
+    fp.close();
+  }
 
   reader::hlsl::Parser parser(hlsl);
   ast::Ast* ast = parser.parse();
 
-  if (ast == nullptr) {
-    std::cerr << "Unable to parse file: " << argv[1] << std::endl;
+  for (const reader::hlsl::Diagnostic& diagnostic : parser.diagnostics()) {
+    const reader::hlsl::SourceLocation& location = diagnostic.location;
+    std::cerr << (location.filename.empty() ? std::string_view(path) : location.filename) << ":"
+              << location.line << ":" << location.column << ": error: " << diagnostic.message
+              << " '" << diagnostic.token.lexeme() << "'" << std::endl;
+  }
+
+  if (parser.hasErrors()) {
+    std::cerr << "Unable to parse file: " << path << std::endl;
+    delete ast;
     return 1;
   }
 
+  // Only reflect what the entry point uses, and report the cbuffer fields it doesn't.
+  if (entryPoint != nullptr) {
+    if (ast->findFunction(entryPoint) == nullptr) {
+      std::cerr << path << ": error: entry point '" << entryPoint << "' not found" << std::endl;
+      delete ast;
+      return 1;
+    }
+    visitor::PruneTree pruneTree(ast);
+    pruneTree.prune(entryPoint);
+    for (const ast::Field* field : pruneTree.unusedFields) {
+      std::cerr << path << ": warning: cbuffer field '" << field->name << "' is not used by '"
+                << entryPoint << "'" << std::endl;
+    }
+  }
+
   BufferFieldSizeVisitor findBuffers;
-  findBuffers.visitRoot(ast->root());
-
-  for (auto& buffer : findBuffers.bufferMap) {
-    std::cout << buffer.first << std::endl;
-    for (auto& field : buffer.second) {
-      std::string fieldName = field.first;
-      size_t& fieldSize = field.second;
-      std::cout << "  " << fieldName << " : " << fieldSize << std::endl;
+  {
+    HLSL_TRACE_SCOPE("reflect buffers");
+    findBuffers.visitRoot(ast->root());
+  }
+
+  // The binding table of every resource, marking those the entry point doesn't use.
+  visitor::ReflectBindings reflectBindings(ast);
+  if (jsonPath != nullptr || blobPath != nullptr) {
+    reflectBindings.reflect();
+  }
+
+  {
+    HLSL_TRACE_SCOPE("write output");
+    for (auto& buffer : findBuffers.bufferMap) {
+      std::cout << buffer.first << std::endl;
+      for (auto& field : buffer.second) {
+        std::string fieldName = field.first;
+        size_t& fieldSize = field.second;
+        std::cout << "  " << fieldName << " : " << fieldSize << std::endl;
+      }
+    }
+
+    if (jsonPath != nullptr) {
+      std::ofstream out(jsonPath);
+      if (!out) {
+        std::cerr << "Unable to write file: " << jsonPath << std::endl;
+        delete ast;
+        return 1;
+      }
+      reflectBindings.writeJson(out);
+    }
+    if (blobPath != nullptr) {
+      const std::vector<uint8_t> blob = reflectBindings.writeBinary();
+      std::ofstream out(blobPath, std::ios::binary);
+      if (!out) {
+        std::cerr << "Unable to write file: " << blobPath << std::endl;
+        delete ast;
+        return 1;
+      }
+      out.write(reinterpret_cast<const char*>(blob.data()), blob.size());
     }
   }
 
@@ -1,31 +1,88 @@
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "../lib/reader/hlsl/parallel_parser.h"
 #include "../lib/reader/hlsl/parser.h"
+#include "../lib/util/trace.h"
 
 int main(int argc, char** argv) {
-  if (argc < 2) {
-    std::cerr << "Usage: hlsl_reflect <file>" << std::endl;
-    return 1;
+  const char* path = nullptr;
+  // 1 parses on the calling thread, 0 uses one thread per hardware thread.
+  int numThreads = 1;
+  bool printStats = false;
+  const char* tracePath = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--threads" && i + 1 < argc) {
+      numThreads = std::atoi(argv[++i]);
+    } else if (arg == "--stats") {
+      printStats = true;
+    } else if (arg == "--trace" && i + 1 < argc) {
+      tracePath = argv[++i];
+    } else {
+      path = argv[i];
+    }
   }
 
-  std::ifstream fp(argv[1], std::ios::binary);
-
-  if (!fp) {
-    std::cerr << "Unable to open file: " << argv[1] << std::endl;
+  if (path == nullptr) {
+    std::cerr << "Usage: hlslParse [--threads <count>] [--stats] [--trace <file.json>] <file>"
+              << std::endl;
     return 1;
   }
 
+  util::TraceFile traceFile(tracePath);
+
   std::string src;
-  std::getline(fp, src, '\0');
-  fp.close();
+  {
+    HLSL_TRACE_SCOPE("load", path);
+    std::ifstream fp(path, std::ios::binary);
+
+    if (!fp) {
+      std::cerr << "Unable to open file: " << path << std::endl;
+      return 1;
+    }
+
+    std::getline(fp, src, '\0');
+    fp.close();
+  }
 
-  std::unique_ptr<ast::Ast> ast{ reader::hlsl::Parser(src).parse() };
+  std::unique_ptr<ast::Ast> ast;
+  std::vector<reader::hlsl::Diagnostic> diagnostics;
+  reader::hlsl::ParseStats stats;
+  if (numThreads == 1) {
+    reader::hlsl::Parser parser(src);
+    ast.reset(parser.parse());
+    diagnostics = parser.diagnostics();
+    stats = parser.stats();
+  } else {
+    reader::hlsl::ParallelParser parser(src, numThreads);
+    ast.reset(parser.parse());
+    diagnostics = parser.diagnostics();
+    stats = parser.stats();
+  }
+
+  if (printStats) {
+#if HLSL_REFLECT_STATS
+    stats.print(std::cout);
+#else
+    std::cerr << "hlslParse was built without HLSL_REFLECT_STATS, no stats to print" << std::endl;
+#endif
+  }
+
+  for (const reader::hlsl::Diagnostic& diagnostic : diagnostics) {
+    const reader::hlsl::SourceLocation& location = diagnostic.location;
+    std::cerr << (location.filename.empty() ? std::string_view(path) : location.filename) << ":"
+              << location.line << ":" << location.column << ": error: " << diagnostic.message
+              << " '" << diagnostic.token.lexeme() << "'" << std::endl;
+  }
 
-  if (!ast) {
-    std::cerr << "Unable to parse file: " << argv[1] << std::endl;
+  if (!diagnostics.empty()) {
+    std::cerr << "Unable to parse file: " << path << std::endl;
     return 1;
   }
 
@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "../lib/reader/hlsl/parser.h"
+
+// Generates a source with the given number of functions, where every errorInterval'th function
+// has a syntax error in its body, and an error at the top level after it.
+static std::string generateSource(int numFunctions, int errorInterval) {
+  std::string source = "cbuffer Globals { float4 _Color; float _Scale; };\n";
+  for (int i = 0; i < numFunctions; ++i) {
+    const std::string name = "func" + std::to_string(i);
+    const bool hasError = errorInterval > 0 && (i % errorInterval) == 0;
+    source += "float4 " + name + "(float4 a, float b) {\n";
+    source += "  float4 c = a * b + _Color;\n";
+    if (hasError) {
+      source += "  float d = (c.x + b;\n";
+    }
+    source += "  for (int j = 0; j < 4; ++j) { c = c * _Scale; }\n";
+    source += "  return c;\n";
+    source += "}\n";
+    if (hasError) {
+      source += "static const float bad" + std::to_string(i) + " = max(1,;\n";
+    }
+  }
+  return source;
+}
+
+int main(int argc, char** argv) {
+  int numFunctions = 2000;
+  int errorInterval = 4;
+  int iterations = 20;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--functions" && i + 1 < argc) {
+      numFunctions = std::atoi(argv[++i]);
+    } else if (arg == "--error-interval" && i + 1 < argc) {
+      errorInterval = std::atoi(argv[++i]);
+    } else if (arg == "--iterations" && i + 1 < argc) {
+      iterations = std::atoi(argv[++i]);
+    } else {
+      std::cerr << "Usage: hlslBenchErrors [--functions <count>] [--error-interval <count>] "
+                   "[--iterations <count>]" << std::endl;
+      return 1;
+    }
+  }
+
+  const std::string source = generateSource(numFunctions, errorInterval);
+
+  typedef std::chrono::high_resolution_clock Clock;
+  size_t numErrors = 0;
+  size_t numStatements = 0;
+  auto t1 = Clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    reader::hlsl::Parser parser(source);
+    ast::Ast* ast = parser.parse();
+    numErrors = parser.diagnostics().size();
+    numStatements = 0;
+    for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+      numStatements++;
+    }
+    delete ast;
+  }
+  auto t2 = Clock::now();
+
+  const double ms = std::chrono::duration<double, std::milli>(t2 - t1).count() / iterations;
+  std::cout << "bytes: " << source.size() << std::endl;
+  std::cout << "errors: " << numErrors << std::endl;
+  std::cout << "statements: " << numStatements << std::endl;
+  std::cout << "ms/parse: " << ms << std::endl;
+  std::cout << "MB/s: " << (source.size() / (1024.0 * 1024.0)) / (ms / 1000.0) << std::endl;
+  return 0;
+}
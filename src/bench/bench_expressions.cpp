@@ -0,0 +1,91 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "../lib/reader/hlsl/parser.h"
+#include "bench_util.h"
+
+static const char* binaryOperators[] = {
+  "+", "-", "*", "/", "%", "<<", ">>", "<", ">", "<=", ">=", "==", "!=", "&", "^", "|", "&&", "||"
+};
+
+static const char* operands[] = {
+  "a", "b", "1", "2.0", "c.x", "max(a, b)", "-a", "!b", "(a + b)", "v[1]"
+};
+
+static std::string generateExpression(bench::Random& random, int depth) {
+  if (depth == 0 || random.next(4) == 0) {
+    return operands[random.next(sizeof(operands) / sizeof(operands[0]))];
+  }
+  const uint32_t numOperators = sizeof(binaryOperators) / sizeof(binaryOperators[0]);
+  const char* op = binaryOperators[random.next(numOperators)];
+  return generateExpression(random, depth - 1) + " " + op + " " +
+         generateExpression(random, depth - 1);
+}
+
+// Generates functions made mostly of binary expressions.
+static std::string generateSource(int numFunctions) {
+  bench::Random random(7);
+  std::string source = "static const float v[4] = { 1, 2, 3, 4 };\n";
+  for (int i = 0; i < numFunctions; ++i) {
+    source += "float func" + std::to_string(i) + "(float a, float b, float4 c) {\n";
+    source += "  float d = " + generateExpression(random, 4) + ";\n";
+    source += "  if (" + generateExpression(random, 3) + ") { d = d * 2; }\n";
+    source += "  return " + generateExpression(random, 5) + ";\n";
+    source += "}\n";
+  }
+  return source;
+}
+
+static void runBenchmark(const char* name, const std::string& source, int iterations) {
+  if (source.empty()) {
+    std::cerr << "Unable to load " << name << std::endl;
+    return;
+  }
+  size_t maxDepth = 0;
+  const double ms = bench::timeIterations(iterations, [&source, &maxDepth]() {
+    reader::hlsl::Parser parser(source);
+    delete parser.parse();
+    HLSL_STATS(maxDepth = parser.stats().parser.maxDepth);
+  });
+  std::cout << name << ": " << source.size() << " bytes, " << ms << " ms/parse, "
+            << (source.size() / (1024.0 * 1024.0)) / (ms / 1000.0) << " MB/s";
+#if HLSL_REFLECT_STATS
+  // The depth of the parser's rules, which binary operators don't add to.
+  std::cout << ", max depth " << maxDepth;
+#endif
+  std::cout << std::endl;
+}
+
+// A single expression of a long chain of binary operators.
+static std::string generateChain(int numOperators) {
+  std::string source = "static const float chain = 1";
+  for (int i = 0; i < numOperators; ++i) {
+    source += binaryOperators[i % 4];
+    source += "2";
+  }
+  return source + ";\n";
+}
+
+int main(int argc, char** argv) {
+  int numFunctions = 2000;
+  int iterations = 20;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--functions" && i + 1 < argc) {
+      numFunctions = std::atoi(argv[++i]);
+    } else if (arg == "--iterations" && i + 1 < argc) {
+      iterations = std::atoi(argv[++i]);
+    } else {
+      std::cerr << "Usage: hlslBenchExpressions [--functions <count>] [--iterations <count>]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  runBenchmark("urp_bloom.hlsl", bench::loadFile(bench::dataPath("/hlsl/urp_bloom.hlsl")),
+               iterations);
+  runBenchmark("generated expressions", generateSource(numFunctions), iterations);
+  runBenchmark("operator chain", generateChain(numFunctions * 10), iterations);
+  return 0;
+}
@@ -0,0 +1,430 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "../lib/reader/hlsl/parser.h"
+#include "../lib/reader/hlsl/scanner.h"
+#include "../lib/visitor/glsl_generator.h"
+#include "../lib/visitor/prune_tree.h"
+#include "../lib/visitor/visitor.h"
+#include "bench_util.h"
+
+// Runs the full pipeline (scan, parse, prune, GLSL generation and buffer reflection) over a
+// corpus, reporting the time and allocations of each stage per file as JSON. The --compare mode
+// diffs two result files and fails if any stage of any file regressed by more than a threshold,
+// so a library upgrade can be checked before it's accepted.
+//
+// The peak resident set size is a high-water mark of the whole process, so with more than one
+// file each file is run in a process of its own, and peak_rss_kb is the peak of that file alone.
+
+// Count every allocation made through operator new, so each stage can report how many it made.
+static std::atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+  allocationCount++;
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+static const char* stageNames[] = { "scan", "parse", "prune", "glsl", "reflect" };
+static const size_t numStages = sizeof(stageNames) / sizeof(stageNames[0]);
+
+struct StageResult {
+  double ms = 0.0;
+  size_t allocations = 0;
+};
+
+struct FileResult {
+  std::string file;
+  size_t bytes = 0;
+  size_t nodes = 0;
+  size_t peakRssKB = 0;
+  StageResult stages[numStages];
+};
+
+// Collects the fields of each cbuffer and tbuffer still visible after pruning, the same
+// reflection hlslReflect reports.
+class BufferReflection : public visitor::Visitor {
+public:
+  std::map<std::string_view, std::vector<std::string_view>> buffers;
+
+  void visitBufferStmt(ast::BufferStmt* node) override {
+    if (!isVisible(node)) {
+      return;
+    }
+    _fields = &buffers[node->name];
+    visitor::Visitor::visitBufferStmt(node);
+    _fields = nullptr;
+  }
+
+  void visitBufferField(ast::Field* node) override {
+    if (_fields != nullptr && isVisible(node)) {
+      _fields->push_back(node->name);
+    }
+  }
+
+private:
+  std::vector<std::string_view>* _fields = nullptr;
+};
+
+// Time a stage, adding its time and allocations to the result.
+template<typename F>
+void runStage(StageResult& result, F&& func) {
+  const size_t allocations = allocationCount;
+  result.ms += bench::timeIterations(1, func);
+  result.allocations += allocationCount - allocations;
+}
+
+// Use "main" as the entry point if there is one, otherwise the last function in the file.
+static std::string_view findEntryPoint(ast::Ast* ast) {
+  if (ast->findFunction("main") != nullptr) {
+    return "main";
+  }
+  std::string_view entry;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::FunctionStmt) {
+      entry = static_cast<ast::FunctionStmt*>(stmt)->name;
+    }
+  }
+  return entry;
+}
+
+static bool runFile(const std::string& path, const std::string& entryPoint, int iterations,
+                    FileResult& result) {
+  const std::string source = bench::loadFile(path);
+  if (source.empty()) {
+    std::cerr << "Unable to open file: " << path << std::endl;
+    return false;
+  }
+
+  result.file = std::filesystem::path(path).filename().string();
+  result.bytes = source.size();
+
+  for (int i = 0; i < iterations; ++i) {
+    runStage(result.stages[0], [&]() {
+      reader::hlsl::Scanner scanner(source);
+      scanner.scan();
+    });
+
+    ast::Ast* ast = nullptr;
+    bool hasErrors = false;
+    runStage(result.stages[1], [&]() {
+      reader::hlsl::Parser parser(source);
+      ast = parser.parse();
+      hasErrors = parser.hasErrors();
+    });
+    if (hasErrors) {
+      std::cerr << "Unable to parse file: " << path << std::endl;
+      delete ast;
+      return false;
+    }
+    result.nodes = ast->numNodes();
+
+    const std::string_view entry = entryPoint.empty() ? findEntryPoint(ast)
+                                                      : std::string_view(entryPoint);
+    runStage(result.stages[2], [&]() {
+      visitor::PruneTree(ast).prune(entry);
+    });
+
+    runStage(result.stages[3], [&]() {
+      std::ostringstream out;
+      visitor::GlslGenerator generator(out);
+      generator.visitRoot(ast->root());
+    });
+
+    runStage(result.stages[4], [&]() {
+      BufferReflection reflection;
+      reflection.visitRoot(ast->root());
+    });
+
+    delete ast;
+  }
+
+  for (StageResult& stage : result.stages) {
+    stage.ms /= iterations;
+    stage.allocations /= iterations;
+  }
+  result.peakRssKB = bench::peakRssKB();
+  return true;
+}
+
+static void writeJson(std::ostream& out, const std::vector<FileResult>& results, int iterations) {
+  out << std::fixed << std::setprecision(4);
+  out << "{\n";
+  out << "  \"benchmark\": \"pipeline\",\n";
+  out << "  \"version\": 1,\n";
+  out << "  \"iterations\": " << iterations << ",\n";
+  out << "  \"files\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const FileResult& r = results[i];
+    out << "    {\"file\": \"" << r.file << "\", \"bytes\": " << r.bytes << ", \"nodes\": "
+        << r.nodes << ", \"peak_rss_kb\": " << r.peakRssKB << ", \"stages\": {";
+    for (size_t s = 0; s < numStages; ++s) {
+      out << (s > 0 ? ", " : "") << "\"" << stageNames[s] << "\": {\"ms\": " << r.stages[s].ms
+          << ", \"allocations\": " << r.stages[s].allocations << "}";
+    }
+    out << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+// Read the per-file results from a file written by writeJson. Each file is on its own line, so
+// this only needs to find the values by key.
+static bool readJson(const std::string& path, std::vector<FileResult>& results) {
+  std::ifstream in(path);
+  if (!in) {
+    std::cerr << "Unable to open file: " << path << std::endl;
+    return false;
+  }
+
+  auto findValue = [](const std::string& line, const std::string& key, size_t from) {
+    size_t pos = line.find("\"" + key + "\": ", from);
+    return pos == std::string::npos ? pos : pos + key.size() + 4;
+  };
+
+  std::string line;
+  while (std::getline(in, line)) {
+    size_t pos = findValue(line, "file", 0);
+    if (pos == std::string::npos) {
+      continue;
+    }
+    FileResult result;
+    result.file = line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+    const size_t bytes = findValue(line, "bytes", 0);
+    const size_t nodes = findValue(line, "nodes", 0);
+    const size_t peakRss = findValue(line, "peak_rss_kb", 0);
+    if (bytes != std::string::npos) {
+      result.bytes = std::strtoull(line.c_str() + bytes, nullptr, 10);
+    }
+    if (nodes != std::string::npos) {
+      result.nodes = std::strtoull(line.c_str() + nodes, nullptr, 10);
+    }
+    if (peakRss != std::string::npos) {
+      result.peakRssKB = std::strtoull(line.c_str() + peakRss, nullptr, 10);
+    }
+    for (size_t s = 0; s < numStages; ++s) {
+      size_t stage = findValue(line, stageNames[s], 0);
+      if (stage == std::string::npos) {
+        std::cerr << "Missing stage " << stageNames[s] << " in " << path << std::endl;
+        return false;
+      }
+      result.stages[s].ms = std::atof(line.c_str() + findValue(line, "ms", stage));
+      result.stages[s].allocations =
+          std::strtoull(line.c_str() + findValue(line, "allocations", stage), nullptr, 10);
+    }
+    results.push_back(result);
+  }
+  return true;
+}
+
+// Run the benchmark of a single file in a new process of this executable, reading its result
+// back from the JSON it writes.
+static bool runFileProcess(const std::string& executable, const std::string& path,
+                           const std::string& entryPoint, int iterations, FileResult& result) {
+  const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+  const std::string jsonPath = (std::filesystem::temp_directory_path() /
+      ("hlslBenchPipeline-" + std::to_string(now) + ".json")).string();
+
+  std::ostringstream command;
+  command << "\"" << executable << "\" --corpus \"" << path << "\" --iterations " << iterations
+          << " --json \"" << jsonPath << "\"";
+  if (!entryPoint.empty()) {
+    command << " --entry \"" << entryPoint << "\"";
+  }
+#if defined(_WIN32)
+  // cmd.exe strips the outer quotes of a command that starts with a quote.
+  const std::string commandLine = "\"" + command.str() + "\"";
+#else
+  const std::string commandLine = command.str();
+#endif
+
+  std::vector<FileResult> results;
+  const bool succeeded = std::system(commandLine.c_str()) == 0 && readJson(jsonPath, results) &&
+                         results.size() == 1;
+  std::error_code error;
+  std::filesystem::remove(jsonPath, error);
+  if (!succeeded) {
+    std::cerr << "Unable to run the benchmark of " << path << std::endl;
+    return false;
+  }
+  result = results[0];
+  return true;
+}
+
+// Whether the new value is more than the limit times the base value, and more than the minimum
+// difference, under which any difference is noise.
+template<typename T>
+static bool regressed(T base, T value, double limit, T minDifference) {
+  return value > base * limit && value - base > minDifference;
+}
+
+// Compare the results of each stage of each file in both results, and the peak memory of each
+// file. Returns false if any of them regressed by more than the threshold.
+static bool compareResults(const std::string& basePath, const std::string& newPath,
+                           double thresholdPercent) {
+  std::vector<FileResult> baseResults;
+  std::vector<FileResult> newResults;
+  if (!readJson(basePath, baseResults) || !readJson(newPath, newResults)) {
+    return false;
+  }
+
+  std::map<std::string, const FileResult*> baseFiles;
+  for (const FileResult& r : baseResults) {
+    baseFiles[r.file] = &r;
+  }
+
+  // Differences smaller than these are timer and allocator noise, whatever the percentage.
+  const double minRegressionMs = 0.05;
+  const size_t minRegressionRssKB = 1024;
+  const double limit = 1.0 + thresholdPercent / 100.0;
+
+  bool passed = true;
+  size_t numFiles = 0;
+  size_t numRegressions = 0;
+  std::cout << std::fixed << std::setprecision(3);
+  for (const FileResult& n : newResults) {
+    auto base = baseFiles.find(n.file);
+    if (base == baseFiles.end()) {
+      std::cerr << "Skipping " << n.file << ", it isn't in " << basePath << std::endl;
+      continue;
+    }
+    numFiles++;
+    const FileResult& b = *base->second;
+
+    std::cout << n.file << std::endl;
+    for (size_t s = 0; s < numStages; ++s) {
+      const StageResult& bs = b.stages[s];
+      const StageResult& ns = n.stages[s];
+      const bool timeRegressed = regressed(bs.ms, ns.ms, limit, minRegressionMs);
+      const bool allocationsRegressed =
+          regressed<size_t>(bs.allocations, ns.allocations, limit, 0);
+      std::cout << "  " << std::left << std::setw(8) << stageNames[s] << std::right
+                << " ms: " << bs.ms << " -> " << ns.ms
+                << "  allocations: " << bs.allocations << " -> " << ns.allocations;
+      if (timeRegressed || allocationsRegressed) {
+        std::cout << "  REGRESSED";
+        numRegressions++;
+        passed = false;
+      }
+      std::cout << std::endl;
+    }
+
+    // Results written before the peak was measured for each file have no peak to compare.
+    if (b.peakRssKB != 0 && n.peakRssKB != 0) {
+      std::cout << "  " << std::left << std::setw(8) << "memory" << std::right
+                << " peak_rss_kb: " << b.peakRssKB << " -> " << n.peakRssKB;
+      if (regressed(b.peakRssKB, n.peakRssKB, limit, minRegressionRssKB)) {
+        std::cout << "  REGRESSED";
+        numRegressions++;
+        passed = false;
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  if (numFiles == 0) {
+    std::cerr << "No files in common" << std::endl;
+    return false;
+  }
+
+  std::cout << (passed ? "PASSED" : "FAILED") << " (" << numFiles << " files, "
+            << numRegressions << " regressions, threshold " << thresholdPercent << "%)"
+            << std::endl;
+  return passed;
+}
+
+int main(int argc, char** argv) {
+  int iterations = 10;
+  double threshold = 10.0;
+  std::string jsonPath;
+  std::string entryPoint;
+  std::vector<std::string> corpus;
+  std::vector<std::string> compare;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--iterations" && i + 1 < argc) {
+      iterations = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--json" && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (arg == "--entry" && i + 1 < argc) {
+      entryPoint = argv[++i];
+    } else if (arg == "--corpus" && i + 1 < argc) {
+      corpus.push_back(argv[++i]);
+    } else if (arg == "--corpus-dir" && i + 1 < argc) {
+      for (const auto& entry : std::filesystem::directory_iterator(argv[++i])) {
+        if (entry.is_regular_file() && entry.path().extension() == ".hlsl") {
+          corpus.push_back(entry.path().string());
+        }
+      }
+    } else if (arg == "--compare" && i + 2 < argc) {
+      compare.push_back(argv[++i]);
+      compare.push_back(argv[++i]);
+    } else if (arg == "--threshold" && i + 1 < argc) {
+      threshold = std::atof(argv[++i]);
+    } else {
+      std::cerr << "Usage: hlslBenchPipeline [--corpus <file>]... [--corpus-dir <dir>] "
+                   "[--entry <name>] [--iterations <count>] [--json <file>]" << std::endl;
+      std::cerr << "       hlslBenchPipeline --compare <base.json> <new.json> "
+                   "[--threshold <percent>]" << std::endl;
+      return 1;
+    }
+  }
+
+  if (!compare.empty()) {
+    return compareResults(compare[0], compare[1], threshold) ? 0 : 1;
+  }
+
+  if (corpus.empty()) {
+    corpus.push_back(bench::dataPath("/hlsl/urp_bloom.hlsl"));
+  }
+  // Sort so the results are in the same order from run to run.
+  std::sort(corpus.begin(), corpus.end());
+
+  std::vector<FileResult> results;
+  for (const std::string& path : corpus) {
+    FileResult result;
+    const bool succeeded = corpus.size() == 1
+        ? runFile(path, entryPoint, iterations, result)
+        : runFileProcess(argv[0], path, entryPoint, iterations, result);
+    if (!succeeded) {
+      return 1;
+    }
+    results.push_back(result);
+  }
+
+  if (jsonPath.empty()) {
+    writeJson(std::cout, results, iterations);
+  } else {
+    std::ofstream out(jsonPath);
+    if (!out) {
+      std::cerr << "Unable to write file: " << jsonPath << std::endl;
+      return 1;
+    }
+    writeJson(out, results, iterations);
+  }
+
+  return 0;
+}
@@ -0,0 +1,143 @@
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../lib/reader/hlsl/scanner.h"
+#include "bench_util.h"
+#include "corpus_generator.h"
+
+// Measures Scanner::scan and Scanner::scanNext throughput on the test corpus and on generated
+// inputs, writing the results as JSON. The format is versioned so results can be compared
+// across releases.
+
+struct Input {
+  std::string name;
+  std::string source;
+};
+
+struct Result {
+  std::string input;
+  std::string mode;
+  size_t bytes = 0;
+  size_t tokens = 0;
+  int iterations = 0;
+  double ms = 0.0;
+};
+
+static size_t scanAll(const std::string& source) {
+  reader::hlsl::Scanner scanner(source);
+  return scanner.scan().size();
+}
+
+static size_t scanNextAll(const std::string& source) {
+  reader::hlsl::Scanner scanner(source);
+  size_t count = 0;
+  while (!scanner.isAtEnd()) {
+    if (scanner.scanNext().type() != reader::hlsl::TokenType::EndOfFile) {
+      count++;
+    }
+  }
+  return count;
+}
+
+static Result runBenchmark(const Input& input, const char* mode,
+                           size_t (*scan)(const std::string&), int iterations) {
+  Result result;
+  result.input = input.name;
+  result.mode = mode;
+  result.bytes = input.source.size();
+  result.iterations = iterations;
+  // One untimed run to warm up and count the tokens.
+  result.tokens = scan(input.source);
+  result.ms = bench::timeIterations(iterations, [&]() { scan(input.source); });
+  return result;
+}
+
+static void writeJson(std::ostream& out, const std::vector<Result>& results) {
+  out << "{\n";
+  out << "  \"benchmark\": \"scanner\",\n";
+  out << "  \"version\": 1,\n";
+  out << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& r = results[i];
+    const double seconds = r.ms / 1000.0;
+    out << "    {\"input\": \"" << r.input << "\", \"mode\": \"" << r.mode << "\", "
+        << "\"bytes\": " << r.bytes << ", \"tokens\": " << r.tokens << ", "
+        << "\"iterations\": " << r.iterations << ", \"ms\": " << r.ms << ", "
+        << "\"mb_per_s\": " << (r.bytes / (1024.0 * 1024.0)) / seconds << ", "
+        << "\"tokens_per_s\": " << static_cast<uint64_t>(r.tokens / seconds) << "}"
+        << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+}
+
+int main(int argc, char** argv) {
+  double sizeMB = 4.0;
+  int iterations = 5;
+  std::string jsonPath;
+  std::vector<std::string> corpus;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--size" && i + 1 < argc) {
+      sizeMB = std::atof(argv[++i]);
+    } else if (arg == "--iterations" && i + 1 < argc) {
+      iterations = std::atoi(argv[++i]);
+    } else if (arg == "--json" && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (arg == "--corpus" && i + 1 < argc) {
+      corpus.push_back(argv[++i]);
+    } else {
+      std::cerr << "Usage: hlslBenchScanner [--size <MB>] [--iterations <count>] "
+                   "[--json <file>] [--corpus <file>]..." << std::endl;
+      return 1;
+    }
+  }
+
+  if (sizeMB <= 0.0 || sizeMB > 100.0) {
+    std::cerr << "--size must be between 0 and 100 MB" << std::endl;
+    return 1;
+  }
+
+  if (corpus.empty()) {
+    corpus.push_back(bench::dataPath("/hlsl/urp_bloom.hlsl"));
+  }
+
+  std::vector<Input> inputs;
+  for (const std::string& path : corpus) {
+    std::string source = bench::loadFile(path);
+    if (source.empty()) {
+      std::cerr << "Unable to open file: " << path << std::endl;
+      return 1;
+    }
+    inputs.push_back(Input{path.substr(path.find_last_of("/\\") + 1), std::move(source)});
+  }
+
+  const size_t size = static_cast<size_t>(sizeMB * 1024.0 * 1024.0);
+  inputs.push_back(Input{"comment_heavy", bench::CorpusGenerator::commentHeavy(size)});
+  inputs.push_back(Input{"identifier_heavy", bench::CorpusGenerator::identifierHeavy(size)});
+  inputs.push_back(Input{"numeric_heavy", bench::CorpusGenerator::numericHeavy(size)});
+  inputs.push_back(Input{"define_heavy", bench::CorpusGenerator::defineHeavy(size)});
+
+  std::vector<Result> results;
+  for (const Input& input : inputs) {
+    results.push_back(runBenchmark(input, "scan", scanAll, iterations));
+    results.push_back(runBenchmark(input, "scanNext", scanNextAll, iterations));
+  }
+
+  if (jsonPath.empty()) {
+    writeJson(std::cout, results);
+  } else {
+    std::ofstream out(jsonPath);
+    if (!out) {
+      std::cerr << "Unable to write file: " << jsonPath << std::endl;
+      return 1;
+    }
+    writeJson(out, results);
+  }
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+namespace bench {
+
+#define BENCH_STRINGIFY(x) #x
+#define BENCH_TOSTRING(x) BENCH_STRINGIFY(x)
+
+/// The path of a file in the test data directory.
+inline std::string dataPath(const char* path) {
+  return std::string(BENCH_TOSTRING(DATA_PATH)) + path;
+}
+
+/// Load a file into a string, returning an empty string if the file couldn't be read.
+inline std::string loadFile(const std::string& path) {
+  std::ifstream fp(path, std::ios::binary);
+  if (!fp) {
+    return std::string();
+  }
+  std::stringstream ss;
+  ss << fp.rdbuf();
+  return ss.str();
+}
+
+/// Call the function the given number of times and return the average milliseconds per call.
+template<typename F>
+double timeIterations(int iterations, F&& func) {
+  typedef std::chrono::high_resolution_clock Clock;
+  auto t1 = Clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    func();
+  }
+  auto t2 = Clock::now();
+  return std::chrono::duration<double, std::milli>(t2 - t1).count() / iterations;
+}
+
+/// The peak resident set size of the process so far, in kilobytes.
+inline size_t peakRssKB() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return counters.PeakWorkingSetSize / 1024;
+  }
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  // macOS reports bytes rather than kilobytes.
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+/// A small deterministic random number generator, so generated inputs are the same every run.
+class Random {
+public:
+  explicit Random(uint32_t seed = 1) : _state(seed) {}
+
+  /// Return a random number in [0, count).
+  uint32_t next(uint32_t count) {
+    _state = _state * 1664525u + 1013904223u;
+    return (_state >> 8) % count;
+  }
+
+private:
+  uint32_t _state;
+};
+
+} // namespace bench
@@ -0,0 +1,201 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../lib/ast/flat_ast.h"
+#include "../lib/reader/hlsl/parser.h"
+#include "../lib/visitor/glsl_generator.h"
+#include "../lib/visitor/infer_types.h"
+#include "../lib/visitor/prune_tree.h"
+#include "../lib/visitor/reachability.h"
+#include "../lib/visitor/resolve_symbols.h"
+#include "../lib/visitor/static_visitor.h"
+#include "../lib/visitor/visitor.h"
+#include "bench_util.h"
+#include "corpus_generator.h"
+
+// Measures the cost per node of walking an Ast with the virtual dispatch of Visitor against the
+// switch dispatch of StaticVisitor, using visitors that do the same work, of flattening the Ast
+// and scanning the FlatAst for the same nodes, and of generating GLSL. Also compares pruning for
+// several entry points one at a time with PruneTree against all at once with Reachability, and
+// the cost of inferring the type of every expression.
+
+// Counts the variable references, literals and calls in the Ast through Visitor.
+class DynamicCounter : public visitor::Visitor {
+public:
+  size_t count = 0;
+
+  void visitVariableExpr(ast::VariableExpr* node) override {
+    count++;
+    visitor::Visitor::visitVariableExpr(node);
+  }
+
+  void visitLiteralExpr(ast::LiteralExpr* node) override {
+    count++;
+  }
+
+  void visitCallExpr(ast::CallExpr* node) override {
+    count++;
+    visitor::Visitor::visitCallExpr(node);
+  }
+};
+
+// Counts the same nodes as DynamicCounter through StaticVisitor.
+class StaticCounter : public visitor::StaticVisitor<StaticCounter> {
+public:
+  size_t count = 0;
+
+  void visitVariableExpr(ast::VariableExpr* node) {
+    count++;
+    StaticVisitor::visitVariableExpr(node);
+  }
+
+  void visitLiteralExpr(ast::LiteralExpr* node) {
+    count++;
+  }
+
+  void visitCallExpr(ast::CallExpr* node) {
+    count++;
+    StaticVisitor::visitCallExpr(node);
+  }
+};
+
+template<typename Counter>
+static void runWalk(const char* name, ast::Ast* ast, int iterations) {
+  // One untimed walk to warm up the caches.
+  Counter().visitRoot(ast->root());
+  size_t count = 0;
+  const double ms = bench::timeIterations(iterations, [&]() {
+    Counter counter;
+    counter.visitRoot(ast->root());
+    count = counter.count;
+  });
+  std::cout << "  " << std::left << std::setw(8) << name << std::right << std::setw(10)
+            << ms * 1000000.0 / ast->numNodes() << " ns/node (" << count << " counted)"
+            << std::endl;
+}
+
+static void runBenchmark(const char* name, const std::string& source, int iterations) {
+  if (source.empty()) {
+    std::cerr << "Unable to load " << name << std::endl;
+    return;
+  }
+  reader::hlsl::Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  if (parser.hasErrors()) {
+    std::cerr << "Unable to parse " << name << std::endl;
+    delete ast;
+    return;
+  }
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << name << ": " << ast->numNodes() << " nodes" << std::endl;
+  runWalk<DynamicCounter>("virtual", ast, iterations);
+  runWalk<StaticCounter>("switch", ast, iterations);
+
+  // The FlatAst includes the nodes the visitors don't walk, such as array sizes and the
+  // parameters after the first, so it counts more of them.
+  ast::FlatAst flat;
+  const double flattenMs = bench::timeIterations(iterations, [&]() { flat.flatten(ast); });
+  std::cout << "  " << std::left << std::setw(8) << "flatten" << std::right << std::setw(10)
+            << flattenMs * 1000000.0 / ast->numNodes() << " ns/node" << std::endl;
+  size_t count = 0;
+  const double scanMs = bench::timeIterations(iterations, [&]() {
+    count = 0;
+    for (const ast::FlatNode& node : flat.nodes()) {
+      if (node.nodeType == ast::NodeType::VariableExpr ||
+          node.nodeType == ast::NodeType::LiteralExpr ||
+          node.nodeType == ast::NodeType::CallExpr) {
+        count++;
+      }
+    }
+  });
+  std::cout << "  " << std::left << std::setw(8) << "scan" << std::right << std::setw(10)
+            << scanMs * 1000000.0 / ast->numNodes() << " ns/node (" << count << " counted)"
+            << std::endl;
+
+  const double ms = bench::timeIterations(iterations, [&]() {
+    std::ostringstream out;
+    visitor::GlslGenerator generator(out);
+    generator.visitRoot(ast->root());
+  });
+  std::cout << "  " << std::left << std::setw(8) << "glsl" << std::right << std::setw(10)
+            << ms * 1000000.0 / ast->numNodes() << " ns/node" << std::endl;
+
+  // The types are inferred after the symbols are resolved, so resolving is timed on its own too.
+  const double resolveMs = bench::timeIterations(iterations, [&]() {
+    visitor::ResolveSymbols(ast).resolve();
+  });
+  std::cout << "  " << std::left << std::setw(8) << "resolve" << std::right << std::setw(10)
+            << resolveMs * 1000000.0 / ast->numNodes() << " ns/node" << std::endl;
+  size_t typed = 0;
+  const double typesMs = bench::timeIterations(iterations, [&]() {
+    visitor::InferTypes pass(ast);
+    pass.infer();
+    typed = pass.expressionsTyped - pass.expressionsUnknown;
+  });
+  std::cout << "  " << std::left << std::setw(8) << "types" << std::right << std::setw(10)
+            << typesMs * 1000000.0 / ast->numNodes() << " ns/node (" << typed
+            << " expressions typed)" << std::endl;
+
+  // Prune for up to 64 of the functions, as if each were the entry point of a stage.
+  std::vector<std::string_view> entryPoints;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr && entryPoints.size() < 64;
+       stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::FunctionStmt) {
+      entryPoints.push_back(static_cast<ast::FunctionStmt*>(stmt)->name);
+    }
+  }
+  visitor::VisibilityVisitor reset(false);
+  const double pruneMs = bench::timeIterations(iterations, [&]() {
+    for (const std::string_view& entryPoint : entryPoints) {
+      reset.visitRoot(ast->root());
+      visitor::PruneTree(ast).prune(entryPoint);
+    }
+  });
+  std::cout << "  " << std::left << std::setw(8) << "prune" << std::right << std::setw(10)
+            << pruneMs * 1000000.0 / ast->numNodes() << " ns/node (" << entryPoints.size()
+            << " entry points)" << std::endl;
+  const double reachMs = bench::timeIterations(iterations, [&]() {
+    visitor::Reachability reachability(ast);
+    reachability.compute(entryPoints);
+  });
+  std::cout << "  " << std::left << std::setw(8) << "reach" << std::right << std::setw(10)
+            << reachMs * 1000000.0 / ast->numNodes() << " ns/node (" << entryPoints.size()
+            << " entry points)" << std::endl;
+  // Once the references are collected, each new set of entry points only costs compute().
+  visitor::Reachability reachability(ast);
+  const double computeMs = bench::timeIterations(iterations, [&]() {
+    reachability.compute(entryPoints);
+  });
+  std::cout << "  " << std::left << std::setw(8) << "compute" << std::right << std::setw(10)
+            << computeMs * 1000000.0 / ast->numNodes() << " ns/node (" << entryPoints.size()
+            << " entry points)" << std::endl;
+  delete ast;
+}
+
+int main(int argc, char** argv) {
+  size_t size = 4 * 1024 * 1024;
+  int iterations = 20;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--size" && i + 1 < argc) {
+      size = std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--iterations" && i + 1 < argc) {
+      iterations = std::atoi(argv[++i]);
+    } else {
+      std::cerr << "Usage: hlslBenchVisitor [--size <bytes>] [--iterations <count>]" << std::endl;
+      return 1;
+    }
+  }
+
+  runBenchmark("urp_bloom.hlsl", bench::loadFile(bench::dataPath("/hlsl/urp_bloom.hlsl")),
+               iterations);
+  const std::string generated = bench::CorpusGenerator::identifierHeavy(size);
+  runBenchmark("generated identifiers", generated, iterations);
+  return 0;
+}
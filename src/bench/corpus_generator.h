@@ -0,0 +1,98 @@
+#pragma once
+
+#include <string>
+
+#include "bench_util.h"
+
+namespace bench {
+
+/// Generates synthetic HLSL sources of a given size for benchmarking. Each generator is
+/// deterministic, so the same size always produces the same source.
+class CorpusGenerator {
+public:
+  /// Functions where most of the source is // and /* */ comments.
+  static std::string commentHeavy(size_t size) {
+    Random random(1);
+    std::string source;
+    source.reserve(size + 256);
+    int index = 0;
+    while (source.size() < size) {
+      source += "// Line comment " + std::to_string(index) + " describing the function below.\n";
+      source += "/* Block comment\n * spanning several lines, with /* nested */ comments\n */\n";
+      source += "float c" + std::to_string(index++) + "() { return 1; } // trailing comment\n";
+      if (random.next(4) == 0) {
+        source += "//////////////////////////////////////////////////////////////////////////\n";
+      }
+    }
+    return source;
+  }
+
+  /// Functions with long identifiers and many variable references.
+  static std::string identifierHeavy(size_t size) {
+    std::string source;
+    source.reserve(size + 256);
+    int index = 0;
+    while (source.size() < size) {
+      const std::string n = std::to_string(index++);
+      source += "float4 _IdentifierFunction" + n +
+                "(float4 _FirstParameter, float4 _SecondParameter) {\n";
+      source += "  float4 _LocalVariable = _FirstParameter * _SecondParameter + _GlobalColor;\n";
+      source += "  _LocalVariable.xyz = _LocalVariable.zyx * _GlobalScale.xxx;\n";
+      source += "  return lerp(_LocalVariable, _SecondParameter, saturate(_GlobalBlend));\n";
+      source += "}\n";
+    }
+    return source;
+  }
+
+  /// Array initializers made of int, float and hex literals.
+  static std::string numericHeavy(size_t size) {
+    Random random(3);
+    std::string source;
+    source.reserve(size + 256);
+    int index = 0;
+    while (source.size() < size) {
+      source += "static const float values" + std::to_string(index++) + "[16] = {";
+      for (int i = 0; i < 16; ++i) {
+        if (i > 0) {
+          source += ",";
+        }
+        switch (random.next(4)) {
+          case 0: source += std::to_string(random.next(100000)); break;
+          case 1: source += "0x" + std::to_string(random.next(0xffff)); break;
+          case 2:
+            source += std::to_string(random.next(1000)) + ".";
+            source += std::to_string(random.next(100000));
+            break;
+          default:
+            source += std::to_string(random.next(10)) + ".5e-";
+            source += std::to_string(random.next(10)) + "f";
+            break;
+        }
+      }
+      source += "};\n";
+    }
+    return source;
+  }
+
+  /// A block of #defines, like a shader variant header, followed by functions that expand them.
+  static std::string defineHeavy(size_t size) {
+    const int numDefines = 256;
+    std::string source;
+    source.reserve(size + 256);
+    for (int i = 0; i < numDefines; ++i) {
+      const std::string n = std::to_string(i);
+      source += "#define SCALE_" + n + " 2.0\n";
+      source += "#define OFFSET_" + n + " float3(0.5, 0.5, 0.5)\n";
+      source += "#define TYPE_" + n + " float3\n";
+    }
+    int index = 0;
+    while (source.size() < size) {
+      const std::string n = std::to_string(index % numDefines);
+      source += "TYPE_" + n + " d" + std::to_string(index++) + "(TYPE_" + n +
+                " a) { return a * SCALE_" + n + " + OFFSET_" + n + "; }\n";
+    }
+    return source;
+  }
+};
+
+} // namespace bench
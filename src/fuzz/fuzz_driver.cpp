@@ -0,0 +1,69 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Runs a fuzz target over files when the compiler doesn't provide libFuzzer, to reproduce a
+// crash or replay a corpus. Each input must finish within the time budget, so inputs that once
+// made the scanner or parser slow are checked as performance regressions.
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+static bool runInput(const std::filesystem::path& path, double budgetMs) {
+  std::ifstream fp(path, std::ios::binary);
+  if (!fp) {
+    std::cerr << "Unable to open file: " << path.string() << std::endl;
+    return false;
+  }
+  std::string input;
+  std::getline(fp, input, '\0');
+
+  const auto start = std::chrono::steady_clock::now();
+  LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+  const auto end = std::chrono::steady_clock::now();
+
+  const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+  if (ms > budgetMs) {
+    std::cerr << path.string() << ": " << ms << " ms, over the budget of " << budgetMs << " ms"
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  double budgetMs = 1000.0;
+  std::vector<std::filesystem::path> inputs;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "--budget-ms" && i + 1 < argc) {
+      budgetMs = std::atof(argv[++i]);
+    } else if (std::filesystem::is_directory(arg)) {
+      for (const auto& entry : std::filesystem::directory_iterator(arg)) {
+        if (entry.is_regular_file()) {
+          inputs.push_back(entry.path());
+        }
+      }
+    } else {
+      inputs.push_back(arg);
+    }
+  }
+
+  if (inputs.empty()) {
+    std::cerr << "Usage: " << argv[0] << " [--budget-ms <ms>] <file or directory>..." << std::endl;
+    return 1;
+  }
+
+  size_t failed = 0;
+  for (const std::filesystem::path& path : inputs) {
+    if (!runInput(path, budgetMs)) {
+      failed++;
+    }
+  }
+  std::cout << (inputs.size() - failed) << " / " << inputs.size() << " inputs passed" << std::endl;
+  return failed == 0 ? 0 : 1;
+}
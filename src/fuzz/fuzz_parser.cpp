@@ -0,0 +1,12 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "fuzz_pipeline.h"
+
+// Run the input through the parsers and visitors, the same pipeline the test of the fuzz corpus
+// runs.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  fuzz::runParserPipeline(std::string(reinterpret_cast<const char*>(data), size));
+  return 0;
+}
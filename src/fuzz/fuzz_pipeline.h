@@ -0,0 +1,41 @@
+#pragma once
+
+#include <sstream>
+#include <string>
+
+#include "../lib/ast/flat_ast.h"
+#include "../lib/reader/hlsl/parallel_parser.h"
+#include "../lib/reader/hlsl/parser.h"
+#include "../lib/visitor/glsl_generator.h"
+#include "../lib/visitor/prune_tree.h"
+#include "../lib/visitor/resolve_symbols.h"
+
+namespace fuzz {
+
+/// Parse the input with both parsers and flatten the result. If it parses without errors,
+/// resolve its symbols, prune it to its first function and generate GLSL, so the visitors see
+/// every tree the parser can produce. This is the pipeline of the hlslFuzzParser target, and
+/// the test of the fuzz corpus runs it on each of the inputs.
+inline void runParserPipeline(const std::string& source) {
+  reader::hlsl::Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  ast::FlatAst flat(ast);
+  if (!parser.hasErrors()) {
+    visitor::ResolveSymbols(ast).resolve();
+    for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+      if (stmt->nodeType == ast::NodeType::FunctionStmt) {
+        visitor::PruneTree(ast).prune(static_cast<ast::FunctionStmt*>(stmt)->name);
+        break;
+      }
+    }
+    std::ostringstream out;
+    visitor::GlslGenerator generator(out);
+    generator.visitRoot(ast->root());
+  }
+  delete ast;
+
+  reader::hlsl::ParallelParser parallelParser(source, 1);
+  delete parallelParser.parse();
+}
+
+} // namespace fuzz
@@ -0,0 +1,23 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "../lib/reader/hlsl/scanner.h"
+
+// Scan the input, streaming the tokens as the parser does, and locate each token in the source
+// to exercise the line index and #line directives.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  const std::string source(reinterpret_cast<const char*>(data), size);
+
+  reader::hlsl::Scanner scanner(source);
+  while (true) {
+    const reader::hlsl::Token token = scanner.scanNext();
+    if (token.type() == reader::hlsl::TokenType::EndOfFile) {
+      break;
+    }
+    scanner.location(token.offset());
+  }
+
+  reader::hlsl::Scanner(source).scan();
+  return 0;
+}
@@ -10,6 +10,7 @@ Ast::Ast(util::Allocator* allocator)
   _firstPage->next = nullptr;
   _currentPage = _firstPage;
   _currentPageOffset = 0;
+  HLSL_STATS(_stats.pages++);
 
   _root = createNode<Root>();
 }
@@ -33,15 +34,164 @@ void* Ast::allocateMemory(size_t size) {
   
   void* buffer = _currentPage->buffer + _currentPageOffset;
   _currentPageOffset += size;
+  HLSL_STATS(_stats.bytesUsed += size);
   return buffer;
 }
 
 void Ast::allocatePage() {
   NodePage* newPage = _allocator->alloc<NodePage>();
-  newPage->next = nullptr;
+  // Pages merged from other Asts may follow the current page.
+  newPage->next = _currentPage->next;
   _currentPage->next = newPage;
   _currentPageOffset = 0;
   _currentPage = newPage;
+  HLSL_STATS(_stats.pages++);
+}
+
+// Returns true if the types are the same, apart from modifiers such as const.
+static bool sameType(const Type* a, const Type* b) {
+  if (a == nullptr || b == nullptr) {
+    return a == b;
+  }
+  return a->baseType == b->baseType && a->name == b->name && a->array == b->array;
+}
+
+static bool sameParameters(const FunctionStmt* a, const FunctionStmt* b) {
+  const Parameter* pa = a->parameters;
+  const Parameter* pb = b->parameters;
+  for (; pa != nullptr && pb != nullptr; pa = pa->next, pb = pb->next) {
+    if (!sameType(pa->type, pb->type) || pa->isArray != pb->isArray) {
+      return false;
+    }
+  }
+  return pa == nullptr && pb == nullptr;
+}
+
+const std::vector<FunctionStmt*>& Ast::findOverloads(const std::string_view& name) const {
+  static const std::vector<FunctionStmt*> none;
+  auto it = _functions.find(name);
+  return it == _functions.end() ? none : it->second;
+}
+
+void Ast::addFunction(FunctionStmt* function) {
+  std::vector<FunctionStmt*>& overloads = _functions[function->name];
+  for (auto it = overloads.begin(); it != overloads.end(); ++it) {
+    if (sameParameters(*it, function)) {
+      overloads.erase(it);
+      break;
+    }
+  }
+  // findFunction() gives the function added last.
+  overloads.push_back(function);
+  if (findIntrinsic(function->name) != Intrinsic::None) {
+    _declaresIntrinsic = true;
+  }
+}
+
+void Ast::indexNode(Node* node) {
+  _nodesByType[static_cast<size_t>(node->nodeType)].push_back(node);
+  _indexLog.push_back(node);
+  if (node->nodeType == NodeType::CallExpr || node->nodeType == NodeType::CallStmt) {
+    if (_currentFunction != nullptr) {
+      _calls[_currentFunction].push_back(node);
+    }
+    _callLog.push_back(_currentFunction);
+  }
+}
+
+void Ast::rollbackNodeIndex(size_t mark) {
+  // Each node is the last of its type recorded after the ones before it in the log, so they can
+  // be removed from the back of their lists in reverse order.
+  while (_indexLog.size() > mark) {
+    const NodeType type = _indexLog.back()->nodeType;
+    _nodesByType[static_cast<size_t>(type)].pop_back();
+    _indexLog.pop_back();
+    if (type == NodeType::CallExpr || type == NodeType::CallStmt) {
+      if (_callLog.back() != nullptr) {
+        _calls[_callLog.back()].pop_back();
+      }
+      _callLog.pop_back();
+    }
+  }
+}
+
+const std::vector<Node*>& Ast::callsFrom(const FunctionStmt* function) const {
+  static const std::vector<Node*> none;
+  auto it = _calls.find(function);
+  return it != _calls.end() ? it->second : none;
+}
+
+uint16_t Ast::typeStructIndex(StructStmt* structStmt) {
+  if (structStmt->typeIndex == 0 && _typeStructs.size() < UINT16_MAX) {
+    _typeStructs.push_back(structStmt);
+    structStmt->typeIndex = static_cast<uint16_t>(_typeStructs.size());
+  }
+  return structStmt->typeIndex;
+}
+
+void Ast::merge(Ast* other) {
+  if (other == nullptr || other == this || other->_firstPage == nullptr) {
+    return;
+  }
+
+  // Splice the other Ast's pages in after our first page, leaving the current page alone so
+  // allocation continues where it left off.
+  NodePage* lastPage = other->_firstPage;
+  while (lastPage->next != nullptr) {
+    lastPage = lastPage->next;
+  }
+  lastPage->next = _firstPage->next;
+  _firstPage->next = other->_firstPage;
+
+  other->_firstPage = nullptr;
+  other->_currentPage = nullptr;
+  other->_currentPageOffset = 0;
+  other->_root = nullptr;
+
+  // The other Ast's root isn't part of this Ast.
+  _numNodes += other->_numNodes - 1;
+  other->_numNodes = 0;
+#if HLSL_REFLECT_STATS
+  _stats.pages += other->_stats.pages;
+  _stats.bytesUsed += other->_stats.bytesUsed;
+  for (size_t i = 0; i < numNodeTypes; ++i) {
+    _stats.nodes[i] += other->_stats.nodes[i];
+  }
+  _stats.nodes[static_cast<size_t>(NodeType::Root)]--;
+  other->_stats = AstStats();
+#endif
+
+  for (auto& it : other->_functions) {
+    for (FunctionStmt* function : it.second) {
+      addFunction(function);
+    }
+  }
+  for (auto& it : other->_variables) {
+    _variables[it.first] = it.second;
+  }
+  for (auto& it : other->_structs) {
+    _structs[it.first] = it.second;
+  }
+  other->_functions.clear();
+  other->_variables.clear();
+  other->_structs.clear();
+
+  _strings.splice(_strings.end(), other->_strings);
+
+  for (size_t i = 0; i < numNodeTypes; ++i) {
+    _nodesByType[i].insert(_nodesByType[i].end(), other->_nodesByType[i].begin(),
+                           other->_nodesByType[i].end());
+    other->_nodesByType[i].clear();
+  }
+  for (auto& it : other->_calls) {
+    std::vector<Node*>& calls = _calls[it.first];
+    calls.insert(calls.end(), it.second.begin(), it.second.end());
+  }
+  other->_calls.clear();
+  _indexLog.insert(_indexLog.end(), other->_indexLog.begin(), other->_indexLog.end());
+  _callLog.insert(_callLog.end(), other->_callLog.begin(), other->_callLog.end());
+  other->_indexLog.clear();
+  other->_callLog.clear();
 }
 
 } // namespace ast
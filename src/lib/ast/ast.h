@@ -1,13 +1,28 @@
 #pragma once
 
+#include <list>
 #include <map>
+#include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include "../util/allocator.h"
+#include "../util/stats.h"
 #include "ast_node.h"
 
 namespace ast {
 
+/// Memory and node counts of an Ast, collected when HLSL_REFLECT_STATS is enabled.
+struct AstStats {
+  /// The number of node memory pages allocated.
+  size_t pages = 0;
+  /// The bytes of the pages used by nodes.
+  size_t bytesUsed = 0;
+  /// The number of nodes created of each NodeType.
+  size_t nodes[numNodeTypes] = {};
+};
+
 /// Abstract Syntax Tree for parsed HLSL code.
 /// All nodes are allocated from a memory pool, so the Ast owns the memory of all AstNodes it
 /// contains.
@@ -20,6 +35,9 @@ public:
   /// The root node of the AST containing all top level statements.
   Root* root() const { return _root; }
 
+  /// The allocator used for the node memory pool.
+  util::Allocator* allocator() const { return _allocator; }
+
   /// Used by the parser to create Ast nodes using the memory pool owned by the Ast.
   /// Creates a new node of type T, using a memory pool to allocate the memory
   /// @tparam T An AstNode derived type. This should have a static const AstNodeType astType member.
@@ -28,19 +46,80 @@ public:
   T* createNode() {
     Node* n = new (allocateMemory(sizeof(T))) T();
     n->nodeType = T::astType;
+    _numNodes++;
+    HLSL_STATS(_stats.nodes[static_cast<size_t>(T::astType)]++);
+    if (_indexNodes) {
+      indexNode(n);
+    }
     return static_cast<T*>(n);
   }
 
+  /// Create a value that lives as long as the nodes, such as the ConstantValue cached on an
+  /// Expression, using the same memory pool. Its destructor is never called.
+  template<typename T>
+  T* createValue(const T& value) {
+    static_assert(std::is_trivially_destructible_v<T>, "The value is never destroyed");
+    static_assert(sizeof(T) % sizeof(void*) == 0, "The nodes that follow must stay aligned");
+    return new (allocateMemory(sizeof(T))) T(value);
+  }
+
+  /// The number of nodes created in the Ast, including the root.
+  size_t numNodes() const { return _numNodes; }
+
+  /// The memory and node counts of the Ast. These are all zero if HLSL_REFLECT_STATS is disabled.
+  const AstStats& stats() const { return _stats; }
+
+  /// Record the nodes of each NodeType as they're created, and the calls made in the body of each
+  /// function, so passes can find them without walking the tree. Only the nodes created after
+  /// this is enabled are recorded. It's off by default, and enabled by Parser::setIndexNodes().
+  void setIndexNodes(bool enable) { _indexNodes = enable; }
+
+  bool indexNodes() const { return _indexNodes; }
+
+  /// The nodes of the given type, in the order they were created. Nodes the parser created and
+  /// then discarded, when it backtracked or dropped a statement with an error, aren't included.
+  /// A struct declared in the type of a field or local variable, such as struct { int a; } s;, is
+  /// included although it's only reachable through findStruct(), not from the root.
+  const std::vector<Node*>& nodesOfType(NodeType type) const {
+    return _nodesByType[static_cast<size_t>(type)];
+  }
+
+  /// The CallExpr and CallStmt nodes in the body of the function, in the order they were
+  /// created. Each is an edge from the function to the functions the call names.
+  const std::vector<Node*>& callsFrom(const FunctionStmt* function) const;
+
+  /// Used by the parser to set the function whose body is being parsed, or null outside of a
+  /// function, so the calls it creates are recorded as calls made by that function.
+  void setCurrentFunction(FunctionStmt* function) { _currentFunction = function; }
+
+  FunctionStmt* currentFunction() const { return _currentFunction; }
+
+  /// Used by the parser to mark the nodes recorded so far, so the ones recorded after the mark
+  /// can be discarded with rollbackNodeIndex() if the parser discards them.
+  size_t nodeIndexMark() const { return _indexLog.size(); }
+
+  /// Discard the nodes recorded since the mark was taken.
+  void rollbackNodeIndex(size_t mark);
+
+  /// The function with the given name. If it's overloaded, the one declared last.
   FunctionStmt* findFunction(const std::string_view& name) const {
     auto it = _functions.find(name);
     if (it == _functions.end())
       return nullptr;
-    return it->second;
+    return it->second.back();
   }
 
-  void addFunction(FunctionStmt* function) {
-    _functions[function->name] = function;
-  }
+  /// Every overload of the function with the given name, in the order they were declared.
+  const std::vector<FunctionStmt*>& findOverloads(const std::string_view& name) const;
+
+  /// Add a function. A function with the same parameter types as an earlier overload, such as
+  /// the definition of a forward declared function, replaces it.
+  void addFunction(FunctionStmt* function);
+
+  /// Whether a function has been added with the name of an intrinsic, such as a lerp() of its
+  /// own, so a call tagged with the intrinsic may call the function instead. While it's false,
+  /// a call tagged with an intrinsic function needn't be looked up.
+  bool declaresIntrinsic() const { return _declaresIntrinsic; }
 
   VariableStmt* findGlobalVariable(const std::string_view& name) const {
     auto it = _variables.find(name);
@@ -64,9 +143,36 @@ public:
     _structs[structStmt->name] = structStmt;
   }
 
+  /// The index an ExpressionType refers to the struct by, giving it the next index if it doesn't
+  /// have one yet. The first struct is 1, as 0 is no struct, and it's 0 for the structs after
+  /// the first 65535.
+  uint16_t typeStructIndex(StructStmt* structStmt);
+
+  /// The struct with the index given by typeStructIndex(), or null for 0.
+  StructStmt* typeStruct(uint16_t index) const {
+    return index != 0 && index <= _typeStructs.size() ? _typeStructs[index - 1] : nullptr;
+  }
+
+  /// Store a string generated while building the Ast, such as the name of an anonymous struct,
+  /// so that it lives as long as the nodes that reference it.
+  /// @return A view of the stored string.
+  std::string_view addString(const std::string& str) {
+    _strings.push_back(str);
+    return _strings.back();
+  }
+
+  /// Move all of the nodes, strings and lookup tables of another Ast into this one. Both Asts
+  /// must use the same allocator. The statements of the other Ast's root are not linked into
+  /// this Ast's root; that is left to the caller, which knows the order they belong in.
+  /// @param other The Ast to merge. It is left empty and can be deleted afterwards.
+  void merge(Ast* other);
+
 private:
   void* allocateMemory(size_t size);
 
+  // Record a node created while indexNodes() is enabled.
+  void indexNode(Node* node);
+
   void allocatePage();
 
   static const size_t nodePageSize = 1024 * 4;
@@ -81,12 +187,28 @@ private:
   NodePage* _firstPage;
   NodePage* _currentPage;
   size_t _currentPageOffset;
+  size_t _numNodes = 0;
+  AstStats _stats;
+
+  bool _indexNodes = false;
+  std::vector<Node*> _nodesByType[numNodeTypes];
+  // The calls made by each function.
+  std::map<const FunctionStmt*, std::vector<Node*>> _calls;
+  FunctionStmt* _currentFunction = nullptr;
+  // Every node recorded, in order, and the function of every call recorded, so the most recent
+  // can be removed again by rollbackNodeIndex().
+  std::vector<Node*> _indexLog;
+  std::vector<const FunctionStmt*> _callLog;
 
   Root* _root;
 
-  std::map<std::string_view, FunctionStmt*> _functions;
+  std::map<std::string_view, std::vector<FunctionStmt*>> _functions;
   std::map<std::string_view, VariableStmt*> _variables;
   std::map<std::string_view, StructStmt*> _structs;
+  bool _declaresIntrinsic = false;
+  // The structs given an index by typeStructIndex(), in order.
+  std::vector<StructStmt*> _typeStructs;
+  std::list<std::string> _strings;
 };
 
 } // namespace ast
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 
 #include "address_space.h"
@@ -7,6 +8,7 @@
 #include "base_type.h"
 #include "buffer_type.h"
 #include "interpolation_modifier.h"
+#include "intrinsic.h"
 #include "operator.h"
 #include "sampler_type.h"
 #include "type_flags.h"
@@ -31,6 +33,7 @@ struct IfStmt;
 struct LiteralExpr;
 struct CastExpr;
 struct AssignmentExpr;
+struct ConstantValue;
 struct Node;
 struct Parameter;
 struct ReturnStmt;
@@ -67,7 +70,11 @@ void foreach(T* node, void (*callback)(T* node)) {
 /// Base class for all AST nodes
 struct Node {
   NodeType nodeType = NodeType::Undefined;
+  /// Whether the node was kept by PruneTree. A visitor given a visible set ignores it, so the
+  /// Ast can be shared by visitors pruned for different entry points.
   bool visible = true;
+  /// The byte offset in the source where the node starts.
+  uint32_t offset = 0;
 };
 
 /// A template argument, either an Type or an Expression.
@@ -92,11 +99,56 @@ struct Type : Node {
   inline bool isStatic() const { return flags & TypeFlags::Static; }
 };
 
+/// The type of the value of an expression, worked out by visitor::InferTypes. It's packed into 32
+/// bits so it fits in the padding between Node and the pointers of Expression, and doesn't make
+/// expressions any larger.
+struct ExpressionType {
+  /// The BaseType, such as Float3, Float4x4, Struct or Texture2D. Undefined if it isn't known.
+  uint8_t baseType = 0;
+  /// Whether the value is an array of the type.
+  bool array = false;
+  /// For a Struct, the index of its StructStmt given by Ast::typeStructIndex(), or 0 if the
+  /// struct isn't known.
+  uint16_t structIndex = 0;
+
+  static ExpressionType of(BaseType type, bool array = false, uint16_t structIndex = 0) {
+    ExpressionType result;
+    result.baseType = static_cast<uint8_t>(type);
+    result.array = array;
+    result.structIndex = structIndex;
+    return result;
+  }
+
+  BaseType base() const { return static_cast<BaseType>(baseType); }
+
+  bool isKnown() const { return baseType != 0; }
+
+  bool operator==(const ExpressionType& other) const {
+    return baseType == other.baseType && array == other.array &&
+        structIndex == other.structIndex;
+  }
+
+  bool operator!=(const ExpressionType& other) const { return !(*this == other); }
+};
+
+static_assert(static_cast<int>(BaseType::Min16uint4x4) <= UINT8_MAX,
+              "ExpressionType stores a BaseType in 8 bits");
+static_assert(sizeof(ExpressionType) == 4, "ExpressionType fits in the padding of Expression");
+
 /// Base class for all expressions
 struct Expression : Node {
+  /// The type of the value, set by visitor::InferTypes. It's declared first to fill the padding
+  /// after Node.
+  ExpressionType resolvedType;
   Expression* next = nullptr;
+  /// The value of the expression, cached by ConstantEvaluator when it's first evaluated. It's
+  /// null until then, and ConstantValue::none if the expression isn't constant.
+  const ConstantValue* constant = nullptr;
 };
 
+static_assert(sizeof(Expression) == sizeof(Node) + sizeof(ExpressionType) + 2 * sizeof(void*),
+              "resolvedType is packed after Node");
+
 /// Attributes augment a statement or expression with additional information.
 struct Attribute : Node {
   static const NodeType astType = NodeType::Attribute;
@@ -137,6 +189,8 @@ struct StructStmt : Statement {
   std::string_view name;
   Field* fields = nullptr;
   FunctionStmt* methods = nullptr;
+  /// The index Ast::typeStructIndex() gave the struct, or 0 if it hasn't given one.
+  uint16_t typeIndex = 0;
 };
 
 /// A cbuffer or tbuffer declaration.
@@ -144,7 +198,10 @@ struct BufferStmt : Statement {
   static const NodeType astType = NodeType::BufferStmt;
   BufferType bufferType = BufferType::Cbuffer;
   std::string_view name;
+  /// The register and space given by register(b0, space1), such as "b0" and "space1". Empty if
+  /// they aren't given.
   std::string_view registerName;
+  std::string_view registerSpace;
   Field* field = nullptr;
 };
 
@@ -221,19 +278,37 @@ struct CallExpr : Expression {
   static const NodeType astType = NodeType::CallExpr;
   std::string_view name;
   Expression* arguments = nullptr;
+  /// The overload called, set by visitor::ResolveSymbols. It stays null for intrinsics and
+  /// unknown functions.
+  FunctionStmt* function = nullptr;
+  /// The intrinsic with the name, set by the parser. A function declared with the name of an
+  /// intrinsic is called instead if ResolveSymbols resolves function to it, and a method of a
+  /// struct with the name of a texture method, such as Sample, is tagged as it too.
+  Intrinsic intrinsic = Intrinsic::None;
 };
 
 /// A variable reference in an expression.
 struct VariableExpr : Expression {
   static const NodeType astType = NodeType::VariableExpr;
   std::string_view name;
+  /// The VariableStmt, Parameter or Field the name refers to, set by visitor::ResolveSymbols.
+  Node* declaration = nullptr;
 };
 
 /// A literal value in an expression.
 struct LiteralExpr : Expression {
   static const NodeType astType = NodeType::LiteralExpr;
+  /// Int, Uint, Float or Half, as the suffix of a number gives, or Bool.
   BaseType type = BaseType::Undefined;
+  /// The text of the literal, as written in the source.
   std::string_view value;
+  /// The value decoded by the parser: intValue for an Int or Uint, with uintValue the same bits
+  /// as a uint, floatValue for a Float or Half, and intValue 1 or 0 for a Bool.
+  union {
+    int64_t intValue = 0;
+    uint64_t uintValue;
+    double floatValue;
+  };
 };
 
 /// A cast expression such as (float)foo.
@@ -259,6 +334,10 @@ struct VariableStmt : Statement {
   bool isArray = false;
   Expression* arraySize = nullptr;
   Expression* initializer = nullptr;
+  /// The register and space of a global resource, given by register(t0, space1), such as "t0"
+  /// and "space1". Empty if they aren't given.
+  std::string_view registerName;
+  std::string_view registerSpace;
 };
 
 /// A function parameter declaration.
@@ -390,6 +469,10 @@ struct CallStmt : Statement {
   static const NodeType astType = NodeType::CallStmt;
   std::string_view name;
   Expression* arguments = nullptr;
+  /// The overload called, set by visitor::ResolveSymbols.
+  FunctionStmt* function = nullptr;
+  /// The intrinsic with the name, set by the parser, as for CallExpr.
+  Intrinsic intrinsic = Intrinsic::None;
 };
 
 /// A statement that declares a user type.
@@ -0,0 +1,56 @@
+#include "ast_node_type.h"
+
+namespace ast {
+
+const std::string_view& nodeTypeToString(NodeType type) {
+  static const std::string_view strings[] = {
+    "Undefined",
+    "Type",
+    "Root",
+    "Field",
+    "Parameter",
+    "Attribute",
+    "SamplerState",
+    "StateAssignment",
+    "SwitchCase",
+    "Block",
+    "TemplateArg",
+    "StructStmt",
+    "BufferStmt",
+    "VariableStmt",
+    "FunctionStmt",
+    "IfStmt",
+    "SwitchStmt",
+    "ForStmt",
+    "DoWhileStmt",
+    "WhileStmt",
+    "DiscardStmt",
+    "BreakStmt",
+    "ContinueStmt",
+    "ReturnStmt",
+    "AssignmentStmt",
+    "ExpressionStmt",
+    "CallStmt",
+    "TypedefStmt",
+    "EmptyStmt",
+    "PrefixExpr",
+    "IncrementExpr",
+    "ArrayExpr",
+    "MemberExpr",
+    "BinaryExpr",
+    "TernaryExpr",
+    "StringExpr",
+    "CallExpr",
+    "VariableExpr",
+    "LiteralExpr",
+    "CastExpr",
+    "AssignmentExpr",
+    "StructInitializerExpr",
+    "ArrayInitializerExpr",
+  };
+  static_assert(sizeof(strings) / sizeof(strings[0]) == numNodeTypes,
+                "nodeTypeToString is missing a NodeType");
+  return strings[static_cast<size_t>(type)];
+}
+
+} // namespace ast
@@ -1,5 +1,8 @@
 #pragma once 
 
+#include <cstddef>
+#include <string_view>
+
 namespace ast {
 
 enum class NodeType {
@@ -52,5 +55,10 @@ enum class NodeType {
   ArrayInitializerExpr,
 };
 
+/// The number of values in NodeType.
+const size_t numNodeTypes = static_cast<size_t>(NodeType::ArrayInitializerExpr) + 1;
+
+const std::string_view& nodeTypeToString(NodeType type);
+
 } // namespace ast
 
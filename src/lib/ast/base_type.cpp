@@ -265,4 +265,66 @@ const std::string_view& baseTypeToString(BaseType t) {
   return (*ti).second;
 }
 
+// The number of components named by the swizzle of a vector of the size, such as 2 for xy, or
+// 0 if the name isn't a swizzle of it.
+static int _vectorSwizzle(const std::string_view& name, int size) {
+  if (name.empty() || name.size() > 4) {
+    return 0;
+  }
+  for (const std::string_view components : {std::string_view("xyzw"), std::string_view("rgba")}) {
+    bool matches = true;
+    for (const char c : name) {
+      const size_t index = components.find(c);
+      if (index == std::string_view::npos || static_cast<int>(index) >= size) {
+        matches = false;
+        break;
+      }
+    }
+    if (matches) {
+      return static_cast<int>(name.size());
+    }
+  }
+  return 0;
+}
+
+// The number of components named by the swizzle of a matrix, such as 2 for _m00_m11 or _11_22,
+// or 0 if the name isn't a swizzle of it.
+static int _matrixSwizzle(const std::string_view& name, int rows, int columns) {
+  int count = 0;
+  size_t i = 0;
+  while (i < name.size()) {
+    if (name[i] != '_' || count == 4) {
+      return 0;
+    }
+    i++;
+    // _mRC counts from 0, and _RC from 1.
+    int first = 1;
+    if (i < name.size() && name[i] == 'm') {
+      first = 0;
+      i++;
+    }
+    if (i + 2 > name.size()) {
+      return 0;
+    }
+    const int row = name[i] - '0' - first;
+    const int column = name[i + 1] - '0' - first;
+    if (row < 0 || row >= rows || column < 0 || column >= columns) {
+      return 0;
+    }
+    i += 2;
+    count++;
+  }
+  return count;
+}
+
+BaseType swizzleBaseType(BaseType t, const std::string_view& name) {
+  if (!isScalarBaseType(t) && t < BaseType::Float1) {
+    return BaseType::Undefined;
+  }
+  const int size = vectorSize(t);
+  const int count = size != 0 ? _vectorSwizzle(name, size)
+                              : _matrixSwizzle(name, matrixRows(t), matrixColumns(t));
+  return count != 0 ? vectorBaseType(scalarBaseType(t), count) : BaseType::Undefined;
+}
+
 } // namespace ast
@@ -1,6 +1,7 @@
 #pragma once
 // Generated by tools/gen_token_type.py
 
+#include <iterator>
 #include <string_view>
 
 namespace ast {
@@ -264,4 +265,97 @@ inline bool isSamplerBaseType(BaseType t) {
       t == BaseType::SamplerComparisonState;
 }
 
+/// Whether the type is a scalar type, such as float or min16uint.
+inline bool isScalarBaseType(BaseType t) {
+  return t >= BaseType::Float && t <= BaseType::Min16uint;
+}
+
+// The scalar types of the vector and matrix types, in the order they're declared. Each has 20
+// vector and matrix types: S1, S1x1 to S1x4, S2, S2x1 to S2x4, and so on to S4x4.
+static const BaseType _vectorScalarTypes[] = {
+  BaseType::Float,
+  BaseType::Half,
+  BaseType::Int,
+  BaseType::Uint,
+  BaseType::Bool,
+  BaseType::Min10float,
+  BaseType::Min16float,
+  BaseType::Min12int,
+  BaseType::Min16int,
+  BaseType::Min16uint,
+};
+
+/// The scalar type of a vector or matrix type, such as Float for float3 and float4x4. Any other
+/// type is returned as it is.
+inline BaseType scalarBaseType(BaseType t) {
+  if (t < BaseType::Float1) {
+    return t;
+  }
+  return _vectorScalarTypes[(static_cast<int>(t) - static_cast<int>(BaseType::Float1)) / 20];
+}
+
+/// The number of components of a vector type, such as 3 for float3. It's 1 for a scalar type,
+/// and 0 for a matrix or any other type.
+inline int vectorSize(BaseType t) {
+  if (t < BaseType::Float1) {
+    return isScalarBaseType(t) ? 1 : 0;
+  }
+  const int index = (static_cast<int>(t) - static_cast<int>(BaseType::Float1)) % 20;
+  return index % 5 == 0 ? index / 5 + 1 : 0;
+}
+
+/// The number of rows of a matrix type, such as 3 for float3x4. It's 0 for any other type.
+inline int matrixRows(BaseType t) {
+  if (t < BaseType::Float1) {
+    return 0;
+  }
+  const int index = (static_cast<int>(t) - static_cast<int>(BaseType::Float1)) % 20;
+  return index % 5 != 0 ? index / 5 + 1 : 0;
+}
+
+/// The number of columns of a matrix type, such as 4 for float3x4. It's 0 for any other type.
+inline int matrixColumns(BaseType t) {
+  if (t < BaseType::Float1) {
+    return 0;
+  }
+  return (static_cast<int>(t) - static_cast<int>(BaseType::Float1)) % 20 % 5;
+}
+
+// The first of the 20 vector and matrix types of the scalar type, or Undefined if it has none.
+inline BaseType _firstVectorBaseType(BaseType scalar) {
+  for (int i = 0; i < static_cast<int>(std::size(_vectorScalarTypes)); ++i) {
+    if (_vectorScalarTypes[i] == scalar) {
+      return static_cast<BaseType>(static_cast<int>(BaseType::Float1) + i * 20);
+    }
+  }
+  return BaseType::Undefined;
+}
+
+/// The vector type with the scalar type and number of components, such as Float3 for Float and
+/// 3. A size of 1 gives the scalar type itself. It's Undefined if there is no such type.
+inline BaseType vectorBaseType(BaseType scalar, int size) {
+  if (!isScalarBaseType(scalar) || size < 1 || size > 4) {
+    return BaseType::Undefined;
+  }
+  if (size == 1) {
+    return scalar;
+  }
+  const BaseType first = _firstVectorBaseType(scalar);
+  return static_cast<BaseType>(static_cast<int>(first) + (size - 1) * 5);
+}
+
+/// The matrix type with the scalar type, rows and columns, such as Float3x4 for Float, 3 and 4.
+/// It's Undefined if there is no such type.
+inline BaseType matrixBaseType(BaseType scalar, int rows, int columns) {
+  if (!isScalarBaseType(scalar) || rows < 1 || rows > 4 || columns < 1 || columns > 4) {
+    return BaseType::Undefined;
+  }
+  const BaseType first = _firstVectorBaseType(scalar);
+  return static_cast<BaseType>(static_cast<int>(first) + (rows - 1) * 5 + columns);
+}
+
+/// The type of a swizzle of a scalar, vector or matrix of the type, such as Float2 for the xy
+/// of a float4 or the _m00_m11 of a float4x4. It's Undefined if the name isn't a swizzle of it.
+BaseType swizzleBaseType(BaseType t, const std::string_view& name);
+
 } // namespace ast
@@ -0,0 +1,603 @@
+#include "constant_evaluator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ast {
+
+namespace {
+
+// How the components of a scalar type are stored and computed.
+enum class Kind { Bool, Int, Uint, Float };
+
+Kind kindOf(BaseType type) {
+  switch (type) {
+    case BaseType::Bool:
+      return Kind::Bool;
+    case BaseType::Int:
+    case BaseType::Min12int:
+    case BaseType::Min16int:
+      return Kind::Int;
+    case BaseType::Uint:
+    case BaseType::Min16uint:
+      return Kind::Uint;
+    default:
+      return Kind::Float;
+  }
+}
+
+// The order of the scalar types in the usual arithmetic conversions, where the type of a binary
+// expression is the type of its operand that ranks highest.
+int rank(BaseType type) {
+  switch (type) {
+    case BaseType::Bool:
+      return 0;
+    case BaseType::Min12int:
+      return 1;
+    case BaseType::Min16int:
+      return 2;
+    case BaseType::Int:
+      return 3;
+    case BaseType::Min16uint:
+      return 4;
+    case BaseType::Uint:
+      return 5;
+    case BaseType::Min10float:
+      return 6;
+    case BaseType::Min16float:
+      return 7;
+    case BaseType::Half:
+      return 8;
+    default:
+      return 9;
+  }
+}
+
+BaseType commonType(BaseType a, BaseType b) {
+  return rank(a) >= rank(b) ? a : b;
+}
+
+// Float to int conversions saturate rather than overflow, and NaN converts to 0.
+int32_t floatToInt(float value) {
+  if (std::isnan(value)) {
+    return 0;
+  }
+  if (value >= 2147483648.0f) {
+    return std::numeric_limits<int32_t>::max();
+  }
+  if (value <= -2147483648.0f) {
+    return std::numeric_limits<int32_t>::min();
+  }
+  return static_cast<int32_t>(value);
+}
+
+uint32_t floatToUint(float value) {
+  if (std::isnan(value) || value <= 0.0f) {
+    return static_cast<uint32_t>(floatToInt(value));
+  }
+  if (value >= 4294967296.0f) {
+    return std::numeric_limits<uint32_t>::max();
+  }
+  return static_cast<uint32_t>(value);
+}
+
+// The value of a literal, from the value the parser decoded.
+ConstantValue literalValue(const LiteralExpr* node) {
+  switch (node->type) {
+    case BaseType::Bool:
+      return ConstantValue::ofBool(node->intValue != 0);
+    case BaseType::Float:
+    case BaseType::Half: {
+      ConstantValue value = ConstantValue::ofFloat(static_cast<float>(node->floatValue));
+      value.type = node->type;
+      return value;
+    }
+    // Literals wrap to 32 bits, so 0xFFFFFFFF is -1 as an int and 4294967295 as a uint.
+    case BaseType::Int:
+      return ConstantValue::ofInt(static_cast<int32_t>(static_cast<uint32_t>(node->intValue)));
+    case BaseType::Uint:
+      return ConstantValue::ofUint(static_cast<uint32_t>(node->intValue));
+    default:
+      return ConstantValue::none;
+  }
+}
+
+// The number of components of a binary or ternary expression of operands of the given sizes. A
+// scalar is repeated to the size of the other operand, and the longer of two vectors is
+// truncated to the shorter.
+uint32_t combinedSize(uint32_t a, uint32_t b) {
+  if (a == 1) {
+    return b;
+  }
+  if (b == 1) {
+    return a;
+  }
+  return std::min(a, b);
+}
+
+// The component of an operand used for the given component of the result.
+uint32_t operandIndex(const ConstantValue& value, uint32_t index) {
+  return value.size == 1 ? 0 : index;
+}
+
+bool compare(Operator op, const ConstantValue& left, uint32_t li, const ConstantValue& right,
+             uint32_t ri, Kind kind) {
+  int order = 0;
+  if (kind == Kind::Float) {
+    const float l = left.asFloat(li);
+    const float r = right.asFloat(ri);
+    if (std::isnan(l) || std::isnan(r)) {
+      // Every comparison with NaN is false, except !=.
+      return op == Operator::NotEqual;
+    }
+    order = l < r ? -1 : l > r ? 1 : 0;
+  } else if (kind == Kind::Uint) {
+    const uint32_t l = left.asUint(li);
+    const uint32_t r = right.asUint(ri);
+    order = l < r ? -1 : l > r ? 1 : 0;
+  } else {
+    const int32_t l = left.asInt(li);
+    const int32_t r = right.asInt(ri);
+    order = l < r ? -1 : l > r ? 1 : 0;
+  }
+  switch (op) {
+    case Operator::EqualEqual:
+      return order == 0;
+    case Operator::NotEqual:
+      return order != 0;
+    case Operator::Less:
+      return order < 0;
+    case Operator::LessEqual:
+      return order <= 0;
+    case Operator::Greater:
+      return order > 0;
+    default:
+      return order >= 0;
+  }
+}
+
+// Compute one component of an arithmetic or bitwise operator, returning false if the operator
+// isn't defined for the operands, such as a division by zero or a shift of a float.
+bool arithmetic(Operator op, const ConstantValue& left, uint32_t li, const ConstantValue& right,
+                uint32_t ri, Kind kind, ConstantValue::Component& result) {
+  if (kind == Kind::Float) {
+    const float l = left.asFloat(li);
+    const float r = right.asFloat(ri);
+    switch (op) {
+      case Operator::Add:
+        result.f = l + r;
+        return true;
+      case Operator::Subtract:
+        result.f = l - r;
+        return true;
+      case Operator::Multiply:
+        result.f = l * r;
+        return true;
+      case Operator::Divide:
+        result.f = l / r;
+        return true;
+      case Operator::Modulo:
+        result.f = std::fmod(l, r);
+        return true;
+      default:
+        return false;
+    }
+  }
+  // Integers are computed with the bits of a uint, so they wrap rather than overflow.
+  const uint32_t l = left.asUint(li);
+  const uint32_t r = right.asUint(ri);
+  const bool isSigned = kind == Kind::Int;
+  switch (op) {
+    case Operator::Add:
+      result.u = l + r;
+      return true;
+    case Operator::Subtract:
+      result.u = l - r;
+      return true;
+    case Operator::Multiply:
+      result.u = l * r;
+      return true;
+    case Operator::Divide:
+    case Operator::Modulo: {
+      if (r == 0) {
+        return false;
+      }
+      if (!isSigned) {
+        result.u = op == Operator::Divide ? l / r : l % r;
+        return true;
+      }
+      const int64_t sl = static_cast<int32_t>(l);
+      const int64_t sr = static_cast<int32_t>(r);
+      result.u = static_cast<uint32_t>(op == Operator::Divide ? sl / sr : sl % sr);
+      return true;
+    }
+    case Operator::And:
+      result.u = l & r;
+      return true;
+    case Operator::Or:
+      result.u = l | r;
+      return true;
+    case Operator::Xor:
+      result.u = l ^ r;
+      return true;
+    case Operator::LeftShift:
+      result.u = l << (r & 31);
+      return true;
+    case Operator::RightShift:
+      if (isSigned) {
+        const int32_t shifted = static_cast<int32_t>(l) >> (r & 31);
+        result.u = static_cast<uint32_t>(shifted);
+      } else {
+        result.u = l >> (r & 31);
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+ConstantValue binaryValue(Operator op, const ConstantValue& left, const ConstantValue& right) {
+  if (!left.isConstant() || !right.isConstant()) {
+    return ConstantValue::none;
+  }
+  ConstantValue result;
+  result.size = combinedSize(left.size, right.size);
+  if (op == Operator::AndAnd || op == Operator::OrOr) {
+    result.type = BaseType::Bool;
+    for (uint32_t i = 0; i < result.size; ++i) {
+      const bool l = left.asBool(operandIndex(left, i));
+      const bool r = right.asBool(operandIndex(right, i));
+      result.components[i].u = op == Operator::AndAnd ? l && r : l || r;
+    }
+    return result;
+  }
+  BaseType type = commonType(left.type, right.type);
+  switch (op) {
+    case Operator::EqualEqual:
+    case Operator::NotEqual:
+    case Operator::Less:
+    case Operator::LessEqual:
+    case Operator::Greater:
+    case Operator::GreaterEqual:
+      result.type = BaseType::Bool;
+      for (uint32_t i = 0; i < result.size; ++i) {
+        result.components[i].u = compare(op, left, operandIndex(left, i), right,
+                                         operandIndex(right, i), kindOf(type));
+      }
+      return result;
+    default:
+      break;
+  }
+  // Arithmetic on bools is done with ints.
+  if (type == BaseType::Bool) {
+    type = BaseType::Int;
+  }
+  result.type = type;
+  for (uint32_t i = 0; i < result.size; ++i) {
+    if (!arithmetic(op, left, operandIndex(left, i), right, operandIndex(right, i), kindOf(type),
+                    result.components[i])) {
+      return ConstantValue::none;
+    }
+  }
+  return result;
+}
+
+ConstantValue prefixValue(Operator op, const ConstantValue& value) {
+  if (!value.isConstant()) {
+    return value;
+  }
+  ConstantValue result = value;
+  if (op == Operator::Not) {
+    result.type = BaseType::Bool;
+    for (uint32_t i = 0; i < value.size; ++i) {
+      result.components[i].u = !value.asBool(i);
+    }
+    return result;
+  }
+  if (op != Operator::Subtract && op != Operator::BitNot) {
+    return ConstantValue::none;
+  }
+  if (result.type == BaseType::Bool) {
+    result = result.convert(BaseType::Int);
+  }
+  const Kind kind = kindOf(result.type);
+  for (uint32_t i = 0; i < value.size; ++i) {
+    ConstantValue::Component& component = result.components[i];
+    if (op == Operator::BitNot) {
+      if (kind == Kind::Float) {
+        return ConstantValue::none;
+      }
+      component.u = ~component.u;
+    } else if (kind == Kind::Float) {
+      component.f = -component.f;
+    } else {
+      component.u = 0 - component.u;
+    }
+  }
+  return result;
+}
+
+// The scalar type and number of components of a scalar or vector type, such as Float and 3 for
+// float3 or vector<float, 3>.
+struct Shape {
+  BaseType scalar = BaseType::Undefined;
+  uint32_t size = 0;
+};
+
+} // namespace
+
+const ConstantValue ConstantValue::none;
+
+bool ConstantValue::isInteger() const {
+  return isConstant() && (kindOf(type) == Kind::Int || kindOf(type) == Kind::Uint);
+}
+
+bool ConstantValue::asBool(uint32_t index) const {
+  return kindOf(type) == Kind::Float ? components[index].f != 0.0f : components[index].u != 0;
+}
+
+int32_t ConstantValue::asInt(uint32_t index) const {
+  return kindOf(type) == Kind::Float ? floatToInt(components[index].f)
+                                     : static_cast<int32_t>(components[index].u);
+}
+
+uint32_t ConstantValue::asUint(uint32_t index) const {
+  return kindOf(type) == Kind::Float ? floatToUint(components[index].f) : components[index].u;
+}
+
+float ConstantValue::asFloat(uint32_t index) const {
+  switch (kindOf(type)) {
+    case Kind::Float:
+      return components[index].f;
+    case Kind::Int:
+      return static_cast<float>(components[index].i);
+    default:
+      return static_cast<float>(components[index].u);
+  }
+}
+
+ConstantValue ConstantValue::convert(BaseType scalarType) const {
+  if (!isConstant()) {
+    return none;
+  }
+  ConstantValue result;
+  result.type = scalarType;
+  result.size = size;
+  for (uint32_t i = 0; i < size; ++i) {
+    switch (kindOf(scalarType)) {
+      case Kind::Bool:
+        result.components[i].u = asBool(i);
+        break;
+      case Kind::Int:
+        result.components[i].i = asInt(i);
+        break;
+      case Kind::Uint:
+        result.components[i].u = asUint(i);
+        break;
+      case Kind::Float:
+        result.components[i].f = asFloat(i);
+        break;
+    }
+  }
+  return result;
+}
+
+ConstantValue ConstantValue::ofBool(bool value) {
+  ConstantValue result;
+  result.type = BaseType::Bool;
+  result.size = 1;
+  result.components[0].u = value;
+  return result;
+}
+
+ConstantValue ConstantValue::ofInt(int32_t value) {
+  ConstantValue result;
+  result.type = BaseType::Int;
+  result.size = 1;
+  result.components[0].i = value;
+  return result;
+}
+
+ConstantValue ConstantValue::ofUint(uint32_t value) {
+  ConstantValue result;
+  result.type = BaseType::Uint;
+  result.size = 1;
+  result.components[0].u = value;
+  return result;
+}
+
+ConstantValue ConstantValue::ofFloat(float value) {
+  ConstantValue result;
+  result.type = BaseType::Float;
+  result.size = 1;
+  result.components[0].f = value;
+  return result;
+}
+
+ConstantEvaluator::ConstantEvaluator(Ast* ast)
+    : _ast(ast) {
+}
+
+const ConstantValue& ConstantEvaluator::evaluate(Expression* expr) {
+  _tooDeep = false;
+  return evaluate(expr, 0);
+}
+
+ConstantValue ConstantEvaluator::evaluateVariable(VariableStmt* var) {
+  if (var == nullptr || !isConstant(var)) {
+    return ConstantValue::none;
+  }
+  _tooDeep = false;
+  return computeVariable(var, 0);
+}
+
+bool ConstantEvaluator::isConstant(const VariableStmt* var) const {
+  if (var->type == nullptr || !var->type->isConst()) {
+    return false;
+  }
+  return var->type->isStatic() || _ast->findGlobalVariable(var->name) != var;
+}
+
+VariableStmt* ConstantEvaluator::constantVariable(const VariableExpr* expr) {
+  if (expr->declaration == nullptr || expr->declaration->nodeType != NodeType::VariableStmt) {
+    return nullptr;
+  }
+  VariableStmt* var = static_cast<VariableStmt*>(expr->declaration);
+  return isConstant(var) ? var : nullptr;
+}
+
+const ConstantValue& ConstantEvaluator::evaluate(Expression* expr, int depth) {
+  if (expr == nullptr) {
+    return ConstantValue::none;
+  }
+  if (expr->constant != nullptr) {
+    return *expr->constant;
+  }
+  if (depth > maxDepth) {
+    _tooDeep = true;
+    return ConstantValue::none;
+  }
+  const bool outerTooDeep = _tooDeep;
+  _tooDeep = false;
+  const ConstantValue value = compute(expr, depth);
+  if (_tooDeep) {
+    // An expression nested in this one wasn't evaluated, so this value may not be final.
+    return ConstantValue::none;
+  }
+  _tooDeep = outerTooDeep;
+  expr->constant = value.isConstant() ? _ast->createValue(value) : &ConstantValue::none;
+  return *expr->constant;
+}
+
+ConstantValue ConstantEvaluator::compute(Expression* expr, int depth) {
+  switch (expr->nodeType) {
+    case NodeType::LiteralExpr:
+      return literalValue(static_cast<LiteralExpr*>(expr));
+    case NodeType::VariableExpr: {
+      VariableStmt* var = constantVariable(static_cast<VariableExpr*>(expr));
+      return var != nullptr ? computeVariable(var, depth + 1) : ConstantValue::none;
+    }
+    case NodeType::PrefixExpr: {
+      PrefixExpr* prefix = static_cast<PrefixExpr*>(expr);
+      return prefixValue(prefix->op, evaluate(prefix->expression, depth + 1));
+    }
+    case NodeType::BinaryExpr: {
+      BinaryExpr* binary = static_cast<BinaryExpr*>(expr);
+      const ConstantValue& left = evaluate(binary->left, depth + 1);
+      if (!left.isConstant()) {
+        return ConstantValue::none;
+      }
+      return binaryValue(binary->op, left, evaluate(binary->right, depth + 1));
+    }
+    case NodeType::TernaryExpr: {
+      TernaryExpr* ternary = static_cast<TernaryExpr*>(expr);
+      const ConstantValue& condition = evaluate(ternary->condition, depth + 1);
+      if (condition.isScalar()) {
+        // Only the value chosen needs to be constant.
+        return evaluate(condition.asBool() ? ternary->trueExpr : ternary->falseExpr, depth + 1);
+      }
+      // A vector condition chooses each component from one value or the other.
+      const ConstantValue& trueValue = evaluate(ternary->trueExpr, depth + 1);
+      const ConstantValue& falseValue = evaluate(ternary->falseExpr, depth + 1);
+      if (!condition.isConstant() || !trueValue.isConstant() || !falseValue.isConstant() ||
+          (trueValue.size != 1 && trueValue.size < condition.size) ||
+          (falseValue.size != 1 && falseValue.size < condition.size)) {
+        return ConstantValue::none;
+      }
+      const BaseType type = commonType(trueValue.type, falseValue.type);
+      const ConstantValue t = trueValue.convert(type);
+      const ConstantValue f = falseValue.convert(type);
+      ConstantValue result;
+      result.type = type;
+      result.size = condition.size;
+      for (uint32_t i = 0; i < result.size; ++i) {
+        result.components[i] = condition.asBool(i) ? t.components[operandIndex(t, i)]
+                                                   : f.components[operandIndex(f, i)];
+      }
+      return result;
+    }
+    case NodeType::CastExpr:
+      return computeCast(static_cast<CastExpr*>(expr), depth);
+    default:
+      return ConstantValue::none;
+  }
+}
+
+ConstantValue ConstantEvaluator::computeCast(CastExpr* cast, int depth) {
+  const Type* type = cast->type;
+  if (type == nullptr || type->array) {
+    return ConstantValue::none;
+  }
+  Shape shape;
+  if (type->baseType == BaseType::Vector) {
+    // vector<T, N>, which is a float4 without the template arguments.
+    shape = {BaseType::Float, 4};
+    const TemplateArg* scalarArg = type->templateArg;
+    if (scalarArg != nullptr) {
+      const TemplateArg* sizeArg = scalarArg->next;
+      if (scalarArg->value == nullptr || scalarArg->value->nodeType != NodeType::Type ||
+          sizeArg == nullptr || sizeArg->value == nullptr ||
+          sizeArg->value->nodeType == NodeType::Type) {
+        return ConstantValue::none;
+      }
+      const ConstantValue& size =
+          evaluate(static_cast<Expression*>(sizeArg->value), depth + 1);
+      shape.scalar = static_cast<const Type*>(scalarArg->value)->baseType;
+      shape.size = size.isScalar() ? size.asUint() : 0;
+    }
+  } else {
+    shape.scalar = scalarBaseType(type->baseType);
+    shape.size = static_cast<uint32_t>(vectorSize(type->baseType));
+  }
+  if (!isScalarBaseType(shape.scalar) || shape.size < 1 || shape.size > 4) {
+    return ConstantValue::none;
+  }
+
+  ConstantValue result;
+  result.type = shape.scalar;
+  result.size = shape.size;
+  Expression* value = cast->value;
+  if (value != nullptr && value->next == nullptr) {
+    // A single value is converted, repeating a scalar and truncating a longer vector, as with
+    // (float3)1 and (float3)color.
+    const ConstantValue converted = evaluate(value, depth + 1).convert(shape.scalar);
+    if (!converted.isConstant() || (converted.size != 1 && converted.size < shape.size)) {
+      return ConstantValue::none;
+    }
+    for (uint32_t i = 0; i < shape.size; ++i) {
+      result.components[i] = converted.components[operandIndex(converted, i)];
+    }
+    return result;
+  }
+  // A constructor such as float4(color.rgb, 1), whose values together have a component for each
+  // component of the type.
+  uint32_t size = 0;
+  for (; value != nullptr; value = value->next) {
+    const ConstantValue converted = evaluate(value, depth + 1).convert(shape.scalar);
+    if (!converted.isConstant() || size + converted.size > shape.size) {
+      return ConstantValue::none;
+    }
+    for (uint32_t i = 0; i < converted.size; ++i) {
+      result.components[size++] = converted.components[i];
+    }
+  }
+  return size == shape.size ? result : ConstantValue::none;
+}
+
+ConstantValue ConstantEvaluator::computeVariable(VariableStmt* var, int depth) {
+  if (var == nullptr || var->isArray || var->type == nullptr || var->initializer == nullptr) {
+    return ConstantValue::none;
+  }
+  // The initializer is converted to the type of the variable as a cast would convert it. The
+  // braces of float3 v = { 1, 2, 3 } are a list of values, as for a constructor.
+  CastExpr conversion;
+  conversion.type = var->type;
+  conversion.value = var->initializer;
+  if (var->initializer->nodeType == NodeType::ArrayInitializerExpr) {
+    conversion.value = static_cast<ArrayInitializerExpr*>(var->initializer)->elements;
+  }
+  return computeCast(&conversion, depth);
+}
+
+} // namespace ast
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+
+#include "ast.h"
+#include "ast_node.h"
+#include "base_type.h"
+
+namespace ast {
+
+/// The value of an expression known at compile time: a bool, int, uint or float scalar or vector
+/// of up to 4 components. Values of the lower precision types, such as half or min16int, are
+/// computed with the 32 bit type of the same kind, but keep their own type.
+struct ConstantValue {
+  /// One component of the value, read through the member for the kind of its type.
+  union Component {
+    int32_t i;
+    uint32_t u;
+    float f;
+  };
+
+  /// The scalar type of the components, such as Float for a float3, or Undefined if the
+  /// expression isn't constant.
+  BaseType type = BaseType::Undefined;
+  /// The number of components, 1 for a scalar, or 0 if the expression isn't constant.
+  uint32_t size = 0;
+  Component components[4] = {};
+
+  /// The value of every expression that isn't constant.
+  static const ConstantValue none;
+
+  bool isConstant() const { return size != 0; }
+
+  bool isScalar() const { return size == 1; }
+
+  /// Whether the components are ints or uints, of any precision.
+  bool isInteger() const;
+
+  /// The type of the value, such as Float3, or Undefined if it isn't constant.
+  BaseType baseType() const { return vectorBaseType(type, static_cast<int>(size)); }
+
+  /// The component converted to the type, with the conversions of HLSL.
+  bool asBool(uint32_t index = 0) const;
+  int32_t asInt(uint32_t index = 0) const;
+  uint32_t asUint(uint32_t index = 0) const;
+  float asFloat(uint32_t index = 0) const;
+
+  /// The value with each component converted to the scalar type.
+  ConstantValue convert(BaseType scalarType) const;
+
+  static ConstantValue ofBool(bool value);
+  static ConstantValue ofInt(int32_t value);
+  static ConstantValue ofUint(uint32_t value);
+  static ConstantValue ofFloat(float value);
+};
+
+/// Evaluates the expressions whose values are known at compile time: literals, the variables
+/// declared const with constant initializers, and the prefix, binary, ternary and cast
+/// expressions of them, including vector constructors such as float3(1, 2, 3).
+///
+/// The value of each expression evaluated is cached on it in Expression::constant, so an
+/// expression shared by many others, such as the initializer of a static const, is only
+/// evaluated once. The cache isn't updated if the expression is changed afterwards, so passes
+/// that change expressions must replace them with expressions of the same value. As evaluating
+/// writes the cache, the expressions of an Ast mustn't be evaluated on several threads at once.
+class ConstantEvaluator {
+public:
+  /// Expressions nested deeper than this aren't evaluated, so a long chain of operators can't
+  /// overflow the stack.
+  static const int maxDepth = 256;
+
+  /// @param ast The Ast the expressions belong to, which holds the values cached.
+  explicit ConstantEvaluator(Ast* ast);
+
+  virtual ~ConstantEvaluator() = default;
+
+  /// The value of the expression, or ConstantValue::none if it isn't constant.
+  const ConstantValue& evaluate(Expression* expr);
+
+  /// The value of a variable, which is the value of its initializer converted to the type of
+  /// the variable.
+  /// @return ConstantValue::none if the variable isn't constant, as isConstant() decides, or
+  /// isn't a scalar or vector with a constant initializer.
+  ConstantValue evaluateVariable(VariableStmt* var);
+
+  /// Whether the variable has a constant value: a local declared const, or a global declared
+  /// static const. A global that is const but not static is a uniform whose initializer is only
+  /// its default value.
+  bool isConstant(const VariableStmt* var) const;
+
+protected:
+  /// The declaration of the variable the expression refers to, if its value is constant. By
+  /// default it's the declaration set by visitor::ResolveSymbols, if isConstant() is true for
+  /// it. A VariableExpr evaluated before ResolveSymbols has run is cached as not constant.
+  virtual VariableStmt* constantVariable(const VariableExpr* expr);
+
+  Ast* _ast;
+
+private:
+  const ConstantValue& evaluate(Expression* expr, int depth);
+
+  ConstantValue compute(Expression* expr, int depth);
+
+  ConstantValue computeCast(CastExpr* cast, int depth);
+
+  ConstantValue computeVariable(VariableStmt* var, int depth);
+
+  // Set when an expression was too deeply nested to evaluate, so the expressions that contain it
+  // don't cache a value that isn't final.
+  bool _tooDeep = false;
+};
+
+} // namespace ast
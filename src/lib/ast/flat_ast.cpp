@@ -0,0 +1,282 @@
+#include "flat_ast.h"
+
+#include <algorithm>
+
+#include "../util/trace.h"
+
+namespace ast {
+
+void FlatAst::flatten(const Ast* ast) {
+  HLSL_TRACE_SCOPE("flatten");
+  _nodes.clear();
+  _nodes.reserve(ast->numNodes());
+  _pending.clear();
+  _pending.push_back({ast->root(), nullptr, FlatNode::none});
+
+  while (!_pending.empty()) {
+    const PendingNode pending = _pending.back();
+    _pending.pop_back();
+
+    const uint32_t index = static_cast<uint32_t>(_nodes.size());
+    FlatNode flatNode;
+    flatNode.node = pending.node;
+    flatNode.nodeType = pending.node->nodeType;
+    flatNode.parent = pending.parent;
+    _nodes.push_back(flatNode);
+
+    const size_t children = _pending.size();
+    _parent = index;
+    addChildren(pending.node, pending.previous);
+    // Reverse the children so the first child is added next.
+    if (_pending.size() > children + 1) {
+      std::reverse(_pending.begin() + children, _pending.end());
+    }
+  }
+
+  // Every node comes after its parent, so summing the subtree sizes from the end gives each node
+  // the size of its whole subtree before its parent reads it.
+  for (size_t i = _nodes.size() - 1; i > 0; --i) {
+    _nodes[_nodes[i].parent].subtreeSize += _nodes[i].subtreeSize;
+  }
+  for (size_t i = 0; i < _nodes.size(); ++i) {
+    FlatNode& flatNode = _nodes[i];
+    if (flatNode.subtreeSize > 1) {
+      flatNode.firstChild = static_cast<uint32_t>(i + 1);
+    }
+    // The node after the subtree is either the next sibling or belongs to an ancestor.
+    const size_t next = i + flatNode.subtreeSize;
+    if (next < _nodes.size() && _nodes[next].parent == flatNode.parent) {
+      flatNode.nextSibling = static_cast<uint32_t>(next);
+    }
+  }
+}
+
+void FlatAst::addAttributes(Statement* node, Node* previous) {
+  // The declarations of a list such as [A] float a, b; share their attributes.
+  if (previous != nullptr && static_cast<Statement*>(previous)->attributes == node->attributes) {
+    return;
+  }
+  addList(node->attributes);
+}
+
+void FlatAst::addArraySize(Node* declaration, Expression* size) {
+  // An array sized by a const variable, such as float a[n];, uses the initializer of the variable
+  // as its size. It belongs to the variable, which was declared before the array.
+  if (size != nullptr && size->offset < declaration->offset) {
+    return;
+  }
+  addList(size);
+}
+
+void FlatAst::addChildren(Node* node, Node* previous) {
+  switch (node->nodeType) {
+    case NodeType::Root:
+      addList(static_cast<Root*>(node)->statements);
+      break;
+    case NodeType::Type: {
+      Type* type = static_cast<Type*>(node);
+      addList(type->templateArg);
+      addArraySize(type, type->arraySize);
+      break;
+    }
+    case NodeType::TemplateArg:
+      addChild(static_cast<TemplateArg*>(node)->value);
+      break;
+    case NodeType::Field: {
+      Field* field = static_cast<Field*>(node);
+      if (previous == nullptr || static_cast<Field*>(previous)->type != field->type) {
+        addChild(field->type);
+      }
+      addArraySize(field, field->arraySize);
+      addList(field->assignment);
+      break;
+    }
+    case NodeType::Parameter: {
+      Parameter* parameter = static_cast<Parameter*>(node);
+      addChild(parameter->type);
+      addArraySize(parameter, parameter->arraySize);
+      addList(parameter->initializer);
+      break;
+    }
+    case NodeType::Attribute:
+      addList(static_cast<Attribute*>(node)->argument);
+      break;
+    case NodeType::SamplerState:
+      addList(static_cast<SamplerState*>(node)->stateAssignments);
+      break;
+    case NodeType::SwitchCase: {
+      SwitchCase* switchCase = static_cast<SwitchCase*>(node);
+      addList(switchCase->condition);
+      addList(switchCase->body);
+      break;
+    }
+    case NodeType::Block: {
+      Block* block = static_cast<Block*>(node);
+      addAttributes(block, previous);
+      addList(block->statements);
+      break;
+    }
+    case NodeType::StructStmt: {
+      StructStmt* structStmt = static_cast<StructStmt*>(node);
+      addAttributes(structStmt, previous);
+      addList(structStmt->fields);
+      addList(structStmt->methods);
+      break;
+    }
+    case NodeType::BufferStmt: {
+      BufferStmt* buffer = static_cast<BufferStmt*>(node);
+      addAttributes(buffer, previous);
+      addList(buffer->field);
+      break;
+    }
+    case NodeType::VariableStmt: {
+      VariableStmt* variable = static_cast<VariableStmt*>(node);
+      addAttributes(variable, previous);
+      if (previous == nullptr || previous->nodeType != NodeType::VariableStmt ||
+          static_cast<VariableStmt*>(previous)->type != variable->type) {
+        addChild(variable->type);
+      }
+      addArraySize(variable, variable->arraySize);
+      addList(variable->initializer);
+      break;
+    }
+    case NodeType::FunctionStmt: {
+      FunctionStmt* function = static_cast<FunctionStmt*>(node);
+      addAttributes(function, previous);
+      addChild(function->returnType);
+      addList(function->parameters);
+      addChild(function->body);
+      break;
+    }
+    case NodeType::IfStmt: {
+      IfStmt* ifStmt = static_cast<IfStmt*>(node);
+      addAttributes(ifStmt, previous);
+      addList(ifStmt->condition);
+      addList(ifStmt->body);
+      addList(ifStmt->elseBody);
+      break;
+    }
+    case NodeType::SwitchStmt: {
+      SwitchStmt* switchStmt = static_cast<SwitchStmt*>(node);
+      addAttributes(switchStmt, previous);
+      addList(switchStmt->condition);
+      addList(switchStmt->cases);
+      break;
+    }
+    case NodeType::ForStmt: {
+      ForStmt* forStmt = static_cast<ForStmt*>(node);
+      addAttributes(forStmt, previous);
+      addList(forStmt->initializer);
+      addList(forStmt->condition);
+      addList(forStmt->increment);
+      addList(forStmt->body);
+      break;
+    }
+    case NodeType::DoWhileStmt: {
+      DoWhileStmt* doWhile = static_cast<DoWhileStmt*>(node);
+      addAttributes(doWhile, previous);
+      addList(doWhile->body);
+      addList(doWhile->condition);
+      break;
+    }
+    case NodeType::WhileStmt: {
+      WhileStmt* whileStmt = static_cast<WhileStmt*>(node);
+      addAttributes(whileStmt, previous);
+      addList(whileStmt->condition);
+      addList(whileStmt->body);
+      break;
+    }
+    case NodeType::ReturnStmt: {
+      ReturnStmt* returnStmt = static_cast<ReturnStmt*>(node);
+      addAttributes(returnStmt, previous);
+      addList(returnStmt->value);
+      break;
+    }
+    case NodeType::AssignmentStmt: {
+      AssignmentStmt* assignment = static_cast<AssignmentStmt*>(node);
+      addAttributes(assignment, previous);
+      addList(assignment->variable);
+      addList(assignment->value);
+      break;
+    }
+    case NodeType::ExpressionStmt: {
+      ExpressionStmt* expressionStmt = static_cast<ExpressionStmt*>(node);
+      addAttributes(expressionStmt, previous);
+      addList(expressionStmt->expression);
+      break;
+    }
+    case NodeType::CallStmt: {
+      CallStmt* call = static_cast<CallStmt*>(node);
+      addAttributes(call, previous);
+      addList(call->arguments);
+      break;
+    }
+    case NodeType::TypedefStmt: {
+      TypedefStmt* typedefStmt = static_cast<TypedefStmt*>(node);
+      addAttributes(typedefStmt, previous);
+      addChild(typedefStmt->type);
+      break;
+    }
+    case NodeType::DiscardStmt:
+    case NodeType::BreakStmt:
+    case NodeType::ContinueStmt:
+      addAttributes(static_cast<Statement*>(node), previous);
+      break;
+    case NodeType::PrefixExpr:
+      addList(static_cast<PrefixExpr*>(node)->expression);
+      break;
+    case NodeType::IncrementExpr:
+      addList(static_cast<IncrementExpr*>(node)->variable);
+      break;
+    case NodeType::ArrayExpr: {
+      ArrayExpr* array = static_cast<ArrayExpr*>(node);
+      addList(array->array);
+      addList(array->index);
+      break;
+    }
+    case NodeType::MemberExpr: {
+      MemberExpr* member = static_cast<MemberExpr*>(node);
+      addList(member->object);
+      addList(member->member);
+      break;
+    }
+    case NodeType::BinaryExpr: {
+      BinaryExpr* binary = static_cast<BinaryExpr*>(node);
+      addList(binary->left);
+      addList(binary->right);
+      break;
+    }
+    case NodeType::TernaryExpr: {
+      TernaryExpr* ternary = static_cast<TernaryExpr*>(node);
+      addList(ternary->condition);
+      addList(ternary->trueExpr);
+      addList(ternary->falseExpr);
+      break;
+    }
+    case NodeType::CallExpr:
+      addList(static_cast<CallExpr*>(node)->arguments);
+      break;
+    case NodeType::CastExpr: {
+      CastExpr* cast = static_cast<CastExpr*>(node);
+      addChild(cast->type);
+      addList(cast->value);
+      break;
+    }
+    case NodeType::AssignmentExpr: {
+      AssignmentExpr* assignment = static_cast<AssignmentExpr*>(node);
+      addList(assignment->variable);
+      addList(assignment->value);
+      break;
+    }
+    case NodeType::StructInitializerExpr:
+      addList(static_cast<StructInitializerExpr*>(node)->fields);
+      break;
+    case NodeType::ArrayInitializerExpr:
+      addList(static_cast<ArrayInitializerExpr*>(node)->elements);
+      break;
+    default:
+      break;
+  }
+}
+
+} // namespace ast
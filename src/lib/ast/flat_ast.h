@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ast.h"
+
+namespace ast {
+
+/// A node of a FlatAst, with the indices of its neighbours in the FlatAst.
+struct FlatNode {
+  /// The index used for a parent, child or sibling that doesn't exist.
+  static const uint32_t none = UINT32_MAX;
+
+  Node* node = nullptr;
+  NodeType nodeType = NodeType::Undefined;
+  /// The index of the parent node, or none for the root.
+  uint32_t parent = none;
+  /// The number of nodes in the subtree of this node, including itself. The subtree is the range
+  /// [index, index + subtreeSize) of the FlatAst.
+  uint32_t subtreeSize = 1;
+  /// The index of the first child, which is always index + 1 if there is one, or none.
+  uint32_t firstChild = none;
+  /// The index of the next child of the same parent, or none.
+  uint32_t nextSibling = none;
+};
+
+/// A contiguous pre-order array of the nodes of an Ast.
+/// Walking the Ast follows pointers between nodes scattered across its memory pages, where a
+/// FlatAst can be scanned in order, so passes that only look for nodes of certain types, such as
+/// every CallExpr in a function, become linear scans over a dense array.
+///
+/// Flattening is an optional step after parsing. Every node reachable from the root is included,
+/// visible or not, with the children of each node in source order, apart from empty statements.
+/// A Type shared by a list of declarations, such as float a, b;, belongs to the first of them.
+/// The FlatAst is a snapshot, and must be flattened again if the Ast is changed.
+class FlatAst {
+public:
+  FlatAst() = default;
+
+  /// Flatten the given Ast.
+  explicit FlatAst(const Ast* ast) { flatten(ast); }
+
+  /// Replace the contents with the nodes of the given Ast, reusing the storage.
+  void flatten(const Ast* ast);
+
+  /// The number of nodes, including the root at index 0.
+  size_t size() const { return _nodes.size(); }
+
+  bool empty() const { return _nodes.empty(); }
+
+  const FlatNode& operator[](size_t index) const { return _nodes[index]; }
+
+  const std::vector<FlatNode>& nodes() const { return _nodes; }
+
+  /// Call the callback with the index of each node of the given type, in pre-order.
+  template<typename F>
+  void forEach(NodeType type, F&& callback) const {
+    forEachInRange(type, 0, static_cast<uint32_t>(_nodes.size()), callback);
+  }
+
+  /// Call the callback with the index of each node of the given type in the subtree of the node
+  /// at the given index, including the node itself, in pre-order.
+  template<typename F>
+  void forEachInSubtree(uint32_t index, NodeType type, F&& callback) const {
+    forEachInRange(type, index, index + _nodes[index].subtreeSize, callback);
+  }
+
+private:
+  template<typename F>
+  void forEachInRange(NodeType type, uint32_t begin, uint32_t end, F& callback) const {
+    for (uint32_t i = begin; i < end; ++i) {
+      if (_nodes[i].nodeType == type) {
+        callback(i);
+      }
+    }
+  }
+
+  // A node waiting to be added, with the node before it in the same list, if any, to find the
+  // Types and Attributes it shares with it.
+  struct PendingNode {
+    Node* node;
+    Node* previous;
+    uint32_t parent;
+  };
+
+  // Push the children of the node onto _pending, in order.
+  void addChildren(Node* node, Node* previous);
+
+  // Push the attributes of a statement, unless it shares them with the statement before it.
+  void addAttributes(Statement* node, Node* previous);
+
+  // Push the array size of a declaration, unless it's shared with an earlier declaration.
+  void addArraySize(Node* declaration, Expression* size);
+
+  // Push a child, and the nodes linked to it by next pointers, onto _pending. The empty
+  // statement is a single instance shared by the whole program, so it isn't included.
+  template<typename T>
+  void addList(T* node) {
+    Node* previous = nullptr;
+    while (node != nullptr) {
+      if (node->nodeType != NodeType::EmptyStmt) {
+        _pending.push_back({node, previous, _parent});
+        previous = node;
+      }
+      node = static_cast<T*>(node->next);
+    }
+  }
+
+  void addChild(Node* node) {
+    if (node != nullptr) {
+      _pending.push_back({node, nullptr, _parent});
+    }
+  }
+
+  std::vector<FlatNode> _nodes;
+  // The nodes still to be added, in reverse order, so the flattening doesn't recurse.
+  std::vector<PendingNode> _pending;
+  // The index of the node whose children are being pushed.
+  uint32_t _parent = FlatNode::none;
+};
+
+} // namespace ast
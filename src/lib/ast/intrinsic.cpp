@@ -0,0 +1,339 @@
+// Generated by tools/gen_intrinsics.py
+#include "intrinsic.h"
+
+#include <cstddef>
+
+namespace ast {
+
+static const IntrinsicInfo _intrinsics[] = {
+  {"", 0, 0, false, IntrinsicReturn::Type, BaseType::Undefined},
+  {"abs", 1, 1, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"acos", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"all", 1, 1, false, IntrinsicReturn::Type, BaseType::Bool},
+  {"AllMemoryBarrier", 0, 0, false, IntrinsicReturn::Type, BaseType::Void},
+  {"AllMemoryBarrierWithGroupSync", 0, 0, false, IntrinsicReturn::Type, BaseType::Void},
+  {"any", 1, 1, false, IntrinsicReturn::Type, BaseType::Bool},
+  {"asfloat", 1, 1, false, IntrinsicReturn::AsFloat, BaseType::Undefined},
+  {"asin", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"asint", 1, 1, false, IntrinsicReturn::IntOfFirst, BaseType::Undefined},
+  {"asuint", 1, 3, false, IntrinsicReturn::UintOfFirst, BaseType::Undefined},
+  {"atan", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"atan2", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"ceil", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"clamp", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"clip", 1, 1, false, IntrinsicReturn::Type, BaseType::Void},
+  {"cos", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"cosh", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"countbits", 1, 1, false, IntrinsicReturn::UintOfFirst, BaseType::Undefined},
+  {"cross", 2, 2, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"D3DCOLORtoUBYTE4", 1, 1, false, IntrinsicReturn::Type, BaseType::Int4},
+  {"ddx", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"ddx_coarse", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"ddx_fine", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"ddy", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"ddy_coarse", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"ddy_fine", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"degrees", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"determinant", 1, 1, false, IntrinsicReturn::FloatScalar, BaseType::Undefined},
+  {"DeviceMemoryBarrier", 0, 0, false, IntrinsicReturn::Type, BaseType::Void},
+  {"DeviceMemoryBarrierWithGroupSync", 0, 0, false, IntrinsicReturn::Type, BaseType::Void},
+  {"distance", 2, 2, false, IntrinsicReturn::FloatScalar, BaseType::Undefined},
+  {"dot", 2, 2, false, IntrinsicReturn::CommonScalar, BaseType::Undefined},
+  {"dst", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"exp", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"exp2", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"f16tof32", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"f32tof16", 1, 1, false, IntrinsicReturn::UintOfFirst, BaseType::Undefined},
+  {"faceforward", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"firstbithigh", 1, 1, false, IntrinsicReturn::UintOfFirst, BaseType::Undefined},
+  {"firstbitlow", 1, 1, false, IntrinsicReturn::UintOfFirst, BaseType::Undefined},
+  {"floor", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"fma", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"fmod", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"frac", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"frexp", 2, 2, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"fwidth", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"GroupMemoryBarrier", 0, 0, false, IntrinsicReturn::Type, BaseType::Void},
+  {"GroupMemoryBarrierWithGroupSync", 0, 0, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedAdd", 2, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedAnd", 2, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedCompareExchange", 4, 4, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedCompareStore", 3, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedExchange", 3, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedMax", 2, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedMin", 2, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedOr", 2, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"InterlockedXor", 2, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"isfinite", 1, 1, false, IntrinsicReturn::BoolOfFirst, BaseType::Undefined},
+  {"isinf", 1, 1, false, IntrinsicReturn::BoolOfFirst, BaseType::Undefined},
+  {"isnan", 1, 1, false, IntrinsicReturn::BoolOfFirst, BaseType::Undefined},
+  {"ldexp", 2, 2, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"length", 1, 1, false, IntrinsicReturn::FloatScalar, BaseType::Undefined},
+  {"lerp", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"lit", 3, 3, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"log", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"log10", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"log2", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"mad", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"max", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"min", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"modf", 2, 2, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"mul", 2, 2, false, IntrinsicReturn::Mul, BaseType::Undefined},
+  {"noise", 1, 1, false, IntrinsicReturn::Type, BaseType::Float},
+  {"normalize", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"pow", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"radians", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"rcp", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"reflect", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"refract", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"reversebits", 1, 1, false, IntrinsicReturn::UintOfFirst, BaseType::Undefined},
+  {"round", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"rsqrt", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"saturate", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"sign", 1, 1, false, IntrinsicReturn::IntOfFirst, BaseType::Undefined},
+  {"sin", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"sincos", 3, 3, false, IntrinsicReturn::Type, BaseType::Void},
+  {"sinh", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"smoothstep", 3, 3, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"sqrt", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"step", 2, 2, false, IntrinsicReturn::Common, BaseType::Undefined},
+  {"tan", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"tanh", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"tex1D", 2, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex1Dbias", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex1Dgrad", 4, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex1Dlod", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex1Dproj", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex2D", 2, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex2Dbias", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex2Dgrad", 4, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex2Dlod", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex2Dproj", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex3D", 2, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex3Dbias", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex3Dgrad", 4, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex3Dlod", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"tex3Dproj", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"texCUBE", 2, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"texCUBEbias", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"texCUBEgrad", 4, 4, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"texCUBElod", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"texCUBEproj", 2, 2, false, IntrinsicReturn::Type, BaseType::Float4},
+  {"transpose", 1, 1, false, IntrinsicReturn::Transpose, BaseType::Undefined},
+  {"trunc", 1, 1, false, IntrinsicReturn::FloatOfFirst, BaseType::Undefined},
+  {"Append", 1, 1, true, IntrinsicReturn::Type, BaseType::Void},
+  {"CalculateLevelOfDetail", 2, 2, true, IntrinsicReturn::Type, BaseType::Float},
+  {"CalculateLevelOfDetailUnclamped", 2, 2, true, IntrinsicReturn::Type, BaseType::Float},
+  {"Consume", 0, 0, true, IntrinsicReturn::Element, BaseType::Undefined},
+  {"DecrementCounter", 0, 0, true, IntrinsicReturn::Type, BaseType::Uint},
+  {"Gather", 2, 4, true, IntrinsicReturn::Gather, BaseType::Undefined},
+  {"GatherAlpha", 2, 4, true, IntrinsicReturn::Gather, BaseType::Undefined},
+  {"GatherBlue", 2, 4, true, IntrinsicReturn::Gather, BaseType::Undefined},
+  {"GatherCmp", 3, 5, true, IntrinsicReturn::Type, BaseType::Float4},
+  {"GatherCmpAlpha", 3, 5, true, IntrinsicReturn::Type, BaseType::Float4},
+  {"GatherCmpBlue", 3, 5, true, IntrinsicReturn::Type, BaseType::Float4},
+  {"GatherCmpGreen", 3, 5, true, IntrinsicReturn::Type, BaseType::Float4},
+  {"GatherCmpRed", 3, 5, true, IntrinsicReturn::Type, BaseType::Float4},
+  {"GatherGreen", 2, 4, true, IntrinsicReturn::Gather, BaseType::Undefined},
+  {"GatherRed", 2, 4, true, IntrinsicReturn::Gather, BaseType::Undefined},
+  {"GetDimensions", 1, 5, true, IntrinsicReturn::Type, BaseType::Void},
+  {"GetSamplePosition", 1, 1, true, IntrinsicReturn::Type, BaseType::Float2},
+  {"IncrementCounter", 0, 0, true, IntrinsicReturn::Type, BaseType::Uint},
+  {"Load", 1, 3, true, IntrinsicReturn::Element, BaseType::Undefined},
+  {"Load2", 1, 2, true, IntrinsicReturn::Type, BaseType::Uint2},
+  {"Load3", 1, 2, true, IntrinsicReturn::Type, BaseType::Uint3},
+  {"Load4", 1, 2, true, IntrinsicReturn::Type, BaseType::Uint4},
+  {"Sample", 2, 5, true, IntrinsicReturn::Element, BaseType::Undefined},
+  {"SampleBias", 3, 6, true, IntrinsicReturn::Element, BaseType::Undefined},
+  {"SampleCmp", 3, 6, true, IntrinsicReturn::Type, BaseType::Float},
+  {"SampleCmpLevelZero", 3, 5, true, IntrinsicReturn::Type, BaseType::Float},
+  {"SampleGrad", 4, 7, true, IntrinsicReturn::Element, BaseType::Undefined},
+  {"SampleLevel", 3, 5, true, IntrinsicReturn::Element, BaseType::Undefined},
+  {"Store", 2, 2, true, IntrinsicReturn::Type, BaseType::Void},
+  {"Store2", 2, 2, true, IntrinsicReturn::Type, BaseType::Void},
+  {"Store3", 2, 2, true, IntrinsicReturn::Type, BaseType::Void},
+  {"Store4", 2, 2, true, IntrinsicReturn::Type, BaseType::Void},
+};
+
+// The seed of each bucket of the perfect hash.
+static const uint16_t _seeds[] = {
+  2, 1, 1, 16, 3, 4, 1, 4, 5, 2, 0, 12, 2, 9, 13, 2,
+  1, 1, 1, 2, 2, 13, 7, 1, 2, 3, 2, 3, 3, 0, 0, 34,
+  61, 0, 6, 12, 7, 28, 0, 1, 3, 3, 13, 18, 55, 0, 6, 12,
+  16, 2, 0, 47, 16, 29, 2, 0, 15, 21, 2, 1, 12, 26, 11, 37,
+  0, 1, 9, 4, 121, 70, 51, 32, 3,
+};
+
+// The intrinsic in each slot of the perfect hash.
+static const Intrinsic _slots[] = {
+  Intrinsic::Store2,
+  Intrinsic::Max,
+  Intrinsic::SampleGrad,
+  Intrinsic::GatherBlue,
+  Intrinsic::Ddy,
+  Intrinsic::InterlockedAdd,
+  Intrinsic::Firstbithigh,
+  Intrinsic::Log,
+  Intrinsic::Store3,
+  Intrinsic::GatherCmpGreen,
+  Intrinsic::Sample,
+  Intrinsic::Tanh,
+  Intrinsic::SampleCmp,
+  Intrinsic::Saturate,
+  Intrinsic::Reversebits,
+  Intrinsic::Log10,
+  Intrinsic::DdxCoarse,
+  Intrinsic::InterlockedCompareExchange,
+  Intrinsic::Round,
+  Intrinsic::Sinh,
+  Intrinsic::GatherCmpAlpha,
+  Intrinsic::F16tof32,
+  Intrinsic::Lerp,
+  Intrinsic::GatherCmpBlue,
+  Intrinsic::Sin,
+  Intrinsic::Cross,
+  Intrinsic::Mul,
+  Intrinsic::Dot,
+  Intrinsic::GatherCmpRed,
+  Intrinsic::Faceforward,
+  Intrinsic::DecrementCounter,
+  Intrinsic::Log2,
+  Intrinsic::CalculateLevelOfDetailUnclamped,
+  Intrinsic::Ddx,
+  Intrinsic::Dst,
+  Intrinsic::Fma,
+  Intrinsic::SampleBias,
+  Intrinsic::F32tof16,
+  Intrinsic::Store,
+  Intrinsic::Sign,
+  Intrinsic::GatherGreen,
+  Intrinsic::Tex1Dproj,
+  Intrinsic::Tex2D,
+  Intrinsic::Tex2Dproj,
+  Intrinsic::SampleCmpLevelZero,
+  Intrinsic::Frac,
+  Intrinsic::TexCUBE,
+  Intrinsic::Modf,
+  Intrinsic::Load3,
+  Intrinsic::DdyFine,
+  Intrinsic::Clip,
+  Intrinsic::All,
+  Intrinsic::Fmod,
+  Intrinsic::TexCUBElod,
+  Intrinsic::Transpose,
+  Intrinsic::IncrementCounter,
+  Intrinsic::Smoothstep,
+  Intrinsic::Floor,
+  Intrinsic::Tex1Dgrad,
+  Intrinsic::Sqrt,
+  Intrinsic::Acos,
+  Intrinsic::Clamp,
+  Intrinsic::GatherAlpha,
+  Intrinsic::GroupMemoryBarrierWithGroupSync,
+  Intrinsic::Rcp,
+  Intrinsic::GetDimensions,
+  Intrinsic::Tex1D,
+  Intrinsic::InterlockedMin,
+  Intrinsic::Tex2Dgrad,
+  Intrinsic::GetSamplePosition,
+  Intrinsic::Asin,
+  Intrinsic::InterlockedCompareStore,
+  Intrinsic::TexCUBEproj,
+  Intrinsic::AllMemoryBarrier,
+  Intrinsic::Ldexp,
+  Intrinsic::Min,
+  Intrinsic::Gather,
+  Intrinsic::Exp,
+  Intrinsic::D3DCOLORtoUBYTE4,
+  Intrinsic::DdyCoarse,
+  Intrinsic::Noise,
+  Intrinsic::TexCUBEbias,
+  Intrinsic::Abs,
+  Intrinsic::Asint,
+  Intrinsic::Cos,
+  Intrinsic::Sincos,
+  Intrinsic::Tex2Dlod,
+  Intrinsic::CalculateLevelOfDetail,
+  Intrinsic::InterlockedOr,
+  Intrinsic::Mad,
+  Intrinsic::Fwidth,
+  Intrinsic::InterlockedMax,
+  Intrinsic::Refract,
+  Intrinsic::Store4,
+  Intrinsic::Load4,
+  Intrinsic::Reflect,
+  Intrinsic::Cosh,
+  Intrinsic::Normalize,
+  Intrinsic::Tex1Dlod,
+  Intrinsic::SampleLevel,
+  Intrinsic::Asfloat,
+  Intrinsic::GatherCmp,
+  Intrinsic::Distance,
+  Intrinsic::GatherRed,
+  Intrinsic::DeviceMemoryBarrierWithGroupSync,
+  Intrinsic::InterlockedXor,
+  Intrinsic::Tex3Dproj,
+  Intrinsic::Atan,
+  Intrinsic::Asuint,
+  Intrinsic::Countbits,
+  Intrinsic::TexCUBEgrad,
+  Intrinsic::DeviceMemoryBarrier,
+  Intrinsic::Firstbitlow,
+  Intrinsic::Frexp,
+  Intrinsic::AllMemoryBarrierWithGroupSync,
+  Intrinsic::Tex3Dgrad,
+  Intrinsic::Step,
+  Intrinsic::Determinant,
+  Intrinsic::Tex1Dbias,
+  Intrinsic::Tan,
+  Intrinsic::Ceil,
+  Intrinsic::Any,
+  Intrinsic::Lit,
+  Intrinsic::Append,
+  Intrinsic::Length,
+  Intrinsic::Exp2,
+  Intrinsic::Consume,
+  Intrinsic::InterlockedAnd,
+  Intrinsic::Isfinite,
+  Intrinsic::Isnan,
+  Intrinsic::Tex2Dbias,
+  Intrinsic::Rsqrt,
+  Intrinsic::InterlockedExchange,
+  Intrinsic::Load,
+  Intrinsic::Degrees,
+  Intrinsic::Tex3Dbias,
+  Intrinsic::Isinf,
+  Intrinsic::DdxFine,
+  Intrinsic::Trunc,
+  Intrinsic::Atan2,
+  Intrinsic::Load2,
+  Intrinsic::GroupMemoryBarrier,
+  Intrinsic::Pow,
+  Intrinsic::Tex3Dlod,
+  Intrinsic::Tex3D,
+  Intrinsic::Radians,
+};
+
+// FNV-1a, starting from the seed.
+static uint32_t _hash(uint32_t seed, const std::string_view& name) {
+  uint32_t h = 2166136261u ^ seed;
+  for (const char c : name) {
+    h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return h;
+}
+
+Intrinsic findIntrinsic(const std::string_view& name) {
+  if (name.size() < 3 || name.size() > 32) {
+    return Intrinsic::None;
+  }
+  const uint32_t seed = _seeds[_hash(0, name) % 73];
+  const Intrinsic intrinsic = _slots[_hash(seed, name) % 146];
+  return _intrinsics[static_cast<size_t>(intrinsic)].name == name ? intrinsic : Intrinsic::None;
+}
+
+const IntrinsicInfo& intrinsicInfo(Intrinsic intrinsic) {
+  return _intrinsics[static_cast<size_t>(intrinsic)];
+}
+
+} // namespace ast
@@ -0,0 +1,215 @@
+#pragma once
+// Generated by tools/gen_intrinsics.py
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "base_type.h"
+
+namespace ast {
+
+/// The intrinsic functions of HLSL, such as mul and lerp, and the methods of textures and
+/// buffers, such as Sample.
+enum class Intrinsic : uint16_t {
+  None,
+  Abs,
+  Acos,
+  All,
+  AllMemoryBarrier,
+  AllMemoryBarrierWithGroupSync,
+  Any,
+  Asfloat,
+  Asin,
+  Asint,
+  Asuint,
+  Atan,
+  Atan2,
+  Ceil,
+  Clamp,
+  Clip,
+  Cos,
+  Cosh,
+  Countbits,
+  Cross,
+  D3DCOLORtoUBYTE4,
+  Ddx,
+  DdxCoarse,
+  DdxFine,
+  Ddy,
+  DdyCoarse,
+  DdyFine,
+  Degrees,
+  Determinant,
+  DeviceMemoryBarrier,
+  DeviceMemoryBarrierWithGroupSync,
+  Distance,
+  Dot,
+  Dst,
+  Exp,
+  Exp2,
+  F16tof32,
+  F32tof16,
+  Faceforward,
+  Firstbithigh,
+  Firstbitlow,
+  Floor,
+  Fma,
+  Fmod,
+  Frac,
+  Frexp,
+  Fwidth,
+  GroupMemoryBarrier,
+  GroupMemoryBarrierWithGroupSync,
+  InterlockedAdd,
+  InterlockedAnd,
+  InterlockedCompareExchange,
+  InterlockedCompareStore,
+  InterlockedExchange,
+  InterlockedMax,
+  InterlockedMin,
+  InterlockedOr,
+  InterlockedXor,
+  Isfinite,
+  Isinf,
+  Isnan,
+  Ldexp,
+  Length,
+  Lerp,
+  Lit,
+  Log,
+  Log10,
+  Log2,
+  Mad,
+  Max,
+  Min,
+  Modf,
+  Mul,
+  Noise,
+  Normalize,
+  Pow,
+  Radians,
+  Rcp,
+  Reflect,
+  Refract,
+  Reversebits,
+  Round,
+  Rsqrt,
+  Saturate,
+  Sign,
+  Sin,
+  Sincos,
+  Sinh,
+  Smoothstep,
+  Sqrt,
+  Step,
+  Tan,
+  Tanh,
+  Tex1D,
+  Tex1Dbias,
+  Tex1Dgrad,
+  Tex1Dlod,
+  Tex1Dproj,
+  Tex2D,
+  Tex2Dbias,
+  Tex2Dgrad,
+  Tex2Dlod,
+  Tex2Dproj,
+  Tex3D,
+  Tex3Dbias,
+  Tex3Dgrad,
+  Tex3Dlod,
+  Tex3Dproj,
+  TexCUBE,
+  TexCUBEbias,
+  TexCUBEgrad,
+  TexCUBElod,
+  TexCUBEproj,
+  Transpose,
+  Trunc,
+  Append,
+  CalculateLevelOfDetail,
+  CalculateLevelOfDetailUnclamped,
+  Consume,
+  DecrementCounter,
+  Gather,
+  GatherAlpha,
+  GatherBlue,
+  GatherCmp,
+  GatherCmpAlpha,
+  GatherCmpBlue,
+  GatherCmpGreen,
+  GatherCmpRed,
+  GatherGreen,
+  GatherRed,
+  GetDimensions,
+  GetSamplePosition,
+  IncrementCounter,
+  Load,
+  Load2,
+  Load3,
+  Load4,
+  Sample,
+  SampleBias,
+  SampleCmp,
+  SampleCmpLevelZero,
+  SampleGrad,
+  SampleLevel,
+  Store,
+  Store2,
+  Store3,
+  Store4,
+};
+
+/// The number of Intrinsic values, including None.
+const size_t numIntrinsics = static_cast<size_t>(Intrinsic::Store4) + 1;
+
+/// How the return type of an intrinsic follows from the types of its arguments.
+enum class IntrinsicReturn : uint8_t {
+  /// The type given by IntrinsicInfo::returnType, such as float4 for tex2D.
+  Type,
+  /// The shape of the first argument, of float if it isn't already floating point, as sin.
+  FloatOfFirst,
+  /// A scalar of the float type of the first argument, as length.
+  FloatScalar,
+  /// The type all the arguments combine to, as lerp.
+  Common,
+  /// A scalar of the type all the arguments combine to, as dot.
+  CommonScalar,
+  /// The shape of the first argument, of bool, int or uint, as isnan, sign and countbits.
+  BoolOfFirst,
+  IntOfFirst,
+  UintOfFirst,
+  /// The shape of the first argument, of float, as asfloat.
+  AsFloat,
+  /// The matrix with the rows and columns of the argument swapped.
+  Transpose,
+  /// The product of a matrix or vector with a matrix or vector.
+  Mul,
+  /// The element type of the texture or buffer, as Sample.
+  Element,
+  /// A 4 component vector of the element type of the texture, as Gather.
+  Gather,
+};
+
+/// The signature of an intrinsic.
+struct IntrinsicInfo {
+  std::string_view name;
+  /// The fewest and most arguments it takes.
+  uint8_t minArguments;
+  uint8_t maxArguments;
+  /// Whether it's a method of a texture or buffer, rather than a function.
+  bool method;
+  IntrinsicReturn returns;
+  /// The type returned, if returns is IntrinsicReturn::Type.
+  BaseType returnType;
+};
+
+/// The intrinsic with the name, or Intrinsic::None if there isn't one, found with a perfect
+/// hash in constant time.
+Intrinsic findIntrinsic(const std::string_view& name);
+
+/// The signature of the intrinsic. The name of Intrinsic::None is empty.
+const IntrinsicInfo& intrinsicInfo(Intrinsic intrinsic);
+
+} // namespace ast
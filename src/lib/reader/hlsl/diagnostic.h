@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+
+#include "source_location.h"
+#include "token.h"
+
+namespace reader {
+namespace hlsl {
+
+/// An error reported by the parser.
+struct Diagnostic {
+  /// The token where the error was found.
+  Token token;
+  /// A description of the error.
+  std::string message;
+  /// Where the token is in the source.
+  SourceLocation location;
+};
+
+} // namespace hlsl
+} // namespace reader
@@ -0,0 +1,248 @@
+#include "parallel_parser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "../../util/trace.h"
+#include "scanner.h"
+
+namespace reader {
+namespace hlsl {
+
+ParallelParser::ParallelParser(const std::string_view& source, unsigned int numThreads)
+  : _source(source)
+  , _numThreads(numThreads) {
+  if (_numThreads == 0) {
+    _numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+}
+
+ast::Ast* ParallelParser::parse() {
+  _stats = ParseStats();
+  HLSL_STATS(util::ScopedTimer timer(_stats.parser.ms));
+  HLSL_TRACE_SCOPE("parallel parse");
+  _tokens.clear();
+  _chunks.clear();
+  _structNames.clear();
+  _typedefNames.clear();
+  _diagnostics.clear();
+
+  // The scanner is kept for locating the diagnostics.
+  Scanner scanner(_source);
+  _tokens = scanner.scan();
+
+  {
+    HLSL_TRACE_SCOPE("split statements");
+    splitTopLevelStatements();
+  }
+
+  ast::Ast* ast = new ast::Ast();
+  ast->setIndexNodes(_indexNodes);
+
+  // Parse the chunks on the worker threads, each thread using its own Ast memory pool.
+  const size_t numThreads = std::max<size_t>(1, std::min<size_t>(_numThreads, _chunks.size()));
+  std::vector<ast::Ast*> threadAsts;
+  for (size_t i = 0; i < numThreads; ++i) {
+    threadAsts.push_back(new ast::Ast(ast->allocator()));
+    threadAsts.back()->setIndexNodes(_indexNodes);
+  }
+
+  std::atomic<size_t> nextChunk{0};
+  auto worker = [&](ast::Ast* threadAst) {
+    HLSL_TRACE_SCOPE("parse statements");
+    while (true) {
+      const size_t ci = nextChunk++;
+      if (ci >= _chunks.size()) {
+        break;
+      }
+      parseChunk(_chunks[ci], threadAst);
+    }
+  };
+
+  if (numThreads == 1) {
+    worker(threadAsts[0]);
+  } else {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; ++i) {
+      threads.emplace_back(worker, threadAsts[i]);
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  {
+    HLSL_TRACE_SCOPE("merge");
+    for (ast::Ast* threadAst : threadAsts) {
+      ast->merge(threadAst);
+      delete threadAst;
+    }
+  }
+
+  // Link the statements together in source order, re-parsing any statements that needed the
+  // context of the statements before them.
+  HLSL_TRACE_SCOPE("link statements");
+  std::map<std::string_view, ast::StructStmt*> structs;
+  std::map<std::string_view, ast::TypedefStmt*> typedefs;
+  std::map<std::string_view, ast::VariableStmt*> variables;
+
+  ast::Statement* lastStatement = nullptr;
+  for (Chunk& chunk : _chunks) {
+    if (chunk.failed) {
+      Parser parser(chunk.begin, chunk.end, chunk.endOffset);
+      parser._ast = ast;
+      parser._maxDepth = _maxDepth;
+      parser._structs = structs;
+      parser._typedefs = typedefs;
+      parser._variables = variables;
+      chunk.statements = parser.parseTopLevelStatements();
+      HLSL_STATS(addStats(chunk.stats, parser.stats().parser));
+      _diagnostics.insert(_diagnostics.end(), parser.diagnostics().begin(),
+                          parser.diagnostics().end());
+    }
+
+    for (ast::Statement* stmt = chunk.statements; stmt != nullptr; stmt = stmt->next) {
+      if (stmt->nodeType == ast::NodeType::FunctionStmt) {
+        ast->addFunction(static_cast<ast::FunctionStmt*>(stmt));
+      } else if (stmt->nodeType == ast::NodeType::VariableStmt) {
+        ast::VariableStmt* var = static_cast<ast::VariableStmt*>(stmt);
+        ast->addGlobalVariable(var);
+        variables[var->name] = var;
+      } else if (stmt->nodeType == ast::NodeType::StructStmt) {
+        ast::StructStmt* structStmt = static_cast<ast::StructStmt*>(stmt);
+        structs[structStmt->name] = structStmt;
+      } else if (stmt->nodeType == ast::NodeType::TypedefStmt) {
+        ast::TypedefStmt* typedefStmt = static_cast<ast::TypedefStmt*>(stmt);
+        typedefs[typedefStmt->name] = typedefStmt;
+      }
+
+      if (lastStatement == nullptr) {
+        ast->root()->statements = stmt;
+      } else {
+        lastStatement->next = stmt;
+      }
+      lastStatement = stmt;
+    }
+  }
+
+  for (Diagnostic& diagnostic : _diagnostics) {
+    diagnostic.location = scanner.location(diagnostic.token.offset());
+  }
+
+#if HLSL_REFLECT_STATS
+  _stats.scanner = scanner.stats();
+  _stats.ast = ast->stats();
+  for (const Chunk& chunk : _chunks) {
+    addStats(_stats.parser, chunk.stats);
+  }
+#endif
+
+  return ast;
+}
+
+void ParallelParser::splitTopLevelStatements() {
+  auto it = _tokens.cbegin();
+  const auto end = _tokens.cend();
+
+  while (it != end) {
+    Chunk chunk;
+    chunk.begin = it;
+
+    int depth = 0;
+    // The depth of parentheses, so the '=' of a default parameter isn't taken for an initializer.
+    int parenDepth = 0;
+    // Structs, typedefs and initializers can have a '}' at depth 0 before the end of the
+    // statement, so they continue until the next ';' rather than ending at the '}'.
+    bool endsWithSemicolon = false;
+    bool isTypedef = false;
+    auto prev = end;
+
+    for (; it != end; prev = it, ++it) {
+      const TokenType type = it->type();
+
+      if (depth == 0) {
+        if (type == TokenType::Struct) {
+          endsWithSemicolon = true;
+          auto next = std::next(it);
+          if (next != end && next->type() == TokenType::Identifier) {
+            _structNames.insert(next->lexeme());
+          }
+        } else if (type == TokenType::Typedef) {
+          endsWithSemicolon = true;
+          isTypedef = true;
+        } else if (type == TokenType::Equal && parenDepth == 0) {
+          endsWithSemicolon = true;
+        } else if (type == TokenType::Semicolon) {
+          // The name of a typedef is the last token before the ';'.
+          if (isTypedef && prev != end) {
+            _typedefNames.insert(prev->lexeme());
+          }
+          ++it;
+          break;
+        }
+      }
+
+      if (type == TokenType::LeftParen) {
+        ++parenDepth;
+      } else if (type == TokenType::RightParen) {
+        --parenDepth;
+      } else if (type == TokenType::LeftBrace) {
+        ++depth;
+      } else if (type == TokenType::RightBrace) {
+        --depth;
+        if (depth < 0 || (depth == 0 && !endsWithSemicolon)) {
+          // End of a function or buffer body, which may be followed by an optional ';'.
+          ++it;
+          if (it != end && it->type() == TokenType::Semicolon) {
+            ++it;
+          }
+          break;
+        }
+      }
+    }
+
+    chunk.end = it;
+    chunk.endOffset = it != end ? it->offset() : static_cast<uint32_t>(_source.size());
+    _chunks.push_back(chunk);
+  }
+}
+
+bool ParallelParser::parseChunk(Chunk& chunk, ast::Ast* ast) {
+  Parser parser(chunk.begin, chunk.end, chunk.endOffset);
+  parser._ast = ast;
+  parser._maxDepth = _maxDepth;
+  addKnownTypes(parser);
+  const size_t nodeMark = ast->nodeIndexMark();
+  chunk.statements = parser.parseTopLevelStatements();
+  HLSL_STATS(chunk.stats = parser.stats().parser);
+  if (parser.hasErrors()) {
+    // The error may be due to missing context, the in-order re-parse will report it if not.
+    chunk.statements = nullptr;
+    ast->rollbackNodeIndex(nodeMark);
+    chunk.failed = true;
+    return false;
+  }
+  return true;
+}
+
+void ParallelParser::addStats(ParserStats& total, const ParserStats& stats) {
+  total.restorePoints += stats.restorePoints;
+  total.restores += stats.restores;
+  total.errors += stats.errors;
+  total.maxDepth = std::max(total.maxDepth, stats.maxDepth);
+}
+
+void ParallelParser::addKnownTypes(Parser& parser) {
+  // The parser only needs to know the names of the types to recognize them. Anything that
+  // needs the declaration itself will fail and be re-parsed with the full context.
+  for (const std::string_view& name : _structNames) {
+    parser._structs[name] = nullptr;
+  }
+  for (const std::string_view& name : _typedefNames) {
+    parser._typedefs[name] = nullptr;
+  }
+}
+
+} // namespace hlsl
+} // namespace reader
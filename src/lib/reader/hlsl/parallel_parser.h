@@ -0,0 +1,98 @@
+#pragma once
+
+#include <set>
+#include <string_view>
+#include <vector>
+
+#include "../../ast/ast.h"
+#include "parser.h"
+#include "token.h"
+
+namespace reader {
+namespace hlsl {
+
+/// Parses a source string by splitting it into top-level statements and parsing the statements
+/// on multiple threads.
+/// The source is first scanned into tokens, and a fast pre-scan tracking brace depth splits the
+/// tokens at top-level statement boundaries, recording the struct and typedef names the parser
+/// needs to recognize types. Each thread parses statements into its own Ast memory pool, and the
+/// pools are merged into a single Ast once all statements have been parsed. Statements that
+/// depend on earlier statements in ways the pre-scan can't see, such as array sizes using a const
+/// variable, are re-parsed in order once the earlier statements are available.
+class ParallelParser {
+public:
+  /// Construct a new ParallelParser for the given source.
+  /// The source string must be valid for the lifetime of the resulting Ast object, as all string
+  /// values are views of the source string.
+  /// @param source The source string to parse.
+  /// @param numThreads The number of threads to parse with, or 0 to use one per hardware thread.
+  ParallelParser(const std::string_view& source, unsigned int numThreads = 0);
+
+  /// Parse the source string and return the resulting Ast object.
+  /// As with Parser, the Ast is returned even if there were errors.
+  /// @return ast::Ast* The resulting Ast object.
+  ast::Ast* parse();
+
+  const std::string_view& source() const { return _source; }
+
+  /// The errors found by the last parse, in source order.
+  const std::vector<Diagnostic>& diagnostics() const { return _diagnostics; }
+
+  /// Returns true if the last parse found any errors.
+  bool hasErrors() const { return !_diagnostics.empty(); }
+
+  /// The number of top-level statement chunks the source was split into by the last parse.
+  size_t numChunks() const { return _chunks.size(); }
+
+  /// The instrumentation stats of the last parse, summed over the statement parsers. The parser
+  /// time is the wall time of the whole parse. These are all zero if HLSL_REFLECT_STATS is
+  /// disabled.
+  const ParseStats& stats() const { return _stats; }
+
+  /// Set how deeply expressions and statements may nest, as with Parser::setMaxDepth().
+  void setMaxDepth(int depth) { _maxDepth = depth; }
+
+  /// Set whether the Ast indexes its nodes, as with Parser::setIndexNodes(). The nodes of each
+  /// type are in the order the threads parsed them, which may not be source order.
+  void setIndexNodes(bool enable) { _indexNodes = enable; }
+
+private:
+  // A range of tokens making up one top-level statement.
+  struct Chunk {
+    std::vector<Token>::const_iterator begin;
+    std::vector<Token>::const_iterator end;
+    // The offset of the token after the chunk, or the size of the source for the last chunk.
+    uint32_t endOffset = 0;
+    ast::Statement* statements = nullptr;
+    bool failed = false;
+    ParserStats stats;
+  };
+
+  // Split the scanned tokens into top-level statement chunks.
+  void splitTopLevelStatements();
+
+  // Parse the chunk using the given Ast for node memory, recording the parser stats in the
+  // chunk. Returns false if the chunk could not be parsed without the context of the statements
+  // before it.
+  bool parseChunk(Chunk& chunk, ast::Ast* ast);
+
+  // Add the counters of a statement parser to a total, leaving the time alone.
+  static void addStats(ParserStats& total, const ParserStats& stats);
+
+  // Seed a parser with the type names found by the pre-scan.
+  void addKnownTypes(Parser& parser);
+
+  const std::string_view _source;
+  unsigned int _numThreads;
+  int _maxDepth = Parser::defaultMaxDepth;
+  bool _indexNodes = false;
+  std::vector<Token> _tokens;
+  std::vector<Chunk> _chunks;
+  std::set<std::string_view> _structNames;
+  std::set<std::string_view> _typedefNames;
+  std::vector<Diagnostic> _diagnostics;
+  ParseStats _stats;
+};
+
+} // namespace hlsl
+} // namespace reader
@@ -0,0 +1,37 @@
+#include "parse_stats.h"
+
+#include <iomanip>
+
+namespace reader {
+namespace hlsl {
+
+void ParseStats::print(std::ostream& out) const {
+  const std::ios_base::fmtflags flags = out.flags();
+  const int width = 24;
+  out << std::fixed << std::setprecision(3) << std::left;
+  out << "Scanner" << std::endl;
+  out << "  " << std::setw(width) << "tokens" << scanner.tokens << std::endl;
+  out << "  " << std::setw(width) << "bytes" << scanner.bytes << std::endl;
+  out << "  " << std::setw(width) << "define expansions" << scanner.defineExpansions << std::endl;
+  out << "  " << std::setw(width) << "look-ahead retries" << scanner.lookAheadRetries << std::endl;
+  out << "  " << std::setw(width) << "scan ms" << scanner.ms << std::endl;
+  out << "Parser" << std::endl;
+  out << "  " << std::setw(width) << "restore points" << parser.restorePoints << std::endl;
+  out << "  " << std::setw(width) << "restores" << parser.restores << std::endl;
+  out << "  " << std::setw(width) << "errors" << parser.errors << std::endl;
+  out << "  " << std::setw(width) << "max depth" << parser.maxDepth << std::endl;
+  out << "  " << std::setw(width) << "parse ms" << parser.ms << std::endl;
+  out << "Ast" << std::endl;
+  out << "  " << std::setw(width) << "pages" << ast.pages << std::endl;
+  out << "  " << std::setw(width) << "bytes used" << ast.bytesUsed << std::endl;
+  for (size_t i = 0; i < ast::numNodeTypes; ++i) {
+    if (ast.nodes[i] != 0) {
+      out << "  " << std::setw(width) << ast::nodeTypeToString(static_cast<ast::NodeType>(i))
+          << ast.nodes[i] << std::endl;
+    }
+  }
+  out.flags(flags);
+}
+
+} // namespace hlsl
+} // namespace reader
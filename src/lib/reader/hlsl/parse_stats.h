@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+#include "../../ast/ast.h"
+
+namespace reader {
+namespace hlsl {
+
+/// Counters collected by the Scanner when HLSL_REFLECT_STATS is enabled.
+struct ScannerStats {
+  /// The number of tokens produced, including the tokens of expanded defines.
+  size_t tokens = 0;
+  /// The number of source bytes scanned.
+  size_t bytes = 0;
+  /// The number of identifiers replaced by a define.
+  size_t defineExpansions = 0;
+  /// The number of times scanToken looked ahead to extend a lexeme that didn't match.
+  size_t lookAheadRetries = 0;
+  /// The time spent in Scanner::scan. Tokens streamed to the parser are counted in its time.
+  double ms = 0.0;
+};
+
+/// Counters collected by the Parser when HLSL_REFLECT_STATS is enabled.
+struct ParserStats {
+  /// The number of restore points started to try an ambiguous rule.
+  size_t restorePoints = 0;
+  /// The number of restore points that were restored, undoing a rule.
+  size_t restores = 0;
+  /// The number of errors raised, including those suppressed while recovering.
+  size_t errors = 0;
+  /// The deepest nesting of rules reached, such as blocks, parenthesized and prefix expressions
+  /// and assignment chains. Binary operators are parsed without recursing, so a long chain of
+  /// them doesn't add to it.
+  size_t maxDepth = 0;
+  /// The time spent in parse, including scanning the tokens it streams.
+  double ms = 0.0;
+};
+
+/// The instrumentation stats of a parse, retrieved from Parser::stats().
+struct ParseStats {
+  ScannerStats scanner;
+  ParserStats parser;
+  ast::AstStats ast;
+
+  /// Print the stats as a table, listing the node counts of each NodeType created.
+  void print(std::ostream& out) const;
+};
+
+} // namespace hlsl
+} // namespace reader
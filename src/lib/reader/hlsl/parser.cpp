@@ -1,9 +1,15 @@
 #include "parser.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+
 #include "../../util/string_util.h"
+#include "../../util/trace.h"
+#include "../../ast/constant_evaluator.h"
 #include "../../ast/type_flags.h"
 #include "parser/effect_state.h"
-#include "parse_exception.h"
+#include "scanner/literal.h"
 
 namespace reader {
 namespace hlsl {
@@ -12,35 +18,56 @@ Parser::Parser(const std::string_view& source)
   : _scanner(source) {
 }
 
+Parser::Parser(std::vector<Token>::const_iterator begin, std::vector<Token>::const_iterator end,
+               uint32_t endOffset)
+  : _scanner(std::string_view())
+  , _tokens(begin, end)
+  , _prescanned(true)
+  , _endOffset(endOffset) {
+}
+
 ast::Ast* Parser::parse() {
-  _ast = new ast::Ast();
+  HLSL_TRACE_SCOPE("parse");
+  _stats = ParseStats();
+  {
+    HLSL_STATS_TIMER(_stats.parser.ms);
+    _ast = new ast::Ast();
+    _ast->setIndexNodes(_indexNodes);
+    _diagnostics.clear();
+    _ast->root()->statements = parseTopLevelStatements();
+  }
+  HLSL_STATS(_stats.scanner = _scanner.stats());
+  HLSL_STATS(_stats.ast = _ast->stats());
+
+  // Locations are only computed for the tokens that have errors.
+  for (Diagnostic& diagnostic : _diagnostics) {
+    diagnostic.location = _scanner.location(diagnostic.token.offset());
+  }
 
-  ast::Root* root = _ast->root();
+  return _ast;
+}
 
+ast::Statement* Parser::parseTopLevelStatements() {
+  ast::Statement* firstStatement = nullptr;
   ast::Statement* lastStatement = nullptr;
   while (!isAtEnd()) {
-    ast::Statement* statement = nullptr;
-    try {
-      statement = parseTopLevelStatement();
-    } catch (ParseException e) {
-      std::cerr << "Error: "  << e.message << std::endl;
-      std::cerr << "  Token: " << e.token.lexeme() << std::endl;
-      std::cerr << "  Line: " << _scanner.absoluteLine() << std::endl;
-      delete _ast;
-      _ast = nullptr;
-      return nullptr;
-    }
-    if (statement == nullptr) {
+    const size_t nodeMark = _ast->nodeIndexMark();
+    ast::Statement* statement = parseTopLevelStatement();
+    if (statement == nullptr && !_panicMode) {
       if (isAtEnd()) {
+        // Drop anything parsed before the end, such as attributes with no statement.
+        _ast->rollbackNodeIndex(nodeMark);
         break;
       }
-      std::cerr << "Error Line: " << _scanner.absoluteLine() << std::endl;
-      delete _ast;
-      _ast = nullptr;
-      return nullptr;
+      error(peekNext(), "statement expected");
+    }
+    if (_panicMode) {
+      // Drop the statement that failed and resume with the next one.
+      synchronize(0, 0, nodeMark);
+      continue;
     }
-    if (root->statements == nullptr) {
-      root->statements = statement;
+    if (firstStatement == nullptr) {
+      firstStatement = statement;
     }
     if (lastStatement != nullptr) {
       lastStatement->next = statement;
@@ -52,45 +79,105 @@ ast::Ast* Parser::parse() {
     }
   }
 
-  return _ast;
+  return firstStatement;
+}
+
+void Parser::error(const Token& token, const std::string& message) {
+  HLSL_STATS(_stats.parser.errors++);
+  if (_panicMode) {
+    // Only the first error of a statement is reported, the rest are usually a consequence of it.
+    return;
+  }
+  _diagnostics.push_back(Diagnostic{token, message});
+  _panicMode = true;
+}
+
+bool Parser::enterNesting() {
+  if (_depth >= _maxDepth) {
+    error(peekNext(), "Nested too deeply, the maximum depth is " + std::to_string(_maxDepth));
+    return false;
+  }
+  _depth++;
+  HLSL_STATS(_stats.parser.maxDepth = std::max(_stats.parser.maxDepth, size_t(_depth)));
+  return true;
+}
+
+void Parser::synchronize(int braceDepth, size_t restoreDepth, size_t nodeMark) {
+  _panicMode = false;
+  while (_restore.size() > restoreDepth) {
+    _restore.pop_back();
+  }
+  _ast->rollbackNodeIndex(nodeMark);
+
+  while (!isAtEnd()) {
+    const TokenType type = peekNext().type();
+    if (type == TokenType::RightBrace && _braceDepth <= braceDepth && braceDepth > 0) {
+      // This '}' closes the enclosing block, leave it for the block to consume.
+      return;
+    }
+    advance();
+    if (_braceDepth < 0) {
+      _braceDepth = 0;
+    }
+    if ((type == TokenType::Semicolon || type == TokenType::RightBrace) &&
+        _braceDepth <= braceDepth) {
+      return;
+    }
+  }
 }
 
 bool Parser::isAtEnd() {
-  return (_pending.empty() && _scanner.isAtEnd()) || peekNext().type() == TokenType::EndOfFile;
+  return _panicMode || (_position == _tokens.size() && _scanner.isAtEnd()) ||
+      peekNext().type() == TokenType::EndOfFile;
 }
 
 Token Parser::consume(TokenType type, const char* message) {
   if (check(type)) {
     return advance();
   }
-  throw ParseException(peekNext(), message);
+  error(peekNext(), message != nullptr ? message : "unexpected token");
+  return _errorToken;
 }
 
 Token Parser::advance() {
-  if (!_pending.empty()) {
-    Token t = _pending.front();
-    _pending.pop_front();
-    if (!_restore.empty()) {
-      _restore.back().push_back(t);
-    }
-    return t;
+  if (_panicMode) {
+    return _errorToken;
   }
 
-  if (!_restore.empty()) {
-    Token t = _scanner.scanNext();
-    _restore.back().push_back(t);
-    return t;
+  const Token t = peekNext();
+  _position++;
+
+  _lastOffset = t.offset();
+
+  if (t.type() == TokenType::LeftBrace) {
+    _braceDepth++;
+  } else if (t.type() == TokenType::RightBrace) {
+    _braceDepth--;
   }
-  
-  return _scanner.scanNext();
+
+  return t;
 }
 
 const Token& Parser::peekNext() {
-  if (!_pending.empty()) {
-    return _pending.front();
+  if (_panicMode) {
+    return _errorToken;
   }
-  _pending.push_back(_scanner.scanNext());
-  return _pending.front();
+  if (_position < _tokens.size()) {
+    return _tokens[_position];
+  }
+  if (_restore.empty() && _tokens.size() > 1) {
+    // Nothing can return to the consumed tokens, reuse the buffer. The last token is kept so
+    // pushBack() can return it.
+    _tokens.front() = _tokens.back();
+    _tokens.resize(1);
+    _position = 1;
+  }
+  if (_prescanned) {
+    _tokens.push_back(Token(TokenType::EndOfFile, "", _endOffset));
+  } else {
+    _tokens.push_back(_scanner.scanNext());
+  }
+  return _tokens.back();
 }
 
 bool Parser::match(TokenType type) {
@@ -124,16 +211,17 @@ ast::Statement* Parser::parseTopLevelStatement() {
     ast::Statement* node = structNode;
     if (peekNext().type() == TokenType::Identifier) {
       Token name = advance();
-      ast::VariableStmt* var = _ast->createNode<ast::VariableStmt>();
-      var->type = _ast->createNode<ast::Type>();
+      // struct S { ... } a, b; declares the struct followed by the variables.
+      ast::VariableStmt* var = createNode<ast::VariableStmt>();
+      structNode->next = var;
+      var->type = createNode<ast::Type>();
       var->type->baseType = ast::BaseType::Struct;
       var->type->name = structNode->name;
       var->name = name.lexeme();
-      node = var;
       while (match(TokenType::Comma)) {
         Token name = consume(TokenType::Identifier, "identifier expected");
-        ast::VariableStmt* next = _ast->createNode<ast::VariableStmt>();
-        next->type = _ast->createNode<ast::Type>();
+        ast::VariableStmt* next = createNode<ast::VariableStmt>();
+        next->type = createNode<ast::Type>();
         next->type->baseType = ast::BaseType::Struct;
         next->type->name = structNode->name;
         next->name = name.lexeme();
@@ -176,6 +264,10 @@ ast::Statement* Parser::parseTopLevelStatement() {
     // function declaration
     if (check(TokenType::LeftParen)) {
       ast::FunctionStmt* func = parseFunctionStmt(type, identifier.lexeme());
+      if (_panicMode) {
+        // The statement is dropped, so don't register it with the Ast.
+        return nullptr;
+      }
       _ast->addFunction(func);
       if (func != nullptr) {
         func->attributes = attributes;
@@ -186,6 +278,9 @@ ast::Statement* Parser::parseTopLevelStatement() {
     // variable declaration
     ast::Statement* var = parseVariableStmt(type, identifier.lexeme(), attributes);
     consume(TokenType::Semicolon, "Expected ';' after variable declaration");
+    if (_panicMode) {
+      return nullptr;
+    }
     // variable declarations can be chained together with ','.
     ast::Statement* firstStmt = var;
     while (var != nullptr) {
@@ -205,41 +300,51 @@ ast::Statement* Parser::parseTopLevelStatement() {
 }
 
 ast::TypedefStmt* Parser::parseTypedef() {
-  ast::TypedefStmt* node = _ast->createNode<ast::TypedefStmt>();
+  ast::TypedefStmt* node = createNode<ast::TypedefStmt>();
   node->type = parseType(true, "typedef type expected");
   node->name = advance().lexeme();
-  _typedefs[node->name] = node;
+  if (!_panicMode) {
+    // As with structs, a typedef without a name would make every token look like a type.
+    _typedefs[node->name] = node;
+  }
   return node;
 }
 
 ast::StructStmt* Parser::parseStruct() {
-  ast::StructStmt* s = _ast->createNode<ast::StructStmt>();
+  ast::StructStmt* s = createNode<ast::StructStmt>();
 
   if (peekNext().type() == TokenType::LeftBrace) {
     // anonymous struct
-    static int anonStructCount = 0;
-    _anonymousStructNames.push_back("__anon_struct_" + std::to_string(anonStructCount++));
-    s->name = std::string_view(_anonymousStructNames.back());
+    static std::atomic<int> anonStructCount{0};
+    s->name = _ast->addString("__anon_struct_" + std::to_string(anonStructCount++));
+    advance();
   } else {
     Token name = consume(TokenType::Identifier, "struct name expected.");
     consume(TokenType::LeftBrace, "'{' expected for struct");  
     s->name = name.lexeme();
   }
 
+  if (_panicMode) {
+    // Don't register a struct without a name, or every token would look like its type.
+    return s;
+  }
   _structs[s->name] = s;
+  _ast->addStruct(s);
 
   ast::Field* lastField = nullptr;
   ast::FunctionStmt* lastMethod = nullptr;
 
   while (!check(TokenType::RightBrace) && !isAtEnd()) {
-    ast::Field* field = parseStructField();
+    ast::Type* type = nullptr;
+    std::string_view name;
+    ast::Field* field = parseStructField(type, name);
 
-    if (check(TokenType::LeftParen)) {
-      // we have a function, so the field parsed above should contain
+    if (field == nullptr) {
+      // we have a function, so the field parsed above gave us
       //   the return type and function name.  We just need to parse the
       //   body of the function.
 
-      ast::FunctionStmt *method = parseFunctionStmt(field->type, field->name);
+      ast::FunctionStmt *method = parseFunctionStmt(type, name);
 
       if (s->methods == nullptr) {
         s->methods = method;
@@ -271,7 +376,7 @@ ast::StructStmt* Parser::parseStruct() {
     if (check(TokenType::Comma)) {
       while (check(TokenType::Comma)) {
         advance(); // consume comma
-        ast::Field* nextField = _ast->createNode<ast::Field>();
+        ast::Field* nextField = createNode<ast::Field>();
         nextField->type = field->type;
         nextField->name = advance().lexeme();
         if (match(TokenType::LeftBracket)) {
@@ -293,17 +398,28 @@ ast::StructStmt* Parser::parseStruct() {
   return s;
 }
 
-ast::Field* Parser::parseStructField() {
-  ast::Field* field = _ast->createNode<ast::Field>();
+ast::Field* Parser::parseStructField(ast::Type*& type, std::string_view& name) {
+  const uint32_t offset = peekNext().offset();
+  ast::InterpolationModifier interpolation = ast::InterpolationModifier::None;
 
   Token tk = peekNext();
   if (isInterpolationModifier(tk.type())) {
-    field->interpolation = tokenTypeToInterpolationModifier(tk.type());
+    interpolation = tokenTypeToInterpolationModifier(tk.type());
     advance();
   }
 
-  field->type = parseType(false /* , "struct field type expected" */);
-  field->name = advance().lexeme();
+  type = parseType(false, "struct field type expected");
+  name = advance().lexeme();
+  if (check(TokenType::LeftParen)) {
+    // A method, which the caller parses. Creating a Field for it would leave a node that isn't
+    // in the tree.
+    return nullptr;
+  }
+
+  ast::Field* field = createNode<ast::Field>(offset);
+  field->interpolation = interpolation;
+  field->type = type;
+  field->name = name;
 
   if (match(TokenType::LeftBracket)) {
     // Array field
@@ -335,7 +451,7 @@ ast::Attribute* Parser::parseAttributes() {
   }
 
   while (!isAtEnd()) {
-    ast::Attribute* attribute = _ast->createNode<ast::Attribute>();
+    ast::Attribute* attribute = createNode<ast::Attribute>(peekNext().offset());
     if (firstAttribute == nullptr) {
       firstAttribute = attribute;
     }
@@ -362,11 +478,12 @@ ast::Attribute* Parser::parseAttributes() {
 
         if (!match(TokenType::Comma)) {
           if (!match(TokenType::RightParen)) {
-            throw ParseException(peekNext(), "')' or ',' expected for attribute");
+            error(peekNext(), "')' or ',' expected for attribute");
           }
           break;
         }
       }
+      attribute->argument = firstArg;
     }
 
     if (match(TokenType::Comma)) {
@@ -374,7 +491,7 @@ ast::Attribute* Parser::parseAttributes() {
     }
 
     if (!match(TokenType::RightBracket)) {
-      throw ParseException(peekNext(), "']' or ',' expected for attribute");
+      error(peekNext(), "']' or ',' expected for attribute");
       break;
     }
 
@@ -389,7 +506,7 @@ ast::Attribute* Parser::parseAttributes() {
 ast::Expression* Parser::parseAssignmentExpression(ast::Type* type) {
   if (check(TokenType::LeftBrace)) {
     // Array or struct initialization expression (e.g. a = {1, 2, 3})
-    if (type->baseType == ast::BaseType::Struct) {
+    if (type != nullptr && type->baseType == ast::BaseType::Struct) {
       // Struct initialization
       return parseStructInitialization(type);
     }
@@ -398,7 +515,7 @@ ast::Expression* Parser::parseAssignmentExpression(ast::Type* type) {
     return parseArrayInitialization(type);
   }
 
-  ast::Expression* expression = parseLogicalOrExpression();
+  ast::Expression* expression = parseBinaryExpression();
   if (expression == nullptr) {
     return nullptr;
   }
@@ -410,11 +527,17 @@ ast::Expression* Parser::parseAssignmentExpression(ast::Type* type) {
 
   ast::Operator op = tokenTypeToAssignmentOperatator(advance().type());
 
+  // Assignments are right associative, so each one in a chain (a = b = c) nests the next.
+  if (!enterNesting()) {
+    return nullptr;
+  }
   ast::Expression* value = parseAssignmentExpression(type);
+  leaveNesting();
   if (value == nullptr) {
-    throw ParseException(peekNext(), "expression expected for assignment");
+    error(peekNext(), "expression expected for assignment");
+    return nullptr;
   }
-  ast::AssignmentExpr* assignment = _ast->createNode<ast::AssignmentExpr>();
+  ast::AssignmentExpr* assignment = createNode<ast::AssignmentExpr>(startOffset(expression));
   assignment->op = op;
   assignment->variable = expression;
   assignment->value = value;
@@ -422,11 +545,13 @@ ast::Expression* Parser::parseAssignmentExpression(ast::Type* type) {
 }
 
 ast::Expression* Parser::parseStructInitialization(ast::Type* type) {
-  consume(TokenType::LeftBrace, "'{' expected for struct initialization");
+  const uint32_t start =
+      consume(TokenType::LeftBrace, "'{' expected for struct initialization").offset();
 
   ast::StructStmt* structType = _structs[type->name];
   if (structType == nullptr) {
-    throw ParseException(peekNext(), "unknown struct type");
+    error(peekNext(), "unknown struct type");
+    return nullptr;
   }
   ast::Field* field = structType->fields;
   ast::Expression* firstExpression = nullptr;
@@ -452,16 +577,25 @@ ast::Expression* Parser::parseStructInitialization(ast::Type* type) {
 
   consume(TokenType::RightBrace, "'}' expected for array initialization");
 
-  ast::StructInitializerExpr* init = _ast->createNode<ast::StructInitializerExpr>();
+  ast::StructInitializerExpr* init = createNode<ast::StructInitializerExpr>(start);
   init->structType = structType;
   init->fields = firstExpression;
   return init;
 }
 
 ast::Expression* Parser::parseArrayInitialization(ast::Type* type) {
+  const uint32_t start = peekNext().offset();
   if (match(TokenType::LeftBrace)) {
+      if (!enterNesting()) {
+        return nullptr;
+      }
       // Nested array initialization (e.g. a = {{1, 2}, {3, 4}}
       ast::Expression* firstExpression = parseArrayInitialization(type);
+      if (firstExpression == nullptr) {
+        leaveNesting();
+        error(peekNext(), "expression expected for assignment");
+        return nullptr;
+      }
       ast::Expression* lastExpression = firstExpression;
 
       while (!isAtEnd() && match(TokenType::Comma)) {
@@ -472,15 +606,18 @@ ast::Expression* Parser::parseArrayInitialization(ast::Type* type) {
         
         ast::Expression* expression = parseArrayInitialization(type);
         if (expression == nullptr) {
-          throw ParseException(peekNext(), "expression expected for assignment");
+          leaveNesting();
+          error(peekNext(), "expression expected for assignment");
+          return nullptr;
         }
         lastExpression->next = expression;
         lastExpression = expression;
       }
 
+      leaveNesting();
       consume(TokenType::RightBrace, "'}' expected for array initialization");
 
-      ast::ArrayInitializerExpr* init = _ast->createNode<ast::ArrayInitializerExpr>();
+      ast::ArrayInitializerExpr* init = createNode<ast::ArrayInitializerExpr>(start);
       init->elements = firstExpression;
 
       return init;
@@ -490,7 +627,7 @@ ast::Expression* Parser::parseArrayInitialization(ast::Type* type) {
 }
 
 ast::Expression* Parser::parseExpression() {
-  return parseLogicalOrExpression();
+  return parseBinaryExpression();
 }
 
 ast::Expression* Parser::parseExpressionList() {
@@ -506,7 +643,7 @@ ast::Expression* Parser::parseExpressionList() {
     }
     ast::Expression* expression = parseExpression();
     if (expression == nullptr) {
-      throw ParseException(peekNext(), "expression expected for expression list");
+      error(peekNext(), "expression expected for expression list");
       break;
     }
     lastExpression->next = expression;
@@ -523,7 +660,7 @@ ast::Field* Parser::parseBufferField() {
   ast::Field* firstDecl = nullptr;
 
   do {
-    ast::Field* decl = _ast->createNode<ast::Field>();
+    ast::Field* decl = createNode<ast::Field>(peekNext().offset());
     if (firstDecl == nullptr) {
       firstDecl = decl;
     }
@@ -544,7 +681,8 @@ ast::Field* Parser::parseBufferField() {
     if (match(TokenType::Equal)) {
       if (decl->type->array) {
         if (!match(TokenType::LeftBrace)) {
-          throw ParseException(peekNext(), "'{' expected for array initializer");
+          error(peekNext(), "'{' expected for array initializer");
+          return firstDecl;
         }
         decl->assignment = parseExpressionList();
         consume(TokenType::RightBrace, "'}' expected for array initializer");
@@ -563,7 +701,7 @@ ast::SamplerState* Parser::parseSamplerState() {
   consume(TokenType::SamplerState, "sampler state expected");
   consume(TokenType::LeftBrace, "'{' expected for sampler state");
 
-  ast::SamplerState* samplerState = _ast->createNode<ast::SamplerState>();
+  ast::SamplerState* samplerState = createNode<ast::SamplerState>();
 
   ast::StateAssignment* lastStateAssignment = nullptr;
   while (!match(TokenType::RightBrace) && !isAtEnd()) {
@@ -581,7 +719,7 @@ ast::SamplerState* Parser::parseSamplerState() {
 }
 
 ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isPipelineState) {
-  ast::StateAssignment* stateAssignment = _ast->createNode<ast::StateAssignment>();
+  ast::StateAssignment* stateAssignment = createNode<ast::StateAssignment>(peekNext().offset());
 
   stateAssignment->stateName = consume(TokenType::Identifier,
       "identifier expected for state assignment").lexeme();
@@ -590,8 +728,8 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
       getEffectState(stateAssignment->stateName, isSamplerState, isPipelineState);
 
   if (state == nullptr) {
-    throw ParseException(peekNext(),
-        "unknown state assignment " + std::string(stateAssignment->stateName));
+    error(peekNext(), "unknown state assignment " + std::string(stateAssignment->stateName));
+    return stateAssignment;
   }
 
   stateAssignment->d3dRenderState = state->d3dRenderState;
@@ -610,7 +748,8 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
   if (state->values == nullptr) {
     Token tk = advance();
     if (tk.type() != TokenType::Identifier || tk.lexeme() != "compile") {
-      throw ParseException(tk, "invalid state assignment");
+      error(tk, "invalid state assignment");
+      return stateAssignment;
     }
 
     while (!match(TokenType::Semicolon) && !isAtEnd()) {
@@ -622,11 +761,11 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
       while (!isAtEnd()) {
         Token tk = advance();
         if (tk.type() == TokenType::IntLiteral) {
-          mask |= util::toInt(tk.lexeme());
+          mask |= static_cast<int>(decodeLiteral(tk.lexeme()).intValue);
         } else if (tk.type() == TokenType::Identifier) {
           // color mask value
           const EffectStateValue* stateValue = colorMaskValues;
-          while (stateValue->name != nullptr) {
+          while (!stateValue->name.empty()) {
             if (util::stringEqualCaseInsensitive(tk.lexeme(), stateValue->name)) {
               mask |= stateValue->value;
               break;
@@ -634,7 +773,8 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
             ++stateValue;
           }
         } else {
-          throw ParseException(tk, "invalid state assignment");
+          error(tk, "invalid state assignment");
+          return stateAssignment;
         }
         if (!match(TokenType::Pipe)) {
           break;
@@ -642,10 +782,10 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
       }
     } else if (expectsInteger) {
       Token tk = consume(TokenType::IntLiteral, "integer expected for state assignment");
-      stateAssignment->intValue = util::toInt(tk.lexeme());
+      stateAssignment->intValue = static_cast<int>(decodeLiteral(tk.lexeme()).intValue);
     } else if (expectsFloat) {
       Token tk = consume(TokenType::FloatLiteral, "float expected for state assignment");
-      stateAssignment->floatValue = util::toFloat(tk.lexeme());
+      stateAssignment->floatValue = static_cast<float>(decodeLiteral(tk.lexeme()).floatValue);
     } else if (expectsBoolean) {
       const Token& tk = advance();
       if (tk.type() == TokenType::Identifier) {
@@ -654,12 +794,14 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
           stateAssignment->intValue = value->value;
         }
       } else if (tk.type() == TokenType::IntLiteral) {
-        stateAssignment->intValue = util::toInt(tk.lexeme());
+        stateAssignment->intValue = static_cast<int>(decodeLiteral(tk.lexeme()).intValue);
       } else {
-        throw ParseException(peekNext(), "invalid state assignment");
+        error(peekNext(), "invalid state assignment");
+        return stateAssignment;
       }
     } else {
-      throw ParseException(peekNext(), "invalid state assignment");
+      error(peekNext(), "invalid state assignment");
+      return stateAssignment;
     }
   }
 
@@ -669,13 +811,10 @@ ast::StateAssignment* Parser::parseStateAssignment(bool isSamplerState, bool isP
 }
 
 ast::BufferStmt* Parser::parseBuffer() {
-  ast::BufferStmt* buffer = _ast->createNode<ast::BufferStmt>();
+  ast::BufferStmt* buffer = createNode<ast::BufferStmt>();
   buffer->name = consume(TokenType::Identifier, "buffer name expected").lexeme();
   if (match(TokenType::Colon)) {
-    consume(TokenType::Register, "register expected");
-    consume(TokenType::LeftParen, "'(' expected");
-    buffer->registerName = consume(TokenType::Identifier, "register name expected").lexeme();
-    consume(TokenType::RightParen, "')' expected");
+    parseRegister(buffer->registerName, buffer->registerSpace);
   }
   consume(TokenType::LeftBrace, "'{' expected for buffer");
   
@@ -683,7 +822,8 @@ ast::BufferStmt* Parser::parseBuffer() {
   while (!match(TokenType::RightBrace) && !isAtEnd()) {
     ast::Field* field = parseBufferField();
     if (field == nullptr) {
-      throw ParseException(peekNext(), "field expected for buffer");
+      error(peekNext(), "field expected for buffer");
+      break;
     }
 
     if (buffer->field == nullptr) {
@@ -704,6 +844,7 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
   // recording the tokens in case we need to rewind.
   startRestorePoint();
 
+  const uint32_t start = peekNext().offset();
   uint32_t flags = ast::TypeFlags::None;
   while (parseTypeModifier(flags) || parseInterpolationModifier(flags)) {}
 
@@ -713,8 +854,7 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
     // We can discard the tokens we recorded because we know this is a type.
     discardRestorePoint();
     ast::StructStmt* structType = parseStruct();
-    _ast->addStruct(structType);
-    ast::Type* type = _ast->createNode<ast::Type>();
+    ast::Type* type = createNode<ast::Type>(start);
     type->flags = flags;
     type->baseType = ast::BaseType::Struct;
     type->name = structType->name;
@@ -726,7 +866,7 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
     if (_typedefs.find(token.lexeme()) != _typedefs.end()) {
       // We can discard the tokens we recorded because we know this is a type.
       discardRestorePoint();
-      ast::Type* type = _ast->createNode<ast::Type>();
+      ast::Type* type = createNode<ast::Type>(start);
       type->flags = flags;
       type->baseType = ast::BaseType::UserDefined;
       type->name = token.lexeme();
@@ -736,7 +876,7 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
     if (_structs.find(token.lexeme()) != _structs.end()) {
       // We can discard the tokens we recorded because we know this is a type.
       discardRestorePoint();
-      ast::Type* type = _ast->createNode<ast::Type>();
+      ast::Type* type = createNode<ast::Type>(start);
       type->flags = flags;
       type->baseType = ast::BaseType::Struct;
       type->name = token.lexeme();
@@ -747,8 +887,8 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
     restorePoint();
 
     if (exceptionMessage != nullptr) {
-      // If a type was expected, throw an exception.
-      throw ParseException(token, exceptionMessage);
+      // If a type was expected, report an error.
+      error(token, exceptionMessage);
     }
 
     // Otherwise the caller was just checking to see if it was a Type, so returning
@@ -763,8 +903,8 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
     // If the token wasn't a built-in type, roll back to the start of the type.
     restorePoint();
     if (exceptionMessage != nullptr) {
-      // If a type was expected, throw an exception.
-      throw ParseException(token, exceptionMessage);
+      // If a type was expected, report an error.
+      error(token, exceptionMessage);
     }
     // Otherwise the caller was just checking to see if it was a Type, so returning
     // null will indicate that it wasn't.
@@ -777,7 +917,7 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
       // We can discard the tokens we recorded because we know this is an
       // accepted void type.
       discardRestorePoint();
-      ast::Type* type = _ast->createNode<ast::Type>();
+      ast::Type* type = createNode<ast::Type>(start);
       type->flags = flags;
       type->baseType = baseType;
       return type;
@@ -785,8 +925,8 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
       // If void isn't allowed, roll back to the start of the type.
       restorePoint();
       if (exceptionMessage != nullptr) {
-        // If a type was expected, throw an exception.
-        throw ParseException(token, exceptionMessage);
+        // If a type was expected, report an error.
+        error(token, exceptionMessage);
       }
       // Otherwise the caller was just checking to see if it was a Type, so returning
       // null will indicate that it wasn't.
@@ -797,10 +937,14 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
   // For template types like Samper<float> or RWStorageBuffer<float>, parse the template arguments.
   ast::TemplateArg* templateArg = nullptr;
   if (match(TokenType::Less)) {
-    templateArg = _ast->createNode<ast::TemplateArg>();
-    templateArg->value = parseType(false);
+    templateArg = createNode<ast::TemplateArg>();
+    // A template argument can itself be a template type (Texture2D<Texture2D<float>>).
+    if (enterNesting()) {
+      templateArg->value = parseType(false);
+      leaveNesting();
+    }
     if (match(TokenType::Comma)) {
-      ast::TemplateArg* next = _ast->createNode<ast::TemplateArg>();
+      ast::TemplateArg* next = createNode<ast::TemplateArg>();
       next->value = parseSingularExpression();
       templateArg->next = next;
     }
@@ -810,7 +954,7 @@ ast::Type* Parser::parseType(bool allowVoid, const char* exceptionMessage) {
   // We can discard the recorded tokens we recorded because we know this is a type.
   discardRestorePoint();
 
-  ast::Type* type = _ast->createNode<ast::Type>();
+  ast::Type* type = createNode<ast::Type>(start);
   type->flags = flags;
   type->baseType = baseType;
   type->templateArg = templateArg;
@@ -895,199 +1039,175 @@ bool Parser::parseInterpolationModifier(uint32_t& flags) {
   return false;
 }
 
-ast::Expression* Parser::parseLogicalOrExpression() {
-  ast::Expression* expr = parseLogicalAndExpression();
-  while (match(TokenType::PipePipe)) {
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = ast::Operator::OrOr;
-    op->left = expr;
-    op->right = parseLogicalAndExpression();
-    expr = op;
-  }
-  return expr;
-}
-
-ast::Expression* Parser::parseLogicalAndExpression() {
-  ast::Expression* expr = parseInclusiveOrExpression();
-  while (match(TokenType::AmpersandAmpersand)) {
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = ast::Operator::AndAnd;
-    op->left = expr;
-    op->right = parseInclusiveOrExpression();
-    expr = op;
-  }
-  return expr;
-}
-
-ast::Expression* Parser::parseInclusiveOrExpression() {
-  ast::Expression* expr = parseExclusiveOrExpression();
-  while (match(TokenType::Pipe)) {
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = ast::Operator::Or;
-    op->left = expr;
-    op->right = parseExclusiveOrExpression();
-    expr = op;
-  }
-  return expr;
+namespace {
+
+// The precedence and operator of a binary operator token. Higher precedences bind tighter, and a
+// precedence of 0 means the token isn't a binary operator.
+struct BinaryOperator {
+  int precedence = 0;
+  ast::Operator op = ast::Operator::Undefined;
+};
+
+// All of the binary operator tokens come before Hash in TokenType.
+const size_t numOperatorTokens = static_cast<size_t>(TokenType::Hash);
+
+// Binary operators indexed by TokenType, following the C operator precedence.
+const std::array<BinaryOperator, numOperatorTokens> binaryOperators = []() {
+  std::array<BinaryOperator, numOperatorTokens> table{};
+  auto set = [&table](TokenType type, int precedence, ast::Operator op) {
+    table[static_cast<size_t>(type)] = BinaryOperator{precedence, op};
+  };
+  set(TokenType::PipePipe, 1, ast::Operator::OrOr);
+  set(TokenType::AmpersandAmpersand, 2, ast::Operator::AndAnd);
+  set(TokenType::Pipe, 3, ast::Operator::Or);
+  set(TokenType::Caret, 4, ast::Operator::Xor);
+  set(TokenType::Ampersand, 5, ast::Operator::And);
+  set(TokenType::EqualEqual, 6, ast::Operator::EqualEqual);
+  set(TokenType::BangEqual, 6, ast::Operator::NotEqual);
+  set(TokenType::Greater, 7, ast::Operator::Greater);
+  set(TokenType::Less, 7, ast::Operator::Less);
+  set(TokenType::GreaterEqual, 7, ast::Operator::GreaterEqual);
+  set(TokenType::LessEqual, 7, ast::Operator::LessEqual);
+  set(TokenType::GreaterGreater, 8, ast::Operator::RightShift);
+  set(TokenType::LessLess, 8, ast::Operator::LeftShift);
+  set(TokenType::Plus, 9, ast::Operator::Add);
+  set(TokenType::Minus, 9, ast::Operator::Subtract);
+  set(TokenType::Star, 10, ast::Operator::Multiply);
+  set(TokenType::Slash, 10, ast::Operator::Divide);
+  set(TokenType::Percent, 10, ast::Operator::Modulo);
+  // A '++' or '--' that wasn't consumed as a postfix operator has always been parsed as a
+  // multiplicative operator.
+  set(TokenType::PlusPlus, 10, ast::Operator::Modulo);
+  set(TokenType::MinusMinus, 10, ast::Operator::Modulo);
+  return table;
+}();
+
+const BinaryOperator& getBinaryOperator(TokenType type) {
+  static const BinaryOperator none;
+  const size_t index = static_cast<size_t>(type);
+  return index < numOperatorTokens ? binaryOperators[index] : none;
 }
 
-ast::Expression* Parser::parseExclusiveOrExpression() {
-  ast::Expression* expr = parseAndExpression();
-  while (match(TokenType::Caret)) {
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = ast::Operator::Xor;
-    op->left = expr;
-    op->right = parseAndExpression();
-    expr = op;
-  }
-  return expr;
-}
+} // namespace
 
-ast::Expression* Parser::parseAndExpression() {
-  ast::Expression* expr = parseEqualityExpression();
-  while (match(TokenType::Ampersand)) {
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = ast::Operator::And;
-    op->left = expr;
-    op->right = parseEqualityExpression();
-    expr = op;
+ast::Expression* Parser::parseBinaryExpression() {
+  const size_t operatorBase = _operators.size();
+  _operands.push_back(parsePrefixExpression());
+  while (true) {
+    const BinaryOperator& binary = getBinaryOperator(peekNext().type());
+    if (binary.precedence == 0) {
+      break;
+    }
+    advance();
+    // Operators of the same precedence are left associative, so combine the pending operators
+    // that bind at least as tightly. The operand left on top is then this operator's left operand.
+    reduceBinaryOperators(operatorBase, binary.precedence);
+    _operators.push_back(PendingOperator{binary.op, binary.precedence,
+                                         startOffset(_operands.back())});
+    _operands.push_back(parsePrefixExpression());
   }
-  return expr;
-}
+  reduceBinaryOperators(operatorBase, 0);
 
-ast::Expression* Parser::parseEqualityExpression() {
-  ast::Expression* expr = parseRelationalExpression();
-  while (check(TokenType::EqualEqual) || check(TokenType::BangEqual)) {
-    Token tk = advance();
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = tk.type() == TokenType::EqualEqual
-        ? ast::Operator::EqualEqual : ast::Operator::NotEqual;
-    op->left = expr;
-    op->right = parseRelationalExpression();
-    expr = op;
-  }
-  return expr;
-}
+  ast::Expression* expr = _operands.back();
+  _operands.pop_back();
 
-ast::Expression* Parser::parseRelationalExpression() {
-  ast::Expression* expr = parseShiftExpression();
-  while (check(TokenType::Greater) || check(TokenType::Less) ||
-        check(TokenType::GreaterEqual) || check(TokenType::LessEqual)) {
-    Token tk = advance();
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = tk.type() == TokenType::Greater ? ast::Operator::Greater :
-             tk.type() == TokenType::Less ? ast::Operator::Less :
-             tk.type() == TokenType::GreaterEqual ? ast::Operator::GreaterEqual :
-             ast::Operator::LessEqual;
-    op->left = expr;
-    op->right = parseShiftExpression();
-    expr = op;
-  }
-  return expr;
-}
-
-ast::Expression* Parser::parseShiftExpression() {
-  ast::Expression* expr = parseAdditiveExpression();
-  while (check(TokenType::GreaterGreater) || check(TokenType::LessLess)) {
-    Token tk = advance();
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = tk.type() == TokenType::GreaterGreater ? ast::Operator::RightShift :
-             ast::Operator::LeftShift;
-    op->left = expr;
-    op->right = parseAdditiveExpression();
-    expr = op;
-  }
-  return expr;
-}
-
-ast::Expression* Parser::parseAdditiveExpression() {
-  ast::Expression* expr = parseMultiplicativeExpression();
-  while (check(TokenType::Plus) || check(TokenType::Minus)) {
-    Token tk = advance();
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = tk.type() == TokenType::Plus ? ast::Operator::Add : ast::Operator::Subtract;
-    op->left = expr;
-    op->right = parseMultiplicativeExpression();
+  if (match(TokenType::Question)) {
+    // Ternary conditional expression (a ? b : c). It binds more loosely than any binary operator,
+    // so the condition is the whole binary expression before the '?'.
+    if (!enterNesting()) {
+      return nullptr;
+    }
+    ast::TernaryExpr* op = createNode<ast::TernaryExpr>(startOffset(expr));
+    op->condition = expr;
+    op->trueExpr = parseExpression();
+    consume(TokenType::Colon, "Expected ':' after ternary expression");
+    op->falseExpr = parseExpression();
+    leaveNesting();
     expr = op;
   }
   return expr;
 }
 
-ast::Expression* Parser::parseMultiplicativeExpression() {
-  ast::Expression* expr = parsePrefixExpression();
-  while (check(TokenType::Star) || check(TokenType::Slash) || check(TokenType::Percent) ||
-      check(TokenType::PlusPlus) || check(TokenType::MinusMinus)) {
-    Token tk = advance();
-    ast::BinaryExpr* op = _ast->createNode<ast::BinaryExpr>();
-    op->op = tk.type() == TokenType::Star ? ast::Operator::Multiply :
-             tk.type() == TokenType::Slash ? ast::Operator::Divide : ast::Operator::Modulo;
-    op->left = expr;
-    op->right = parsePrefixExpression();
-    expr = op;
+void Parser::reduceBinaryOperators(size_t operatorBase, int minPrecedence) {
+  while (_operators.size() > operatorBase && _operators.back().precedence >= minPrecedence) {
+    const PendingOperator& pending = _operators.back();
+    ast::BinaryExpr* op = createNode<ast::BinaryExpr>(pending.offset);
+    op->op = pending.op;
+    op->right = _operands.back();
+    _operands.pop_back();
+    op->left = _operands.back();
+    _operands.back() = op;
+    _operators.pop_back();
   }
-  return expr;
 }
 
 ast::Expression* Parser::parsePrefixExpression() {
-  if (check(TokenType::Minus) || check(TokenType::Bang) || check(TokenType::Tilde) ||
-      check(TokenType::PlusPlus) || check(TokenType::MinusMinus)) {
+  // Chain the prefix operators as they're consumed, so a long run of them doesn't recurse.
+  ast::PrefixExpr* first = nullptr;
+  ast::PrefixExpr* last = nullptr;
+  while (check(TokenType::Minus) || check(TokenType::Bang) || check(TokenType::Tilde) ||
+         check(TokenType::PlusPlus) || check(TokenType::MinusMinus)) {
     Token tk = advance();
-    ast::PrefixExpr* op = _ast->createNode<ast::PrefixExpr>();
+    ast::PrefixExpr* op = createNode<ast::PrefixExpr>();
     op->op = tk.type() == TokenType::Minus ? ast::Operator::Subtract :
              tk.type() == TokenType::Bang ? ast::Operator::Not :
              tk.type() == TokenType::Tilde ? ast::Operator::BitNot :
              tk.type() == TokenType::PlusPlus ? ast::Operator::PlusPlus :
              ast::Operator::MinusMinus;
-    op->expression = parsePrefixExpression();
-    return op;
+    if (last == nullptr) {
+      first = op;
+    } else {
+      last->expression = op;
+    }
+    last = op;
+  }
+  if (last == nullptr) {
+    return parseSingularExpression();
   }
-  return parseSingularExpression();
+  last->expression = parseSingularExpression();
+  return first;
 }
 
 ast::Expression* Parser::parseSingularExpression() {
+  if (!enterNesting()) {
+    return nullptr;
+  }
   ast::Expression* expr = parsePrimaryExpression();
   expr = parsePostfixExpression(expr);
-
-  if (match(TokenType::Question)) {
-    // Ternary conditional expression (a ? b : c)
-    ast::TernaryExpr* op = _ast->createNode<ast::TernaryExpr>();
-    op->condition = expr;
-    op->trueExpr = parseExpression();
-    consume(TokenType::Colon, "Expected ':' after ternary expression");
-    op->falseExpr = parseExpression();
-    expr = op;
-  }
-
+  leaveNesting();
   return expr;
 }
 
 ast::Expression* Parser::parsePostfixExpression(ast::Expression* expr) {
   // ++, --, [], .
-  if (check(TokenType::PlusPlus) || check(TokenType::MinusMinus)) {
-    Token tk = advance();
-    ast::IncrementExpr* op = _ast->createNode<ast::IncrementExpr>();
-    op->op = tk.type() == TokenType::PlusPlus ? ast::Operator::PlusPlus : ast::Operator::MinusMinus;
-    op->variable = expr;
-    return parsePostfixExpression(op);
-  }
-
-  if (match(TokenType::LeftBracket)) {
-    ast::Expression* index = parseExpression();
-    consume(TokenType::RightBracket, "Expected ']' after expression");
-    ast::ArrayExpr* array = _ast->createNode<ast::ArrayExpr>();
-    array->array = expr;
-    array->index = index;
-    return parsePostfixExpression(array);
-  }
-
-  if (match(TokenType::Dot)) {
-    ast::MemberExpr* member = _ast->createNode<ast::MemberExpr>();
-    member->object = expr;
-    member->member = parseSingularExpression();   
-    return parsePostfixExpression(member);
+  while (true) {
+    if (check(TokenType::PlusPlus) || check(TokenType::MinusMinus)) {
+      Token tk = advance();
+      ast::IncrementExpr* op = createNode<ast::IncrementExpr>(startOffset(expr));
+      op->op = tk.type() == TokenType::PlusPlus ? ast::Operator::PlusPlus
+                                                : ast::Operator::MinusMinus;
+      op->variable = expr;
+      expr = op;
+    } else if (match(TokenType::LeftBracket)) {
+      ast::Expression* index = parseExpression();
+      consume(TokenType::RightBracket, "Expected ']' after expression");
+      ast::ArrayExpr* array = createNode<ast::ArrayExpr>(startOffset(expr));
+      array->array = expr;
+      array->index = index;
+      expr = array;
+    } else if (match(TokenType::Dot)) {
+      ast::MemberExpr* member = createNode<ast::MemberExpr>(startOffset(expr));
+      member->object = expr;
+      member->member = parseSingularExpression();
+      if (member->member == nullptr) {
+        error(peekNext(), "Expected member name after '.'");
+        return member;
+      }
+      expr = member;
+    } else {
+      return expr;
+    }
   }
-
-  return expr;
 }
 
 ast::Expression* Parser::parsePrimaryExpression() {
@@ -1095,13 +1215,14 @@ ast::Expression* Parser::parsePrimaryExpression() {
     // An identifier is either a variable or a function call
     Token name = advance();
     if (check(TokenType::LeftParen)) {
-      ast::CallExpr* expr = _ast->createNode<ast::CallExpr>();
+      ast::CallExpr* expr = createNode<ast::CallExpr>();
       expr->name = name.lexeme();
+      expr->intrinsic = ast::findIntrinsic(expr->name);
       expr->arguments = parseArgumentList();
       return expr;
     }
 
-    ast::VariableExpr* expr = _ast->createNode<ast::VariableExpr>();
+    ast::VariableExpr* expr = createNode<ast::VariableExpr>();
     expr->name = name.lexeme();
     return expr;
   }
@@ -1109,16 +1230,28 @@ ast::Expression* Parser::parsePrimaryExpression() {
   if (check(TokenType::IntLiteral) || check(TokenType::FloatLiteral) || check(TokenType::True) ||
       check(TokenType::False)) {
     Token tk = advance();
-    ast::LiteralExpr* expr = _ast->createNode<ast::LiteralExpr>();
-    expr->type = tokenTypeToBaseType(tk.type());
+    ast::LiteralExpr* expr = createNode<ast::LiteralExpr>();
     expr->value = tk.lexeme();
+    if (tk.type() == TokenType::True || tk.type() == TokenType::False) {
+      expr->type = ast::BaseType::Bool;
+      expr->intValue = tk.type() == TokenType::True ? 1 : 0;
+    } else {
+      // The number is decoded once here, so the passes that need its value don't parse the text.
+      const LiteralValue literal = decodeLiteral(tk.lexeme());
+      expr->type = literal.type;
+      if (literal.tokenType == TokenType::FloatLiteral) {
+        expr->floatValue = literal.floatValue;
+      } else {
+        expr->intValue = literal.intValue;
+      }
+    }
     return expr;
   }
 
   if (check(TokenType::LeftParen)) {
     // Either a parenthesized expression or a cast expression
     startRestorePoint();
-    advance(); // consume '('
+    const uint32_t start = advance().offset(); // consume '('
     if (isType(peekNext())) {
       advance();
       if (check(TokenType::RightParen)) {
@@ -1130,7 +1263,7 @@ ast::Expression* Parser::parsePrimaryExpression() {
         consume(TokenType::RightParen, "Expected ')' after type");
 
         ast::Expression* valueExpr = parseSingularExpression();
-        ast::CastExpr* expr = _ast->createNode<ast::CastExpr>();
+        ast::CastExpr* expr = createNode<ast::CastExpr>(start);
         expr->type = type;
         expr->value = valueExpr;
         return expr;
@@ -1144,7 +1277,7 @@ ast::Expression* Parser::parsePrimaryExpression() {
   Token tk = peekNext();
   // float(x) is a cast expression
   if (isType(tk)) {
-    ast::CastExpr* expr = _ast->createNode<ast::CastExpr>();
+    ast::CastExpr* expr = createNode<ast::CastExpr>(tk.offset());
     expr->type = parseType(false, "Invalid type");
     consume(TokenType::LeftParen, "Expected '(' after type");
     expr->value = parseExpressionList();
@@ -1167,7 +1300,7 @@ ast::Expression* Parser::parsePrimaryExpression() {
       valueExpr = parseSingularExpression();
     }
 
-    ast::CastExpr* expr = _ast->createNode<ast::CastExpr>();
+    ast::CastExpr* expr = createNode<ast::CastExpr>(tk.offset());
     expr->type = type;
     expr->value = valueExpr;
 
@@ -1179,21 +1312,25 @@ ast::Expression* Parser::parsePrimaryExpression() {
 
 ast::Expression* Parser::parseParenthesizedExpression() {
   consume(TokenType::LeftParen, "Expected '(' after expression");
-  ast::Expression* expr = parseLogicalOrExpression();
+  ast::Expression* expr = parseBinaryExpression();
   consume(TokenType::RightParen, "Expected ')' after expression");
   return expr;
 }
 
 ast::Expression* Parser::parseArgumentList() {
   consume(TokenType::LeftParen, "Expected '(' after function name");
-  ast::Expression* firstExpr = parseLogicalOrExpression();
+  ast::Expression* firstExpr = parseBinaryExpression();
   ast::Expression* lastExpr = firstExpr;
   while (match(TokenType::Comma)) {
     if (check(TokenType::RightParen)) {
       // trailing comma
       break;
     }
-    ast::Expression* expr = parseLogicalOrExpression();
+    ast::Expression* expr = parseBinaryExpression();
+    if (lastExpr == nullptr || expr == nullptr) {
+      error(peekNext(), "Expected argument");
+      break;
+    }
     lastExpr->next = expr;
     lastExpr = expr;
   }
@@ -1202,7 +1339,7 @@ ast::Expression* Parser::parseArgumentList() {
 }
 
 ast::FunctionStmt* Parser::parseFunctionStmt(ast::Type* returnType, const std::string_view& name) {
-  ast::FunctionStmt* func = _ast->createNode<ast::FunctionStmt>();
+  ast::FunctionStmt* func = createNode<ast::FunctionStmt>(startOffset(returnType));
   func->returnType = returnType;
   func->name = name;
   func->parameters = parseParameterList();
@@ -1211,7 +1348,10 @@ ast::FunctionStmt* Parser::parseFunctionStmt(ast::Type* returnType, const std::s
     func->semantic = advance().lexeme();
   }
 
+  ast::FunctionStmt* enclosingFunction = _ast->currentFunction();
+  _ast->setCurrentFunction(func);
   func->body = parseBlock();
+  _ast->setCurrentFunction(enclosingFunction);
   return func;
 }
 
@@ -1238,7 +1378,7 @@ ast::Parameter* Parser::parseParameterList() {
 }
 
 ast::Parameter* Parser::parseParameter() {
-  ast::Parameter* param = _ast->createNode<ast::Parameter>();
+  ast::Parameter* param = createNode<ast::Parameter>(peekNext().offset());
   param->type = parseType(false, "Expected parameter type");
   param->name = consume(TokenType::Identifier, "Expected parameter name").lexeme();
 
@@ -1258,9 +1398,19 @@ ast::Parameter* Parser::parseParameter() {
   return param;
 }
 
+void Parser::parseRegister(std::string_view& registerName, std::string_view& registerSpace) {
+  consume(TokenType::Register, "register expected");
+  consume(TokenType::LeftParen, "'(' expected");
+  registerName = consume(TokenType::Identifier, "register name expected").lexeme();
+  if (match(TokenType::Comma)) {
+    registerSpace = consume(TokenType::Identifier, "register space expected").lexeme();
+  }
+  consume(TokenType::RightParen, "')' expected");
+}
+
 ast::VariableStmt* Parser::parseVariableStmt(ast::Type* type, const std::string_view& name,
                                            ast::Attribute* attributes) {
-  ast::VariableStmt* var = _ast->createNode<ast::VariableStmt>();
+  ast::VariableStmt* var = createNode<ast::VariableStmt>(startOffset(type));
   var->type = type;
   var->name = name;
   var->attributes = attributes;
@@ -1269,13 +1419,21 @@ ast::VariableStmt* Parser::parseVariableStmt(ast::Type* type, const std::string_
   // Parse array dimensions (int a[1][2])
   while (match(TokenType::LeftBracket)) {
     var->isArray = true;
+    ast::Expression* size = parseArraySize();
+    if (size == nullptr) {
+      continue;
+    }
     if (var->arraySize == nullptr) {
-      var->arraySize = parseArraySize();
-      lastArraySize = var->arraySize;
+      var->arraySize = size;
     } else {
-      lastArraySize->next = parseArraySize();
-      lastArraySize = (ast::LiteralExpr*)lastArraySize->next;
+      lastArraySize->next = size;
     }
+    lastArraySize = size;
+  }
+
+  // Parse the register of a resource (Texture2D t : register(t0, space1))
+  if (match(TokenType::Colon)) {
+    parseRegister(var->registerName, var->registerSpace);
   }
 
   // Parse variable initializer (int a = 1)
@@ -1289,7 +1447,7 @@ ast::VariableStmt* Parser::parseVariableStmt(ast::Type* type, const std::string_
   // Parse multiple variable declarations (a = b, c = d)
   while (match(TokenType::Comma) && !isAtEnd()) {
     std::string_view name = consume(TokenType::Identifier, "Expected variable name").lexeme();
-    ast::VariableStmt* next = _ast->createNode<ast::VariableStmt>();
+    ast::VariableStmt* next = createNode<ast::VariableStmt>();
     next->type = type;
     next->name = name;
     next->attributes = attributes;
@@ -1299,8 +1457,12 @@ ast::VariableStmt* Parser::parseVariableStmt(ast::Type* type, const std::string_
       next->arraySize = parseArraySize();
     }
 
+    if (match(TokenType::Colon)) {
+      parseRegister(next->registerName, next->registerSpace);
+    }
+
     if (match(TokenType::Equal)) {
-      next->initializer = parseLogicalOrExpression();
+      next->initializer = parseBinaryExpression();
     }
 
     _variables[next->name] = next;
@@ -1313,57 +1475,62 @@ ast::VariableStmt* Parser::parseVariableStmt(ast::Type* type, const std::string_
   return firstVar;
 }
 
+namespace {
+
+// Evaluates array sizes as they're parsed, before visitor::ResolveSymbols has set the
+// declarations of the variables, by looking their names up in the variables parsed so far. A
+// global that is const but not static is taken as constant, as it always has been for array
+// sizes.
+class ArraySizeEvaluator : public ast::ConstantEvaluator {
+public:
+  ArraySizeEvaluator(ast::Ast* ast,
+                     const std::map<std::string_view, ast::VariableStmt*>& variables)
+      : ConstantEvaluator(ast)
+      , _variables(variables) {}
+
+protected:
+  ast::VariableStmt* constantVariable(const ast::VariableExpr* expr) override {
+    auto var = _variables.find(expr->name);
+    if (var == _variables.end() || var->second == nullptr || var->second->type == nullptr ||
+        !var->second->type->isConst()) {
+      return nullptr;
+    }
+    return var->second;
+  }
+
+private:
+  const std::map<std::string_view, ast::VariableStmt*>& _variables;
+};
+
+} // namespace
+
 ast::Expression* Parser::parseArraySize() {
-  ast::Expression* firstSize = nullptr;
-  // Array declaration (int a[10])
-  Token next = peekNext();
-  if (next.type() == TokenType::Identifier) {
+  // Array declaration (int a[10]), whose size can be any constant int expression, such as
+  // int a[SIZE * 2]. An array whose size comes from its initializer (int a[] = {1, 2}) has none.
+  if (check(TokenType::RightBracket)) {
     advance();
-    auto var = _variables.find(next.lexeme());
-    if (var == _variables.end()) {
-      throw ParseException(next, "Unknown variable");
-    }
-    ast::VariableStmt* varStmt = var->second;
-    if (!varStmt->type->isConst() || varStmt->type->baseType != ast::BaseType::Int) {
-      throw ParseException(next, "Expected const int");
-    }
-    if (varStmt->initializer == nullptr ||
-        varStmt->initializer->nodeType != ast::NodeType::LiteralExpr) {
-      throw ParseException(next, "Expected const int");
-    }
-    ast::LiteralExpr* size = (ast::LiteralExpr*)varStmt->initializer;
-    /*if (size->type != ast::BaseType::Int) {
-      throw ParseException(next, "Expected const int");
-    }*/
-
-    firstSize = size;
-  } else if (next.type() == TokenType::IntLiteral) {
-    ast::Expression* size = parseExpression();
-    firstSize = size;
-
-    /*Token count = advance();
-    ast::LiteralExpr* size = _ast->createNode<ast::LiteralExpr>();
-    size->type = ast::BaseType::Int;
-    size->value = count.lexeme();
-    firstSize = size;*/
-
-    // This isn't needed if HLSL doesn't support multi-dimensional arrays declared as [10, 20].
-    /*while (match(TokenType::Comma) && !isAtEnd()) {
-      Token count = consume(TokenType::IntLiteral, "Expected array size");
-      ast::LiteralExpr* nextSize = _ast->createNode<ast::LiteralExpr>();
-      nextSize->value = count.lexeme();
-      size->next = nextSize;
-      size = nextSize;
-    }*/
+    return nullptr;
+  }
+  Token next = peekNext();
+  ast::Expression* size = parseExpression();
+  if (size == nullptr) {
+    error(next, "Expected array size");
+    return nullptr;
+  }
+  // The value is cached on the expression, so later passes don't need to evaluate it again.
+  const ast::ConstantValue& value = ArraySizeEvaluator(_ast, _variables).evaluate(size);
+  if (!value.isScalar() || !value.isInteger() || value.asFloat() < 1.0f) {
+    error(next, "Expected const int");
+    return nullptr;
   }
 
   consume(TokenType::RightBracket, "Expected ']' for array declaration");
-  return firstSize;
+  return size;
 }
 
 // Parse a block of statements enclosed in braces
 ast::Block* Parser::parseBlock() {
-  ast::Block* block = _ast->createNode<ast::Block>();
+  ast::Block* block = createNode<ast::Block>(peekNext().offset());
 
   if (check(TokenType::Semicolon)) {
     // We have a function forward declaration.  Just eat the
@@ -1379,25 +1546,41 @@ ast::Block* Parser::parseBlock() {
     return block;
   }
 
-  block->statements = parseStatement();
-  if (block->statements == nullptr) {
-    consume(TokenType::RightBrace, "Expected '}' after block");
+  if (!enterNesting()) {
     return block;
   }
 
-  ast::Statement* lastStmt = block->statements;
+  const int braceDepth = _braceDepth;
+  const size_t restoreDepth = _restore.size();
+
+  ast::Statement* lastStmt = nullptr;
   while (!check(TokenType::RightBrace) && !isAtEnd()) {
+    const size_t nodeMark = _ast->nodeIndexMark();
     ast::Statement* stmt = parseStatement();
-    if (stmt == nullptr) {
-      throw ParseException(peekNext(), "Expected statement");
+    if (stmt == nullptr && !_panicMode) {
+      error(peekNext(), "Expected statement");
+    }
+    if (_panicMode) {
+      // Drop the statement that failed and resume with the next statement in the block.
+      synchronize(braceDepth, restoreDepth, nodeMark);
+      continue;
     }
     if (stmt->nodeType == ast::NodeType::EmptyStmt) {
       continue;
     }
-    lastStmt->next = stmt;
+    if (lastStmt == nullptr) {
+      block->statements = stmt;
+    } else {
+      lastStmt->next = stmt;
+    }
     lastStmt = stmt;
+    // A declaration such as float a, b; is a list of statements, continue from the last one.
+    while (lastStmt->next != nullptr) {
+      lastStmt = lastStmt->next;
+    }
   }
 
+  leaveNesting();
   consume(TokenType::RightBrace, "Expected '}' after block");
   return block;
 }
@@ -1411,6 +1594,8 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
     return &ast::EmptyStatement::instance;
   }
 
+  const size_t nodeMark = _ast->nodeIndexMark();
+
   // Attributes are really only for top-level statements, but checking for
   // them in all cases until we pass in something to let us know this is
   // a top-level statement.
@@ -1456,7 +1641,7 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
   }
 
   if (match(TokenType::Return)) {
-    ast::ReturnStmt* stmt = _ast->createNode<ast::ReturnStmt>();
+    ast::ReturnStmt* stmt = createNode<ast::ReturnStmt>();
     stmt->attributes = attributes;
 
     if (check(TokenType::Semicolon)) {
@@ -1470,9 +1655,10 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
       advance(); // consume the assignment operator
       ast::Expression* value = parseExpression();
       if (value == nullptr) {
-        throw ParseException(assignmentOp, "Expected expression after assignment operator");
+        error(assignmentOp, "Expected expression after assignment operator");
+        return nullptr;
       }
-      ast::AssignmentExpr* assign = _ast->createNode<ast::AssignmentExpr>();
+      ast::AssignmentExpr* assign = createNode<ast::AssignmentExpr>(startOffset(stmt->value));
       assign->op = tokenTypeToAssignmentOperatator(assignmentOp.type());
       assign->variable = stmt->value;
       assign->value = value;
@@ -1487,7 +1673,7 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
   }
 
   if (match(TokenType::Break)) {
-    ast::BreakStmt* stmt = _ast->createNode<ast::BreakStmt>();
+    ast::BreakStmt* stmt = createNode<ast::BreakStmt>();
     stmt->attributes = attributes;
     if (expectSemicolon) {
       consume(TokenType::Semicolon, "Expected ';' after 'break'");
@@ -1496,7 +1682,7 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
   }
 
   if (match(TokenType::Continue)) {
-    ast::ContinueStmt* stmt = _ast->createNode<ast::ContinueStmt>();
+    ast::ContinueStmt* stmt = createNode<ast::ContinueStmt>();
     stmt->attributes = attributes;
     if (expectSemicolon) {
       consume(TokenType::Semicolon, "Expected ';' after 'continue'");
@@ -1505,7 +1691,7 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
   }
 
   if (match(TokenType::Discard)) {
-    ast::DiscardStmt* stmt = _ast->createNode<ast::DiscardStmt>();
+    ast::DiscardStmt* stmt = createNode<ast::DiscardStmt>();
     stmt->attributes = attributes;
     if (expectSemicolon) {
       consume(TokenType::Semicolon, "Expected ';' after 'discard'");
@@ -1518,8 +1704,9 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
   if (check(TokenType::Identifier)) {
     Token name = advance();
     if (check(TokenType::LeftParen)) {
-      ast::CallStmt* call = _ast->createNode<ast::CallStmt>();
+      ast::CallStmt* call = createNode<ast::CallStmt>();
       call->name = name.lexeme();
+      call->intrinsic = ast::findIntrinsic(call->name);
       call->arguments = parseArgumentList();
       call->attributes = attributes;
       if (expectSemicolon) {
@@ -1528,7 +1715,7 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
       return call;
     }
 
-    pushBack(name);
+    pushBack();
   }
 
   ast::Type* type = parseType(false);
@@ -1558,14 +1745,15 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
     }
 
     if (!isUnderscore && var == nullptr) {
-      throw ParseException(peekNext(), "Expected variable name");
+      error(peekNext(), "Expected variable name");
+      return nullptr;
     }
 
     Token tk = advance();
 
     if (tk.type() == TokenType::Semicolon) {
       // We're done here, the "assignment" was actually a method call.
-      ast::ExpressionStmt* stmt = _ast->createNode<ast::ExpressionStmt>();
+      ast::ExpressionStmt* stmt = createNode<ast::ExpressionStmt>(startOffset(var));
       stmt->expression = var;
       stmt->attributes = attributes;
       discardRestorePoint();
@@ -1574,7 +1762,7 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
 
     ast::Operator op = tokenTypeToAssignmentOperatator(tk.type());
     if (op != ast::Operator::Undefined) {
-      ast::AssignmentStmt* stmt = _ast->createNode<ast::AssignmentStmt>();
+      ast::AssignmentStmt* stmt = createNode<ast::AssignmentStmt>(startOffset(var));
       stmt->variable = var;
       stmt->op = op;
       stmt->value = parseAssignmentExpression(type);
@@ -1596,14 +1784,11 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
     restorePoint();
   }
 
-  try {
-    ast::Expression* expr = parseExpression();
-    if (expr != nullptr) {
-      ast::ExpressionStmt* exprStmt = _ast->createNode<ast::ExpressionStmt>();
-      exprStmt->expression = expr;
-      stmt = exprStmt;
-    }
-  } catch (ParseException& e) {
+  ast::Expression* expr = parseExpression();
+  if (expr != nullptr && !_panicMode) {
+    ast::ExpressionStmt* exprStmt = createNode<ast::ExpressionStmt>(expr->offset);
+    exprStmt->expression = expr;
+    stmt = exprStmt;
   }
 
   if (stmt != nullptr) {
@@ -1620,11 +1805,25 @@ ast::Statement* Parser::parseStatement(bool expectSemicolon) {
     return stmt;
   }
 
+  // There's no statement, so drop any attributes parsed for it.
+  _ast->rollbackNodeIndex(nodeMark);
   return nullptr;
 }
 
+ast::Statement* Parser::parseBodyStatement(const char* message) {
+  if (!enterNesting()) {
+    return nullptr;
+  }
+  ast::Statement* stmt = parseStatement();
+  leaveNesting();
+  if (stmt == nullptr) {
+    error(peekNext(), message);
+  }
+  return stmt;
+}
+
 ast::IfStmt* Parser::parseIfStmt() {
-  ast::IfStmt* stmt = _ast->createNode<ast::IfStmt>();
+  ast::IfStmt* stmt = createNode<ast::IfStmt>();
 
   consume(TokenType::LeftParen, "Expected '(' after 'if'");
 
@@ -1632,17 +1831,17 @@ ast::IfStmt* Parser::parseIfStmt() {
 
   consume(TokenType::RightParen, "Expected ')' after 'if' condition");
 
-  stmt->body = parseStatement();
+  stmt->body = parseBodyStatement("Expected statement after 'if' condition");
 
   if (match(TokenType::Else)) {
-    stmt->elseBody = parseStatement();
+    stmt->elseBody = parseBodyStatement("Expected statement after 'else'");
   }
 
   return stmt;
 }
 
 ast::SwitchStmt* Parser::parseSwitchStmt() {
-  ast::SwitchStmt* switchStmt = _ast->createNode<ast::SwitchStmt>();
+  ast::SwitchStmt* switchStmt = createNode<ast::SwitchStmt>();
   
   consume(TokenType::LeftParen, "Expected '(' after 'switch'");
   switchStmt->condition = parseExpression();
@@ -1652,7 +1851,7 @@ ast::SwitchStmt* Parser::parseSwitchStmt() {
   
   ast::SwitchCase* lastCase = nullptr;
   while (!match(TokenType::RightBrace) && !isAtEnd()) {
-    ast::SwitchCase* caseStmt = _ast->createNode<ast::SwitchCase>();
+    ast::SwitchCase* caseStmt = createNode<ast::SwitchCase>();
 
     if (match(TokenType::Case)) {      
       caseStmt->isDefault = false;
@@ -1660,15 +1859,16 @@ ast::SwitchStmt* Parser::parseSwitchStmt() {
     } else if (match(TokenType::Default)) {
       caseStmt->isDefault = true;
     } else {
-      throw ParseException(peekNext(), "Expected 'case' or 'default' in switch statement");
+      error(peekNext(), "Expected 'case' or 'default' in switch statement");
+      break;
     }
 
     if (switchStmt->cases == nullptr) {
-      lastCase = caseStmt;
       switchStmt->cases = caseStmt;
     } else {
       lastCase->next = caseStmt;
     }
+    lastCase = caseStmt;
 
     consume(TokenType::Colon, "Expected ':' after 'case' or 'default'");
 
@@ -1676,15 +1876,22 @@ ast::SwitchStmt* Parser::parseSwitchStmt() {
     ast::Statement* lastStatement = nullptr;
 
     Token next = peekNext();
-    while (next.type() != TokenType::Case && next.type() != TokenType::Default && next.type() != TokenType::RightBrace) {
+    while (next.type() != TokenType::Case && next.type() != TokenType::Default &&
+           next.type() != TokenType::RightBrace && !isAtEnd()) {
       ast::Statement* caseBodyStmt = parseStatement();
-      if (caseBodyStmt != nullptr) {
+      if (caseBodyStmt == nullptr) {
+        break;
+      }
+      if (caseBodyStmt->nodeType != ast::NodeType::EmptyStmt) {
         if (firstStatement == nullptr) {
           firstStatement = caseBodyStmt;
         } else {
           lastStatement->next = caseBodyStmt;
         }
         lastStatement = caseBodyStmt;
+        while (lastStatement->next != nullptr) {
+          lastStatement = lastStatement->next;
+        }
       }
       if (caseBodyStmt->nodeType == ast::NodeType::BreakStmt || caseBodyStmt->nodeType == ast::NodeType::ReturnStmt) {
         break;
@@ -1698,7 +1905,7 @@ ast::SwitchStmt* Parser::parseSwitchStmt() {
 }
 
 ast::ForStmt* Parser::parseForStmt() {
-  ast::ForStmt* stmt = _ast->createNode<ast::ForStmt>();
+  ast::ForStmt* stmt = createNode<ast::ForStmt>();
 
   consume(TokenType::LeftParen, "Expected '(' after 'for'");
   if (!check(TokenType::Semicolon)) {
@@ -1714,20 +1921,20 @@ ast::ForStmt* Parser::parseForStmt() {
   if (!check(TokenType::RightParen)) {
     stmt->increment = parseStatement(false);
     ast::Statement* next = stmt->increment;
-    while (match(TokenType::Comma)) {
+    while (next != nullptr && match(TokenType::Comma)) {
       next->next = parseStatement(false);
       next = next->next;
     }
   }
   consume(TokenType::RightParen, "Expected ')' after 'for' increment");
 
-  stmt->body = parseStatement();
+  stmt->body = parseBodyStatement("Expected statement after 'for'");
 
   return stmt;
 }
 
 ast::DoWhileStmt* Parser::parseDoWhileStmt() {
-  ast::DoWhileStmt* stmt = _ast->createNode<ast::DoWhileStmt>();
+  ast::DoWhileStmt* stmt = createNode<ast::DoWhileStmt>();
 
   stmt->body = parseBlock();
 
@@ -1740,11 +1947,11 @@ ast::DoWhileStmt* Parser::parseDoWhileStmt() {
 }
 
 ast::WhileStmt* Parser::parseWhileStmt() {
-  ast::WhileStmt* stmt = _ast->createNode<ast::WhileStmt>();
+  ast::WhileStmt* stmt = createNode<ast::WhileStmt>();
   consume(TokenType::LeftParen, "Expected '(' after 'while'");
   stmt->condition = parseExpression();
   consume(TokenType::RightParen, "Expected ')' after 'while' condition");
-  stmt->body = parseStatement();
+  stmt->body = parseBodyStatement("Expected statement after 'while' condition");
   return stmt;
 }
 
@@ -1,11 +1,14 @@
 #pragma once
 
-#include <list>
 #include <map>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "../../ast/ast.h"
 #include "../../ast/base_type.h"
+#include "diagnostic.h"
+#include "parse_stats.h"
 #include "scanner.h"
 #include "token.h"
 #include "token_to_ast.h"
@@ -17,6 +20,10 @@ namespace hlsl {
 /// This is a recursive descent parser, which means that each method is responsible for parsing
 /// a single grammar rule. HLSL does not have a formal specification defining its grammar,
 /// so the grammar rules are based on the HLSL documentation.
+///
+/// Errors don't abort the parse. They are recorded as Diagnostics, and the parser skips ahead to
+/// the next ';' or '}' at the depth of the statement that failed and continues from there, so a
+/// single bad construct only drops that statement from the resulting Ast.
 class Parser {
 public:
   /// Construct a new Parser object for the given source.
@@ -26,12 +33,65 @@ public:
   Parser(const std::string_view& source);
 
   /// Parse the source string and return the resulting Ast object.
+  /// The Ast is returned even if there were errors, containing the statements that were parsed
+  /// successfully. Check hasErrors() or diagnostics() for the errors found.
   /// @return ast::* The resulting Ast object.
   ast::Ast* parse();
 
   const std::string_view& source() { return _scanner.source(); }
 
+  /// The errors found by the last parse.
+  const std::vector<Diagnostic>& diagnostics() const { return _diagnostics; }
+
+  /// Returns true if the last parse found any errors.
+  bool hasErrors() const { return !_diagnostics.empty(); }
+
+  /// The instrumentation stats of the last parse. These are all zero if HLSL_REFLECT_STATS is
+  /// disabled.
+  const ParseStats& stats() const { return _stats; }
+
+  /// The default for setMaxDepth().
+  static const int defaultMaxDepth = 256;
+
+  /// Set how deeply expressions, initializers and statements may nest before the parser reports
+  /// an error instead of parsing further, as each level of nesting recurses. Chains of binary
+  /// operators and prefix operators don't count towards the depth, as they're parsed without
+  /// recursion.
+  void setMaxDepth(int depth) { _maxDepth = depth; }
+
+  int maxDepth() const { return _maxDepth; }
+
+  /// Set whether the Ast records the nodes of each type and the calls made by each function as
+  /// they're parsed, as with ast::Ast::setIndexNodes(). It's off by default.
+  void setIndexNodes(bool enable) { _indexNodes = enable; }
+
 private:
+  friend class ParallelParser;
+
+  // Construct a parser for a list of tokens that have already been scanned, such as a single
+  // top-level statement split out by the ParallelParser. The end of the tokens is reported at
+  // endOffset, the offset of the token that follows them or the size of the source, so errors
+  // at the end have the location they would have when parsing the whole source.
+  Parser(std::vector<Token>::const_iterator begin, std::vector<Token>::const_iterator end,
+         uint32_t endOffset);
+
+  // Parse top-level statements until the end of the input, returning the first statement of
+  // the resulting linked list.
+  ast::Statement* parseTopLevelStatements();
+
+  // Record an error at the given token and enter panic mode. While in panic mode the parser
+  // acts as if it's at the end of the input, so every rule returns without consuming more
+  // tokens until synchronize() is called by the enclosing statement loop.
+  void error(const Token& token, const std::string& message);
+
+  // Leave panic mode, skipping tokens until the end of the statement that failed: a ';' or
+  // '}' at the given brace depth. A '}' that closes the enclosing block is not consumed.
+  // @param braceDepth The brace depth of the statement loop that is recovering.
+  // @param restoreDepth The number of restore points that were open when the statement started.
+  // @param nodeMark The Ast node index mark taken when the statement started, so the nodes of the
+  // dropped statement are removed from the index.
+  void synchronize(int braceDepth, size_t restoreDepth, size_t nodeMark);
+
   // Returns true if the current token is at the end of the source.
   bool isAtEnd();
 
@@ -58,16 +118,44 @@ private:
   // @return true if the next token is the given type.
   bool check(TokenType type);
 
-  /// Push a token back onto the front of the pending token list.
-  void pushBack(const Token& token) {
-    _pending.push_front(token);
+  // Enter a level of nesting, reporting an error and returning false if that would exceed the
+  // maximum depth. Each call that returns true must be paired with a call to leaveNesting().
+  bool enterNesting();
+
+  void leaveNesting() { _depth--; }
+
+  // Create a node in the Ast, located at the given source offset.
+  template<typename T>
+  T* createNode(uint32_t offset) {
+    T* node = _ast->createNode<T>();
+    node->offset = offset;
+    return node;
+  }
+
+  // Create a node in the Ast, located at the last token consumed. Nodes created before their
+  // first token is consumed, or after their first child, should pass the offset explicitly.
+  template<typename T>
+  T* createNode() {
+    return createNode<T>(_lastOffset);
+  }
+
+  // The start offset of a node that may be null, such as a child expression.
+  uint32_t startOffset(const ast::Node* node) const {
+    return node != nullptr ? node->offset : _lastOffset;
+  }
+
+  /// Return the last token consumed to the input, so it's the next token again.
+  void pushBack() {
+    _position--;
   }
 
   ast::Statement* parseTopLevelStatement();
 
   ast::StructStmt* parseStruct();
 
-  ast::Field* parseStructField();
+  // Parse a struct field. If the field is the return type and name of a method, no Field is
+  // created, they're returned through type and name, and the result is null.
+  ast::Field* parseStructField(ast::Type*& type, std::string_view& name);
 
   ast::Attribute* parseAttributes();
 
@@ -81,6 +169,9 @@ private:
 
   ast::BufferStmt* parseBuffer();
 
+  // Parse register(t0) or register(t0, space1), after the ':' of a global declaration.
+  void parseRegister(std::string_view& registerName, std::string_view& registerSpace);
+
   ast::Type* parseType(bool allowVoid, const char* exceptionMessage = nullptr);
 
   bool parseTypeModifier(uint32_t& flags);
@@ -97,25 +188,14 @@ private:
 
   ast::Expression* parseExpressionList();
 
-  ast::Expression* parseLogicalOrExpression();
-
-  ast::Expression* parseLogicalAndExpression();
-
-  ast::Expression* parseInclusiveOrExpression();
-
-  ast::Expression* parseExclusiveOrExpression();
-
-  ast::Expression* parseAndExpression();
-
-  ast::Expression* parseEqualityExpression();
+  // Parse a binary expression by operator precedence, using the _operands and _operators stacks
+  // rather than recursing for each operator, so long chains of operators can't overflow the
+  // stack, followed by an optional ternary conditional taking it as its condition.
+  ast::Expression* parseBinaryExpression();
 
-  ast::Expression* parseRelationalExpression();
-
-  ast::Expression* parseShiftExpression();
-
-  ast::Expression* parseAdditiveExpression();
-
-  ast::Expression* parseMultiplicativeExpression();
+  // Combine the operators on top of the _operators stack, above operatorBase, that have a
+  // precedence of at least minPrecedence with their operands.
+  void reduceBinaryOperators(size_t operatorBase, int minPrecedence);
 
   ast::Expression* parsePrefixExpression();
 
@@ -142,6 +222,9 @@ private:
 
   ast::Statement* parseStatement(bool expectSemicolon = true);
 
+  // Parse the statement a control statement applies to, reporting an error if there isn't one.
+  ast::Statement* parseBodyStatement(const char* message);
+
   ast::IfStmt* parseIfStmt();
 
   ast::SwitchStmt* parseSwitchStmt();
@@ -161,25 +244,35 @@ private:
             _structs.find(tk.lexeme()) != _structs.end();
   }
 
-  // Start saving all tokens that are consumed. restorePoint() can be called to restore the tokens
-  // that were consumed back to the startRestorePoint. This is used to undo a parse, since some
-  // grammar rules are ambiguous.
+  // Keep all tokens that are consumed from here on. restorePoint() can be called to restore the
+  // tokens that were consumed back to the startRestorePoint. This is used to undo a parse, since
+  // some grammar rules are ambiguous.
   void startRestorePoint() {
-    _restore.push_back(std::list<Token>());
+    _restore.push_back({_position, _ast->nodeIndexMark()});
+    HLSL_STATS(_stats.parser.restorePoints++);
   }
 
-  // Restore the tokens that were recorded since the last startRestorePoint() call.
+  // Restore the tokens that were consumed since the last startRestorePoint() call.
   void restorePoint() {
     if (_restore.empty()) {
       return;
     }
 
-    std::list<Token>& restore = _restore.back();
-    _pending.splice(_pending.begin(), restore);
+    HLSL_STATS(_stats.parser.restores++);
+    for (size_t i = _restore.back().position; i < _position; ++i) {
+      const TokenType type = _tokens[i].type();
+      if (type == TokenType::LeftBrace) {
+        _braceDepth--;
+      } else if (type == TokenType::RightBrace) {
+        _braceDepth++;
+      }
+    }
+    _position = _restore.back().position;
+    _ast->rollbackNodeIndex(_restore.back().nodeMark);
     _restore.pop_back();
   }
 
-  // Discard the tokens that were recorded since the last startRestorePoint() call.
+  // Stop keeping the tokens that were consumed since the last startRestorePoint() call.
   void discardRestorePoint() {
     _restore.pop_back();   
   }
@@ -188,18 +281,57 @@ private:
   ast::Ast* _ast = nullptr;
   // The lexer that is used to scan the source string into Tokens.
   Scanner _scanner;
-  // A list of tokens that have been scanned from the scanner but not yet parsed.
-  std::list<Token> _pending;
-
-  //std::list<size_t> _restorePointStack;
-  std::list<std::list<Token>> _restore;
+  // The tokens read from the scanner. Tokens before _position have been consumed, and are kept
+  // while a restore point may return to them. The buffer is reset once every token in it has
+  // been consumed and no restore point is open, so its storage is reused for the whole parse.
+  std::vector<Token> _tokens;
+  // The index in _tokens of the next token to parse.
+  size_t _position = 0;
+  // Whether the tokens were scanned before the parser was constructed, and the offset of the
+  // end of them, which is given to the EndOfFile token.
+  bool _prescanned = false;
+  uint32_t _endOffset = 0;
+  // An open restore point, with the Ast node index mark to roll back to with the tokens.
+  struct RestorePoint {
+    size_t position;
+    size_t nodeMark;
+  };
+  std::vector<RestorePoint> _restore;
+
+  // A binary operator parsed by parseBinaryExpression that is waiting for its right operand.
+  struct PendingOperator {
+    ast::Operator op;
+    int precedence;
+    uint32_t offset;
+  };
+  // The operands and operators of the binary expressions being parsed. A binary expression
+  // nested in another, such as in parentheses, uses the entries above those of the outer one.
+  std::vector<ast::Expression*> _operands;
+  std::vector<PendingOperator> _operators;
+
+  // The current nesting depth, and the depth at which the parser reports an error.
+  int _depth = 0;
+  int _maxDepth = defaultMaxDepth;
+  bool _indexNodes = false;
 
   // Track typedefs to verify type names.
   std::map<std::string_view, ast::TypedefStmt*> _typedefs;
   // Track structs to verify type names.
   std::map<std::string_view, ast::StructStmt*> _structs;
   std::map<std::string_view, ast::VariableStmt*> _variables;
-  std::list<std::string> _anonymousStructNames;
+
+  // Errors found while parsing.
+  std::vector<Diagnostic> _diagnostics;
+  // Set when an error is found, until the parser synchronizes at the end of a statement.
+  bool _panicMode = false;
+  // The number of unclosed '{' consumed so far, used to find where to resume after an error.
+  int _braceDepth = 0;
+  // Returned by peekNext() while in panic mode.
+  Token _errorToken;
+  // The source offset of the last token consumed.
+  uint32_t _lastOffset = 0;
+  // The instrumentation stats of the last parse.
+  ParseStats _stats;
 };
 
 } // namespace hlsl
@@ -1,3 +1,4 @@
+#include <iterator>
 #include <string_view>
 #include <ctype.h>
 
@@ -256,7 +257,8 @@ const EffectState* getEffectState(const std::string_view& name,
     bool isSamplerState, bool isPipeline) {
   const EffectState* states = isSamplerState ? samplerStates :
       isPipeline ? pipelineStates : effectStates;
-  const size_t count = sizeof(states) / sizeof(states[0]);
+  const size_t count = isSamplerState ? std::size(samplerStates) :
+      isPipeline ? std::size(pipelineStates) : std::size(effectStates);
   for (size_t i = 0; i < count; ++i) {
     const std::string_view sname = states[i].name;
     if (util::stringEqualCaseInsensitive(name, sname)) {
@@ -1,7 +1,11 @@
 #include "scanner.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iterator>
+#include <limits>
 
+#include "../../util/trace.h"
 #include "scanner/literal.h"
 #include "scanner/template_types.h"
 #include "token_type.h"
@@ -12,9 +16,12 @@ namespace hlsl {
 Scanner::Scanner(const std::string_view& source, const std::string filename)
     : _source(source)
     , _size(source.size())
-    , _filename(filename) {}
+    , _filename(filename)
+    , _sourceFilename(filename) {}
 
-const std::list<Token>& Scanner::scan() {
+const std::vector<Token>& Scanner::scan() {
+  HLSL_STATS_TIMER(_stats.ms);
+  HLSL_TRACE_SCOPE("scan");
   while (!isAtEnd()) {
     _start = _position;
     _lexemeLength = 0;
@@ -26,12 +33,12 @@ const std::list<Token>& Scanner::scan() {
 }
 
 Token Scanner::scanNext() {
-  if (!_tokens.empty()) {
-    Token tk = _tokens.front();
-    _tokens.pop_front();
-    return tk;
+  if (_nextToken < _tokens.size()) {
+    return _tokens[_nextToken++];
   }
 
+  _tokens.clear();
+  _nextToken = 0;
   while (!isAtEnd()) {
     _start = _position;
     _lexemeLength = 0;
@@ -39,17 +46,64 @@ Token Scanner::scanNext() {
       break;
     }
     if (!_tokens.empty()) {
-       Token tk = _tokens.front();
-      _tokens.pop_front();
-      return tk;
+      return _tokens[_nextToken++];
     }
   }
 
-  return Token{TokenType::EndOfFile, ""};
+  return Token{TokenType::EndOfFile, "", static_cast<uint32_t>(_size)};
 }
 
 bool Scanner::isAtEnd() const { return _position >= _size; }
 
+void Scanner::buildLineIndex() const {
+  _lineOffsets.clear();
+  _lineOffsets.push_back(0);
+  const char* data = _source.data();
+  const char* end = data + _size;
+  for (const char* p = data; p < end; ++p) {
+    p = static_cast<const char*>(memchr(p, '\n', end - p));
+    if (p == nullptr) {
+      break;
+    }
+    _lineOffsets.push_back(static_cast<uint32_t>(p - data + 1));
+  }
+  _lineIndexBuilt = true;
+}
+
+int Scanner::absoluteLine(uint32_t offset) const {
+  if (!_lineIndexBuilt) {
+    buildLineIndex();
+  }
+  // The line is the number of line starts at or before the offset.
+  return static_cast<int>(
+      std::upper_bound(_lineOffsets.begin(), _lineOffsets.end(), offset) - _lineOffsets.begin());
+}
+
+SourceLocation Scanner::location(uint32_t offset) const {
+  SourceLocation location;
+  location.offset = offset;
+  location.filename = _sourceFilename;
+
+  offset = std::min<uint32_t>(offset, static_cast<uint32_t>(_size));
+
+  const int line = absoluteLine(offset);
+  location.line = line;
+  location.column = static_cast<int>(offset - _lineOffsets[line - 1]) + 1;
+
+  // Remap the line by the last #line directive before the offset.
+  auto directive = std::upper_bound(_lineDirectives.begin(), _lineDirectives.end(), offset,
+      [](uint32_t offset, const LineDirective& d) { return offset < d.offset; });
+  if (directive != _lineDirectives.begin()) {
+    --directive;
+    location.line = directive->line + (line - absoluteLine(directive->offset));
+    if (!directive->filename.empty()) {
+      location.filename = directive->filename;
+    }
+  }
+
+  return location;
+}
+
 char Scanner::advance() { 
   char c = current();
   ++_position;
@@ -85,13 +139,18 @@ void Scanner::addToken(TokenType t) {
   if (!_defines.empty()) {
     auto dIter = _defines.find(lexeme);
     if (dIter != _defines.end()) {
-      auto& define = dIter->second;
-      _tokens.insert(_tokens.end(), define.begin(), define.end());
+      // The expanded tokens are located at the macro name.
+      for (const Token& tk : dIter->second) {
+        _tokens.emplace_back(tk.type(), tk.lexeme(), static_cast<uint32_t>(_start));
+      }
+      HLSL_STATS(_stats.defineExpansions++);
+      HLSL_STATS(_stats.tokens += dIter->second.size());
       return;
     }
   }
 
-  _tokens.emplace_back(t, lexeme);
+  _tokens.emplace_back(t, lexeme, static_cast<uint32_t>(_start));
+  HLSL_STATS(_stats.tokens++);
 }
 
 void Scanner::scanPragma() {
@@ -155,12 +214,8 @@ void Scanner::scanPragma() {
       std::string_view defineValue = _source.substr(start, end - start);
 
       Scanner defineScanner(defineValue, _filename);
-      auto defineTokens = defineScanner.scan();
-
-      _defines[defineName] = defineTokens;
+      _defines[defineName] = defineScanner.scan();
 
-      _line++;
-      _absoluteLine++;
       advance();
       return;
     }
@@ -169,13 +224,15 @@ void Scanner::scanPragma() {
       ci++;
       advance();
       skipWhitespace();
-      if (isNumeric(current())) {
-        _line = 0;
-        while (!isAtEnd() && isNumeric(current())) {
-          _line = _line * 10 + (current() - '0');
-          advance();
+      int directiveLine = 0;
+      while (!isAtEnd() && isNumeric(current())) {
+        // Clamp rather than overflow on a line number too large to be real.
+        if (directiveLine <= (std::numeric_limits<int>::max() - 9) / 10) {
+          directiveLine = directiveLine * 10 + (current() - '0');
         }
+        advance();
       }
+      std::string_view directiveFilename;
       while (!isAtEnd() && isWhitespace(current())) {
         advance();
       }
@@ -191,16 +248,22 @@ void Scanner::scanPragma() {
           advance();
         }
         _filename = _source.substr(start, end - start);
+        directiveFilename = _source.substr(start, end - start);
+      }
+      while (!isAtEnd() && current() != '\n') {
+        advance();
+      }
+      if (directiveFilename.empty() && !_lineDirectives.empty()) {
+        directiveFilename = _lineDirectives.back().filename;
       }
+      _lineDirectives.push_back(
+          LineDirective{static_cast<uint32_t>(_position + 1), directiveLine, directiveFilename});
       continue;
     }
 
     advance();
   }
   advance();
-  
-  _line++;
-  _absoluteLine++;
 }
 
 bool Scanner::scanToken() {
@@ -213,10 +276,8 @@ bool Scanner::scanToken() {
     return true;
   }
 
-  // Skip line-feed, adding to the line counter.
+  // Skip line-feed. Lines are computed from the offsets of the tokens when needed.
   if (c == '\n') {
-    _line++;
-    _absoluteLine++;
     return true;
   }
  
@@ -229,15 +290,10 @@ bool Scanner::scanToken() {
     char next = current();
     // If it's a // comment, skip everything until the next line-feed.
     if (next == '/') {
-      while (c != '\n') {
-        if (isAtEnd()) {
-          return true;
-        }
-        c = advance();
-      }
-      // skip the linefeed
-      _line++;
-      _absoluteLine++;
+      const char* lineEnd = static_cast<const char*>(
+          memchr(_source.data() + _position, '\n', _size - _position));
+      // Skip past the linefeed.
+      _position = lineEnd != nullptr ? (lineEnd - _source.data()) + 1 : _size;
       return true;
     } else if (next == '*') {
       // If it's a / * block comment, skip everything until the matching * /,
@@ -249,10 +305,7 @@ bool Scanner::scanToken() {
           return true;
         }
         c = advance();
-        if (c == '\n') {
-          _line++;
-          _absoluteLine++;
-        } else if (c == '*') {
+        if (c == '*') {
           next = current();
           if (next == '/') {
             advance();
@@ -347,6 +400,7 @@ bool Scanner::scanToken() {
       const int maxLookAhead = 2;
       for (int li = 0; li < maxLookAhead; ++li) {
         lookAheadLexeme = src.substr(_start, _lexemeLength + 1 + li);
+        HLSL_STATS(_stats.lookAheadRetries++);
         matchedType = findTokenType(lookAheadLexeme);
         if (matchedType != TokenType::Undefined) {
           lookAhead = li;
@@ -1,11 +1,14 @@
 #pragma once
 
-#include <list>
+#include <algorithm>
 #include <map>
 #include <string>
 #include <string_view>
 #include <vector>
 
+#include "../../util/stats.h"
+#include "parse_stats.h"
+#include "source_location.h"
 #include "token.h"
 
 namespace reader {
@@ -26,7 +29,7 @@ public:
   Scanner(const std::string_view& source, const std::string filename = "");
 
   /// Scan the source code and return a list of all tokens.
-  const std::list<Token>& scan();
+  const std::vector<Token>& scan();
 
   /// Scan the next token in the source code. This is used to stream tokens from the
   /// scanner rather than scanning the entire source code at once.
@@ -41,15 +44,43 @@ public:
     return _filename;
   }
 
+  /// The line the scanner is currently on, remapped by any #line directives.
   int line() const {
-    return _line;
+    return location(static_cast<uint32_t>(_position)).line;
   }
 
+  /// The line the scanner is currently on, ignoring #line directives.
   int absoluteLine() const {
-    return _absoluteLine;
+    return absoluteLine(static_cast<uint32_t>(_position));
+  }
+
+  /// Compute the line of an offset in the source, ignoring #line directives.
+  /// @param offset The byte offset in the source, such as Token::offset().
+  int absoluteLine(uint32_t offset) const;
+
+  /// Compute the file, line and column of an offset in the source. Lines aren't tracked while
+  /// scanning; the first call builds an index of the newline offsets in the source, and each
+  /// call is a binary search of it.
+  /// @param offset The byte offset in the source, such as Token::offset().
+  SourceLocation location(uint32_t offset) const;
+
+  /// The counters collected so far. These are all zero if HLSL_REFLECT_STATS is disabled.
+  ScannerStats stats() const {
+    ScannerStats stats = _stats;
+    HLSL_STATS(stats.bytes = std::min(_position, _size));
+    return stats;
   }
 
 private:
+  // A #line directive, remapping the lines that follow it.
+  struct LineDirective {
+    // The offset of the start of the line following the directive.
+    uint32_t offset;
+    // The line number of the line following the directive.
+    int line;
+    std::string_view filename;
+  };
+
   bool scanToken();
 
   char advance();
@@ -64,6 +95,9 @@ private:
 
   void scanPragma();
 
+  // Build the index of the offsets of the start of each line.
+  void buildLineIndex() const;
+
   void skipWhitespace() {
     while (!isAtEnd() && isWhitespace(current())) {
       advance();
@@ -72,15 +106,25 @@ private:
 
   const std::string_view _source;
   const size_t _size;
-  std::list<Token> _tokens;
+  // The tokens scanned but not yet returned by scanNext. The storage is reused once they have
+  // all been returned, so streaming tokens doesn't allocate once it has warmed up.
+  std::vector<Token> _tokens;
+  size_t _nextToken = 0;
   size_t _start = 0;
   size_t _position = 0;
   size_t _lexemeLength = 0;
   std::string _filename;
-  int _line = 1;
-  int _absoluteLine = 1;
+  // The file name the scanner was constructed with, before any #line directives.
+  const std::string _sourceFilename;
+  // The offset of the start of each line, built on the first location request.
+  mutable std::vector<uint32_t> _lineOffsets;
+  mutable bool _lineIndexBuilt = false;
+  // The #line directives scanned so far, in source order.
+  std::vector<LineDirective> _lineDirectives;
+
+  std::map<std::string_view, std::vector<Token>> _defines;
 
-  std::map<std::string_view, std::list<Token>> _defines;
+  ScannerStats _stats;
 };
 
 } // namespace hlsl
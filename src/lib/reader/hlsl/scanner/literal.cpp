@@ -1,5 +1,8 @@
 #include "literal.h"
 
+#include <charconv>
+#include <cstdlib>
+
 namespace reader {
 namespace hlsl {
 
@@ -11,6 +14,10 @@ static bool isHexAlpha(char c) {
   return c >= 'a' && c <= 'f' || c >= 'A' && c <= 'F';
 }
 
+static uint64_t digitValue(char c) {
+  return isNumeric(c) ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : c - 'A' + 10;
+}
+
 static bool isAlpha(char c) {
   return c >= 'a' && c <= 'z' || c >= 'A' && c <= 'Z' || c == '_';
 }
@@ -23,7 +30,7 @@ TokenType matchLiteral(const std::string_view& lexeme) {
   char c = lexeme[0];
   const size_t len = lexeme.length();
   // Using std::regex instead of manually parsing the string was 12x slower.
-  // /-?0x[0-9a-fA-F]+[uUL]?|-?0[0-7]*[uUL]?|-?[1-9][0-9]*[uUL]?/
+  // /-?0[xX][0-9a-fA-F]+[uUL]?|-?0[0-7]*[uUL]?|-?[1-9][0-9]*[uUL]?/
   // /-?[0-9]+(.[0-9]*)?([eE][+-]?[0-9]+)?[FfHh]?/
   if (c == '-' || c == '.' || isNumeric(c)) {
     size_t ci = 0;
@@ -39,11 +46,15 @@ TokenType matchLiteral(const std::string_view& lexeme) {
       }
       ci++;
       c = lexeme[ci];
+      // A number must follow the -, so -f or -L is the start of the negation of a name.
+      if (!isNumeric(c) && !(c == '.' && ci + 1 < len && isNumeric(lexeme[ci + 1]))) {
+        return TokenType::Undefined;
+      }
     }
 
     if (c == '0') {
       // Octal or hex
-      if ((ci + 1) < len && lexeme[ci + 1] == 'x') {
+      if ((ci + 1) < len && (lexeme[ci + 1] == 'x' || lexeme[ci + 1] == 'X')) {
         isHex = true;
         ci += 2;
       } else {
@@ -164,5 +175,58 @@ TokenType matchLiteral(const std::string_view& lexeme) {
   return TokenType::Undefined;
 }
 
+LiteralValue decodeLiteral(const std::string_view& lexeme) {
+  LiteralValue value;
+  const TokenType tokenType = lexeme.empty() ? TokenType::Undefined : matchLiteral(lexeme);
+  if (tokenType != TokenType::IntLiteral && tokenType != TokenType::FloatLiteral) {
+    return value;
+  }
+  value.tokenType = tokenType;
+
+  std::string_view text = lexeme;
+  const bool negative = text[0] == '-';
+  if (negative) {
+    text.remove_prefix(1);
+  }
+  const bool isHex = text.size() > 1 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X');
+  const char suffix = text.back();
+
+  if (tokenType == TokenType::FloatLiteral) {
+    value.type = suffix == 'h' || suffix == 'H' ? ast::BaseType::Half : ast::BaseType::Float;
+    if (!isNumeric(suffix) && suffix != '.') {
+      text.remove_suffix(1);
+    }
+    double number = 0.0;
+    const std::from_chars_result result =
+        std::from_chars(text.data(), text.data() + text.size(), number);
+    if (result.ec == std::errc::result_out_of_range) {
+      // strtod gives the infinity or 0 a number out of range rounds to.
+      number = std::strtod(std::string(text).c_str(), nullptr);
+    }
+    value.floatValue = negative ? -number : number;
+    return value;
+  }
+
+  value.type = suffix == 'u' || suffix == 'U' ? ast::BaseType::Uint : ast::BaseType::Int;
+  if (!isNumeric(suffix) && !(isHex && isHexAlpha(suffix))) {
+    text.remove_suffix(1);
+  }
+  uint64_t base = 10;
+  if (isHex) {
+    base = 16;
+    text.remove_prefix(2);
+  } else if (text.size() > 1 && text[0] == '0') {
+    base = 8;
+    text.remove_prefix(1);
+  }
+  // A number too large for 64 bits wraps.
+  uint64_t number = 0;
+  for (char c : text) {
+    number = number * base + digitValue(c);
+  }
+  value.uintValue = negative ? 0 - number : number;
+  return value;
+}
+
 } // namespace hlsl
 } // namespace reader
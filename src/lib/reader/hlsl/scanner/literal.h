@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <variant>
 
+#include "../../../ast/base_type.h"
 #include "../token_type.h"
 
 namespace reader {
@@ -16,5 +18,26 @@ namespace hlsl {
 /// or TokenType::Undefined if it wasn't matched to a literal.
 TokenType matchLiteral(const std::string_view& lexeme);
 
+/// The value of a number literal, decoded from its lexeme.
+struct LiteralValue {
+  /// TokenType::IntLiteral or TokenType::FloatLiteral, as matchLiteral classifies the lexeme,
+  /// or TokenType::Undefined if it isn't a number.
+  TokenType tokenType = TokenType::Undefined;
+  /// The type given by the suffix: Uint for u, Half for h, otherwise Int or Float.
+  ast::BaseType type = ast::BaseType::Undefined;
+  /// intValue for an int literal, which wraps to 64 bits, with uintValue the same bits as a
+  /// uint, and floatValue for a float literal. A leading - is part of the value.
+  union {
+    int64_t intValue = 0;
+    uint64_t uintValue;
+    double floatValue;
+  };
+};
+
+/// Decode a number literal, in decimal, hex such as 0x1F or octal such as 017, with its suffix.
+/// @param lexeme The string to decode.
+/// @return The value, with a tokenType of TokenType::Undefined if the lexeme isn't a number.
+LiteralValue decodeLiteral(const std::string_view& lexeme);
+
 } // namespace hlsl
 } // namespace reader
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace reader {
+namespace hlsl {
+
+/// A location in the source, with the file and line remapped by any #line directives.
+struct SourceLocation {
+  /// The byte offset in the source.
+  uint32_t offset = 0;
+  /// The file name from the last #line directive, or the name the scanner was given.
+  std::string_view filename;
+  /// The 1-based line, as set by the last #line directive.
+  int line = 1;
+  /// The 1-based column, in bytes.
+  int column = 1;
+};
+
+} // namespace hlsl
+} // namespace reader
@@ -1,31 +1,37 @@
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 #include "token_type.h"
 
 namespace reader {
 namespace hlsl {
 
-/// A token is a single lexeme with a type.
+/// A token is a single lexeme with a type, and the offset in the source it was scanned from.
+/// Tokens expanded from a #define have the offset of the macro name where it was used.
 class Token {
 public:
   Token()
       : _type(TokenType::Undefined) { }
 
-  Token(TokenType type, std::string_view lexeme)
+  Token(TokenType type, std::string_view lexeme, uint32_t offset = 0)
       : _type(type)
+      , _offset(offset)
       , _lexeme(lexeme) { }
 
   Token(const Token& other)
       : _type(other._type)
+      , _offset(other._offset)
       , _lexeme(other._lexeme) { }
 
   Token(const Token&& other)
       : _type(other._type)
+      , _offset(other._offset)
       , _lexeme(std::move(other._lexeme)) { }
 
   Token& operator=(const Token& other) {
     _type = other._type;
+    _offset = other._offset;
     _lexeme = other._lexeme;
     return *this;
   }
@@ -38,8 +44,12 @@ public:
 
   const std::string_view& lexeme() const { return _lexeme; }
 
+  /// The byte offset of the token in the source. Use Scanner::location to get the line and column.
+  uint32_t offset() const { return _offset; }
+
 private:
   TokenType _type;
+  uint32_t _offset = 0;
   std::string_view _lexeme;
 };
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <chrono>
+
+// Instrumentation counters and timers in the scanner, parser and Ast. They are compiled in by
+// default; define HLSL_REFLECT_STATS=0 (the HLSL_REFLECT_STATS CMake option) to remove them.
+#ifndef HLSL_REFLECT_STATS
+#define HLSL_REFLECT_STATS 1
+#endif
+
+#if HLSL_REFLECT_STATS
+// Compile the statement only when stats are enabled.
+#define HLSL_STATS(statement) statement
+// Add the time until the end of the enclosing scope to a double total, in milliseconds.
+#define HLSL_STATS_TIMER(total) util::ScopedTimer HLSL_STATS_CONCAT(_statsTimer, __LINE__)(total)
+#define HLSL_STATS_CONCAT(a, b) HLSL_STATS_CONCAT2(a, b)
+#define HLSL_STATS_CONCAT2(a, b) a##b
+#else
+#define HLSL_STATS(statement)
+#define HLSL_STATS_TIMER(total)
+#endif
+
+namespace util {
+
+/// Adds the time between its construction and destruction to a total, in milliseconds.
+class ScopedTimer {
+public:
+  ScopedTimer(double& total)
+    : _total(total)
+    , _start(std::chrono::steady_clock::now()) {}
+
+  ~ScopedTimer() {
+    const auto end = std::chrono::steady_clock::now();
+    _total += std::chrono::duration<double, std::milli>(end - _start).count();
+  }
+
+private:
+  double& _total;
+  std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace util
@@ -1,6 +1,5 @@
 #include "string_util.h"
 
-#include <charconv>
 #include <ctype.h>
 
 namespace util {
@@ -22,16 +21,4 @@ bool stringEqualCaseInsensitive(const std::string_view& a, const std::string_vie
   return true;
 }
 
-int toInt(const std::string_view& str) {
-  int value = 0;
-  std::from_chars(str.data(), str.data() + str.size(), value);
-  return value;
-}
-
-float toFloat(const std::string_view& str) {
-  float value = 0;
-  std::from_chars(str.data(), str.data() + str.size(), value);
-  return value;
-}
-
 } // namespace util
\ No newline at end of file
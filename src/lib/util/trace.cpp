@@ -0,0 +1,164 @@
+#include "trace.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace util {
+
+namespace {
+
+struct TraceEvent {
+  const char* name;
+  std::string detail;
+  int64_t start;
+  int64_t end;
+};
+
+// The events recorded by one thread. Buffers are owned by the registry rather than the thread,
+// so the events of worker threads outlive the threads.
+struct ThreadBuffer {
+  uint32_t threadId;
+  std::vector<TraceEvent> events;
+  // The index the next event is written to.
+  size_t next = 0;
+  // Set once the buffer has wrapped around and the oldest events have been overwritten.
+  bool wrapped = false;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+  size_t eventsPerThread = 0;
+  // Incremented by enable(), so threads replace buffers registered by an earlier trace.
+  std::atomic<uint32_t> generation{0};
+};
+
+Registry& registry() {
+  static Registry registry;
+  return registry;
+}
+
+const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+thread_local ThreadBuffer* threadBuffer = nullptr;
+thread_local uint32_t threadGeneration = 0;
+
+ThreadBuffer* getThreadBuffer() {
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  auto buffer = std::make_unique<ThreadBuffer>();
+  buffer->threadId = static_cast<uint32_t>(reg.buffers.size()) + 1;
+  buffer->events.resize(reg.eventsPerThread);
+  threadGeneration = reg.generation;
+  reg.buffers.push_back(std::move(buffer));
+  return reg.buffers.back().get();
+}
+
+void writeString(std::ostream& out, const std::string& str) {
+  out << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec
+          << std::setfill(' ');
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+} // namespace
+
+std::atomic<bool> Trace::_enabled{false};
+
+void Trace::enable(size_t eventsPerThread) {
+  Registry& reg = registry();
+  {
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.buffers.clear();
+    reg.eventsPerThread = std::max<size_t>(1, eventsPerThread);
+    reg.generation++;
+  }
+  _enabled = true;
+}
+
+int64_t Trace::now() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now() - startTime).count();
+}
+
+void Trace::record(const char* name, const std::string& detail, int64_t start, int64_t end) {
+  if (threadBuffer == nullptr || threadGeneration != registry().generation) {
+    threadBuffer = getThreadBuffer();
+  }
+  ThreadBuffer& buffer = *threadBuffer;
+  TraceEvent& event = buffer.events[buffer.next];
+  event.name = name;
+  event.detail = detail;
+  event.start = start;
+  event.end = end;
+  if (++buffer.next == buffer.events.size()) {
+    buffer.next = 0;
+    buffer.wrapped = true;
+  }
+}
+
+void Trace::write(std::ostream& out) {
+  Registry& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+
+  out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+  bool first = true;
+  for (const std::unique_ptr<ThreadBuffer>& buffer : reg.buffers) {
+    out << (first ? "" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+        << "\"tid\": " << buffer->threadId << ", \"args\": {\"name\": \""
+        << "thread " << buffer->threadId << "\"}}";
+    first = false;
+
+    // Write the events oldest first.
+    const size_t count = buffer->wrapped ? buffer->events.size() : buffer->next;
+    const size_t begin = buffer->wrapped ? buffer->next : 0;
+    for (size_t i = 0; i < count; ++i) {
+      const TraceEvent& event = buffer->events[(begin + i) % buffer->events.size()];
+      out << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"hlsl\", \"ph\": \"X\", "
+          << "\"ts\": " << event.start << ", \"dur\": " << (event.end - event.start)
+          << ", \"pid\": 1, \"tid\": " << buffer->threadId;
+      if (!event.detail.empty()) {
+        out << ", \"args\": {\"detail\": ";
+        writeString(out, event.detail);
+        out << "}";
+      }
+      out << "}";
+    }
+  }
+  out << "\n]}\n";
+}
+
+TraceFile::TraceFile(const char* path)
+  : _path(path) {
+  if (_path != nullptr) {
+    Trace::enable();
+  }
+}
+
+TraceFile::~TraceFile() {
+  if (_path == nullptr) {
+    return;
+  }
+  std::ofstream out(_path);
+  if (!out) {
+    std::cerr << "Unable to write file: " << _path << std::endl;
+    return;
+  }
+  Trace::write(out);
+}
+
+} // namespace util
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace util {
+
+/// Records timed events for export as Chrome trace-event JSON, which can be opened with
+/// chrome://tracing or Perfetto to see the timeline of each thread.
+/// Recording is off until enable() is called; until then a TraceScope costs one atomic load.
+/// Each thread records into its own ring buffer, so recording doesn't lock, and once a buffer is
+/// full the oldest events of that thread are overwritten.
+class Trace {
+public:
+  /// Start recording events.
+  /// @param eventsPerThread The size of each thread's ring buffer.
+  static void enable(size_t eventsPerThread = 64 * 1024);
+
+  /// Stop recording events. The events already recorded are kept until the next enable().
+  static void disable() { _enabled = false; }
+
+  /// Returns true if events are being recorded.
+  static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  /// The current time in microseconds, on the clock events are recorded with.
+  static int64_t now();
+
+  /// Record an event on the calling thread's buffer.
+  /// @param name The name of the event. It must be valid until the trace is written, such as
+  /// a string literal.
+  /// @param detail Extra information shown with the event, such as a file name. May be empty.
+  /// @param start The start time of the event, from now().
+  /// @param end The end time of the event, from now().
+  static void record(const char* name, const std::string& detail, int64_t start, int64_t end);
+
+  /// Write the recorded events of all threads as Chrome trace-event JSON. The threads that
+  /// recorded events must have finished recording.
+  static void write(std::ostream& out);
+
+private:
+  static std::atomic<bool> _enabled;
+};
+
+/// Records a trace event spanning the lifetime of the scope, if tracing is enabled.
+class TraceScope {
+public:
+  TraceScope(const char* name, const std::string& detail = std::string())
+    : _name(name)
+    , _start(Trace::isEnabled() ? Trace::now() : -1) {
+    if (_start >= 0) {
+      _detail = detail;
+    }
+  }
+
+  ~TraceScope() {
+    if (_start >= 0) {
+      Trace::record(_name, _detail, _start, Trace::now());
+    }
+  }
+
+private:
+  const char* _name;
+  int64_t _start;
+  std::string _detail;
+};
+
+/// Enables tracing for its lifetime and writes the trace to a file when it's destroyed, so the
+/// trace is written on every return path of a tool. Failing to write the file is reported on
+/// std::cerr.
+class TraceFile {
+public:
+  /// @param path The file to write the trace to. If null, tracing isn't enabled.
+  explicit TraceFile(const char* path);
+  ~TraceFile();
+
+  TraceFile(const TraceFile&) = delete;
+  TraceFile& operator=(const TraceFile&) = delete;
+
+private:
+  const char* _path;
+};
+
+} // namespace util
+
+// Trace the rest of the enclosing scope as an event with the given name and optional detail.
+#define HLSL_TRACE_SCOPE(...) util::TraceScope HLSL_TRACE_CONCAT(_traceScope, __LINE__)(__VA_ARGS__)
+#define HLSL_TRACE_CONCAT(a, b) HLSL_TRACE_CONCAT2(a, b)
+#define HLSL_TRACE_CONCAT2(a, b) a##b
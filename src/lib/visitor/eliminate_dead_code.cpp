@@ -0,0 +1,366 @@
+#include "eliminate_dead_code.h"
+
+#include <unordered_set>
+#include <vector>
+
+#include "../ast/constant_evaluator.h"
+#include "../util/trace.h"
+#include "prune_tree.h"
+#include "resolve_symbols.h"
+#include "static_visitor.h"
+
+namespace visitor {
+
+namespace {
+
+// Collects the declarations the variables in a function refer to, and the names of the
+// variables that weren't resolved.
+class LocalUses : public StaticVisitor<LocalUses> {
+public:
+  std::unordered_set<const ast::Node*> declarations;
+  std::unordered_set<std::string_view> names;
+
+  void visitVariableStmt(ast::VariableStmt* node) {
+    StaticVisitor::visitVariableStmt(node);
+    visitExpression(node->arraySize);
+  }
+
+  void visitVariableExpr(ast::VariableExpr* node) {
+    if (node->declaration != nullptr) {
+      declarations.insert(node->declaration);
+    } else {
+      names.insert(node->name);
+    }
+  }
+
+  bool isUsed(const ast::VariableStmt* node) const {
+    return declarations.count(node) != 0 || names.count(node->name) != 0;
+  }
+};
+
+// Finds whether an expression has a side effect: a call, an assignment or an increment. Any
+// call may write to an out parameter or a UAV, so all are counted.
+class SideEffects : public StaticVisitor<SideEffects> {
+public:
+  bool found = false;
+
+  void visitCallExpr(ast::CallExpr*) { found = true; }
+
+  void visitAssignmentExpr(ast::AssignmentExpr*) { found = true; }
+
+  void visitIncrementExpr(ast::IncrementExpr*) { found = true; }
+
+  void visitPrefixExpr(ast::PrefixExpr* node) {
+    if (node->op == ast::Operator::PlusPlus || node->op == ast::Operator::MinusMinus) {
+      found = true;
+    } else {
+      StaticVisitor::visitPrefixExpr(node);
+    }
+  }
+};
+
+bool hasSideEffects(ast::Expression* expr) {
+  SideEffects sideEffects;
+  sideEffects.visitExpression(expr);
+  return sideEffects.found;
+}
+
+// Removes the dead code of function bodies.
+class DeadCodeRemover {
+public:
+  DeadCodeRemover(EliminateDeadCode* pass, ast::ConstantEvaluator& evaluator)
+      : _pass(pass)
+      , _evaluator(evaluator) {}
+
+  void simplifyFunction(ast::FunctionStmt* function) {
+    if (function->body == nullptr) {
+      return;
+    }
+    simplifyStatements(&function->body->statements);
+    // Removing a local can leave the locals its initializer used unused, so repeat until
+    // nothing more is removed.
+    while (true) {
+      LocalUses uses;
+      uses.visitBlock(function->body);
+      _removed = false;
+      removeUnusedLocals(&function->body->statements, uses);
+      if (!_removed) {
+        break;
+      }
+    }
+  }
+
+private:
+  // Simplify a list of statements, replacing or removing the statements in it.
+  void simplifyStatements(ast::Statement** slot) {
+    while (*slot != nullptr) {
+      ast::Statement* stmt = *slot;
+      ast::Statement* replacement = simplifyStatement(stmt);
+      if (replacement == stmt) {
+        slot = &stmt->next;
+        continue;
+      }
+      // A replacement is the statements of a branch, usually one, so they take the place of the
+      // statement in the list, and are simplified in turn.
+      if (replacement == nullptr) {
+        *slot = stmt->next;
+      } else {
+        ast::Statement* last = replacement;
+        while (last->next != nullptr) {
+          last = last->next;
+        }
+        last->next = stmt->next;
+        *slot = replacement;
+      }
+    }
+  }
+
+  // Simplify the body of an if or loop, which can't be removed entirely.
+  void simplifyBody(ast::Statement** slot) {
+    simplifyStatements(slot);
+    if (*slot == nullptr) {
+      *slot = _pass->ast->createNode<ast::Block>();
+    }
+  }
+
+  // Simplify the statement, returning the statement to replace it with, or null to remove it.
+  ast::Statement* simplifyStatement(ast::Statement* stmt) {
+    switch (stmt->nodeType) {
+      case ast::NodeType::IfStmt: {
+        ast::IfStmt* ifStmt = static_cast<ast::IfStmt*>(stmt);
+        foldExpression(&ifStmt->condition);
+        const ast::ConstantValue& condition = _evaluator.evaluate(ifStmt->condition);
+        if (condition.isScalar()) {
+          _pass->branchesRemoved++;
+          return condition.asBool() ? ifStmt->body : ifStmt->elseBody;
+        }
+        simplifyBody(&ifStmt->body);
+        simplifyStatements(&ifStmt->elseBody);
+        return stmt;
+      }
+      case ast::NodeType::WhileStmt: {
+        ast::WhileStmt* whileStmt = static_cast<ast::WhileStmt*>(stmt);
+        foldExpression(&whileStmt->condition);
+        const ast::ConstantValue& condition = _evaluator.evaluate(whileStmt->condition);
+        if (condition.isScalar() && !condition.asBool()) {
+          _pass->branchesRemoved++;
+          return nullptr;
+        }
+        simplifyBody(&whileStmt->body);
+        return stmt;
+      }
+      case ast::NodeType::ForStmt: {
+        ast::ForStmt* forStmt = static_cast<ast::ForStmt*>(stmt);
+        foldExpression(&forStmt->condition);
+        simplifyBody(&forStmt->body);
+        return stmt;
+      }
+      case ast::NodeType::DoWhileStmt: {
+        ast::DoWhileStmt* doWhile = static_cast<ast::DoWhileStmt*>(stmt);
+        foldExpression(&doWhile->condition);
+        simplifyBody(&doWhile->body);
+        return stmt;
+      }
+      case ast::NodeType::SwitchStmt: {
+        ast::SwitchStmt* switchStmt = static_cast<ast::SwitchStmt*>(stmt);
+        foldExpression(&switchStmt->condition);
+        for (ast::SwitchCase* switchCase = switchStmt->cases; switchCase != nullptr;
+             switchCase = switchCase->next) {
+          simplifyStatements(&switchCase->body);
+        }
+        return stmt;
+      }
+      case ast::NodeType::Block:
+        simplifyStatements(&static_cast<ast::Block*>(stmt)->statements);
+        return stmt;
+      case ast::NodeType::ExpressionStmt:
+        foldExpression(&static_cast<ast::ExpressionStmt*>(stmt)->expression);
+        return stmt;
+      case ast::NodeType::ReturnStmt:
+        foldExpression(&static_cast<ast::ReturnStmt*>(stmt)->value);
+        return stmt;
+      case ast::NodeType::VariableStmt:
+        foldExpression(&static_cast<ast::VariableStmt*>(stmt)->initializer);
+        return stmt;
+      case ast::NodeType::AssignmentStmt:
+        foldExpression(&static_cast<ast::AssignmentStmt*>(stmt)->value);
+        return stmt;
+      case ast::NodeType::CallStmt:
+        foldExpression(&static_cast<ast::CallStmt*>(stmt)->arguments);
+        return stmt;
+      default:
+        return stmt;
+    }
+  }
+
+  // Replace the ternaries with a constant condition in the expression, and in the list of
+  // expressions that follow it, with the value they choose. The expressions are walked with an
+  // explicit stack of the pointers to them, as Visitor walks them, so a deeply nested
+  // expression can't overflow the stack.
+  void foldExpression(ast::Expression** root) {
+    _slots.clear();
+    _slots.push_back(root);
+    while (!_slots.empty()) {
+      ast::Expression** slot = _slots.back();
+      _slots.pop_back();
+      ast::Expression* expr = *slot;
+      if (expr == nullptr) {
+        continue;
+      }
+      if (expr->nodeType == ast::NodeType::TernaryExpr) {
+        ast::TernaryExpr* ternary = static_cast<ast::TernaryExpr*>(expr);
+        const ast::ConstantValue& condition = _evaluator.evaluate(ternary->condition);
+        ast::Expression* chosen = condition.asBool() ? ternary->trueExpr : ternary->falseExpr;
+        if (condition.isScalar() && chosen != nullptr) {
+          _pass->ternariesFolded++;
+          chosen->next = ternary->next;
+          *slot = chosen;
+          _slots.push_back(slot);
+          continue;
+        }
+      }
+      // An operand's next is null, and an element of a list is followed by the next one.
+      _slots.push_back(&expr->next);
+      pushOperands(expr);
+    }
+  }
+
+  void pushOperands(ast::Expression* expr) {
+    switch (expr->nodeType) {
+      case ast::NodeType::BinaryExpr:
+        _slots.push_back(&static_cast<ast::BinaryExpr*>(expr)->left);
+        _slots.push_back(&static_cast<ast::BinaryExpr*>(expr)->right);
+        break;
+      case ast::NodeType::PrefixExpr:
+        _slots.push_back(&static_cast<ast::PrefixExpr*>(expr)->expression);
+        break;
+      case ast::NodeType::TernaryExpr:
+        _slots.push_back(&static_cast<ast::TernaryExpr*>(expr)->condition);
+        _slots.push_back(&static_cast<ast::TernaryExpr*>(expr)->trueExpr);
+        _slots.push_back(&static_cast<ast::TernaryExpr*>(expr)->falseExpr);
+        break;
+      case ast::NodeType::CastExpr:
+        _slots.push_back(&static_cast<ast::CastExpr*>(expr)->value);
+        break;
+      case ast::NodeType::CallExpr:
+        _slots.push_back(&static_cast<ast::CallExpr*>(expr)->arguments);
+        break;
+      case ast::NodeType::ArrayExpr:
+        _slots.push_back(&static_cast<ast::ArrayExpr*>(expr)->array);
+        _slots.push_back(&static_cast<ast::ArrayExpr*>(expr)->index);
+        break;
+      case ast::NodeType::MemberExpr:
+        _slots.push_back(&static_cast<ast::MemberExpr*>(expr)->object);
+        // The arguments of a method call.
+        if (static_cast<ast::MemberExpr*>(expr)->member != nullptr &&
+            static_cast<ast::MemberExpr*>(expr)->member->nodeType == ast::NodeType::CallExpr) {
+          _slots.push_back(
+              &static_cast<ast::CallExpr*>(static_cast<ast::MemberExpr*>(expr)->member)->arguments);
+        }
+        break;
+      case ast::NodeType::AssignmentExpr:
+        _slots.push_back(&static_cast<ast::AssignmentExpr*>(expr)->variable);
+        _slots.push_back(&static_cast<ast::AssignmentExpr*>(expr)->value);
+        break;
+      case ast::NodeType::IncrementExpr:
+        _slots.push_back(&static_cast<ast::IncrementExpr*>(expr)->variable);
+        break;
+      case ast::NodeType::ArrayInitializerExpr:
+        _slots.push_back(&static_cast<ast::ArrayInitializerExpr*>(expr)->elements);
+        break;
+      case ast::NodeType::StructInitializerExpr:
+        _slots.push_back(&static_cast<ast::StructInitializerExpr*>(expr)->fields);
+        break;
+      default:
+        break;
+    }
+  }
+
+  // Remove the local variables that aren't used and have no side effects from a list of
+  // statements and the statements nested in them.
+  void removeUnusedLocals(ast::Statement** slot, const LocalUses& uses) {
+    while (*slot != nullptr) {
+      ast::Statement* stmt = *slot;
+      if (stmt->nodeType == ast::NodeType::VariableStmt) {
+        ast::VariableStmt* var = static_cast<ast::VariableStmt*>(stmt);
+        if (!uses.isUsed(var) && !hasSideEffects(var->initializer)) {
+          *slot = stmt->next;
+          _pass->localsRemoved++;
+          _removed = true;
+          continue;
+        }
+      }
+      removeUnusedLocalsIn(stmt, uses);
+      slot = &stmt->next;
+    }
+  }
+
+  void removeUnusedLocalsIn(ast::Statement* stmt, const LocalUses& uses) {
+    switch (stmt->nodeType) {
+      case ast::NodeType::Block:
+        removeUnusedLocals(&static_cast<ast::Block*>(stmt)->statements, uses);
+        break;
+      case ast::NodeType::IfStmt:
+        removeUnusedLocalsInBody(&static_cast<ast::IfStmt*>(stmt)->body, uses);
+        removeUnusedLocals(&static_cast<ast::IfStmt*>(stmt)->elseBody, uses);
+        break;
+      case ast::NodeType::ForStmt:
+        removeUnusedLocalsInBody(&static_cast<ast::ForStmt*>(stmt)->body, uses);
+        break;
+      case ast::NodeType::WhileStmt:
+        removeUnusedLocalsInBody(&static_cast<ast::WhileStmt*>(stmt)->body, uses);
+        break;
+      case ast::NodeType::DoWhileStmt:
+        removeUnusedLocalsInBody(&static_cast<ast::DoWhileStmt*>(stmt)->body, uses);
+        break;
+      case ast::NodeType::SwitchStmt:
+        for (ast::SwitchCase* switchCase = static_cast<ast::SwitchStmt*>(stmt)->cases;
+             switchCase != nullptr; switchCase = switchCase->next) {
+          removeUnusedLocals(&switchCase->body, uses);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  void removeUnusedLocalsInBody(ast::Statement** slot, const LocalUses& uses) {
+    removeUnusedLocals(slot, uses);
+    if (*slot == nullptr) {
+      *slot = _pass->ast->createNode<ast::Block>();
+    }
+  }
+
+  EliminateDeadCode* _pass;
+  ast::ConstantEvaluator& _evaluator;
+  std::vector<ast::Expression**> _slots;
+  bool _removed = false;
+};
+
+} // namespace
+
+EliminateDeadCode::EliminateDeadCode(ast::Ast* ast)
+    : ast(ast) {
+}
+
+void EliminateDeadCode::eliminate(const std::string_view& entryPoint) {
+  HLSL_TRACE_SCOPE("eliminate dead code");
+  ResolveSymbols(ast).resolve();
+  {
+    ast::ConstantEvaluator evaluator(ast);
+    DeadCodeRemover remover(this, evaluator);
+    for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+      if (stmt->nodeType == ast::NodeType::FunctionStmt) {
+        remover.simplifyFunction(static_cast<ast::FunctionStmt*>(stmt));
+      } else if (stmt->nodeType == ast::NodeType::StructStmt) {
+        for (ast::FunctionStmt* method = static_cast<ast::StructStmt*>(stmt)->methods;
+             method != nullptr; method = static_cast<ast::FunctionStmt*>(method->next)) {
+          remover.simplifyFunction(method);
+        }
+      }
+    }
+  }
+  PruneTree(ast).prune(entryPoint);
+}
+
+} // namespace visitor
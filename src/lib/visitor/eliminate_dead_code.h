@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string_view>
+
+#include "../ast/ast.h"
+
+namespace visitor {
+
+/// Removes the code in function bodies that static const flags make dead, such as the
+/// `if (_USE_RGBM)` blocks of shaders exported by Unity, then prunes the declarations no longer
+/// reachable from the entry point.
+///
+/// The conditions of if statements, while loops and ternaries are evaluated with
+/// ast::ConstantEvaluator, which knows the values of static const and local const variables. An
+/// if with a constant condition is replaced by the branch taken, a while loop that never runs and
+/// a ternary with a constant condition are folded, and local variables that are no longer used
+/// and whose initializers have no side effects are removed.
+///
+/// The Ast is changed in place. The statements removed stay in Ast::nodesOfType().
+class EliminateDeadCode {
+public:
+  ast::Ast* ast;
+
+  /// The number of if statements and while loops replaced by the code that runs.
+  size_t branchesRemoved = 0;
+  /// The number of ternaries replaced by the value they choose.
+  size_t ternariesFolded = 0;
+  /// The number of unused local variables removed.
+  size_t localsRemoved = 0;
+
+  EliminateDeadCode(ast::Ast* ast);
+
+  /// Remove the dead code of every function, then prune the Ast for the entry point with
+  /// PruneTree. This runs ResolveSymbols first to find the variables the code uses.
+  void eliminate(const std::string_view& entryPoint);
+};
+
+} // namespace visitor
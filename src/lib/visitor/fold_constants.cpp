@@ -0,0 +1,377 @@
+#include "fold_constants.h"
+
+#include <charconv>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../ast/constant_evaluator.h"
+#include "../util/trace.h"
+#include "resolve_symbols.h"
+
+namespace visitor {
+
+namespace {
+
+// Whether a value of the type can be written as a literal, rather than a cast of one.
+bool hasLiteral(ast::BaseType type) {
+  return type == ast::BaseType::Bool || type == ast::BaseType::Int ||
+         type == ast::BaseType::Uint || type == ast::BaseType::Float;
+}
+
+// Whether the expression is a literal, or a negated number, as the parser reads -1.
+bool isLiteral(const ast::Expression* expr) {
+  if (expr->nodeType == ast::NodeType::LiteralExpr) {
+    return true;
+  }
+  if (expr->nodeType != ast::NodeType::PrefixExpr) {
+    return false;
+  }
+  const ast::PrefixExpr* prefix = static_cast<const ast::PrefixExpr*>(expr);
+  return prefix->op == ast::Operator::Subtract && prefix->expression != nullptr &&
+         prefix->expression->nodeType == ast::NodeType::LiteralExpr &&
+         static_cast<const ast::LiteralExpr*>(prefix->expression)->type != ast::BaseType::Bool;
+}
+
+// Replaces the constant expressions of declarations and statements with their values.
+class ExpressionFolder {
+public:
+  explicit ExpressionFolder(FoldConstants* pass)
+      : _pass(pass)
+      , _evaluator(pass->ast) {}
+
+  void foldTopLevelStatement(ast::Statement* stmt) {
+    switch (stmt->nodeType) {
+      case ast::NodeType::FunctionStmt:
+        foldFunction(static_cast<ast::FunctionStmt*>(stmt));
+        break;
+      case ast::NodeType::StructStmt: {
+        ast::StructStmt* structStmt = static_cast<ast::StructStmt*>(stmt);
+        foldFields(structStmt->fields);
+        for (ast::FunctionStmt* method = structStmt->methods; method != nullptr;
+             method = static_cast<ast::FunctionStmt*>(method->next)) {
+          foldFunction(method);
+        }
+        break;
+      }
+      case ast::NodeType::BufferStmt:
+        foldFields(static_cast<ast::BufferStmt*>(stmt)->field);
+        break;
+      case ast::NodeType::TypedefStmt:
+        foldType(static_cast<ast::TypedefStmt*>(stmt)->type);
+        break;
+      default:
+        foldStatements(stmt, false);
+        break;
+    }
+  }
+
+private:
+  void foldFunction(ast::FunctionStmt* function) {
+    foldAttributes(function->attributes);
+    foldType(function->returnType);
+    for (ast::Parameter* param = function->parameters; param != nullptr; param = param->next) {
+      foldType(param->type);
+      foldExpression(&param->arraySize);
+      foldExpression(&param->initializer);
+    }
+    if (function->body != nullptr) {
+      foldStatements(function->body->statements, true);
+    }
+  }
+
+  void foldFields(ast::Field* field) {
+    for (; field != nullptr; field = field->next) {
+      foldType(field->type);
+      foldExpression(&field->arraySize);
+      foldExpression(&field->assignment);
+    }
+  }
+
+  void foldType(ast::Type* type) {
+    if (type != nullptr) {
+      foldExpression(&type->arraySize);
+    }
+  }
+
+  void foldAttributes(ast::Attribute* attribute) {
+    for (; attribute != nullptr; attribute = attribute->next) {
+      foldExpression(&attribute->argument);
+    }
+  }
+
+  // Fold the expressions of a statement, and of the statements after it if all is true.
+  void foldStatements(ast::Statement* stmt, bool all) {
+    for (; stmt != nullptr; stmt = all ? stmt->next : nullptr) {
+      foldAttributes(stmt->attributes);
+      switch (stmt->nodeType) {
+        case ast::NodeType::VariableStmt: {
+          ast::VariableStmt* var = static_cast<ast::VariableStmt*>(stmt);
+          foldType(var->type);
+          foldExpression(&var->arraySize);
+          foldExpression(&var->initializer);
+          break;
+        }
+        case ast::NodeType::Block:
+          foldStatements(static_cast<ast::Block*>(stmt)->statements, true);
+          break;
+        case ast::NodeType::IfStmt: {
+          ast::IfStmt* ifStmt = static_cast<ast::IfStmt*>(stmt);
+          foldExpression(&ifStmt->condition);
+          foldStatements(ifStmt->body, true);
+          foldStatements(ifStmt->elseBody, true);
+          break;
+        }
+        case ast::NodeType::ForStmt: {
+          ast::ForStmt* forStmt = static_cast<ast::ForStmt*>(stmt);
+          foldStatements(forStmt->initializer, true);
+          foldExpression(&forStmt->condition);
+          foldStatements(forStmt->increment, true);
+          foldStatements(forStmt->body, true);
+          break;
+        }
+        case ast::NodeType::WhileStmt: {
+          ast::WhileStmt* whileStmt = static_cast<ast::WhileStmt*>(stmt);
+          foldExpression(&whileStmt->condition);
+          foldStatements(whileStmt->body, true);
+          break;
+        }
+        case ast::NodeType::DoWhileStmt: {
+          ast::DoWhileStmt* doWhile = static_cast<ast::DoWhileStmt*>(stmt);
+          foldStatements(doWhile->body, true);
+          foldExpression(&doWhile->condition);
+          break;
+        }
+        case ast::NodeType::SwitchStmt: {
+          ast::SwitchStmt* switchStmt = static_cast<ast::SwitchStmt*>(stmt);
+          foldExpression(&switchStmt->condition);
+          for (ast::SwitchCase* switchCase = switchStmt->cases; switchCase != nullptr;
+               switchCase = switchCase->next) {
+            foldExpression(&switchCase->condition);
+            foldStatements(switchCase->body, true);
+          }
+          break;
+        }
+        case ast::NodeType::ExpressionStmt:
+          foldExpression(&static_cast<ast::ExpressionStmt*>(stmt)->expression);
+          break;
+        case ast::NodeType::ReturnStmt:
+          foldExpression(&static_cast<ast::ReturnStmt*>(stmt)->value);
+          break;
+        case ast::NodeType::AssignmentStmt:
+          foldExpression(&static_cast<ast::AssignmentStmt*>(stmt)->variable);
+          foldExpression(&static_cast<ast::AssignmentStmt*>(stmt)->value);
+          break;
+        case ast::NodeType::CallStmt:
+          foldExpression(&static_cast<ast::CallStmt*>(stmt)->arguments);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  // Fold the expression, and the list of expressions that follow it. The expressions are walked
+  // with an explicit stack of the pointers to them, as Visitor walks them, so a deeply nested
+  // expression can't overflow the stack.
+  void foldExpression(ast::Expression** root) {
+    _slots.clear();
+    _slots.push_back(root);
+    while (!_slots.empty()) {
+      ast::Expression** slot = _slots.back();
+      _slots.pop_back();
+      ast::Expression* expr = *slot;
+      if (expr == nullptr) {
+        continue;
+      }
+      ast::Expression* value = foldedValue(expr);
+      if (value != nullptr) {
+        value->next = expr->next;
+        *slot = value;
+        _pass->expressionsFolded++;
+        _slots.push_back(&value->next);
+        continue;
+      }
+      // An operand's next is null, and an element of a list is followed by the next one.
+      _slots.push_back(&expr->next);
+      pushOperands(expr);
+    }
+  }
+
+  void pushOperands(ast::Expression* expr) {
+    switch (expr->nodeType) {
+      case ast::NodeType::BinaryExpr:
+        _slots.push_back(&static_cast<ast::BinaryExpr*>(expr)->left);
+        _slots.push_back(&static_cast<ast::BinaryExpr*>(expr)->right);
+        break;
+      case ast::NodeType::PrefixExpr:
+        _slots.push_back(&static_cast<ast::PrefixExpr*>(expr)->expression);
+        break;
+      case ast::NodeType::TernaryExpr:
+        _slots.push_back(&static_cast<ast::TernaryExpr*>(expr)->condition);
+        _slots.push_back(&static_cast<ast::TernaryExpr*>(expr)->trueExpr);
+        _slots.push_back(&static_cast<ast::TernaryExpr*>(expr)->falseExpr);
+        break;
+      case ast::NodeType::CastExpr:
+        _slots.push_back(&static_cast<ast::CastExpr*>(expr)->value);
+        break;
+      case ast::NodeType::CallExpr:
+        _slots.push_back(&static_cast<ast::CallExpr*>(expr)->arguments);
+        break;
+      case ast::NodeType::ArrayExpr:
+        _slots.push_back(&static_cast<ast::ArrayExpr*>(expr)->array);
+        _slots.push_back(&static_cast<ast::ArrayExpr*>(expr)->index);
+        break;
+      case ast::NodeType::MemberExpr: {
+        // A swizzle of a const vector, such as COLOR.rgb, is left as it is rather than becoming
+        // a swizzle of a constructor. The member is a name, not an expression to fold, but a
+        // method call has arguments.
+        ast::MemberExpr* member = static_cast<ast::MemberExpr*>(expr);
+        if (member->object != nullptr &&
+            member->object->nodeType != ast::NodeType::VariableExpr) {
+          _slots.push_back(&member->object);
+        }
+        if (member->member != nullptr && member->member->nodeType == ast::NodeType::CallExpr) {
+          _slots.push_back(&static_cast<ast::CallExpr*>(member->member)->arguments);
+        }
+        break;
+      }
+      case ast::NodeType::AssignmentExpr:
+        _slots.push_back(&static_cast<ast::AssignmentExpr*>(expr)->variable);
+        _slots.push_back(&static_cast<ast::AssignmentExpr*>(expr)->value);
+        break;
+      case ast::NodeType::IncrementExpr:
+        _slots.push_back(&static_cast<ast::IncrementExpr*>(expr)->variable);
+        break;
+      case ast::NodeType::ArrayInitializerExpr:
+        _slots.push_back(&static_cast<ast::ArrayInitializerExpr*>(expr)->elements);
+        break;
+      case ast::NodeType::StructInitializerExpr:
+        _slots.push_back(&static_cast<ast::StructInitializerExpr*>(expr)->fields);
+        break;
+      default:
+        break;
+    }
+  }
+
+  // The expression to replace the expression with, or null if it isn't constant or is already
+  // written as its value.
+  ast::Expression* foldedValue(ast::Expression* expr) {
+    switch (expr->nodeType) {
+      case ast::NodeType::VariableExpr:
+      case ast::NodeType::PrefixExpr:
+      case ast::NodeType::BinaryExpr:
+      case ast::NodeType::TernaryExpr:
+      case ast::NodeType::CastExpr:
+        break;
+      default:
+        return nullptr;
+    }
+    if (isLiteral(expr)) {
+      return nullptr;
+    }
+    const ast::ConstantValue& value = _evaluator.evaluate(expr);
+    if (!value.isConstant()) {
+      return nullptr;
+    }
+    if (expr->nodeType == ast::NodeType::CastExpr && isWrittenAs(static_cast<ast::CastExpr*>(expr),
+                                                                 value)) {
+      return nullptr;
+    }
+    for (uint32_t i = 0; i < value.size; ++i) {
+      if (!value.isInteger() && value.type != ast::BaseType::Bool &&
+          !std::isfinite(value.components[i].f)) {
+        return nullptr;
+      }
+    }
+
+    ast::Expression* folded = nullptr;
+    if (value.isScalar() && hasLiteral(value.type)) {
+      folded = createLiteral(value, 0, expr->offset);
+    } else {
+      ast::CastExpr* cast = _pass->ast->createNode<ast::CastExpr>();
+      cast->offset = expr->offset;
+      cast->type = _pass->ast->createNode<ast::Type>();
+      cast->type->offset = expr->offset;
+      cast->type->baseType = value.baseType();
+      ast::Expression** last = &cast->value;
+      for (uint32_t i = 0; i < value.size; ++i) {
+        *last = createLiteral(value, i, expr->offset);
+        last = &(*last)->next;
+      }
+      folded = cast;
+    }
+    folded->constant = expr->constant;
+    return folded;
+  }
+
+  // Whether the cast is already the constructor of literals that folding would make of it.
+  bool isWrittenAs(const ast::CastExpr* cast, const ast::ConstantValue& value) const {
+    if (value.isScalar() && hasLiteral(value.type)) {
+      return false;
+    }
+    uint32_t size = 0;
+    for (const ast::Expression* expr = cast->value; expr != nullptr; expr = expr->next) {
+      if (!isLiteral(expr)) {
+        return false;
+      }
+      size++;
+    }
+    return size == value.size;
+  }
+
+  ast::LiteralExpr* createLiteral(const ast::ConstantValue& value, uint32_t index,
+                                  uint32_t offset) {
+    ast::LiteralExpr* literal = _pass->ast->createNode<ast::LiteralExpr>();
+    literal->offset = offset;
+    std::string text;
+    if (value.type == ast::BaseType::Bool) {
+      literal->type = ast::BaseType::Bool;
+      literal->intValue = value.asBool(index) ? 1 : 0;
+      text = value.asBool(index) ? "true" : "false";
+    } else if (value.isInteger()) {
+      const bool isUint = value.type == ast::BaseType::Uint ||
+                          value.type == ast::BaseType::Min16uint;
+      literal->type = isUint ? ast::BaseType::Uint : ast::BaseType::Int;
+      literal->intValue = isUint ? static_cast<int64_t>(value.asUint(index)) : value.asInt(index);
+      text = isUint ? std::to_string(value.asUint(index)) + "u"
+                    : std::to_string(value.asInt(index));
+    } else {
+      literal->type = ast::BaseType::Float;
+      literal->floatValue = value.asFloat(index);
+      // The shortest text that reads back as the same float, with a decimal point so it's read
+      // as a float rather than an int.
+      char buffer[32];
+      const std::to_chars_result result =
+          std::to_chars(buffer, buffer + sizeof(buffer), value.asFloat(index));
+      text.assign(buffer, result.ptr);
+      const size_t exponent = text.find('e');
+      if (text.find('.') == std::string::npos) {
+        text.insert(exponent == std::string::npos ? text.size() : exponent, ".0");
+      }
+    }
+    literal->value = _pass->ast->addString(text);
+    return literal;
+  }
+
+  FoldConstants* _pass;
+  ast::ConstantEvaluator _evaluator;
+  std::vector<ast::Expression**> _slots;
+};
+
+} // namespace
+
+FoldConstants::FoldConstants(ast::Ast* ast)
+    : ast(ast) {
+}
+
+void FoldConstants::fold() {
+  HLSL_TRACE_SCOPE("fold constants");
+  ResolveSymbols(ast).resolve();
+  ExpressionFolder folder(this);
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    folder.foldTopLevelStatement(stmt);
+  }
+}
+
+} // namespace visitor
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "../ast/ast.h"
+
+namespace visitor {
+
+/// Replaces the expressions whose values are known at compile time with their values, such as
+/// SIZE * 2 with 8 and float3(0.5, 0.5, 0.5) * 2 with float3(1.0, 1.0, 1.0), including the
+/// references to static const and local const variables.
+///
+/// The values are found with ast::ConstantEvaluator, which caches the value of each expression on
+/// it, and the expressions that replace them keep those values. A scalar becomes a LiteralExpr,
+/// and a vector, or a scalar of a lower precision type such as half, a CastExpr of literals, such
+/// as float3(1.0, 2.0, 3.0). A float that isn't finite has no literal, so it isn't folded.
+///
+/// The Ast is changed in place. The expressions replaced stay in Ast::nodesOfType().
+class FoldConstants {
+public:
+  ast::Ast* ast;
+
+  /// The number of expressions replaced by their values.
+  size_t expressionsFolded = 0;
+
+  FoldConstants(ast::Ast* ast);
+
+  /// Fold the expressions of every declaration and function. This runs ResolveSymbols first to
+  /// find the variables the expressions use.
+  void fold();
+};
+
+} // namespace visitor
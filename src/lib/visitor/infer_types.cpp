@@ -0,0 +1,791 @@
+#include "infer_types.h"
+
+#include <algorithm>
+
+#include "../util/trace.h"
+#include "resolve_symbols.h"
+
+namespace visitor {
+
+namespace {
+
+using ast::BaseType;
+using ast::ExpressionType;
+
+// Typedefs and member chains nested deeper than this aren't followed, so a cycle of typedefs or
+// a very long chain can't overflow the stack.
+const int maxDepth = 64;
+
+// The shape of a scalar, vector or matrix type.
+struct Shape {
+  // The scalar type of the components, or Undefined if the type isn't a scalar, vector or matrix.
+  BaseType scalar = BaseType::Undefined;
+  // The number of components of a scalar or vector, or 0 for a matrix.
+  int size = 0;
+  int rows = 0;
+  int columns = 0;
+
+  bool isNumeric() const { return scalar != BaseType::Undefined; }
+};
+
+Shape shapeOf(const ExpressionType& type) {
+  Shape shape;
+  const BaseType base = type.base();
+  if (type.array || !(ast::isScalarBaseType(base) || base >= BaseType::Float1)) {
+    return shape;
+  }
+  shape.scalar = ast::scalarBaseType(base);
+  shape.size = ast::vectorSize(base);
+  shape.rows = ast::matrixRows(base);
+  shape.columns = ast::matrixColumns(base);
+  return shape;
+}
+
+// The type of the shape, with the components of the scalar type.
+ExpressionType typeOfShape(const Shape& shape, BaseType scalar) {
+  return ExpressionType::of(shape.size != 0
+      ? ast::vectorBaseType(scalar, shape.size)
+      : ast::matrixBaseType(scalar, shape.rows, shape.columns));
+}
+
+// The order in which the scalar types are promoted, so the more precise of two is chosen.
+int precision(BaseType scalar) {
+  switch (scalar) {
+    case BaseType::Bool: return 1;
+    case BaseType::Min12int: return 2;
+    case BaseType::Min16int: return 3;
+    case BaseType::Int: return 4;
+    case BaseType::Min16uint: return 5;
+    case BaseType::Uint: return 6;
+    case BaseType::Min10float: return 7;
+    case BaseType::Min16float: return 8;
+    case BaseType::Half: return 9;
+    case BaseType::Float: return 10;
+    default: return 0;
+  }
+}
+
+bool isFloat(BaseType scalar) {
+  return scalar == BaseType::Float || scalar == BaseType::Half ||
+         scalar == BaseType::Min10float || scalar == BaseType::Min16float;
+}
+
+// The scalar type of an arithmetic operation on the scalar type, which promotes bool to int.
+BaseType arithmetic(BaseType scalar) {
+  return scalar == BaseType::Bool ? BaseType::Int : scalar;
+}
+
+// The shape of an operation on values of the two shapes. A scalar is repeated to the shape of
+// the other, and the larger of two vectors or matrices is truncated to the smaller.
+// @return false if the shapes can't be combined.
+bool combine(const Shape& a, const Shape& b, Shape* result) {
+  if (!a.isNumeric() || !b.isNumeric()) {
+    return false;
+  }
+  if (a.size == 1) {
+    *result = b;
+  } else if (b.size == 1) {
+    *result = a;
+  } else if (a.size != 0 && b.size != 0) {
+    *result = a;
+    result->size = std::min(a.size, b.size);
+  } else if (a.size == 0 && b.size == 0) {
+    *result = a;
+    result->rows = std::min(a.rows, b.rows);
+    result->columns = std::min(a.columns, b.columns);
+  } else {
+    return false;
+  }
+  result->scalar = precision(a.scalar) >= precision(b.scalar) ? a.scalar : b.scalar;
+  return true;
+}
+
+// The type both values can be converted to: their type if it's the same, such as a struct, or
+// the combined type of two numeric types.
+ExpressionType commonType(const ExpressionType& a, const ExpressionType& b) {
+  if (a == b) {
+    return a;
+  }
+  Shape shape;
+  if (!combine(shapeOf(a), shapeOf(b), &shape)) {
+    return ExpressionType();
+  }
+  return typeOfShape(shape, shape.scalar);
+}
+
+bool isTexture(BaseType type) {
+  return (type >= BaseType::RWTexture1D && type <= BaseType::RWTexture3D) ||
+         (type >= BaseType::Texture && type <= BaseType::TextureCubeArray);
+}
+
+bool isBuffer(BaseType type) {
+  return type == BaseType::RWBuffer || type == BaseType::RWStructuredBuffer ||
+         type == BaseType::StructuredBuffer;
+}
+
+// The declared type of a VariableStmt, Parameter or Field, and whether it's an array.
+const ast::Type* declaredType(const ast::Node* declaration, bool* array) {
+  if (declaration == nullptr) {
+    return nullptr;
+  }
+  switch (declaration->nodeType) {
+    case ast::NodeType::VariableStmt: {
+      const ast::VariableStmt* variable = static_cast<const ast::VariableStmt*>(declaration);
+      *array = variable->isArray;
+      return variable->type;
+    }
+    case ast::NodeType::Parameter: {
+      const ast::Parameter* parameter = static_cast<const ast::Parameter*>(declaration);
+      *array = parameter->isArray;
+      return parameter->type;
+    }
+    case ast::NodeType::Field: {
+      const ast::Field* field = static_cast<const ast::Field*>(declaration);
+      *array = field->isArray;
+      return field->type;
+    }
+    default:
+      return nullptr;
+  }
+}
+
+} // namespace
+
+InferTypes::InferTypes(ast::Ast* ast)
+    : ast(ast) {
+}
+
+void InferTypes::infer() {
+  HLSL_TRACE_SCOPE("infer types");
+  ResolveSymbols(ast).resolve();
+  _typedefs.clear();
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::TypedefStmt) {
+      const ast::TypedefStmt* typedefStmt = static_cast<const ast::TypedefStmt*>(stmt);
+      _typedefs[typedefStmt->name] = typedefStmt->type;
+    }
+  }
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    switch (stmt->nodeType) {
+      case ast::NodeType::StructStmt:
+        visitStructStmt(static_cast<ast::StructStmt*>(stmt));
+        break;
+      case ast::NodeType::BufferStmt:
+        visitBufferStmt(static_cast<ast::BufferStmt*>(stmt));
+        break;
+      case ast::NodeType::FunctionStmt:
+        visitFunctionStmt(static_cast<ast::FunctionStmt*>(stmt));
+        break;
+      case ast::NodeType::TypedefStmt:
+        visitTypedefStmt(static_cast<ast::TypedefStmt*>(stmt));
+        break;
+      case ast::NodeType::VariableStmt:
+        visitVariableStmt(static_cast<ast::VariableStmt*>(stmt));
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+ExpressionType InferTypes::typeOf(const ast::Type* type, bool array) {
+  if (type == nullptr) {
+    return ExpressionType();
+  }
+  array = array || type->array;
+  switch (type->baseType) {
+    case BaseType::UserDefined: {
+      auto it = _typedefs.find(type->name);
+      if (it != _typedefs.end()) {
+        if (_typedefDepth >= maxDepth) {
+          return ExpressionType();
+        }
+        _typedefDepth++;
+        ExpressionType result = typeOf(it->second, array);
+        _typedefDepth--;
+        return result;
+      }
+      ast::StructStmt* structStmt = ast->findStruct(type->name);
+      if (structStmt == nullptr) {
+        return ExpressionType();
+      }
+      return ExpressionType::of(BaseType::Struct, array, ast->typeStructIndex(structStmt));
+    }
+    case BaseType::Struct: {
+      ast::StructStmt* structStmt = ast->findStruct(type->name);
+      return ExpressionType::of(BaseType::Struct, array,
+                                structStmt != nullptr ? ast->typeStructIndex(structStmt) : 0);
+    }
+    case BaseType::Vector:
+    case BaseType::Matrix: {
+      // vector<float, 3> and matrix<float> name the scalar type and the size.
+      BaseType scalar = BaseType::Float;
+      int size = 4;
+      const ast::TemplateArg* arg = type->templateArg;
+      if (arg != nullptr && arg->value != nullptr && arg->value->nodeType == ast::NodeType::Type) {
+        scalar = ast::scalarBaseType(static_cast<const ast::Type*>(arg->value)->baseType);
+        arg = arg->next;
+      }
+      if (arg != nullptr && arg->value != nullptr &&
+          arg->value->nodeType == ast::NodeType::LiteralExpr) {
+        size = static_cast<int>(static_cast<const ast::LiteralExpr*>(arg->value)->intValue);
+      }
+      return ExpressionType::of(type->baseType == BaseType::Vector
+                                    ? ast::vectorBaseType(scalar, size)
+                                    : ast::matrixBaseType(scalar, 4, 4),
+                                array);
+    }
+    default:
+      return ExpressionType::of(type->baseType, array);
+  }
+}
+
+void InferTypes::visitExpression(ast::Expression* node) {
+  if (node == nullptr) {
+    return;
+  }
+  // Collect the tree in pre-order, then type it in reverse, so each expression is typed after
+  // its operands.
+  const size_t base = _order.size();
+  _pending.push_back(node);
+  while (!_pending.empty()) {
+    ast::Expression* expr = _pending.back();
+    _pending.pop_back();
+    _order.push_back(expr);
+    pushOperands(expr);
+  }
+  for (size_t i = _order.size(); i-- > base;) {
+    setType(_order[i], typeOfExpression(_order[i]));
+  }
+  _order.resize(base);
+}
+
+void InferTypes::visitFunctionStmt(ast::FunctionStmt* node) {
+  visitAttributes(node->attributes);
+  visitType(node->returnType);
+  for (ast::Parameter* parameter = node->parameters; parameter != nullptr;
+       parameter = parameter->next) {
+    visitParameter(parameter);
+  }
+  if (node->body != nullptr) {
+    visitBlock(node->body);
+  }
+}
+
+void InferTypes::visitStructStmt(ast::StructStmt* node) {
+  StaticVisitor::visitStructStmt(node);
+  for (ast::Statement* method = node->methods; method != nullptr; method = method->next) {
+    visitFunctionStmt(static_cast<ast::FunctionStmt*>(method));
+  }
+}
+
+void InferTypes::visitStructField(ast::Field* node) {
+  visitBufferField(node);
+}
+
+void InferTypes::visitBufferField(ast::Field* node) {
+  visitType(node->type);
+  for (ast::Expression* size = node->arraySize; size != nullptr; size = size->next) {
+    visitExpression(size);
+  }
+  visitExpression(node->assignment);
+}
+
+void InferTypes::visitVariableStmt(ast::VariableStmt* node) {
+  visitType(node->type);
+  for (ast::Expression* size = node->arraySize; size != nullptr; size = size->next) {
+    visitExpression(size);
+  }
+  visitExpression(node->initializer);
+}
+
+void InferTypes::visitParameter(ast::Parameter* node) {
+  visitType(node->type);
+  for (ast::Expression* size = node->arraySize; size != nullptr; size = size->next) {
+    visitExpression(size);
+  }
+  visitExpression(node->initializer);
+}
+
+void InferTypes::visitAttribute(ast::Attribute* node) {
+  for (ast::Expression* argument = node->argument; argument != nullptr;
+       argument = argument->next) {
+    visitExpression(argument);
+  }
+}
+
+void InferTypes::visitType(ast::Type* type) {
+  if (type == nullptr) {
+    return;
+  }
+  for (ast::Expression* size = type->arraySize; size != nullptr; size = size->next) {
+    visitExpression(size);
+  }
+  // The size of vector<float, 3> is an expression.
+  for (ast::TemplateArg* arg = type->templateArg; arg != nullptr; arg = arg->next) {
+    if (arg->value != nullptr && arg->value->nodeType != ast::NodeType::Type) {
+      visitExpression(static_cast<ast::Expression*>(arg->value));
+    }
+  }
+}
+
+void InferTypes::pushOperands(ast::Expression* expr) {
+  auto push = [this](ast::Expression* operand) {
+    if (operand != nullptr) {
+      _pending.push_back(operand);
+    }
+  };
+  auto pushList = [this](ast::Expression* operand) {
+    for (; operand != nullptr; operand = operand->next) {
+      _pending.push_back(operand);
+    }
+  };
+  switch (expr->nodeType) {
+    case ast::NodeType::BinaryExpr:
+      push(static_cast<ast::BinaryExpr*>(expr)->left);
+      push(static_cast<ast::BinaryExpr*>(expr)->right);
+      break;
+    case ast::NodeType::PrefixExpr:
+      push(static_cast<ast::PrefixExpr*>(expr)->expression);
+      break;
+    case ast::NodeType::IncrementExpr:
+      push(static_cast<ast::IncrementExpr*>(expr)->variable);
+      break;
+    case ast::NodeType::TernaryExpr: {
+      ast::TernaryExpr* ternary = static_cast<ast::TernaryExpr*>(expr);
+      push(ternary->condition);
+      push(ternary->trueExpr);
+      push(ternary->falseExpr);
+      break;
+    }
+    case ast::NodeType::CastExpr:
+      pushList(static_cast<ast::CastExpr*>(expr)->value);
+      break;
+    case ast::NodeType::CallExpr:
+      pushList(static_cast<ast::CallExpr*>(expr)->arguments);
+      break;
+    case ast::NodeType::ArrayExpr:
+      push(static_cast<ast::ArrayExpr*>(expr)->array);
+      push(static_cast<ast::ArrayExpr*>(expr)->index);
+      break;
+    case ast::NodeType::AssignmentExpr:
+      push(static_cast<ast::AssignmentExpr*>(expr)->variable);
+      push(static_cast<ast::AssignmentExpr*>(expr)->value);
+      break;
+    case ast::NodeType::ArrayInitializerExpr:
+      pushList(static_cast<ast::ArrayInitializerExpr*>(expr)->elements);
+      break;
+    case ast::NodeType::StructInitializerExpr:
+      pushList(static_cast<ast::StructInitializerExpr*>(expr)->fields);
+      break;
+    case ast::NodeType::MemberExpr: {
+      ast::MemberExpr* member = static_cast<ast::MemberExpr*>(expr);
+      push(member->object);
+      if (member->member != nullptr) {
+        pushMemberOperands(member->member);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void InferTypes::pushMemberOperands(ast::Expression* member) {
+  if (_memberDepth >= maxDepth) {
+    return;
+  }
+  _memberDepth++;
+  switch (member->nodeType) {
+    case ast::NodeType::VariableExpr:
+      break;
+    case ast::NodeType::CallExpr:
+      for (ast::Expression* argument = static_cast<ast::CallExpr*>(member)->arguments;
+           argument != nullptr; argument = argument->next) {
+        _pending.push_back(argument);
+      }
+      break;
+    case ast::NodeType::MemberExpr: {
+      ast::MemberExpr* memberExpr = static_cast<ast::MemberExpr*>(member);
+      pushMemberOperands(memberExpr->object);
+      if (memberExpr->member != nullptr) {
+        pushMemberOperands(memberExpr->member);
+      }
+      break;
+    }
+    case ast::NodeType::ArrayExpr: {
+      ast::ArrayExpr* array = static_cast<ast::ArrayExpr*>(member);
+      pushMemberOperands(array->array);
+      if (array->index != nullptr) {
+        _pending.push_back(array->index);
+      }
+      break;
+    }
+    case ast::NodeType::IncrementExpr:
+      pushMemberOperands(static_cast<ast::IncrementExpr*>(member)->variable);
+      break;
+    case ast::NodeType::TernaryExpr: {
+      // The parser reads a.b ? c : d with the ternary as the member.
+      ast::TernaryExpr* ternary = static_cast<ast::TernaryExpr*>(member);
+      pushMemberOperands(ternary->condition);
+      _pending.push_back(ternary->trueExpr);
+      _pending.push_back(ternary->falseExpr);
+      break;
+    }
+    default:
+      break;
+  }
+  _memberDepth--;
+}
+
+ExpressionType InferTypes::setType(ast::Expression* expr, const ExpressionType& type) {
+  expr->resolvedType = type;
+  expressionsTyped++;
+  if (!type.isKnown()) {
+    expressionsUnknown++;
+  }
+  return type;
+}
+
+ExpressionType InferTypes::typeOfExpression(ast::Expression* expr) {
+  switch (expr->nodeType) {
+    case ast::NodeType::LiteralExpr:
+      return ExpressionType::of(static_cast<ast::LiteralExpr*>(expr)->type);
+    case ast::NodeType::VariableExpr:
+      return typeOfDeclaration(static_cast<ast::VariableExpr*>(expr)->declaration);
+    case ast::NodeType::SamplerState:
+      return ExpressionType::of(BaseType::SamplerState);
+    case ast::NodeType::CastExpr:
+      return typeOf(static_cast<ast::CastExpr*>(expr)->type);
+    case ast::NodeType::CallExpr:
+      return typeOfCall(static_cast<ast::CallExpr*>(expr));
+    case ast::NodeType::BinaryExpr:
+      return typeOfBinary(static_cast<ast::BinaryExpr*>(expr));
+    case ast::NodeType::PrefixExpr: {
+      const ast::PrefixExpr* prefix = static_cast<ast::PrefixExpr*>(expr);
+      if (prefix->expression == nullptr) {
+        return ExpressionType();
+      }
+      const Shape shape = shapeOf(prefix->expression->resolvedType);
+      if (!shape.isNumeric()) {
+        return ExpressionType();
+      }
+      return typeOfShape(shape, prefix->op == ast::Operator::Not ? BaseType::Bool
+                                                                 : arithmetic(shape.scalar));
+    }
+    case ast::NodeType::IncrementExpr: {
+      const ast::Expression* variable = static_cast<ast::IncrementExpr*>(expr)->variable;
+      return variable != nullptr ? variable->resolvedType : ExpressionType();
+    }
+    case ast::NodeType::AssignmentExpr: {
+      const ast::Expression* variable = static_cast<ast::AssignmentExpr*>(expr)->variable;
+      return variable != nullptr ? variable->resolvedType : ExpressionType();
+    }
+    case ast::NodeType::TernaryExpr: {
+      const ast::TernaryExpr* ternary = static_cast<ast::TernaryExpr*>(expr);
+      if (ternary->trueExpr == nullptr || ternary->falseExpr == nullptr) {
+        return ExpressionType();
+      }
+      return commonType(ternary->trueExpr->resolvedType, ternary->falseExpr->resolvedType);
+    }
+    case ast::NodeType::ArrayExpr: {
+      const ast::Expression* array = static_cast<ast::ArrayExpr*>(expr)->array;
+      return array != nullptr ? typeOfIndex(array->resolvedType, array) : ExpressionType();
+    }
+    case ast::NodeType::MemberExpr: {
+      ast::MemberExpr* member = static_cast<ast::MemberExpr*>(expr);
+      if (member->object == nullptr || member->member == nullptr) {
+        return ExpressionType();
+      }
+      return typeOfMember(member->object->resolvedType, member->object, member->member);
+    }
+    case ast::NodeType::StructInitializerExpr: {
+      ast::StructStmt* structStmt = static_cast<ast::StructInitializerExpr*>(expr)->structType;
+      return structStmt != nullptr
+          ? ExpressionType::of(BaseType::Struct, false, ast->typeStructIndex(structStmt))
+          : ExpressionType();
+    }
+    case ast::NodeType::ArrayInitializerExpr: {
+      // An array of the type of its elements, if they're all the same.
+      const ast::Expression* element = static_cast<ast::ArrayInitializerExpr*>(expr)->elements;
+      if (element == nullptr || element->resolvedType.array) {
+        return ExpressionType();
+      }
+      const ExpressionType type = element->resolvedType;
+      for (; element != nullptr; element = element->next) {
+        if (element->resolvedType != type) {
+          return ExpressionType();
+        }
+      }
+      return ExpressionType::of(type.base(), true, type.structIndex);
+    }
+    default:
+      return ExpressionType();
+  }
+}
+
+ExpressionType InferTypes::typeOfDeclaration(const ast::Node* declaration) {
+  bool array = false;
+  const ast::Type* type = declaredType(declaration, &array);
+  return type != nullptr ? typeOf(type, array) : ExpressionType();
+}
+
+ExpressionType InferTypes::typeOfCall(ast::CallExpr* call) {
+  if (call->function != nullptr) {
+    return typeOf(call->function->returnType);
+  }
+  const ast::IntrinsicInfo& intrinsic = ast::intrinsicInfo(call->intrinsic);
+  if (call->intrinsic == ast::Intrinsic::None || intrinsic.method) {
+    return ExpressionType();
+  }
+  if (intrinsic.returns == ast::IntrinsicReturn::Type) {
+    return ExpressionType::of(intrinsic.returnType);
+  }
+
+  const Shape first = call->arguments != nullptr ? shapeOf(call->arguments->resolvedType)
+                                                 : Shape();
+  if (!first.isNumeric()) {
+    return ExpressionType();
+  }
+  const BaseType floatScalar = isFloat(first.scalar) ? first.scalar : BaseType::Float;
+  switch (intrinsic.returns) {
+    case ast::IntrinsicReturn::FloatOfFirst:
+      return typeOfShape(first, floatScalar);
+    case ast::IntrinsicReturn::FloatScalar:
+      return ExpressionType::of(floatScalar);
+    case ast::IntrinsicReturn::BoolOfFirst:
+      return typeOfShape(first, BaseType::Bool);
+    case ast::IntrinsicReturn::IntOfFirst:
+      return typeOfShape(first, BaseType::Int);
+    case ast::IntrinsicReturn::UintOfFirst:
+      return typeOfShape(first, BaseType::Uint);
+    case ast::IntrinsicReturn::AsFloat:
+      return typeOfShape(first, BaseType::Float);
+    case ast::IntrinsicReturn::Transpose: {
+      Shape transposed = first;
+      std::swap(transposed.rows, transposed.columns);
+      return typeOfShape(transposed, first.scalar);
+    }
+    case ast::IntrinsicReturn::Common:
+    case ast::IntrinsicReturn::CommonScalar: {
+      Shape shape = first;
+      for (const ast::Expression* argument = call->arguments->next; argument != nullptr;
+           argument = argument->next) {
+        if (!combine(shape, shapeOf(argument->resolvedType), &shape)) {
+          return ExpressionType();
+        }
+      }
+      return intrinsic.returns == ast::IntrinsicReturn::Common
+          ? typeOfShape(shape, shape.scalar)
+          : ExpressionType::of(shape.scalar);
+    }
+    case ast::IntrinsicReturn::Mul: {
+      if (call->arguments->next == nullptr) {
+        return ExpressionType();
+      }
+      const Shape second = shapeOf(call->arguments->next->resolvedType);
+      Shape result;
+      if (!second.isNumeric()) {
+        return ExpressionType();
+      }
+      const BaseType scalar =
+          precision(first.scalar) >= precision(second.scalar) ? first.scalar : second.scalar;
+      if (first.size == 1 || second.size == 1) {
+        // A scalar scales the other.
+        result = first.size == 1 ? second : first;
+      } else if (first.size != 0 && second.size != 0) {
+        // The dot product of two vectors.
+        result.size = 1;
+      } else if (first.size != 0) {
+        // A row vector times a matrix gives a row of its columns.
+        result.size = second.columns;
+      } else if (second.size != 0) {
+        result.size = first.rows;
+      } else {
+        result.rows = first.rows;
+        result.columns = second.columns;
+      }
+      return typeOfShape(result, scalar);
+    }
+    default:
+      return ExpressionType();
+  }
+}
+
+ExpressionType InferTypes::typeOfBinary(const ast::BinaryExpr* binary) {
+  if (binary->left == nullptr || binary->right == nullptr) {
+    return ExpressionType();
+  }
+  Shape shape;
+  if (!combine(shapeOf(binary->left->resolvedType), shapeOf(binary->right->resolvedType),
+               &shape)) {
+    return ExpressionType();
+  }
+  switch (binary->op) {
+    case ast::Operator::OrOr:
+    case ast::Operator::AndAnd:
+    case ast::Operator::EqualEqual:
+    case ast::Operator::NotEqual:
+    case ast::Operator::Less:
+    case ast::Operator::LessEqual:
+    case ast::Operator::Greater:
+    case ast::Operator::GreaterEqual:
+      return typeOfShape(shape, BaseType::Bool);
+    default:
+      return typeOfShape(shape, arithmetic(shape.scalar));
+  }
+}
+
+ExpressionType InferTypes::typeOfIndex(const ExpressionType& array, const ast::Expression* expr) {
+  if (array.array) {
+    return ExpressionType::of(array.base(), false, array.structIndex);
+  }
+  const BaseType base = array.base();
+  if (isTexture(base) || isBuffer(base)) {
+    return elementType(base, expr);
+  }
+  // A component of a vector, or a row of a matrix.
+  const Shape shape = shapeOf(array);
+  if (!shape.isNumeric()) {
+    return ExpressionType();
+  }
+  return ExpressionType::of(ast::vectorBaseType(shape.scalar, shape.size != 0 ? 1 : shape.columns));
+}
+
+ExpressionType InferTypes::typeOfMember(const ExpressionType& object,
+                                        const ast::Expression* objectExpr,
+                                        ast::Expression* member) {
+  if (_memberDepth >= maxDepth) {
+    return ExpressionType();
+  }
+  _memberDepth++;
+  ExpressionType result;
+  switch (member->nodeType) {
+    case ast::NodeType::VariableExpr:
+      result = setType(member, typeOfField(object, static_cast<ast::VariableExpr*>(member)));
+      break;
+    case ast::NodeType::CallExpr:
+      result = setType(member,
+                       typeOfMethod(object, objectExpr, static_cast<ast::CallExpr*>(member)));
+      break;
+    case ast::NodeType::MemberExpr: {
+      // a.b.c is read as a.(b.c), so b is the member of a, and c the member of b.
+      ast::MemberExpr* memberExpr = static_cast<ast::MemberExpr*>(member);
+      const ExpressionType inner = typeOfMember(object, objectExpr, memberExpr->object);
+      if (memberExpr->member != nullptr) {
+        result = typeOfMember(inner, memberExpr->object, memberExpr->member);
+      }
+      setType(member, result);
+      break;
+    }
+    case ast::NodeType::ArrayExpr: {
+      ast::ArrayExpr* array = static_cast<ast::ArrayExpr*>(member);
+      result = setType(member, typeOfIndex(typeOfMember(object, objectExpr, array->array),
+                                           array->array));
+      break;
+    }
+    case ast::NodeType::IncrementExpr:
+      result = setType(member, typeOfMember(object, objectExpr,
+                                            static_cast<ast::IncrementExpr*>(member)->variable));
+      break;
+    case ast::NodeType::TernaryExpr: {
+      ast::TernaryExpr* ternary = static_cast<ast::TernaryExpr*>(member);
+      typeOfMember(object, objectExpr, ternary->condition);
+      if (ternary->trueExpr != nullptr && ternary->falseExpr != nullptr) {
+        result = commonType(ternary->trueExpr->resolvedType, ternary->falseExpr->resolvedType);
+      }
+      setType(member, result);
+      break;
+    }
+    default:
+      break;
+  }
+  _memberDepth--;
+  return result;
+}
+
+ExpressionType InferTypes::typeOfField(const ExpressionType& object, ast::VariableExpr* member) {
+  if (object.array) {
+    return ExpressionType();
+  }
+  if (object.base() == BaseType::Struct) {
+    ast::StructStmt* structStmt = ast->typeStruct(object.structIndex);
+    if (structStmt == nullptr) {
+      return ExpressionType();
+    }
+    // ResolveSymbols only resolves the first member of a chain such as a.b.c.
+    for (ast::Field* field = structStmt->fields; field != nullptr; field = field->next) {
+      if (field->name == member->name) {
+        member->declaration = field;
+        return typeOfDeclaration(field);
+      }
+    }
+    return ExpressionType();
+  }
+  return ExpressionType::of(ast::swizzleBaseType(object.base(), member->name));
+}
+
+ExpressionType InferTypes::typeOfMethod(const ExpressionType& object,
+                                        const ast::Expression* objectExpr, ast::CallExpr* call) {
+  if (object.array) {
+    return ExpressionType();
+  }
+  const BaseType base = object.base();
+  if (base == BaseType::Struct) {
+    ast::FunctionStmt* method = call->function;
+    ast::StructStmt* structStmt = ast->typeStruct(object.structIndex);
+    if (method == nullptr && structStmt != nullptr) {
+      for (ast::Statement* stmt = structStmt->methods; stmt != nullptr; stmt = stmt->next) {
+        if (static_cast<ast::FunctionStmt*>(stmt)->name == call->name) {
+          method = static_cast<ast::FunctionStmt*>(stmt);
+          break;
+        }
+      }
+    }
+    return method != nullptr ? typeOf(method->returnType) : ExpressionType();
+  }
+
+  const ast::IntrinsicInfo& intrinsic = ast::intrinsicInfo(call->intrinsic);
+  if (!intrinsic.method ||
+      (!isTexture(base) && !isBuffer(base) && base != BaseType::RWByteAddressBuffer)) {
+    return ExpressionType();
+  }
+  switch (intrinsic.returns) {
+    case ast::IntrinsicReturn::Type:
+      return ExpressionType::of(intrinsic.returnType);
+    case ast::IntrinsicReturn::Element:
+      // Load of a byte address buffer reads a uint.
+      return base == BaseType::RWByteAddressBuffer ? ExpressionType::of(BaseType::Uint)
+                                                   : elementType(base, objectExpr);
+    case ast::IntrinsicReturn::Gather: {
+      const Shape element = shapeOf(elementType(base, objectExpr));
+      return ExpressionType::of(ast::vectorBaseType(
+          element.isNumeric() ? element.scalar : BaseType::Float, 4));
+    }
+    default:
+      return ExpressionType();
+  }
+}
+
+ExpressionType InferTypes::elementType(BaseType resourceType, const ast::Expression* resource) {
+  // The element of textures[i] is the element of the array of textures.
+  while (resource != nullptr && resource->nodeType == ast::NodeType::ArrayExpr) {
+    resource = static_cast<const ast::ArrayExpr*>(resource)->array;
+  }
+  if (resource != nullptr && resource->nodeType == ast::NodeType::VariableExpr) {
+    bool array = false;
+    const ast::Type* type =
+        declaredType(static_cast<const ast::VariableExpr*>(resource)->declaration, &array);
+    if (type != nullptr && type->templateArg != nullptr && type->templateArg->value != nullptr &&
+        type->templateArg->value->nodeType == ast::NodeType::Type) {
+      return typeOf(static_cast<const ast::Type*>(type->templateArg->value));
+    }
+  }
+  // A texture or typed buffer declared without a template argument holds float4s.
+  if (isTexture(resourceType) || resourceType == BaseType::RWBuffer) {
+    return ExpressionType::of(BaseType::Float4);
+  }
+  return ExpressionType();
+}
+
+} // namespace visitor
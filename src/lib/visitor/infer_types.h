@@ -0,0 +1,106 @@
+#pragma once
+
+#include <map>
+#include <string_view>
+#include <vector>
+
+#include "../ast/ast.h"
+#include "static_visitor.h"
+
+namespace visitor {
+
+/// Works out the type of the value of every expression, and stores it on the expression in
+/// Expression::resolvedType, so code generators and reflection read it rather than each working
+/// it out again.
+///
+/// The types follow the rules of HLSL. The operands of an operator are promoted to the more
+/// precise of their scalar types, so int + float is a float. A scalar is repeated to the shape
+/// of the other operand, and the larger of two vectors or matrices is truncated to the smaller.
+/// Comparisons give bools of the same shape. A member of a struct has the type of its field, a
+/// swizzle such as v.xy or m._m00_m11 is a vector of the components it names, and indexing an
+/// array, vector or matrix gives its element, component or row. A call gives the return type of
+/// the function ResolveSymbols resolved it to, or of the intrinsic or texture method it names.
+///
+/// An expression whose type can't be worked out, such as a call of an unknown function, is left
+/// Undefined, and so are the expressions that use it.
+class InferTypes : public StaticVisitor<InferTypes> {
+public:
+  ast::Ast* ast;
+
+  /// The number of expressions given a type, and the number of those whose type isn't known.
+  size_t expressionsTyped = 0;
+  size_t expressionsUnknown = 0;
+
+  InferTypes(ast::Ast* ast);
+
+  /// Work out the types of the expressions of every declaration and function, visible or not.
+  /// This runs ResolveSymbols first to find the declarations the expressions use.
+  void infer();
+
+  /// The ExpressionType of a declared type, such as the type of a variable.
+  /// @param array Whether the declaration is an array, such as float a[4].
+  ast::ExpressionType typeOf(const ast::Type* type, bool array = false);
+
+  void visitExpression(ast::Expression* node);
+
+  void visitFunctionStmt(ast::FunctionStmt* node);
+
+  void visitStructStmt(ast::StructStmt* node);
+
+  void visitStructField(ast::Field* node);
+
+  void visitBufferField(ast::Field* node);
+
+  void visitVariableStmt(ast::VariableStmt* node);
+
+  void visitParameter(ast::Parameter* node);
+
+  void visitAttribute(ast::Attribute* node);
+
+  void visitType(ast::Type* type);
+
+private:
+  // Push the operands of the expression that are typed before it. The member of a MemberExpr is
+  // named by the type of its object, so only the operands in it that aren't are pushed.
+  void pushOperands(ast::Expression* expr);
+
+  void pushMemberOperands(ast::Expression* member);
+
+  // Work out the type of the expression from the types of its operands.
+  ast::ExpressionType typeOfExpression(ast::Expression* expr);
+
+  // Store the type on the expression and count it.
+  ast::ExpressionType setType(ast::Expression* expr, const ast::ExpressionType& type);
+
+  ast::ExpressionType typeOfDeclaration(const ast::Node* declaration);
+
+  ast::ExpressionType typeOfCall(ast::CallExpr* call);
+
+  ast::ExpressionType typeOfBinary(const ast::BinaryExpr* binary);
+
+  ast::ExpressionType typeOfIndex(const ast::ExpressionType& array, const ast::Expression* expr);
+
+  // The type of the member of an object of the given type, setting the types of the expressions
+  // in the member that the object names.
+  ast::ExpressionType typeOfMember(const ast::ExpressionType& object,
+                                   const ast::Expression* objectExpr, ast::Expression* member);
+
+  ast::ExpressionType typeOfField(const ast::ExpressionType& object, ast::VariableExpr* member);
+
+  ast::ExpressionType typeOfMethod(const ast::ExpressionType& object,
+                                   const ast::Expression* objectExpr, ast::CallExpr* call);
+
+  // The type of the elements of a texture or buffer of the type, given by the template argument
+  // of its declaration, such as float for Texture2D<float>.
+  ast::ExpressionType elementType(ast::BaseType resourceType, const ast::Expression* resource);
+
+  // Typedefs by name, so a UserDefined type can be followed to the type it names.
+  std::map<std::string_view, const ast::Type*> _typedefs;
+  // The expressions of the tree being typed, in pre-order.
+  std::vector<ast::Expression*> _order;
+  std::vector<ast::Expression*> _pending;
+  int _typedefDepth = 0;
+  int _memberDepth = 0;
+};
+
+} // namespace visitor
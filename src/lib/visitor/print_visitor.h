@@ -2,32 +2,32 @@
 
 #include <iostream>
 
-#include "visitor.h"
+#include "static_visitor.h"
 
 namespace visitor {
 
 /// A visitor that prints the AST to stdout.
 /// This will print it out in a format that is similar to Swift, to demonstrate translating
 /// to a different syntax style.
-class PrintVisitor : public Visitor {
+class PrintVisitor : public StaticVisitor<PrintVisitor> {
 public:
   std::ostream &_out;
 
   PrintVisitor(std::ostream &out = std::cout)
     : _out(out) {}
 
-  void visitBlock(ast::Block* node) override {
+  void visitBlock(ast::Block* node) {
     _out << "{" << std::endl;
 
     _indent++;
-    Visitor::visitBlock(node);
+    StaticVisitor::visitBlock(node);
     _indent--;
 
     indent();
     _out << "}" << std::endl;
   }
 
-  void visitStatements(ast::Statement* node) override {
+  void visitStatements(ast::Statement* node) {
     while (node) {
       indent();
       visitStatement(node);
@@ -36,7 +36,7 @@ public:
     }
   }
 
-  void visitBufferStmt(ast::BufferStmt* node) override {
+  void visitBufferStmt(ast::BufferStmt* node) {
     indent();
     if (node->bufferType == ast::BufferType::Cbuffer) {
       _out << "cbuffer ";
@@ -45,7 +45,7 @@ public:
     }
     _out << node->name << " {" << std::endl;
     _indent++;
-    Visitor::visitBufferStmt(node);
+    StaticVisitor::visitBufferStmt(node);
     _indent--;
     indent();
     _out << "}" << std::endl;
@@ -58,25 +58,25 @@ public:
     _out << ";" << std::endl;
   }
 
-  void visitStructStmt(ast::StructStmt* node) override {
+  void visitStructStmt(ast::StructStmt* node) {
     indent();
     _out << "struct " << node->name << " {" << std::endl;
     _indent++;
-    Visitor::visitStructStmt(node);
+    StaticVisitor::visitStructStmt(node);
     _indent--;
     indent();
     _out << "}" << std::endl;
   }
 
-  void visitStructField(ast::Field* node) override {
+  void visitStructField(ast::Field* node) {
     indent();
     _out << " " << node->name << ": ";
     visitType(node->type);
     _out << ";" << std::endl;
   }
 
-  void visitStatement(ast::Statement* node) override {
-    Visitor::visitStatement(node);
+  void visitStatement(ast::Statement* node) {
+    StaticVisitor::visitStatement(node);
     if (node->nodeType != ast::NodeType::Block &&
         node->nodeType != ast::NodeType::IfStmt &&
         node->nodeType != ast::NodeType::ForStmt &&
@@ -86,7 +86,7 @@ public:
     }
   }
 
-  void visitForStmt(ast::ForStmt* node) override {
+  void visitForStmt(ast::ForStmt* node) {
     _out << "for (";
     ast::Statement* init = node->initializer;
     while (init != nullptr) {
@@ -118,7 +118,7 @@ public:
     visitStatements(node->body);
   }
 
-  void visitSwitchStmt(ast::SwitchStmt* node) override {
+  void visitSwitchStmt(ast::SwitchStmt* node) {
     _out << "switch (";
     visitExpression(node->condition);
     _out << ") {" << std::endl;
@@ -133,7 +133,7 @@ public:
     _out << "}" << std::endl;
   }
 
-  void visitSwitchCase(ast::SwitchCase* node) override {
+  void visitSwitchCase(ast::SwitchCase* node) {
     indent();
     if (node->isDefault) {
       _out << "default:" << std::endl;
@@ -147,11 +147,11 @@ public:
     _indent--;
   }
 
-  void visitBreakStmt(ast::BreakStmt* node) override {
+  void visitBreakStmt(ast::BreakStmt* node) {
     _out << "break";
   }
 
-  void visitFunctionStmt(ast::FunctionStmt* node) override {
+  void visitFunctionStmt(ast::FunctionStmt* node) {
     _out << "fn " << node->name << "(";
     visitParameters(node->parameters);
     _out << ") -> ";
@@ -161,7 +161,7 @@ public:
     _out << std::endl;
   }
 
-  void visitVariableStmt(ast::VariableStmt* node) override {
+  void visitVariableStmt(ast::VariableStmt* node) {
     if (node->type->flags & ast::TypeFlags::Const) {
       _out << "const ";
     } else {
@@ -185,7 +185,7 @@ public:
     _out << std::endl;
   }
 
-  void visitParameter(ast::Parameter* node) override {
+  void visitParameter(ast::Parameter* node) {
     _out << node->name << ": ";
     visitType(node->type);
     if (node->initializer != nullptr) {
@@ -194,7 +194,7 @@ public:
     }
   }
 
-  void visitParameters(ast::Parameter* node) override {
+  void visitParameters(ast::Parameter* node) {
     while (node != nullptr) {
       visitParameter(node);
       if (node->next != nullptr) {
@@ -204,11 +204,11 @@ public:
     }
   }
 
-  void visitType(ast::Type* node) override {
+  void visitType(ast::Type* node) {
     _out << baseTypeToString(node->baseType);
   }
 
-  void visitIfStmt(ast::IfStmt* node) override {
+  void visitIfStmt(ast::IfStmt* node) {
     _out << "if (";
     visitExpression(node->condition);
     _out << ")" << std::endl;
@@ -220,50 +220,50 @@ public:
     }
   }
 
-  void visitAssignmentStmt(ast::AssignmentStmt* node) override {
+  void visitAssignmentStmt(ast::AssignmentStmt* node) {
     visitExpression(node->variable);
     _out << " " << operatorToString(node->op) << " ";
     visitExpression(node->value);
   }
 
-  void visitAssignmentExpr(ast::AssignmentExpr* node) override {
+  void visitAssignmentExpr(ast::AssignmentExpr* node) {
     visitExpression(node->variable);
     _out << " " << operatorToString(node->op) << " ";
     visitExpression(node->value);
   }
 
-  void visitBinaryExpr(ast::BinaryExpr *node) override {
+  void visitBinaryExpr(ast::BinaryExpr *node) {
     visitExpression(node->left);
     _out << " " << operatorToString(node->op) << " ";
     visitExpression(node->right);
   }
 
-  void visitVariableExpr(ast::VariableExpr* node) override {
+  void visitVariableExpr(ast::VariableExpr* node) {
     _out << node->name;
   }
 
-  void visitLiteralExpr(ast::LiteralExpr* node) override {
+  void visitLiteralExpr(ast::LiteralExpr* node) {
     _out << node->value;
   }
 
-  void visitReturn(ast::ReturnStmt* node) override {
+  void visitReturn(ast::ReturnStmt* node) {
     _out << "return ";
     visitExpression(node->value);
   }
 
-  void visitCallStmt(ast::CallStmt* node) override {
+  void visitCallStmt(ast::CallStmt* node) {
     _out << node->name << "(";
     visitArguments(node->arguments);
     _out << ");";
   }
 
-  void visitCallExpr(ast::CallExpr* node) override {
+  void visitCallExpr(ast::CallExpr* node) {
     _out << node->name << "(";
     visitArguments(node->arguments);
     _out << ")";
   }
 
-  void visitCastExpr(ast::CastExpr* node) override {
+  void visitCastExpr(ast::CastExpr* node) {
     visitType(node->type);
     _out << "(";
     visitArguments(node->value);
@@ -292,7 +292,7 @@ public:
     _out << "}";
   }
 
-  void visitArguments(ast::Expression* args) override {
+  void visitArguments(ast::Expression* args) {
     while (args != nullptr) {
       visitExpression(args);
       if (args->next != nullptr) {
@@ -302,23 +302,23 @@ public:
     }
   }
 
-  void visitIncrementExpr(ast::IncrementExpr* node) override {
+  void visitIncrementExpr(ast::IncrementExpr* node) {
     visitExpression(node->variable);
     _out << operatorToString(node->op);
   }
 
-  void visitPrefixExpr(ast::PrefixExpr* node) override {
+  void visitPrefixExpr(ast::PrefixExpr* node) {
     _out << operatorToString(node->op);
     visitExpression(node->expression);
   }
 
-  void visitMemberExpr(ast::MemberExpr* node) override {
+  void visitMemberExpr(ast::MemberExpr* node) {
     visitExpression(node->object);
     _out << ".";
     visitExpression(node->member);
   }
 
-  void visitTernaryExpr(ast::TernaryExpr* node) override {
+  void visitTernaryExpr(ast::TernaryExpr* node) {
     visitExpression(node->condition);
     _out << " ? ";
     visitExpression(node->trueExpr);
@@ -1,5 +1,9 @@
 #include "prune_tree.h"
 
+#include "../util/trace.h"
+#include "reachability.h"
+#include "resolve_symbols.h"
+
 namespace visitor {
 
 PruneTree::PruneTree(ast::Ast* ast)
@@ -7,31 +11,22 @@ PruneTree::PruneTree(ast::Ast* ast)
 }
 
 void PruneTree::prune(const std::string_view& entryPoint) {
-  ast::FunctionStmt* entry = ast->findFunction(entryPoint);
-  if (entry != nullptr) {
-    MarkVisibleStatements markVisibleStatements(ast);
-    markVisibleStatements.visitFunctionStmt(entry);
-  }
-
-  ast::Statement* stmt = ast->root()->statements;
-  while (stmt != nullptr) {
+  HLSL_TRACE_SCOPE("prune");
+  // Resolve the calls first, so only the overloads called are reachable.
+  ResolveSymbols(ast).resolve();
+  Reachability reachability(ast);
+  reachability.compute({ entryPoint });
+  const ReachableSet reachable = reachability.reachableSet(0);
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    stmt->visible = reachable.contains(stmt);
     if (stmt->nodeType == ast::NodeType::BufferStmt) {
-      ast::BufferStmt* buffer = static_cast<ast::BufferStmt*>(stmt);
-      if (buffer->visible) {
-        stmt = stmt->next;
-        continue;
-      }
-      ast::Field* field = buffer->field;
-      while (field != nullptr) {
-        if (field->visible) {
-          buffer->visible = true;
-          break;
-        }
-        field = field->next;
+      for (ast::Field* field = static_cast<ast::BufferStmt*>(stmt)->field; field != nullptr;
+           field = field->next) {
+        field->visible = reachable.contains(field);
       }
     }
-    stmt = stmt->next;
   }
+  unusedFields = reachability.unusedFields(0);
 }
 
 } // namespace visitor
@@ -1,15 +1,26 @@
 #pragma once
 
+#include <vector>
+
 #include "visibility_visitor.h"
 
 namespace visitor {
 
+/// Marks the statements of the Ast reachable from an entry point visible and the rest hidden.
+/// To prune for several entry points at once without changing the Ast, use Reachability.
 class PruneTree {
 public:
   ast::Ast* ast;
 
+  /// The fields of the visible cbuffers and tbuffers the entry point doesn't use, found by
+  /// prune().
+  std::vector<const ast::Field*> unusedFields;
+
   PruneTree(ast::Ast* ast);
 
+  /// Set Node::visible of every top-level statement and cbuffer field to whether it's reachable
+  /// from the entry point. Nothing is visible if there's no function with its name. This runs
+  /// ResolveSymbols first, so a call reaches the overload it calls.
   void prune(const std::string_view& entryPoint);
 };
 
@@ -0,0 +1,378 @@
+#include "reachability.h"
+
+#include <algorithm>
+
+#include "../util/trace.h"
+#include "static_visitor.h"
+
+namespace visitor {
+
+// Records the symbols each symbol refers to through calls, variables and types.
+class ReferenceCollector : public StaticVisitor<ReferenceCollector> {
+public:
+  ReferenceCollector(Reachability* reachability)
+      : _reachability(reachability) {}
+
+  // Collect the references of a top-level statement.
+  void collect(ast::Statement* node, uint32_t id) {
+    _symbol = id;
+    visitAttributes(node->attributes);
+    switch (node->nodeType) {
+      case ast::NodeType::StructStmt:
+        visitStructStmt(static_cast<ast::StructStmt*>(node));
+        break;
+      case ast::NodeType::BufferStmt:
+        visitBufferStmt(static_cast<ast::BufferStmt*>(node));
+        break;
+      case ast::NodeType::FunctionStmt:
+        visitFunctionStmt(static_cast<ast::FunctionStmt*>(node));
+        break;
+      case ast::NodeType::TypedefStmt:
+        visitTypedefStmt(static_cast<ast::TypedefStmt*>(node));
+        break;
+      case ast::NodeType::VariableStmt:
+        visitVariableStmt(static_cast<ast::VariableStmt*>(node));
+        break;
+      default:
+        break;
+    }
+  }
+
+  void visitStatement(ast::Statement* node) {
+    visitAttributes(node->attributes);
+    StaticVisitor::visitStatement(node);
+  }
+
+  // The arguments of attributes such as [numthreads(N, 1, 1)] can name static consts.
+  void visitAttribute(ast::Attribute* node) {
+    for (ast::Expression* argument = node->argument; argument != nullptr;
+         argument = argument->next) {
+      visitExpression(argument);
+    }
+  }
+
+  void visitFunctionStmt(ast::FunctionStmt* node) {
+    visitType(node->returnType);
+    visitParameters(node->parameters);
+    if (node->body != nullptr) {
+      visitBlock(node->body);
+    }
+  }
+
+  void visitStructStmt(ast::StructStmt* node) {
+    StaticVisitor::visitStructStmt(node);
+    for (ast::Statement* method = node->methods; method != nullptr; method = method->next) {
+      visitFunctionStmt(static_cast<ast::FunctionStmt*>(method));
+    }
+  }
+
+  void visitBufferStmt(ast::BufferStmt* node) {
+    // Each field is a symbol of its own.
+    const uint32_t buffer = _symbol;
+    for (ast::Field* field = node->field; field != nullptr; field = field->next) {
+      _symbol = _reachability->symbolId(field);
+      visitBufferField(field);
+    }
+    _symbol = buffer;
+  }
+
+  void visitBufferField(ast::Field* node) {
+    StaticVisitor::visitBufferField(node);
+    visitExpression(node->arraySize);
+  }
+
+  void visitStructField(ast::Field* node) {
+    StaticVisitor::visitStructField(node);
+    visitExpression(node->arraySize);
+  }
+
+  void visitVariableStmt(ast::VariableStmt* node) {
+    StaticVisitor::visitVariableStmt(node);
+    visitExpression(node->arraySize);
+  }
+
+  void visitParameter(ast::Parameter* node) {
+    StaticVisitor::visitParameter(node);
+    visitExpression(node->arraySize);
+  }
+
+  // A struct or typedef is referred to by the name of a type, including a template argument such
+  // as the struct of a StructuredBuffer<S>.
+  void visitType(ast::Type* type) {
+    if (type == nullptr) {
+      return;
+    }
+    if (type->baseType == ast::BaseType::Struct || type->baseType == ast::BaseType::UserDefined) {
+      addReference(Reachability::findName(_reachability->_types, type->name));
+    }
+    for (ast::TemplateArg* arg = type->templateArg; arg != nullptr; arg = arg->next) {
+      if (arg->value == nullptr) {
+        continue;
+      }
+      if (arg->value->nodeType == ast::NodeType::Type) {
+        visitType(static_cast<ast::Type*>(arg->value));
+      } else {
+        visitExpression(static_cast<ast::Expression*>(arg->value));
+      }
+    }
+    visitExpression(type->arraySize);
+  }
+
+  // A sampler state can name its texture, as in Texture = <tex>.
+  void visitStateAssignment(ast::StateAssignment* node) {
+    addGlobal(node->stringValue);
+  }
+
+  void visitCallStmt(ast::CallStmt* node) {
+    StaticVisitor::visitCallStmt(node);
+    addCall(node->function, node->name, node->intrinsic);
+  }
+
+  void visitCallExpr(ast::CallExpr* node) {
+    StaticVisitor::visitCallExpr(node);
+    addCall(node->function, node->name, node->intrinsic);
+  }
+
+  void visitMemberExpr(ast::MemberExpr* node) {
+    visitOperand(node->object);
+    if (node->member == nullptr) {
+      return;
+    }
+    // A member is named by the type of the object, so it isn't looked up by name. A method
+    // ResolveSymbols resolved refers to its struct.
+    if (node->member->nodeType == ast::NodeType::CallExpr) {
+      ast::CallExpr* call = static_cast<ast::CallExpr*>(node->member);
+      if (call->function != nullptr) {
+        addReference(_reachability->symbolId(call->function));
+      }
+      visitArguments(call->arguments);
+    } else if (node->member->nodeType != ast::NodeType::VariableExpr) {
+      visitOperand(node->member);
+    }
+  }
+
+  void visitVariableExpr(ast::VariableExpr* node) {
+    if (node->declaration != nullptr) {
+      // Parameters and locals aren't symbols.
+      if (node->declaration->nodeType != ast::NodeType::Parameter) {
+        addReference(_reachability->symbolId(node->declaration));
+      }
+      return;
+    }
+    addGlobal(node->name);
+  }
+
+private:
+  void addGlobal(const std::string_view& name) {
+    addReference(Reachability::findName(_reachability->_globals, name));
+  }
+
+  void addCall(ast::FunctionStmt* function, const std::string_view& name,
+               ast::Intrinsic intrinsic) {
+    if (function != nullptr) {
+      addReference(_reachability->symbolId(function));
+      return;
+    }
+    // A call of an intrinsic needn't be looked up unless a function has the name of one. A call
+    // ResolveSymbols didn't resolve could call any of the overloads, so they're all reachable.
+    if (intrinsic == ast::Intrinsic::None || _reachability->_ast->declaresIntrinsic()) {
+      for (ast::FunctionStmt* overload : _reachability->_ast->findOverloads(name)) {
+        addReference(_reachability->symbolId(overload));
+      }
+    }
+  }
+
+  void addReference(uint32_t id) {
+    if (id != Reachability::noSymbol && id != _symbol) {
+      _reachability->addReference(_symbol, id);
+    }
+  }
+
+  Reachability* _reachability;
+  uint32_t _symbol = Reachability::noSymbol;
+};
+
+bool ReachableSet::contains(const ast::Node* node) const {
+  if (_ids == nullptr) {
+    return true;
+  }
+  const uint32_t id = findId(*_ids, node);
+  return id == Reachability::noSymbol || containsSymbol(id);
+}
+
+uint32_t ReachableSet::findId(const IdTable& ids, const ast::Node* node) {
+  auto it = std::lower_bound(ids.begin(), ids.end(), std::make_pair(node, uint32_t(0)));
+  return it != ids.end() && it->first == node ? it->second : Reachability::noSymbol;
+}
+
+Reachability::Reachability(const ast::Ast* ast)
+    : _ast(ast)
+    , _ids(std::make_shared<ReachableSet::IdTable>()) {
+  HLSL_TRACE_SCOPE("reachability");
+  // The node lists of the Ast include nested declarations, so these are upper bounds.
+  const size_t maxSymbols = ast->nodesOfType(ast::NodeType::FunctionStmt).size() +
+                            ast->nodesOfType(ast::NodeType::VariableStmt).size() +
+                            ast->nodesOfType(ast::NodeType::Field).size() +
+                            ast->nodesOfType(ast::NodeType::StructStmt).size() +
+                            ast->nodesOfType(ast::NodeType::TypedefStmt).size() +
+                            ast->nodesOfType(ast::NodeType::BufferStmt).size();
+  _symbols.reserve(maxSymbols);
+  _ids->reserve(maxSymbols);
+  _lastReferrer.reserve(maxSymbols);
+
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    const uint32_t id = addSymbol(stmt);
+    if (stmt->nodeType == ast::NodeType::VariableStmt) {
+      _globals.emplace_back(static_cast<ast::VariableStmt*>(stmt)->name, id);
+    } else if (stmt->nodeType == ast::NodeType::BufferStmt) {
+      // The fields of a cbuffer are global variables, and refer to the cbuffer so it's reachable
+      // if any of them is.
+      ast::BufferStmt* buffer = static_cast<ast::BufferStmt*>(stmt);
+      for (ast::Field* field = buffer->field; field != nullptr; field = field->next) {
+        const uint32_t fieldId = addSymbol(field);
+        _globals.emplace_back(field->name, fieldId);
+        addReference(fieldId, id);
+      }
+    } else if (stmt->nodeType == ast::NodeType::TypedefStmt) {
+      _types.emplace_back(static_cast<ast::TypedefStmt*>(stmt)->name, id);
+    } else if (stmt->nodeType == ast::NodeType::StructStmt) {
+      ast::StructStmt* structStmt = static_cast<ast::StructStmt*>(stmt);
+      _types.emplace_back(structStmt->name, id);
+      for (ast::Statement* method = structStmt->methods; method != nullptr;
+           method = method->next) {
+        _ids->emplace_back(method, id);
+      }
+    }
+  }
+  // Sorting by name then id puts the last declaration of a name last among its equals.
+  std::sort(_ids->begin(), _ids->end());
+  std::sort(_globals.begin(), _globals.end());
+  std::sort(_types.begin(), _types.end());
+
+  ReferenceCollector collector(this);
+  uint32_t id = 0;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    collector.collect(stmt, id);
+    // Skip the fields of a buffer, which follow it.
+    id++;
+    if (stmt->nodeType == ast::NodeType::BufferStmt) {
+      for (ast::Field* field = static_cast<ast::BufferStmt*>(stmt)->field; field != nullptr;
+           field = field->next) {
+        id++;
+      }
+    }
+  }
+
+  // Group the references by the symbol referring to them.
+  _referenceOffsets.assign(_symbols.size() + 1, 0);
+  for (const std::pair<uint32_t, uint32_t>& edge : _edges) {
+    _referenceOffsets[edge.first + 1]++;
+  }
+  for (size_t i = 1; i < _referenceOffsets.size(); ++i) {
+    _referenceOffsets[i] += _referenceOffsets[i - 1];
+  }
+  _references.resize(_edges.size());
+  std::vector<uint32_t> next(_referenceOffsets.begin(), _referenceOffsets.end() - 1);
+  for (const std::pair<uint32_t, uint32_t>& edge : _edges) {
+    _references[next[edge.first]++] = edge.second;
+  }
+  _edges = std::vector<std::pair<uint32_t, uint32_t>>();
+  _lastReferrer = std::vector<uint32_t>();
+}
+
+uint32_t Reachability::symbolId(const ast::Node* node) const {
+  return ReachableSet::findId(*_ids, node);
+}
+
+uint32_t Reachability::findName(const NameTable& table, const std::string_view& name) {
+  auto it = std::upper_bound(table.begin(), table.end(), name,
+                             [](const std::string_view& name,
+                                const std::pair<std::string_view, uint32_t>& entry) {
+                               return name < entry.first;
+                             });
+  return it != table.begin() && (it - 1)->first == name ? (it - 1)->second : noSymbol;
+}
+
+void Reachability::compute(const std::vector<std::string_view>& entryPoints) {
+  HLSL_TRACE_SCOPE("reachability compute");
+  _numEntryPoints = entryPoints.size();
+  _words = std::max<size_t>(1, (_numEntryPoints + 63) / 64);
+  _bits.assign(_symbols.size() * _words, 0);
+
+  std::vector<uint32_t> pending;
+  for (size_t i = 0; i < entryPoints.size(); ++i) {
+    const uint32_t id = symbolId(_ast->findFunction(entryPoints[i]));
+    if (id != noSymbol) {
+      _bits[id * _words + i / 64] |= uint64_t(1) << (i % 64);
+      pending.push_back(id);
+    }
+  }
+
+  // Give each referenced symbol the bits of the symbol referring to it, and propagate any bits
+  // that are new to it further.
+  while (!pending.empty()) {
+    const uint32_t id = pending.back();
+    pending.pop_back();
+    for (uint32_t r = _referenceOffsets[id]; r < _referenceOffsets[id + 1]; ++r) {
+      const uint32_t reference = _references[r];
+      bool changed = false;
+      for (size_t w = 0; w < _words; ++w) {
+        const uint64_t added = _bits[id * _words + w] & ~_bits[reference * _words + w];
+        if (added != 0) {
+          _bits[reference * _words + w] |= added;
+          changed = true;
+        }
+      }
+      if (changed) {
+        pending.push_back(reference);
+      }
+    }
+  }
+}
+
+ReachableSet Reachability::reachableSet(size_t entryPoint) const {
+  ReachableSet set;
+  set._ids = _ids;
+  set._bits.assign((_symbols.size() + 63) / 64, 0);
+  for (uint32_t id = 0; id < _symbols.size(); ++id) {
+    if (isReachable(id, entryPoint)) {
+      set._bits[id / 64] |= uint64_t(1) << (id % 64);
+    }
+  }
+  return set;
+}
+
+std::vector<const ast::Field*> Reachability::unusedFields(size_t entryPoint) const {
+  std::vector<const ast::Field*> fields;
+  for (uint32_t id = 0; id < _symbols.size(); ++id) {
+    if (_symbols[id]->nodeType != ast::NodeType::BufferStmt || !isReachable(id, entryPoint)) {
+      continue;
+    }
+    const ast::BufferStmt* buffer = static_cast<const ast::BufferStmt*>(_symbols[id]);
+    for (const ast::Field* field = buffer->field; field != nullptr; field = field->next) {
+      if (!isReachable(symbolId(field), entryPoint)) {
+        fields.push_back(field);
+      }
+    }
+  }
+  return fields;
+}
+
+uint32_t Reachability::addSymbol(const ast::Node* node) {
+  const uint32_t id = static_cast<uint32_t>(_symbols.size());
+  _symbols.push_back(node);
+  _ids->emplace_back(node, id);
+  _lastReferrer.push_back(noSymbol);
+  return id;
+}
+
+void Reachability::addReference(uint32_t from, uint32_t to) {
+  // The references of each symbol are collected together, so a reference is already recorded
+  // if the symbol was last referred to by the same symbol.
+  if (_lastReferrer[to] != from) {
+    _lastReferrer[to] = from;
+    _edges.emplace_back(from, to);
+  }
+}
+
+} // namespace visitor
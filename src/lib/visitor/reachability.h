@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../ast/ast.h"
+
+namespace visitor {
+
+class Reachability;
+
+/// The symbols reachable from one entry point, from Reachability::reachableSet(). It's a copy
+/// of the entry point's bits, and shares the ids of the symbols with the Reachability, so it
+/// stays valid if the Reachability computes other entry points or is destroyed, and it can be
+/// read from any number of threads. The Ast must outlive it.
+class ReachableSet {
+public:
+  ReachableSet() = default;
+
+  /// Whether the node is reachable. A node that isn't a symbol, such as a statement in a
+  /// function, is reachable if the symbol containing it is, so this is only asked of symbols.
+  bool contains(const ast::Node* node) const;
+
+  /// Whether the symbol with the given id is reachable.
+  bool containsSymbol(uint32_t id) const {
+    return (_bits[id / 64] >> (id % 64)) & 1;
+  }
+
+private:
+  friend class Reachability;
+
+  // The symbols and struct methods with their ids, sorted by node.
+  typedef std::vector<std::pair<const ast::Node*, uint32_t>> IdTable;
+
+  static uint32_t findId(const IdTable& ids, const ast::Node* node);
+
+  std::shared_ptr<const IdTable> _ids;
+  std::vector<uint64_t> _bits;
+};
+
+/// Finds the symbols reachable from any number of entry points at once, without changing the
+/// Ast, so one parse can be pruned for every stage of a program.
+///
+/// The symbols are the top-level statements of the Ast and the fields of its cbuffers and
+/// tbuffers. Constructing a Reachability walks the Ast once to find the symbols each symbol
+/// refers to, through calls, variables, including textures, samplers and static consts, and the
+/// structs and typedefs named by types, array sizes and attributes. compute() then gives every
+/// symbol a bitset with a bit for each entry point, and propagates the bits of each entry
+/// point's function along the references, so the cost of the walk is shared by all of the entry
+/// points. A cbuffer is reachable if any of its fields is.
+///
+/// Calls and variables resolved by ResolveSymbols follow the resolved declarations, so only the
+/// overloads called are reachable; otherwise they're found by name, and a call reaches every
+/// overload with its name.
+///
+/// The lookup tables are sorted arrays and the references one array indexed by symbol, so
+/// finding them takes a fixed number of allocations however large the Ast is.
+class Reachability {
+public:
+  /// The id of a node that isn't a symbol.
+  static constexpr uint32_t noSymbol = UINT32_MAX;
+
+  /// Find the symbols of the Ast and the references between them.
+  explicit Reachability(const ast::Ast* ast);
+
+  /// Find the symbols reachable from each of the entry points, replacing any computed before.
+  /// An entry point that isn't the name of a function reaches nothing.
+  void compute(const std::vector<std::string_view>& entryPoints);
+
+  size_t numSymbols() const { return _symbols.size(); }
+
+  size_t numEntryPoints() const { return _numEntryPoints; }
+
+  /// The id of a symbol, or noSymbol. The methods of a struct have the id of the struct.
+  uint32_t symbolId(const ast::Node* node) const;
+
+  /// The symbol with the given id.
+  const ast::Node* symbol(uint32_t id) const { return _symbols[id]; }
+
+  /// The number of symbols the symbol refers to.
+  size_t numReferences(uint32_t id) const {
+    return _referenceOffsets[id + 1] - _referenceOffsets[id];
+  }
+
+  /// The id of the index'th symbol the symbol refers to.
+  uint32_t reference(uint32_t id, size_t index) const {
+    return _references[_referenceOffsets[id] + index];
+  }
+
+  /// Whether the symbol with the given id is reachable from the entry point at the given index.
+  bool isReachable(uint32_t id, size_t entryPoint) const {
+    return (_bits[id * _words + entryPoint / 64] >> (entryPoint % 64)) & 1;
+  }
+
+  /// The symbols reachable from the entry point at the given index.
+  ReachableSet reachableSet(size_t entryPoint) const;
+
+  /// The fields of the cbuffers and tbuffers reachable from the entry point that it doesn't use,
+  /// in source order, which can be stripped from the buffers.
+  std::vector<const ast::Field*> unusedFields(size_t entryPoint) const;
+
+private:
+  friend class ReferenceCollector;
+
+  typedef std::vector<std::pair<std::string_view, uint32_t>> NameTable;
+
+  uint32_t addSymbol(const ast::Node* node);
+
+  // The id of the last symbol declared with the name, or noSymbol.
+  static uint32_t findName(const NameTable& table, const std::string_view& name);
+
+  // Add a reference from one symbol to another, unless it's already recorded.
+  void addReference(uint32_t from, uint32_t to);
+
+  const ast::Ast* _ast;
+  std::vector<const ast::Node*> _symbols;
+  // The ids of the symbols, shared with the ReachableSets taken from this.
+  std::shared_ptr<ReachableSet::IdTable> _ids;
+  // The global variables and cbuffer fields by name, for variables that weren't resolved.
+  NameTable _globals;
+  // The structs and typedefs by name.
+  NameTable _types;
+  // The references of symbol i are _references[_referenceOffsets[i]] up to
+  // _referenceOffsets[i + 1]. While they're being collected, _edges holds them as pairs.
+  std::vector<uint32_t> _referenceOffsets;
+  std::vector<uint32_t> _references;
+  std::vector<std::pair<uint32_t, uint32_t>> _edges;
+  // The symbol that last referred to each symbol, to skip repeated references.
+  std::vector<uint32_t> _lastReferrer;
+
+  size_t _numEntryPoints = 0;
+  // The number of 64 bit words of entry point bits each symbol has.
+  size_t _words = 0;
+  std::vector<uint64_t> _bits;
+};
+
+} // namespace visitor
@@ -0,0 +1,337 @@
+#include "reflect_bindings.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "../ast/constant_evaluator.h"
+#include "../util/trace.h"
+
+namespace visitor {
+
+using ast::BaseType;
+
+namespace {
+
+struct ResourceType {
+  BindingKind kind;
+  BindingDimension dimension;
+};
+
+// The kind and dimension of a resource type, or false if the type isn't a resource.
+bool resourceType(BaseType type, ResourceType* resource) {
+  switch (type) {
+    case BaseType::Texture:
+      *resource = { BindingKind::Texture, BindingDimension::None };
+      return true;
+    case BaseType::Texture1D:
+    case BaseType::Texture1D_float:
+      *resource = { BindingKind::Texture, BindingDimension::Texture1D };
+      return true;
+    case BaseType::Texture1DArray:
+      *resource = { BindingKind::Texture, BindingDimension::Texture1DArray };
+      return true;
+    case BaseType::Texture2D:
+    case BaseType::Texture2D_float:
+      *resource = { BindingKind::Texture, BindingDimension::Texture2D };
+      return true;
+    case BaseType::Texture2DArray:
+      *resource = { BindingKind::Texture, BindingDimension::Texture2DArray };
+      return true;
+    case BaseType::Texture2DMS:
+    case BaseType::Texture2DMS_float:
+      *resource = { BindingKind::Texture, BindingDimension::Texture2DMS };
+      return true;
+    case BaseType::Texture2DMSArray:
+      *resource = { BindingKind::Texture, BindingDimension::Texture2DMSArray };
+      return true;
+    case BaseType::Texture3D:
+    case BaseType::Texture3D_float:
+      *resource = { BindingKind::Texture, BindingDimension::Texture3D };
+      return true;
+    case BaseType::TextureCube:
+    case BaseType::TextureCube_float:
+      *resource = { BindingKind::Texture, BindingDimension::TextureCube };
+      return true;
+    case BaseType::TextureCubeArray:
+      *resource = { BindingKind::Texture, BindingDimension::TextureCubeArray };
+      return true;
+    case BaseType::StructuredBuffer:
+      *resource = { BindingKind::StructuredBuffer, BindingDimension::Buffer };
+      return true;
+    case BaseType::Sampler:
+    case BaseType::SamplerState:
+    case BaseType::SamplerComparisonState:
+      *resource = { BindingKind::Sampler, BindingDimension::None };
+      return true;
+    case BaseType::Sampler2D:
+    case BaseType::Sampler2D_float:
+      *resource = { BindingKind::Sampler, BindingDimension::Texture2D };
+      return true;
+    case BaseType::SamplerCUBE:
+    case BaseType::SamplerCUBE_float:
+      *resource = { BindingKind::Sampler, BindingDimension::TextureCube };
+      return true;
+    case BaseType::RWBuffer:
+    case BaseType::RWByteAddressBuffer:
+    case BaseType::RWStructuredBuffer:
+      *resource = { BindingKind::UnorderedAccess, BindingDimension::Buffer };
+      return true;
+    case BaseType::RWTexture1D:
+      *resource = { BindingKind::UnorderedAccess, BindingDimension::Texture1D };
+      return true;
+    case BaseType::RWTexture1DArray:
+      *resource = { BindingKind::UnorderedAccess, BindingDimension::Texture1DArray };
+      return true;
+    case BaseType::RWTexture2D:
+      *resource = { BindingKind::UnorderedAccess, BindingDimension::Texture2D };
+      return true;
+    case BaseType::RWTexture2DArray:
+      *resource = { BindingKind::UnorderedAccess, BindingDimension::Texture2DArray };
+      return true;
+    case BaseType::RWTexture3D:
+      *resource = { BindingKind::UnorderedAccess, BindingDimension::Texture3D };
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether the resources of the type hold float4s when they're declared without a template
+// argument, as textures and typed buffers do.
+bool defaultsToFloat4(const Binding& binding) {
+  if (binding.kind == BindingKind::UnorderedAccess) {
+    return binding.type != BaseType::RWStructuredBuffer &&
+        binding.type != BaseType::RWByteAddressBuffer;
+  }
+  return binding.kind == BindingKind::Texture;
+}
+
+// The number after the prefix of a register or space, such as 1 for space1, or -1 if there
+// isn't one.
+int32_t registerNumber(const std::string_view& name, size_t prefixLength) {
+  if (name.size() <= prefixLength) {
+    return -1;
+  }
+  int64_t number = 0;
+  for (size_t i = prefixLength; i < name.size(); ++i) {
+    if (name[i] < '0' || name[i] > '9' || number > INT32_MAX / 10) {
+      return -1;
+    }
+    number = number * 10 + (name[i] - '0');
+  }
+  return number <= INT32_MAX ? static_cast<int32_t>(number) : -1;
+}
+
+void setRegister(Binding& binding, const std::string_view& registerName,
+                 const std::string_view& registerSpace) {
+  if (!registerName.empty()) {
+    const char c = registerName[0];
+    binding.registerClass = c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    binding.registerIndex = registerNumber(registerName, 1);
+  }
+  const int32_t space = registerNumber(registerSpace, 5);
+  binding.space = space > 0 ? static_cast<uint32_t>(space) : 0;
+}
+
+void writeJsonString(std::ostream& out, const std::string_view& str) {
+  // The strings are identifiers and type names, which have nothing to escape.
+  out << '"' << str << '"';
+}
+
+void write16(std::vector<uint8_t>& out, size_t offset, uint32_t value) {
+  out[offset] = static_cast<uint8_t>(value);
+  out[offset + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+void write32(std::vector<uint8_t>& out, size_t offset, uint32_t value) {
+  write16(out, offset, value);
+  write16(out, offset + 2, value >> 16);
+}
+
+} // namespace
+
+const char* bindingKindToString(BindingKind kind) {
+  switch (kind) {
+    case BindingKind::ConstantBuffer: return "cbuffer";
+    case BindingKind::TextureBuffer: return "tbuffer";
+    case BindingKind::Texture: return "texture";
+    case BindingKind::StructuredBuffer: return "structuredBuffer";
+    case BindingKind::Sampler: return "sampler";
+    case BindingKind::UnorderedAccess: return "uav";
+  }
+  return "";
+}
+
+const char* bindingDimensionToString(BindingDimension dimension) {
+  switch (dimension) {
+    case BindingDimension::None: return "none";
+    case BindingDimension::Buffer: return "buffer";
+    case BindingDimension::Texture1D: return "1d";
+    case BindingDimension::Texture1DArray: return "1dArray";
+    case BindingDimension::Texture2D: return "2d";
+    case BindingDimension::Texture2DArray: return "2dArray";
+    case BindingDimension::Texture2DMS: return "2dMS";
+    case BindingDimension::Texture2DMSArray: return "2dMSArray";
+    case BindingDimension::Texture3D: return "3d";
+    case BindingDimension::TextureCube: return "cube";
+    case BindingDimension::TextureCubeArray: return "cubeArray";
+  }
+  return "";
+}
+
+ReflectBindings::ReflectBindings(ast::Ast* ast)
+    : ast(ast) {
+}
+
+void ReflectBindings::reflect(const ReachableSet* usedSet) {
+  HLSL_TRACE_SCOPE("reflect bindings");
+  bindings.clear();
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    const bool used = usedSet != nullptr ? usedSet->contains(stmt) : stmt->visible;
+    if (stmt->nodeType == ast::NodeType::BufferStmt) {
+      addBuffer(static_cast<const ast::BufferStmt*>(stmt), used);
+    } else if (stmt->nodeType == ast::NodeType::VariableStmt) {
+      addVariable(static_cast<const ast::VariableStmt*>(stmt), used);
+    }
+  }
+}
+
+void ReflectBindings::addBuffer(const ast::BufferStmt* buffer, bool used) {
+  Binding binding;
+  binding.name = buffer->name;
+  binding.kind = buffer->bufferType == ast::BufferType::Cbuffer ? BindingKind::ConstantBuffer
+                                                                : BindingKind::TextureBuffer;
+  binding.dimension = BindingDimension::Buffer;
+  setRegister(binding, buffer->registerName, buffer->registerSpace);
+  binding.used = used;
+  bindings.push_back(binding);
+}
+
+void ReflectBindings::addVariable(const ast::VariableStmt* variable, bool used) {
+  ResourceType resource;
+  if (variable->type == nullptr || !resourceType(variable->type->baseType, &resource)) {
+    return;
+  }
+  Binding binding;
+  binding.name = variable->name;
+  binding.kind = resource.kind;
+  binding.dimension = resource.dimension;
+  binding.type = variable->type->baseType;
+
+  const ast::TemplateArg* templateArg = variable->type->templateArg;
+  if (templateArg != nullptr && templateArg->value != nullptr &&
+      templateArg->value->nodeType == ast::NodeType::Type) {
+    const ast::Type* element = static_cast<const ast::Type*>(templateArg->value);
+    binding.elementType = element->baseType;
+    binding.elementName = element->name;
+    if (element->baseType == BaseType::UserDefined && ast->findStruct(element->name) != nullptr) {
+      binding.elementType = BaseType::Struct;
+    }
+  } else if (defaultsToFloat4(binding)) {
+    binding.elementType = BaseType::Float4;
+  }
+
+  setRegister(binding, variable->registerName, variable->registerSpace);
+
+  if (variable->isArray) {
+    // Each dimension of Texture2D t[2][3] multiplies the count. Array sizes are evaluated by the
+    // parser, so the values are cached.
+    ast::ConstantEvaluator evaluator(ast);
+    if (variable->arraySize == nullptr) {
+      binding.arrayCount = 0;
+    }
+    for (ast::Expression* size = variable->arraySize; size != nullptr; size = size->next) {
+      const ast::ConstantValue& value = evaluator.evaluate(size);
+      binding.arrayCount *= value.isConstant() ? value.asUint() : 0;
+    }
+  }
+  binding.used = used;
+  bindings.push_back(binding);
+}
+
+void ReflectBindings::writeJson(std::ostream& out) const {
+  out << "[";
+  bool first = true;
+  for (const Binding& binding : bindings) {
+    out << (first ? "\n" : ",\n") << "  {\"name\": ";
+    first = false;
+    writeJsonString(out, binding.name);
+    out << ", \"kind\": \"" << bindingKindToString(binding.kind) << "\", \"dimension\": \""
+        << bindingDimensionToString(binding.dimension) << "\"";
+    if (binding.type != BaseType::Undefined) {
+      out << ", \"type\": ";
+      writeJsonString(out, ast::baseTypeToString(binding.type));
+    }
+    if (!binding.elementName.empty()) {
+      out << ", \"elementType\": ";
+      writeJsonString(out, binding.elementName);
+    } else if (binding.elementType != BaseType::Undefined) {
+      out << ", \"elementType\": ";
+      writeJsonString(out, ast::baseTypeToString(binding.elementType));
+    }
+    if (binding.registerClass != 0) {
+      out << ", \"register\": \"" << binding.registerClass << "\", \"index\": "
+          << binding.registerIndex;
+    }
+    out << ", \"space\": " << binding.space << ", \"arrayCount\": " << binding.arrayCount
+        << ", \"used\": " << (binding.used ? "true" : "false") << "}";
+  }
+  out << (first ? "]\n" : "\n]\n");
+}
+
+std::vector<uint8_t> ReflectBindings::writeBinary() const {
+  // The strings start with the empty string, so an offset of 0 is empty. Names declared more
+  // than once, such as the struct of several buffers, are stored once.
+  std::string strings(1, '\0');
+  std::map<std::string_view, uint32_t> stringOffsets;
+  auto addString = [&](const std::string_view& str) -> uint32_t {
+    if (str.empty()) {
+      return 0;
+    }
+    auto it = stringOffsets.find(str);
+    if (it != stringOffsets.end()) {
+      return it->second;
+    }
+    const uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings.append(str);
+    strings.push_back('\0');
+    stringOffsets[str] = offset;
+    return offset;
+  };
+
+  const size_t stringsOffset = sizeof(PackedBindingHeader) +
+      bindings.size() * sizeof(PackedBinding);
+  std::vector<uint8_t> out(stringsOffset);
+  write32(out, offsetof(PackedBindingHeader, magic), packedBindingMagic);
+  write16(out, offsetof(PackedBindingHeader, version), packedBindingVersion);
+  write16(out, offsetof(PackedBindingHeader, bindingSize), sizeof(PackedBinding));
+  write32(out, offsetof(PackedBindingHeader, numBindings), static_cast<uint32_t>(bindings.size()));
+  write32(out, offsetof(PackedBindingHeader, stringsOffset), static_cast<uint32_t>(stringsOffset));
+
+  size_t offset = sizeof(PackedBindingHeader);
+  for (const Binding& binding : bindings) {
+    write32(out, offset + offsetof(PackedBinding, name), addString(binding.name));
+    write32(out, offset + offsetof(PackedBinding, elementName), addString(binding.elementName));
+    out[offset + offsetof(PackedBinding, kind)] = static_cast<uint8_t>(binding.kind);
+    out[offset + offsetof(PackedBinding, dimension)] = static_cast<uint8_t>(binding.dimension);
+    out[offset + offsetof(PackedBinding, registerClass)] =
+        static_cast<uint8_t>(binding.registerClass);
+    out[offset + offsetof(PackedBinding, flags)] = binding.used ? packedBindingUsed : 0;
+    write16(out, offset + offsetof(PackedBinding, type), static_cast<uint32_t>(binding.type));
+    write16(out, offset + offsetof(PackedBinding, elementType),
+            static_cast<uint32_t>(binding.elementType));
+    write32(out, offset + offsetof(PackedBinding, registerIndex),
+            static_cast<uint32_t>(binding.registerIndex));
+    write32(out, offset + offsetof(PackedBinding, space), binding.space);
+    write32(out, offset + offsetof(PackedBinding, arrayCount), binding.arrayCount);
+    offset += sizeof(PackedBinding);
+  }
+
+  out.insert(out.end(), strings.begin(), strings.end());
+  // Pad to 4 bytes, so blobs can be placed one after another.
+  out.resize((out.size() + 3) & ~size_t(3));
+  return out;
+}
+
+} // namespace visitor
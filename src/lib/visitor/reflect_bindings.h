@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "../ast/ast.h"
+#include "reachability.h"
+
+namespace visitor {
+
+/// What a resource binding is, which decides the class of register it's bound to.
+enum class BindingKind : uint8_t {
+  /// A cbuffer, bound to a b register.
+  ConstantBuffer,
+  /// A tbuffer, bound to a t register.
+  TextureBuffer,
+  /// A texture, bound to a t register.
+  Texture,
+  /// A StructuredBuffer, bound to a t register.
+  StructuredBuffer,
+  /// A sampler, bound to an s register. The samplers of Direct3D 9, such as sampler2D, are also
+  /// textures of their dimension.
+  Sampler,
+  /// A RW texture or buffer, bound to a u register.
+  UnorderedAccess,
+};
+
+/// The shape of a texture, or Buffer for a buffer.
+enum class BindingDimension : uint8_t {
+  None,
+  Buffer,
+  Texture1D,
+  Texture1DArray,
+  Texture2D,
+  Texture2DArray,
+  Texture2DMS,
+  Texture2DMSArray,
+  Texture3D,
+  TextureCube,
+  TextureCubeArray,
+};
+
+const char* bindingKindToString(BindingKind kind);
+
+const char* bindingDimensionToString(BindingDimension dimension);
+
+/// A cbuffer, tbuffer, texture, sampler or buffer declared by the program, and where it's bound.
+struct Binding {
+  std::string_view name;
+  BindingKind kind = BindingKind::Texture;
+  BindingDimension dimension = BindingDimension::None;
+  /// The declared type, such as Texture2D or RWStructuredBuffer. Undefined for cbuffers and
+  /// tbuffers.
+  ast::BaseType type = ast::BaseType::Undefined;
+  /// The type of the elements, given by the template argument, such as Float for
+  /// Texture2D<float>, or Struct for StructuredBuffer<Light>. A texture or typed buffer without
+  /// one holds Float4s. Undefined if the resource has no elements, such as a sampler.
+  ast::BaseType elementType = ast::BaseType::Undefined;
+  /// The name of the struct or typedef of the elements, if they're one.
+  std::string_view elementName;
+  /// The register given by register(t0), as its class, such as 't', and its index. The class is
+  /// 0 and the index -1 if no register is given.
+  char registerClass = 0;
+  int32_t registerIndex = -1;
+  /// The space given by register(t0, space1), or 0.
+  uint32_t space = 0;
+  /// The number of resources of an array, such as 4 for Texture2D t[4], 0 for an array without
+  /// a size, such as Texture2D t[], or 1 if it isn't an array.
+  uint32_t arrayCount = 1;
+  /// Whether the entry point uses the resource.
+  bool used = true;
+};
+
+/// The header of the blob written by ReflectBindings::writeBinary(). The blob is the header, an
+/// array of PackedBinding, then the names as null-terminated strings, so a runtime can map the
+/// file and read it in place. Every value is little-endian.
+struct PackedBindingHeader {
+  /// packedBindingMagic.
+  uint32_t magic;
+  /// packedBindingVersion.
+  uint16_t version;
+  /// sizeof(PackedBinding), so a reader can skip fields added by later versions.
+  uint16_t bindingSize;
+  uint32_t numBindings;
+  /// The offset of the strings from the start of the blob.
+  uint32_t stringsOffset;
+};
+
+/// A Binding in the blob. The strings are offsets into the strings of the blob, where 0 is the
+/// empty string.
+struct PackedBinding {
+  uint32_t name;
+  uint32_t elementName;
+  uint8_t kind;
+  uint8_t dimension;
+  /// The register class, such as 't', or 0.
+  uint8_t registerClass;
+  /// packedBindingUsed if the entry point uses the resource.
+  uint8_t flags;
+  uint16_t type;
+  uint16_t elementType;
+  int32_t registerIndex;
+  uint32_t space;
+  uint32_t arrayCount;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(PackedBindingHeader) == 16, "The header is packed");
+static_assert(sizeof(PackedBinding) == 32, "Bindings are packed");
+
+/// "HLRB", as the little-endian magic number of the blob.
+const uint32_t packedBindingMagic = 0x42524c48;
+const uint16_t packedBindingVersion = 1;
+const uint8_t packedBindingUsed = 1;
+
+/// Finds the resources the program declares, the cbuffers, tbuffers, textures, samplers and
+/// buffers, with the registers and spaces they're bound to, and writes them as a binding table
+/// in JSON or as a blob a runtime can map.
+///
+/// Whether each resource is used comes from Node::visible, so after PruneTree has pruned the
+/// Ast for an entry point, the resources it doesn't use are kept in the table but not used.
+/// Reflecting with a ReachableSet reads the set instead, so one Ast can be reflected for each
+/// of the entry points Reachability computed.
+class ReflectBindings {
+public:
+  ast::Ast* ast;
+
+  /// The bindings found by reflect(), in the order they're declared.
+  std::vector<Binding> bindings;
+
+  ReflectBindings(ast::Ast* ast);
+
+  /// Find the bindings of the global declarations, replacing any found before.
+  /// @param usedSet The symbols the entry point uses, or null to read Node::visible.
+  void reflect(const ReachableSet* usedSet = nullptr);
+
+  /// Write the bindings as a JSON array of objects, one for each binding.
+  void writeJson(std::ostream& out) const;
+
+  /// The bindings as a blob starting with a PackedBindingHeader.
+  std::vector<uint8_t> writeBinary() const;
+
+private:
+  void addBuffer(const ast::BufferStmt* buffer, bool used);
+
+  void addVariable(const ast::VariableStmt* variable, bool used);
+};
+
+} // namespace visitor
@@ -0,0 +1,485 @@
+#include "resolve_symbols.h"
+
+#include <algorithm>
+
+#include "../util/trace.h"
+
+namespace visitor {
+
+static ast::Field* findField(ast::StructStmt* structStmt, const std::string_view& name) {
+  for (ast::Field* field = structStmt->fields; field != nullptr; field = field->next) {
+    if (field->name == name) {
+      return field;
+    }
+  }
+  return nullptr;
+}
+
+ResolveSymbols::ResolveSymbols(ast::Ast* ast)
+    : ast(ast) {
+}
+
+void ResolveSymbols::resolve() {
+  HLSL_TRACE_SCOPE("resolve symbols");
+  _globals.clear();
+  _callees.clear();
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    switch (stmt->nodeType) {
+      case ast::NodeType::StructStmt:
+        visitStructStmt(static_cast<ast::StructStmt*>(stmt));
+        break;
+      case ast::NodeType::BufferStmt:
+        visitBufferStmt(static_cast<ast::BufferStmt*>(stmt));
+        break;
+      case ast::NodeType::FunctionStmt:
+        visitFunctionStmt(static_cast<ast::FunctionStmt*>(stmt));
+        break;
+      case ast::NodeType::TypedefStmt:
+        visitTypedefStmt(static_cast<ast::TypedefStmt*>(stmt));
+        break;
+      case ast::NodeType::VariableStmt:
+        visitVariableStmt(static_cast<ast::VariableStmt*>(stmt));
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+const std::vector<ast::FunctionStmt*>& ResolveSymbols::callees(
+    const ast::FunctionStmt* function) const {
+  static const std::vector<ast::FunctionStmt*> none;
+  auto it = _callees.find(function);
+  return it == _callees.end() ? none : it->second;
+}
+
+void ResolveSymbols::visitFunctionStmt(ast::FunctionStmt* node) {
+  ast::FunctionStmt* enclosing = _function;
+  _function = node;
+  visitType(node->returnType);
+  pushScope();
+  for (ast::Parameter* parameter = node->parameters; parameter != nullptr;
+       parameter = parameter->next) {
+    visitParameter(parameter);
+    declare(parameter->name, parameter);
+  }
+  if (node->body != nullptr) {
+    visitBlock(node->body);
+  }
+  popScope();
+  _function = enclosing;
+}
+
+void ResolveSymbols::visitStructStmt(ast::StructStmt* node) {
+  StaticVisitor::visitStructStmt(node);
+  // The fields are in scope in the methods.
+  ast::StructStmt* enclosing = _struct;
+  _struct = node;
+  pushScope();
+  for (ast::Field* field = node->fields; field != nullptr; field = field->next) {
+    declare(field->name, field);
+  }
+  for (ast::Statement* method = node->methods; method != nullptr; method = method->next) {
+    visitFunctionStmt(static_cast<ast::FunctionStmt*>(method));
+  }
+  popScope();
+  _struct = enclosing;
+}
+
+void ResolveSymbols::visitBufferStmt(ast::BufferStmt* node) {
+  // The fields of a cbuffer are global variables.
+  for (ast::Field* field = node->field; field != nullptr; field = field->next) {
+    visitBufferField(field);
+    declare(field->name, field);
+  }
+}
+
+void ResolveSymbols::visitBlock(ast::Block* node) {
+  pushScope();
+  StaticVisitor::visitBlock(node);
+  popScope();
+}
+
+void ResolveSymbols::visitForStmt(ast::ForStmt* node) {
+  pushScope();
+  StaticVisitor::visitForStmt(node);
+  popScope();
+}
+
+void ResolveSymbols::visitSwitchStmt(ast::SwitchStmt* node) {
+  pushScope();
+  StaticVisitor::visitSwitchStmt(node);
+  popScope();
+}
+
+void ResolveSymbols::visitVariableStmt(ast::VariableStmt* node) {
+  visitType(node->type);
+  visitArraySize(node->arraySize);
+  // As in C, the variable is in scope in its own initializer.
+  declare(node->name, node);
+  if (node->initializer != nullptr) {
+    visitExpression(node->initializer);
+  }
+}
+
+void ResolveSymbols::visitParameter(ast::Parameter* node) {
+  StaticVisitor::visitParameter(node);
+  visitArraySize(node->arraySize);
+}
+
+void ResolveSymbols::visitType(ast::Type* type) {
+  if (type != nullptr) {
+    visitArraySize(type->arraySize);
+  }
+}
+
+void ResolveSymbols::visitArraySize(ast::Expression* size) {
+  // The sizes of the dimensions of an array.
+  for (; size != nullptr; size = size->next) {
+    visitExpression(size);
+  }
+}
+
+void ResolveSymbols::visitCallStmt(ast::CallStmt* node) {
+  if (node->function == nullptr && !callsIntrinsic(node->intrinsic)) {
+    node->function = resolveCall(node->name, node->arguments);
+  }
+  addCallee(node->function);
+  StaticVisitor::visitCallStmt(node);
+}
+
+void ResolveSymbols::visitCallExpr(ast::CallExpr* node) {
+  addCallee(resolveCallExpr(node, nullptr));
+  StaticVisitor::visitCallExpr(node);
+}
+
+void ResolveSymbols::visitVariableExpr(ast::VariableExpr* node) {
+  node->declaration = lookup(node->name);
+}
+
+void ResolveSymbols::visitMemberExpr(ast::MemberExpr* node) {
+  visitOperand(node->object);
+  if (node->member == nullptr) {
+    return;
+  }
+  // The member is named by the struct of the object, not the scope, so it isn't visited as a
+  // variable or call. Members of other types, such as swizzles and texture methods, are left
+  // unresolved.
+  if (node->member->nodeType == ast::NodeType::VariableExpr) {
+    ast::StructStmt* structStmt = structOf(node->object);
+    if (structStmt != nullptr) {
+      ast::VariableExpr* member = static_cast<ast::VariableExpr*>(node->member);
+      member->declaration = findField(structStmt, member->name);
+    }
+  } else if (node->member->nodeType == ast::NodeType::CallExpr) {
+    ast::CallExpr* call = static_cast<ast::CallExpr*>(node->member);
+    ast::StructStmt* structStmt = structOf(node->object);
+    if (structStmt != nullptr) {
+      addCallee(resolveCallExpr(call, structStmt));
+    }
+    visitArguments(call->arguments);
+  } else {
+    visitOperand(node->member);
+  }
+}
+
+ResolveSymbols::ValueType ResolveSymbols::valueType(const ast::Type* type, bool array) {
+  ValueType value;
+  if (type == nullptr) {
+    return value;
+  }
+  value.baseType = type->baseType;
+  if (type->baseType == ast::BaseType::Struct || type->baseType == ast::BaseType::UserDefined) {
+    value.name = type->name;
+  }
+  value.array = array || type->array;
+  return value;
+}
+
+ResolveSymbols::ValueType ResolveSymbols::declarationType(const ast::Node* declaration) {
+  if (declaration == nullptr) {
+    return ValueType();
+  }
+  switch (declaration->nodeType) {
+    case ast::NodeType::VariableStmt: {
+      const ast::VariableStmt* variable = static_cast<const ast::VariableStmt*>(declaration);
+      return valueType(variable->type, variable->isArray);
+    }
+    case ast::NodeType::Parameter: {
+      const ast::Parameter* parameter = static_cast<const ast::Parameter*>(declaration);
+      return valueType(parameter->type, parameter->isArray);
+    }
+    case ast::NodeType::Field: {
+      const ast::Field* field = static_cast<const ast::Field*>(declaration);
+      return valueType(field->type, field->isArray);
+    }
+    default:
+      return ValueType();
+  }
+}
+
+ResolveSymbols::ValueType ResolveSymbols::typeOf(ast::Expression* expr) {
+  // Member, index and call expressions need the types of their operands. Give up on the rare
+  // expressions that nest them deeply, rather than risk the stack.
+  if (_typeDepth >= maxTypeDepth) {
+    return ValueType();
+  }
+  _typeDepth++;
+
+  // Follow the operand that gives the expression its type, so long chains of operators don't
+  // recurse.
+  ValueType value;
+  bool comparison = false;
+  while (expr != nullptr) {
+    ast::Expression* operand = nullptr;
+    switch (expr->nodeType) {
+      case ast::NodeType::LiteralExpr:
+        value.baseType = static_cast<ast::LiteralExpr*>(expr)->type;
+        break;
+      case ast::NodeType::VariableExpr: {
+        ast::VariableExpr* variable = static_cast<ast::VariableExpr*>(expr);
+        value = declarationType(variable->declaration != nullptr ? variable->declaration
+                                                                 : lookup(variable->name));
+        break;
+      }
+      case ast::NodeType::CastExpr:
+        value = valueType(static_cast<ast::CastExpr*>(expr)->type, false);
+        break;
+      case ast::NodeType::CallExpr: {
+        ast::FunctionStmt* function = resolveCallExpr(static_cast<ast::CallExpr*>(expr), nullptr);
+        if (function != nullptr) {
+          value = valueType(function->returnType, false);
+        }
+        break;
+      }
+      case ast::NodeType::BinaryExpr: {
+        ast::BinaryExpr* binary = static_cast<ast::BinaryExpr*>(expr);
+        switch (binary->op) {
+          case ast::Operator::OrOr:
+          case ast::Operator::AndAnd:
+          case ast::Operator::EqualEqual:
+          case ast::Operator::NotEqual:
+          case ast::Operator::Less:
+          case ast::Operator::LessEqual:
+          case ast::Operator::Greater:
+          case ast::Operator::GreaterEqual:
+            comparison = true;
+            break;
+          default:
+            break;
+        }
+        operand = binary->left;
+        break;
+      }
+      case ast::NodeType::PrefixExpr: {
+        ast::PrefixExpr* prefix = static_cast<ast::PrefixExpr*>(expr);
+        comparison = comparison || prefix->op == ast::Operator::Not;
+        operand = prefix->expression;
+        break;
+      }
+      case ast::NodeType::TernaryExpr:
+        operand = static_cast<ast::TernaryExpr*>(expr)->trueExpr;
+        break;
+      case ast::NodeType::AssignmentExpr:
+        operand = static_cast<ast::AssignmentExpr*>(expr)->variable;
+        break;
+      case ast::NodeType::IncrementExpr:
+        operand = static_cast<ast::IncrementExpr*>(expr)->variable;
+        break;
+      case ast::NodeType::ArrayExpr: {
+        // Indexing an array gives its element, but indexing a vector or matrix gives a type that
+        // isn't worked out here.
+        const ValueType array = typeOf(static_cast<ast::ArrayExpr*>(expr)->array);
+        if (array.array) {
+          value = array;
+          value.array = false;
+        }
+        break;
+      }
+      case ast::NodeType::MemberExpr: {
+        ast::MemberExpr* member = static_cast<ast::MemberExpr*>(expr);
+        if (member->member == nullptr) {
+          break;
+        }
+        const ValueType object = typeOf(member->object);
+        ast::StructStmt* structStmt = object.baseType == ast::BaseType::Struct && !object.array
+            ? ast->findStruct(object.name)
+            : nullptr;
+        if (structStmt == nullptr) {
+          // A swizzle of a scalar, vector or matrix, such as v.xy, as InferTypes types it.
+          if (!object.array && member->member->nodeType == ast::NodeType::VariableExpr) {
+            value.baseType = ast::swizzleBaseType(
+                object.baseType, static_cast<ast::VariableExpr*>(member->member)->name);
+          }
+          break;
+        }
+        if (member->member->nodeType == ast::NodeType::VariableExpr) {
+          value = declarationType(
+              findField(structStmt, static_cast<ast::VariableExpr*>(member->member)->name));
+        } else if (member->member->nodeType == ast::NodeType::CallExpr) {
+          ast::FunctionStmt* method =
+              resolveCallExpr(static_cast<ast::CallExpr*>(member->member), structStmt);
+          if (method != nullptr) {
+            value = valueType(method->returnType, false);
+          }
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    expr = operand;
+  }
+
+  if (comparison) {
+    // Comparing scalars gives a bool. Comparing vectors gives a bool vector, which isn't worked
+    // out here.
+    const bool scalar = !value.array && (value.baseType == ast::BaseType::Float ||
+        value.baseType == ast::BaseType::Half || value.baseType == ast::BaseType::Int ||
+        value.baseType == ast::BaseType::Uint || value.baseType == ast::BaseType::Bool);
+    value = ValueType();
+    if (scalar) {
+      value.baseType = ast::BaseType::Bool;
+    }
+  }
+  _typeDepth--;
+  return value;
+}
+
+ast::StructStmt* ResolveSymbols::structOf(ast::Expression* expr) {
+  const ValueType value = typeOf(expr);
+  if (value.baseType != ast::BaseType::Struct || value.array) {
+    return nullptr;
+  }
+  return ast->findStruct(value.name);
+}
+
+ast::FunctionStmt* ResolveSymbols::resolveCall(const std::string_view& name,
+                                               ast::Expression* arguments) {
+  if (_struct != nullptr) {
+    ast::FunctionStmt* method = resolveMethod(_struct, name, arguments);
+    if (method != nullptr) {
+      return method;
+    }
+  }
+  return chooseOverload(ast->findOverloads(name), arguments);
+}
+
+ast::FunctionStmt* ResolveSymbols::resolveMethod(ast::StructStmt* structStmt,
+                                                 const std::string_view& name,
+                                                 ast::Expression* arguments) {
+  std::vector<ast::FunctionStmt*> methods;
+  for (ast::Statement* stmt = structStmt->methods; stmt != nullptr; stmt = stmt->next) {
+    ast::FunctionStmt* method = static_cast<ast::FunctionStmt*>(stmt);
+    if (method->name == name) {
+      methods.push_back(method);
+    }
+  }
+  return chooseOverload(methods, arguments);
+}
+
+ast::FunctionStmt* ResolveSymbols::chooseOverload(
+    const std::vector<ast::FunctionStmt*>& candidates, ast::Expression* arguments) {
+  if (candidates.size() <= 1) {
+    return candidates.empty() ? nullptr : candidates[0];
+  }
+
+  std::vector<ValueType> argumentTypes;
+  for (ast::Expression* argument = arguments; argument != nullptr; argument = argument->next) {
+    argumentTypes.push_back(typeOf(argument));
+  }
+
+  // Each argument scores 2 if its type is the same as the parameter's, 1 if its type is unknown
+  // and 0 otherwise. The overload with the best score is chosen, and of those with the same
+  // score the one that fills in the fewest default arguments. If several still tie, the call is
+  // left unresolved rather than guessing, so passes that follow calls keep all of them.
+  ast::FunctionStmt* best = nullptr;
+  int bestScore = -1;
+  size_t bestDefaults = 0;
+  bool tied = false;
+  for (ast::FunctionStmt* candidate : candidates) {
+    size_t numParameters = 0;
+    size_t numRequired = 0;
+    int score = 0;
+    for (ast::Parameter* parameter = candidate->parameters; parameter != nullptr;
+         parameter = parameter->next) {
+      if (parameter->initializer == nullptr) {
+        numRequired = numParameters + 1;
+      }
+      if (numParameters < argumentTypes.size()) {
+        const ValueType& argument = argumentTypes[numParameters];
+        const ValueType parameterType = declarationType(parameter);
+        if (argument.baseType == ast::BaseType::Undefined) {
+          score += 1;
+        } else if (argument.baseType == parameterType.baseType &&
+                   argument.name == parameterType.name &&
+                   argument.array == parameterType.array) {
+          score += 2;
+        }
+      }
+      numParameters++;
+    }
+    if (argumentTypes.size() < numRequired || argumentTypes.size() > numParameters) {
+      continue;
+    }
+    const size_t defaults = numParameters - argumentTypes.size();
+    if (score > bestScore || (score == bestScore && defaults < bestDefaults)) {
+      best = candidate;
+      bestScore = score;
+      bestDefaults = defaults;
+      tied = false;
+    } else if (score == bestScore && defaults == bestDefaults) {
+      tied = true;
+    }
+  }
+  if (tied) {
+    return nullptr;
+  }
+  // If no overload takes that many arguments, use the last, as Ast::findFunction() does.
+  return best != nullptr ? best : candidates.back();
+}
+
+ast::FunctionStmt* ResolveSymbols::resolveCallExpr(ast::CallExpr* node,
+                                                   ast::StructStmt* structStmt) {
+  if (node->function == nullptr && (structStmt != nullptr || !callsIntrinsic(node->intrinsic))) {
+    node->function = structStmt != nullptr
+        ? resolveMethod(structStmt, node->name, node->arguments)
+        : resolveCall(node->name, node->arguments);
+  }
+  return node->function;
+}
+
+bool ResolveSymbols::callsIntrinsic(ast::Intrinsic intrinsic) const {
+  // Methods aren't added to the Ast, so in a method the name may be one of its struct.
+  return intrinsic != ast::Intrinsic::None && !ast->declaresIntrinsic() && _struct == nullptr;
+}
+
+void ResolveSymbols::addCallee(ast::FunctionStmt* function) {
+  if (_function == nullptr || function == nullptr) {
+    return;
+  }
+  std::vector<ast::FunctionStmt*>& callees = _callees[_function];
+  if (std::find(callees.begin(), callees.end(), function) == callees.end()) {
+    callees.push_back(function);
+  }
+}
+
+void ResolveSymbols::declare(const std::string_view& name, ast::Node* declaration) {
+  if (_scopes.empty()) {
+    _globals[name] = declaration;
+  } else {
+    _locals.emplace_back(name, declaration);
+  }
+}
+
+ast::Node* ResolveSymbols::lookup(const std::string_view& name) const {
+  for (auto it = _locals.rbegin(); it != _locals.rend(); ++it) {
+    if (it->first == name) {
+      return it->second;
+    }
+  }
+  auto it = _globals.find(name);
+  return it == _globals.end() ? nullptr : it->second;
+}
+
+} // namespace visitor
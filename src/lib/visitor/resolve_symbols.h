@@ -0,0 +1,127 @@
+#pragma once
+
+#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../ast/ast.h"
+#include "static_visitor.h"
+
+namespace visitor {
+
+/// Resolves the names used in an Ast to their declarations, so later passes follow a pointer
+/// rather than looking the name up again.
+///
+/// Each CallExpr and CallStmt is given the overload it calls, chosen by the number and types of
+/// its arguments, and each VariableExpr is given the local variable, parameter, global variable
+/// or cbuffer field it refers to, following the scopes of blocks and functions. A call or member
+/// of a struct resolves to the method or field of the struct. The functions each function calls
+/// are recorded as a call graph.
+///
+/// The type of an argument is only worked out for simple expressions, such as variables,
+/// literals, casts, calls, swizzles and the operators on them. An argument of unknown type
+/// matches any parameter. A call that matches several overloads equally well is left
+/// unresolved.
+class ResolveSymbols : public StaticVisitor<ResolveSymbols> {
+public:
+  ast::Ast* ast;
+
+  ResolveSymbols(ast::Ast* ast);
+
+  /// Resolve every name in the Ast, visible or not.
+  void resolve();
+
+  /// The functions called by the function, each once, in the order they're first called.
+  const std::vector<ast::FunctionStmt*>& callees(const ast::FunctionStmt* function) const;
+
+  void visitFunctionStmt(ast::FunctionStmt* node);
+
+  void visitStructStmt(ast::StructStmt* node);
+
+  void visitBufferStmt(ast::BufferStmt* node);
+
+  void visitBlock(ast::Block* node);
+
+  void visitForStmt(ast::ForStmt* node);
+
+  void visitSwitchStmt(ast::SwitchStmt* node);
+
+  void visitVariableStmt(ast::VariableStmt* node);
+
+  void visitParameter(ast::Parameter* node);
+
+  void visitType(ast::Type* type);
+
+  void visitCallStmt(ast::CallStmt* node);
+
+  void visitCallExpr(ast::CallExpr* node);
+
+  void visitVariableExpr(ast::VariableExpr* node);
+
+  void visitMemberExpr(ast::MemberExpr* node);
+
+private:
+  // The type of an expression, as far as choosing an overload needs it. Undefined is unknown.
+  struct ValueType {
+    ast::BaseType baseType = ast::BaseType::Undefined;
+    std::string_view name;
+    bool array = false;
+  };
+
+  static ValueType valueType(const ast::Type* type, bool array);
+
+  // The type of a VariableStmt, Parameter or Field.
+  static ValueType declarationType(const ast::Node* declaration);
+
+  ValueType typeOf(ast::Expression* expr);
+
+  void visitArraySize(ast::Expression* size);
+
+  // The struct the expression is an instance of, or null.
+  ast::StructStmt* structOf(ast::Expression* expr);
+
+  // Choose the overload of a function for the arguments. In a method, the methods of its struct
+  // are looked for first.
+  ast::FunctionStmt* resolveCall(const std::string_view& name, ast::Expression* arguments);
+
+  // Choose the overload of a method of the struct for the arguments, or null if it has none.
+  ast::FunctionStmt* resolveMethod(ast::StructStmt* structStmt, const std::string_view& name,
+                                   ast::Expression* arguments);
+
+  ast::FunctionStmt* chooseOverload(const std::vector<ast::FunctionStmt*>& candidates,
+                                    ast::Expression* arguments);
+
+  // Resolve the call, if it isn't already, as a method of structStmt if it's given.
+  ast::FunctionStmt* resolveCallExpr(ast::CallExpr* node, ast::StructStmt* structStmt);
+
+  // Whether a call tagged with the intrinsic calls it, so its name needn't be looked up.
+  bool callsIntrinsic(ast::Intrinsic intrinsic) const;
+
+  void addCallee(ast::FunctionStmt* function);
+
+  void declare(const std::string_view& name, ast::Node* declaration);
+
+  ast::Node* lookup(const std::string_view& name) const;
+
+  void pushScope() { _scopes.push_back(_locals.size()); }
+
+  void popScope() {
+    _locals.resize(_scopes.back());
+    _scopes.pop_back();
+  }
+
+  // The declarations of the enclosing scopes, innermost last, and where each scope starts.
+  std::vector<std::pair<std::string_view, ast::Node*>> _locals;
+  std::vector<size_t> _scopes;
+  std::map<std::string_view, ast::Node*> _globals;
+
+  ast::FunctionStmt* _function = nullptr;
+  ast::StructStmt* _struct = nullptr;
+  // The depth of nested typeOf calls.
+  int _typeDepth = 0;
+  static const int maxTypeDepth = 64;
+  std::map<const ast::FunctionStmt*, std::vector<ast::FunctionStmt*>> _callees;
+};
+
+} // namespace visitor
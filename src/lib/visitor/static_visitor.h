@@ -0,0 +1,450 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "../ast/ast_node.h"
+#include "reachability.h"
+
+namespace visitor {
+
+/// A visitor that dispatches to the visit methods of Derived at compile time.
+/// It walks the Ast in the same order as Visitor, with the same visit methods, but a derived
+/// class hides the methods it handles rather than overriding them, and each node type is
+/// dispatched with a single switch on its NodeType rather than a chain of compares and a virtual
+/// call. Visitors that are written for one purpose, such as the GLSL generator, should use this;
+/// Visitor remains for visitors that are extended by further subclasses.
+///
+/// A derived class calls the default handling of a node with the base class method, for
+/// example StaticVisitor::visitBlock(node), and must call the visit methods through derived()
+/// or unqualified from its own methods so they dispatch to it.
+template<typename Derived>
+class StaticVisitor {
+public:
+  /// Visit only the top-level statements in the set rather than those marked visible, as
+  /// Visitor::setVisibleSet does.
+  void setVisibleSet(const ReachableSet* set) { _visibleSet = set; }
+
+  const ReachableSet* visibleSet() const { return _visibleSet; }
+
+  void visitRoot(ast::Root* node) {
+    if (node == nullptr) {
+      return;
+    }
+    for (ast::Statement* statement = node->statements; statement != nullptr;
+         statement = statement->next) {
+      derived().visitTopLevelStatement(statement);
+    }
+  }
+
+  void visitTopLevelStatement(ast::Statement* node) {
+    if (!isVisible(node)) {
+      return;
+    }
+    switch (node->nodeType) {
+      case ast::NodeType::StructStmt:
+        derived().visitStructStmt(static_cast<ast::StructStmt*>(node));
+        break;
+      case ast::NodeType::BufferStmt:
+        derived().visitBufferStmt(static_cast<ast::BufferStmt*>(node));
+        break;
+      case ast::NodeType::FunctionStmt:
+        derived().visitFunctionStmt(static_cast<ast::FunctionStmt*>(node));
+        break;
+      case ast::NodeType::TypedefStmt:
+        derived().visitTypedefStmt(static_cast<ast::TypedefStmt*>(node));
+        break;
+      case ast::NodeType::VariableStmt:
+        derived().visitVariableStmt(static_cast<ast::VariableStmt*>(node));
+        break;
+      default:
+        break;
+    }
+  }
+
+  void visitStatements(ast::Statement* node) {
+    while (node != nullptr) {
+      derived().visitStatement(node);
+      node = node->next;
+    }
+  }
+
+  void visitStatement(ast::Statement* node) {
+    switch (node->nodeType) {
+      case ast::NodeType::ExpressionStmt:
+        derived().visitExpressionStmt(static_cast<ast::ExpressionStmt*>(node));
+        break;
+      case ast::NodeType::ReturnStmt:
+        derived().visitReturn(static_cast<ast::ReturnStmt*>(node));
+        break;
+      case ast::NodeType::IfStmt:
+        derived().visitIfStmt(static_cast<ast::IfStmt*>(node));
+        break;
+      case ast::NodeType::ForStmt:
+        derived().visitForStmt(static_cast<ast::ForStmt*>(node));
+        break;
+      case ast::NodeType::DoWhileStmt:
+        derived().visitDoWhileStmt(static_cast<ast::DoWhileStmt*>(node));
+        break;
+      case ast::NodeType::WhileStmt:
+        derived().visitWhileStmt(static_cast<ast::WhileStmt*>(node));
+        break;
+      case ast::NodeType::SwitchStmt:
+        derived().visitSwitchStmt(static_cast<ast::SwitchStmt*>(node));
+        break;
+      case ast::NodeType::BreakStmt:
+        derived().visitBreakStmt(static_cast<ast::BreakStmt*>(node));
+        break;
+      case ast::NodeType::ContinueStmt:
+        derived().visitContinueStmt(static_cast<ast::ContinueStmt*>(node));
+        break;
+      case ast::NodeType::DiscardStmt:
+        derived().visitDiscardStmt(static_cast<ast::DiscardStmt*>(node));
+        break;
+      case ast::NodeType::Block:
+        derived().visitBlock(static_cast<ast::Block*>(node));
+        break;
+      case ast::NodeType::AssignmentStmt:
+        derived().visitAssignmentStmt(static_cast<ast::AssignmentStmt*>(node));
+        break;
+      case ast::NodeType::VariableStmt:
+        derived().visitVariableStmt(static_cast<ast::VariableStmt*>(node));
+        break;
+      case ast::NodeType::CallStmt:
+        derived().visitCallStmt(static_cast<ast::CallStmt*>(node));
+        break;
+      default:
+        break;
+    }
+  }
+
+  void visitBlock(ast::Block* node) {
+    derived().visitStatements(node->statements);
+  }
+
+  void visitBreakStmt(ast::BreakStmt* node) {}
+
+  void visitBufferStmt(ast::BufferStmt* node) {
+    for (ast::Field* field = node->field; field != nullptr; field = field->next) {
+      derived().visitBufferField(field);
+    }
+  }
+
+  void visitContinueStmt(ast::ContinueStmt* node) {}
+
+  void visitDiscardStmt(ast::DiscardStmt* node) {}
+
+  void visitDoWhileStmt(ast::DoWhileStmt* node) {
+    derived().visitStatements(node->body);
+    derived().visitExpression(node->condition);
+  }
+
+  void visitExpressionStmt(ast::ExpressionStmt* node) {
+    derived().visitExpression(node->expression);
+  }
+
+  void visitForStmt(ast::ForStmt* node) {
+    if (node->initializer != nullptr) {
+      derived().visitStatement(node->initializer);
+    }
+    if (node->condition != nullptr) {
+      derived().visitExpression(node->condition);
+    }
+    if (node->increment != nullptr) {
+      derived().visitStatements(node->increment);
+    }
+    derived().visitStatements(node->body);
+  }
+
+  void visitFunctionStmt(ast::FunctionStmt* node) {
+    derived().visitType(node->returnType);
+    if (node->parameters != nullptr) {
+      derived().visitParameter(node->parameters);
+    }
+    derived().visitBlock(node->body);
+  }
+
+  void visitIfStmt(ast::IfStmt* node) {
+    derived().visitExpression(node->condition);
+    derived().visitStatements(node->body);
+    if (node->elseBody != nullptr) {
+      derived().visitStatements(node->elseBody);
+    }
+  }
+
+  void visitStructStmt(ast::StructStmt* node) {
+    for (ast::Field* field = node->fields; field != nullptr; field = field->next) {
+      derived().visitStructField(field);
+    }
+  }
+
+  void visitSwitchStmt(ast::SwitchStmt* node) {
+    derived().visitExpression(node->condition);
+    for (ast::SwitchCase* switchCase = node->cases; switchCase != nullptr;
+         switchCase = switchCase->next) {
+      derived().visitSwitchCase(switchCase);
+    }
+  }
+
+  void visitVariableStmt(ast::VariableStmt* node) {
+    derived().visitType(node->type);
+    if (node->initializer != nullptr) {
+      derived().visitExpression(node->initializer);
+    }
+  }
+
+  void visitTypedefStmt(ast::TypedefStmt* node) {
+    derived().visitType(node->type);
+  }
+
+  void visitWhileStmt(ast::WhileStmt* node) {
+    derived().visitExpression(node->condition);
+    derived().visitStatements(node->body);
+  }
+
+  void visitCallStmt(ast::CallStmt* node) {
+    derived().visitArguments(node->arguments);
+  }
+
+  void visitAssignmentStmt(ast::AssignmentStmt* node) {
+    derived().visitExpression(node->variable);
+    derived().visitExpression(node->value);
+  }
+
+  void visitReturn(ast::ReturnStmt* node) {
+    derived().visitExpression(node->value);
+  }
+
+  // Visit an expression tree in pre-order with an explicit stack, as Visitor::visitExpression
+  // does, so deeply nested expressions can't overflow the stack.
+  void visitExpression(ast::Expression* node) {
+    if (node == nullptr) {
+      return;
+    }
+    const size_t base = _expressionStack.size();
+    _expressionWalks++;
+    while (true) {
+      const size_t operands = _expressionStack.size();
+      dispatchExpression(node);
+      // The operands were pushed in order, so reverse them to pop the first operand first.
+      if (_expressionStack.size() > operands + 1) {
+        std::reverse(_expressionStack.begin() + operands, _expressionStack.end());
+      }
+      if (_expressionStack.size() == base) {
+        break;
+      }
+      node = _expressionStack.back();
+      _expressionStack.pop_back();
+    }
+    _expressionWalks--;
+  }
+
+  void visitBinaryExpr(ast::BinaryExpr* node) {
+    visitOperand(node->left);
+    visitOperand(node->right);
+  }
+
+  void visitCallExpr(ast::CallExpr* node) {
+    derived().visitArguments(node->arguments);
+  }
+
+  void visitLiteralExpr(ast::LiteralExpr* node) {}
+
+  void visitCastExpr(ast::CastExpr* node) {
+    derived().visitType(node->type);
+    // A constructor such as float3(a, b, c) has a list of values.
+    for (ast::Expression* value = node->value; value != nullptr; value = value->next) {
+      visitOperand(value);
+    }
+  }
+
+  void visitParameter(ast::Parameter* node) {
+    derived().visitType(node->type);
+    if (node->initializer != nullptr) {
+      derived().visitExpression(node->initializer);
+    }
+  }
+
+  void visitParameters(ast::Parameter* node) {
+    for (ast::Parameter* p = node; p != nullptr; p = p->next) {
+      derived().visitParameter(p);
+    }
+  }
+
+  void visitStringExpr(ast::StringExpr* node) {}
+
+  void visitTernaryExpr(ast::TernaryExpr* node) {
+    visitOperand(node->condition);
+    visitOperand(node->trueExpr);
+    visitOperand(node->falseExpr);
+  }
+
+  void visitPrefixExpr(ast::PrefixExpr* node) {
+    visitOperand(node->expression);
+  }
+
+  void visitVariableExpr(ast::VariableExpr* node) {}
+
+  void visitIncrementExpr(ast::IncrementExpr* node) {
+    visitOperand(node->variable);
+  }
+
+  void visitArrayExpr(ast::ArrayExpr* node) {
+    visitOperand(node->array);
+    visitOperand(node->index);
+  }
+
+  void visitMemberExpr(ast::MemberExpr* node) {
+    visitOperand(node->object);
+    visitOperand(node->member);
+  }
+
+  void visitAssignmentExpr(ast::AssignmentExpr* node) {
+    visitOperand(node->variable);
+    visitOperand(node->value);
+  }
+
+  void visitArrayInitializerExpr(ast::ArrayInitializerExpr* node) {
+    for (ast::Expression* expr = node->elements; expr != nullptr; expr = expr->next) {
+      visitOperand(expr);
+    }
+  }
+
+  void visitStructInitializerExpr(ast::StructInitializerExpr* node) {
+    for (ast::Expression* expr = node->fields; expr != nullptr; expr = expr->next) {
+      visitOperand(expr);
+    }
+  }
+
+  void visitArgument(ast::Expression* node) {
+    derived().visitExpression(node);
+  }
+
+  void visitArguments(ast::Expression* node) {
+    for (; node != nullptr; node = node->next) {
+      derived().visitArgument(node);
+    }
+  }
+
+  void visitAttribute(ast::Attribute* node) {}
+
+  void visitAttributes(ast::Attribute* node) {
+    for (; node != nullptr; node = node->next) {
+      derived().visitAttribute(node);
+    }
+  }
+
+  void visitBufferField(ast::Field* node) {
+    derived().visitType(node->type);
+    if (node->assignment != nullptr) {
+      derived().visitExpression(node->assignment);
+    }
+  }
+
+  void visitStateAssignment(ast::StateAssignment* node) {}
+
+  void visitSamplerState(ast::SamplerState* node) {
+    for (ast::StateAssignment* stateAssignment = node->stateAssignments;
+         stateAssignment != nullptr; stateAssignment = stateAssignment->next) {
+      derived().visitStateAssignment(stateAssignment);
+    }
+  }
+
+  void visitStructField(ast::Field* node) {
+    derived().visitType(node->type);
+  }
+
+  void visitSwitchCase(ast::SwitchCase* node) {
+    if (node->condition != nullptr) {
+      derived().visitExpression(node->condition);
+    }
+    if (node->body != nullptr) {
+      derived().visitStatements(node->body);
+    }
+  }
+
+  void visitType(ast::Type* type) {}
+
+protected:
+  Derived& derived() { return static_cast<Derived&>(*this); }
+
+  // Whether the node is in the visible set, or marked visible if there isn't one.
+  bool isVisible(const ast::Node* node) const {
+    return _visibleSet != nullptr ? _visibleSet->contains(node) : node->visible;
+  }
+
+  // Visit an expression that is an operand of the expression being visited, as
+  // Visitor::visitOperand does.
+  void visitOperand(ast::Expression* node) {
+    if (node == nullptr) {
+      return;
+    }
+    if (_expressionWalks > 0) {
+      _expressionStack.push_back(node);
+    } else {
+      derived().visitExpression(node);
+    }
+  }
+
+private:
+  // Call the visit method of Derived for the type of expression.
+  void dispatchExpression(ast::Expression* node) {
+    switch (node->nodeType) {
+      case ast::NodeType::BinaryExpr:
+        derived().visitBinaryExpr(static_cast<ast::BinaryExpr*>(node));
+        break;
+      case ast::NodeType::PrefixExpr:
+        derived().visitPrefixExpr(static_cast<ast::PrefixExpr*>(node));
+        break;
+      case ast::NodeType::TernaryExpr:
+        derived().visitTernaryExpr(static_cast<ast::TernaryExpr*>(node));
+        break;
+      case ast::NodeType::CastExpr:
+        derived().visitCastExpr(static_cast<ast::CastExpr*>(node));
+        break;
+      case ast::NodeType::SamplerState:
+        derived().visitSamplerState(static_cast<ast::SamplerState*>(node));
+        break;
+      case ast::NodeType::StringExpr:
+        derived().visitStringExpr(static_cast<ast::StringExpr*>(node));
+        break;
+      case ast::NodeType::CallExpr:
+        derived().visitCallExpr(static_cast<ast::CallExpr*>(node));
+        break;
+      case ast::NodeType::VariableExpr:
+        derived().visitVariableExpr(static_cast<ast::VariableExpr*>(node));
+        break;
+      case ast::NodeType::LiteralExpr:
+        derived().visitLiteralExpr(static_cast<ast::LiteralExpr*>(node));
+        break;
+      case ast::NodeType::IncrementExpr:
+        derived().visitIncrementExpr(static_cast<ast::IncrementExpr*>(node));
+        break;
+      case ast::NodeType::ArrayExpr:
+        derived().visitArrayExpr(static_cast<ast::ArrayExpr*>(node));
+        break;
+      case ast::NodeType::MemberExpr:
+        derived().visitMemberExpr(static_cast<ast::MemberExpr*>(node));
+        break;
+      case ast::NodeType::AssignmentExpr:
+        derived().visitAssignmentExpr(static_cast<ast::AssignmentExpr*>(node));
+        break;
+      case ast::NodeType::ArrayInitializerExpr:
+        derived().visitArrayInitializerExpr(static_cast<ast::ArrayInitializerExpr*>(node));
+        break;
+      case ast::NodeType::StructInitializerExpr:
+        derived().visitStructInitializerExpr(static_cast<ast::StructInitializerExpr*>(node));
+        break;
+      default:
+        break;
+    }
+  }
+
+  // The expressions waiting to be visited by visitExpression.
+  std::vector<ast::Expression*> _expressionStack;
+  // The number of visitExpression calls walking the expression stack.
+  int _expressionWalks = 0;
+  const ReachableSet* _visibleSet = nullptr;
+};
+
+} // namespace visitor
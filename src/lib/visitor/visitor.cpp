@@ -1,5 +1,7 @@
 #include "visitor.h"
 
+#include <algorithm>
+
 namespace visitor {
 
 inline bool isStatement(ast::Node* node) {
@@ -28,7 +30,7 @@ void Visitor::visitRoot(ast::Root* node) {
 }
 
 void Visitor::visitTopLevelStatement(ast::Statement* node) {
-  if (node->visible == false) {
+  if (!isVisible(node)) {
     return;
   }
   if (node->nodeType == ast::NodeType::StructStmt) {
@@ -95,9 +97,6 @@ void Visitor::visitBufferField(ast::Field* node) {
   if (node->assignment != nullptr) {
     visitExpression(node->assignment);
   }
-  if (node->next != nullptr) {
-    visitBufferField(node->next);
-  }
 }
 
 void Visitor::visitStructStmt(ast::StructStmt* node) {
@@ -217,6 +216,38 @@ void Visitor::visitExpression(ast::Expression* node) {
   if (node == nullptr) {
     return;
   }
+  // Visit the expression tree in pre-order, with the base visit methods pushing the operands of
+  // each node rather than recursing, so deeply nested expressions can't overflow the stack.
+  const size_t base = _expressionStack.size();
+  _expressionWalks++;
+  while (true) {
+    const size_t operands = _expressionStack.size();
+    dispatchExpression(node);
+    // The operands were pushed in order, so reverse them to pop the first operand first.
+    if (_expressionStack.size() > operands + 1) {
+      std::reverse(_expressionStack.begin() + operands, _expressionStack.end());
+    }
+    if (_expressionStack.size() == base) {
+      break;
+    }
+    node = _expressionStack.back();
+    _expressionStack.pop_back();
+  }
+  _expressionWalks--;
+}
+
+void Visitor::visitOperand(ast::Expression* node) {
+  if (node == nullptr) {
+    return;
+  }
+  if (_expressionWalks > 0) {
+    _expressionStack.push_back(node);
+  } else {
+    visitExpression(node);
+  }
+}
+
+void Visitor::dispatchExpression(ast::Expression* node) {
   if (node->nodeType == ast::NodeType::BinaryExpr) {
     visitBinaryExpr((ast::BinaryExpr*)node);
   } else if (node->nodeType == ast::NodeType::PrefixExpr) {
@@ -255,7 +286,7 @@ void Visitor::visitExpression(ast::Expression* node) {
 void Visitor::visitArrayInitializerExpr(ast::ArrayInitializerExpr* node) {
   ast::Expression* expr = node->elements;
   while (expr != nullptr) {
-    visitExpression(expr);
+    visitOperand(expr);
     expr = expr->next;
   }
 }
@@ -263,41 +294,32 @@ void Visitor::visitArrayInitializerExpr(ast::ArrayInitializerExpr* node) {
 void Visitor::visitStructInitializerExpr(ast::StructInitializerExpr* node) {
   ast::Expression* expr = node->fields;
   while (expr != nullptr) {
-    visitExpression(expr);
+    visitOperand(expr);
     expr = expr->next;
   }
 }
 
 void Visitor::visitBinaryExpr(ast::BinaryExpr *node) {
-  if (node->left != nullptr) {
-    visitExpression(node->left);
-  }
-  if (node->right != nullptr) {
-    visitExpression(node->right);
-  }
+  visitOperand(node->left);
+  visitOperand(node->right);
 }
 
 void Visitor::visitPrefixExpr(ast::PrefixExpr *node) {
-  if (node->expression != nullptr) {
-    visitExpression(node->expression);
-  }
+  visitOperand(node->expression);
 }
 
 void Visitor::visitTernaryExpr(ast::TernaryExpr *node) {
-  if (node->condition != nullptr) {
-    visitExpression(node->condition);
-  }
-  if (node->trueExpr != nullptr) {
-    visitExpression(node->trueExpr);
-  }
-  if (node->falseExpr != nullptr) {
-    visitExpression(node->falseExpr);
-  }
+  visitOperand(node->condition);
+  visitOperand(node->trueExpr);
+  visitOperand(node->falseExpr);
 }
 
 void Visitor::visitCastExpr(ast::CastExpr* node) {
   visitType(node->type);
-  visitExpression(node->value);
+  // A constructor such as float3(a, b, c) has a list of values.
+  for (ast::Expression* value = node->value; value != nullptr; value = value->next) {
+    visitOperand(value);
+  }
 }
 
 void Visitor::visitArgument(ast::Expression* node) {
@@ -366,22 +388,22 @@ void Visitor::visitCallStmt(ast::CallStmt* node) {
 }
 
 void Visitor::visitIncrementExpr(ast::IncrementExpr* node) {
-  visitExpression(node->variable);
+  visitOperand(node->variable);
 }
 
 void Visitor::visitArrayExpr(ast::ArrayExpr* node) {
-  visitExpression(node->array);
-  visitExpression(node->index);
+  visitOperand(node->array);
+  visitOperand(node->index);
 }
 
 void Visitor::visitMemberExpr(ast::MemberExpr* node) {
-  visitExpression(node->object);
-  visitExpression(node->member);
+  visitOperand(node->object);
+  visitOperand(node->member);
 }
 
 void Visitor::visitAssignmentExpr(ast::AssignmentExpr* node) {
-  visitExpression(node->variable);
-  visitExpression(node->value);
+  visitOperand(node->variable);
+  visitOperand(node->value);
 }
 
 } // namespace visitor
@@ -1,11 +1,21 @@
 #pragma once
 
+#include <vector>
+
 #include "../ast/ast_node.h"
+#include "reachability.h"
 
 namespace visitor {
 
 class Visitor {
 public:
+  /// Visit only the top-level statements in the set rather than those marked visible, so a
+  /// visitor can run on an Ast pruned for one entry point while other threads use it for others.
+  /// The set isn't owned, and null goes back to Node::visible.
+  void setVisibleSet(const ReachableSet* set) { _visibleSet = set; }
+
+  const ReachableSet* visibleSet() const { return _visibleSet; }
+
   virtual void visitRoot(ast::Root* node);
 
   virtual void visitTopLevelStatement(ast::Statement* node);
@@ -59,6 +69,29 @@ public:
   virtual void visitStructField(ast::Field* node);
   virtual void visitSwitchCase(ast::SwitchCase* node);
   virtual void visitType(ast::Type* type);
+
+protected:
+  // Visit an expression that is an operand of the expression being visited. visitExpression walks
+  // an expression tree with an explicit stack rather than recursing, so while it's walking the
+  // operand is pushed to be visited after the current expression's visit method returns.
+  // Otherwise the operand is visited immediately.
+  void visitOperand(ast::Expression* node);
+
+  // Whether the node is in the visible set, or marked visible if there isn't one.
+  bool isVisible(const ast::Node* node) const {
+    return _visibleSet != nullptr ? _visibleSet->contains(node) : node->visible;
+  }
+
+private:
+  // Call the visit method for the type of expression.
+  void dispatchExpression(ast::Expression* node);
+
+  // The expressions waiting to be visited by visitExpression. A nested visitExpression call,
+  // such as for the arguments of a call, uses the entries above those of the outer call.
+  std::vector<ast::Expression*> _expressionStack;
+  // The number of visitExpression calls walking the expression stack.
+  int _expressionWalks = 0;
+  const ReachableSet* _visibleSet = nullptr;
 };
 
 } // namespace visitor
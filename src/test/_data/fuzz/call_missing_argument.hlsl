@@ -0,0 +1 @@
+float f = pow(max(, 1), 2);
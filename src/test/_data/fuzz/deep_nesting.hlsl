@@ -0,0 +1,6 @@
+float a = ((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((((1))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+float b[] = {{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{1}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}};
+void f(int x) {{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{{}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}}
+void g(int x) { if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) if (x) x = 1; }
+float h(float x) { return x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x.x; }
+float k(float x) { return --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x + x; }
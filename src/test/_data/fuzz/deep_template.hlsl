@@ -0,0 +1 @@
+Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<Texture2D<float>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> t;
@@ -0,0 +1,3 @@
+void foo() {
+  if (1) ; else
+}
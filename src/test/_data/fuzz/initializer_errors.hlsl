@@ -0,0 +1 @@
+float a[] = { , 1 };
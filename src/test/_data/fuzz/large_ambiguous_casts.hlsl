@@ -0,0 +1,1004 @@
+struct S { float a; };
+float main(float x) {
+  float v0 = (S)(x) + (x)(x) + (float)(x);
+  float v1 = (S)(x) + (x)(x) + (float)(x);
+  float v2 = (S)(x) + (x)(x) + (float)(x);
+  float v3 = (S)(x) + (x)(x) + (float)(x);
+  float v4 = (S)(x) + (x)(x) + (float)(x);
+  float v5 = (S)(x) + (x)(x) + (float)(x);
+  float v6 = (S)(x) + (x)(x) + (float)(x);
+  float v7 = (S)(x) + (x)(x) + (float)(x);
+  float v8 = (S)(x) + (x)(x) + (float)(x);
+  float v9 = (S)(x) + (x)(x) + (float)(x);
+  float v10 = (S)(x) + (x)(x) + (float)(x);
+  float v11 = (S)(x) + (x)(x) + (float)(x);
+  float v12 = (S)(x) + (x)(x) + (float)(x);
+  float v13 = (S)(x) + (x)(x) + (float)(x);
+  float v14 = (S)(x) + (x)(x) + (float)(x);
+  float v15 = (S)(x) + (x)(x) + (float)(x);
+  float v16 = (S)(x) + (x)(x) + (float)(x);
+  float v17 = (S)(x) + (x)(x) + (float)(x);
+  float v18 = (S)(x) + (x)(x) + (float)(x);
+  float v19 = (S)(x) + (x)(x) + (float)(x);
+  float v20 = (S)(x) + (x)(x) + (float)(x);
+  float v21 = (S)(x) + (x)(x) + (float)(x);
+  float v22 = (S)(x) + (x)(x) + (float)(x);
+  float v23 = (S)(x) + (x)(x) + (float)(x);
+  float v24 = (S)(x) + (x)(x) + (float)(x);
+  float v25 = (S)(x) + (x)(x) + (float)(x);
+  float v26 = (S)(x) + (x)(x) + (float)(x);
+  float v27 = (S)(x) + (x)(x) + (float)(x);
+  float v28 = (S)(x) + (x)(x) + (float)(x);
+  float v29 = (S)(x) + (x)(x) + (float)(x);
+  float v30 = (S)(x) + (x)(x) + (float)(x);
+  float v31 = (S)(x) + (x)(x) + (float)(x);
+  float v32 = (S)(x) + (x)(x) + (float)(x);
+  float v33 = (S)(x) + (x)(x) + (float)(x);
+  float v34 = (S)(x) + (x)(x) + (float)(x);
+  float v35 = (S)(x) + (x)(x) + (float)(x);
+  float v36 = (S)(x) + (x)(x) + (float)(x);
+  float v37 = (S)(x) + (x)(x) + (float)(x);
+  float v38 = (S)(x) + (x)(x) + (float)(x);
+  float v39 = (S)(x) + (x)(x) + (float)(x);
+  float v40 = (S)(x) + (x)(x) + (float)(x);
+  float v41 = (S)(x) + (x)(x) + (float)(x);
+  float v42 = (S)(x) + (x)(x) + (float)(x);
+  float v43 = (S)(x) + (x)(x) + (float)(x);
+  float v44 = (S)(x) + (x)(x) + (float)(x);
+  float v45 = (S)(x) + (x)(x) + (float)(x);
+  float v46 = (S)(x) + (x)(x) + (float)(x);
+  float v47 = (S)(x) + (x)(x) + (float)(x);
+  float v48 = (S)(x) + (x)(x) + (float)(x);
+  float v49 = (S)(x) + (x)(x) + (float)(x);
+  float v50 = (S)(x) + (x)(x) + (float)(x);
+  float v51 = (S)(x) + (x)(x) + (float)(x);
+  float v52 = (S)(x) + (x)(x) + (float)(x);
+  float v53 = (S)(x) + (x)(x) + (float)(x);
+  float v54 = (S)(x) + (x)(x) + (float)(x);
+  float v55 = (S)(x) + (x)(x) + (float)(x);
+  float v56 = (S)(x) + (x)(x) + (float)(x);
+  float v57 = (S)(x) + (x)(x) + (float)(x);
+  float v58 = (S)(x) + (x)(x) + (float)(x);
+  float v59 = (S)(x) + (x)(x) + (float)(x);
+  float v60 = (S)(x) + (x)(x) + (float)(x);
+  float v61 = (S)(x) + (x)(x) + (float)(x);
+  float v62 = (S)(x) + (x)(x) + (float)(x);
+  float v63 = (S)(x) + (x)(x) + (float)(x);
+  float v64 = (S)(x) + (x)(x) + (float)(x);
+  float v65 = (S)(x) + (x)(x) + (float)(x);
+  float v66 = (S)(x) + (x)(x) + (float)(x);
+  float v67 = (S)(x) + (x)(x) + (float)(x);
+  float v68 = (S)(x) + (x)(x) + (float)(x);
+  float v69 = (S)(x) + (x)(x) + (float)(x);
+  float v70 = (S)(x) + (x)(x) + (float)(x);
+  float v71 = (S)(x) + (x)(x) + (float)(x);
+  float v72 = (S)(x) + (x)(x) + (float)(x);
+  float v73 = (S)(x) + (x)(x) + (float)(x);
+  float v74 = (S)(x) + (x)(x) + (float)(x);
+  float v75 = (S)(x) + (x)(x) + (float)(x);
+  float v76 = (S)(x) + (x)(x) + (float)(x);
+  float v77 = (S)(x) + (x)(x) + (float)(x);
+  float v78 = (S)(x) + (x)(x) + (float)(x);
+  float v79 = (S)(x) + (x)(x) + (float)(x);
+  float v80 = (S)(x) + (x)(x) + (float)(x);
+  float v81 = (S)(x) + (x)(x) + (float)(x);
+  float v82 = (S)(x) + (x)(x) + (float)(x);
+  float v83 = (S)(x) + (x)(x) + (float)(x);
+  float v84 = (S)(x) + (x)(x) + (float)(x);
+  float v85 = (S)(x) + (x)(x) + (float)(x);
+  float v86 = (S)(x) + (x)(x) + (float)(x);
+  float v87 = (S)(x) + (x)(x) + (float)(x);
+  float v88 = (S)(x) + (x)(x) + (float)(x);
+  float v89 = (S)(x) + (x)(x) + (float)(x);
+  float v90 = (S)(x) + (x)(x) + (float)(x);
+  float v91 = (S)(x) + (x)(x) + (float)(x);
+  float v92 = (S)(x) + (x)(x) + (float)(x);
+  float v93 = (S)(x) + (x)(x) + (float)(x);
+  float v94 = (S)(x) + (x)(x) + (float)(x);
+  float v95 = (S)(x) + (x)(x) + (float)(x);
+  float v96 = (S)(x) + (x)(x) + (float)(x);
+  float v97 = (S)(x) + (x)(x) + (float)(x);
+  float v98 = (S)(x) + (x)(x) + (float)(x);
+  float v99 = (S)(x) + (x)(x) + (float)(x);
+  float v100 = (S)(x) + (x)(x) + (float)(x);
+  float v101 = (S)(x) + (x)(x) + (float)(x);
+  float v102 = (S)(x) + (x)(x) + (float)(x);
+  float v103 = (S)(x) + (x)(x) + (float)(x);
+  float v104 = (S)(x) + (x)(x) + (float)(x);
+  float v105 = (S)(x) + (x)(x) + (float)(x);
+  float v106 = (S)(x) + (x)(x) + (float)(x);
+  float v107 = (S)(x) + (x)(x) + (float)(x);
+  float v108 = (S)(x) + (x)(x) + (float)(x);
+  float v109 = (S)(x) + (x)(x) + (float)(x);
+  float v110 = (S)(x) + (x)(x) + (float)(x);
+  float v111 = (S)(x) + (x)(x) + (float)(x);
+  float v112 = (S)(x) + (x)(x) + (float)(x);
+  float v113 = (S)(x) + (x)(x) + (float)(x);
+  float v114 = (S)(x) + (x)(x) + (float)(x);
+  float v115 = (S)(x) + (x)(x) + (float)(x);
+  float v116 = (S)(x) + (x)(x) + (float)(x);
+  float v117 = (S)(x) + (x)(x) + (float)(x);
+  float v118 = (S)(x) + (x)(x) + (float)(x);
+  float v119 = (S)(x) + (x)(x) + (float)(x);
+  float v120 = (S)(x) + (x)(x) + (float)(x);
+  float v121 = (S)(x) + (x)(x) + (float)(x);
+  float v122 = (S)(x) + (x)(x) + (float)(x);
+  float v123 = (S)(x) + (x)(x) + (float)(x);
+  float v124 = (S)(x) + (x)(x) + (float)(x);
+  float v125 = (S)(x) + (x)(x) + (float)(x);
+  float v126 = (S)(x) + (x)(x) + (float)(x);
+  float v127 = (S)(x) + (x)(x) + (float)(x);
+  float v128 = (S)(x) + (x)(x) + (float)(x);
+  float v129 = (S)(x) + (x)(x) + (float)(x);
+  float v130 = (S)(x) + (x)(x) + (float)(x);
+  float v131 = (S)(x) + (x)(x) + (float)(x);
+  float v132 = (S)(x) + (x)(x) + (float)(x);
+  float v133 = (S)(x) + (x)(x) + (float)(x);
+  float v134 = (S)(x) + (x)(x) + (float)(x);
+  float v135 = (S)(x) + (x)(x) + (float)(x);
+  float v136 = (S)(x) + (x)(x) + (float)(x);
+  float v137 = (S)(x) + (x)(x) + (float)(x);
+  float v138 = (S)(x) + (x)(x) + (float)(x);
+  float v139 = (S)(x) + (x)(x) + (float)(x);
+  float v140 = (S)(x) + (x)(x) + (float)(x);
+  float v141 = (S)(x) + (x)(x) + (float)(x);
+  float v142 = (S)(x) + (x)(x) + (float)(x);
+  float v143 = (S)(x) + (x)(x) + (float)(x);
+  float v144 = (S)(x) + (x)(x) + (float)(x);
+  float v145 = (S)(x) + (x)(x) + (float)(x);
+  float v146 = (S)(x) + (x)(x) + (float)(x);
+  float v147 = (S)(x) + (x)(x) + (float)(x);
+  float v148 = (S)(x) + (x)(x) + (float)(x);
+  float v149 = (S)(x) + (x)(x) + (float)(x);
+  float v150 = (S)(x) + (x)(x) + (float)(x);
+  float v151 = (S)(x) + (x)(x) + (float)(x);
+  float v152 = (S)(x) + (x)(x) + (float)(x);
+  float v153 = (S)(x) + (x)(x) + (float)(x);
+  float v154 = (S)(x) + (x)(x) + (float)(x);
+  float v155 = (S)(x) + (x)(x) + (float)(x);
+  float v156 = (S)(x) + (x)(x) + (float)(x);
+  float v157 = (S)(x) + (x)(x) + (float)(x);
+  float v158 = (S)(x) + (x)(x) + (float)(x);
+  float v159 = (S)(x) + (x)(x) + (float)(x);
+  float v160 = (S)(x) + (x)(x) + (float)(x);
+  float v161 = (S)(x) + (x)(x) + (float)(x);
+  float v162 = (S)(x) + (x)(x) + (float)(x);
+  float v163 = (S)(x) + (x)(x) + (float)(x);
+  float v164 = (S)(x) + (x)(x) + (float)(x);
+  float v165 = (S)(x) + (x)(x) + (float)(x);
+  float v166 = (S)(x) + (x)(x) + (float)(x);
+  float v167 = (S)(x) + (x)(x) + (float)(x);
+  float v168 = (S)(x) + (x)(x) + (float)(x);
+  float v169 = (S)(x) + (x)(x) + (float)(x);
+  float v170 = (S)(x) + (x)(x) + (float)(x);
+  float v171 = (S)(x) + (x)(x) + (float)(x);
+  float v172 = (S)(x) + (x)(x) + (float)(x);
+  float v173 = (S)(x) + (x)(x) + (float)(x);
+  float v174 = (S)(x) + (x)(x) + (float)(x);
+  float v175 = (S)(x) + (x)(x) + (float)(x);
+  float v176 = (S)(x) + (x)(x) + (float)(x);
+  float v177 = (S)(x) + (x)(x) + (float)(x);
+  float v178 = (S)(x) + (x)(x) + (float)(x);
+  float v179 = (S)(x) + (x)(x) + (float)(x);
+  float v180 = (S)(x) + (x)(x) + (float)(x);
+  float v181 = (S)(x) + (x)(x) + (float)(x);
+  float v182 = (S)(x) + (x)(x) + (float)(x);
+  float v183 = (S)(x) + (x)(x) + (float)(x);
+  float v184 = (S)(x) + (x)(x) + (float)(x);
+  float v185 = (S)(x) + (x)(x) + (float)(x);
+  float v186 = (S)(x) + (x)(x) + (float)(x);
+  float v187 = (S)(x) + (x)(x) + (float)(x);
+  float v188 = (S)(x) + (x)(x) + (float)(x);
+  float v189 = (S)(x) + (x)(x) + (float)(x);
+  float v190 = (S)(x) + (x)(x) + (float)(x);
+  float v191 = (S)(x) + (x)(x) + (float)(x);
+  float v192 = (S)(x) + (x)(x) + (float)(x);
+  float v193 = (S)(x) + (x)(x) + (float)(x);
+  float v194 = (S)(x) + (x)(x) + (float)(x);
+  float v195 = (S)(x) + (x)(x) + (float)(x);
+  float v196 = (S)(x) + (x)(x) + (float)(x);
+  float v197 = (S)(x) + (x)(x) + (float)(x);
+  float v198 = (S)(x) + (x)(x) + (float)(x);
+  float v199 = (S)(x) + (x)(x) + (float)(x);
+  float v200 = (S)(x) + (x)(x) + (float)(x);
+  float v201 = (S)(x) + (x)(x) + (float)(x);
+  float v202 = (S)(x) + (x)(x) + (float)(x);
+  float v203 = (S)(x) + (x)(x) + (float)(x);
+  float v204 = (S)(x) + (x)(x) + (float)(x);
+  float v205 = (S)(x) + (x)(x) + (float)(x);
+  float v206 = (S)(x) + (x)(x) + (float)(x);
+  float v207 = (S)(x) + (x)(x) + (float)(x);
+  float v208 = (S)(x) + (x)(x) + (float)(x);
+  float v209 = (S)(x) + (x)(x) + (float)(x);
+  float v210 = (S)(x) + (x)(x) + (float)(x);
+  float v211 = (S)(x) + (x)(x) + (float)(x);
+  float v212 = (S)(x) + (x)(x) + (float)(x);
+  float v213 = (S)(x) + (x)(x) + (float)(x);
+  float v214 = (S)(x) + (x)(x) + (float)(x);
+  float v215 = (S)(x) + (x)(x) + (float)(x);
+  float v216 = (S)(x) + (x)(x) + (float)(x);
+  float v217 = (S)(x) + (x)(x) + (float)(x);
+  float v218 = (S)(x) + (x)(x) + (float)(x);
+  float v219 = (S)(x) + (x)(x) + (float)(x);
+  float v220 = (S)(x) + (x)(x) + (float)(x);
+  float v221 = (S)(x) + (x)(x) + (float)(x);
+  float v222 = (S)(x) + (x)(x) + (float)(x);
+  float v223 = (S)(x) + (x)(x) + (float)(x);
+  float v224 = (S)(x) + (x)(x) + (float)(x);
+  float v225 = (S)(x) + (x)(x) + (float)(x);
+  float v226 = (S)(x) + (x)(x) + (float)(x);
+  float v227 = (S)(x) + (x)(x) + (float)(x);
+  float v228 = (S)(x) + (x)(x) + (float)(x);
+  float v229 = (S)(x) + (x)(x) + (float)(x);
+  float v230 = (S)(x) + (x)(x) + (float)(x);
+  float v231 = (S)(x) + (x)(x) + (float)(x);
+  float v232 = (S)(x) + (x)(x) + (float)(x);
+  float v233 = (S)(x) + (x)(x) + (float)(x);
+  float v234 = (S)(x) + (x)(x) + (float)(x);
+  float v235 = (S)(x) + (x)(x) + (float)(x);
+  float v236 = (S)(x) + (x)(x) + (float)(x);
+  float v237 = (S)(x) + (x)(x) + (float)(x);
+  float v238 = (S)(x) + (x)(x) + (float)(x);
+  float v239 = (S)(x) + (x)(x) + (float)(x);
+  float v240 = (S)(x) + (x)(x) + (float)(x);
+  float v241 = (S)(x) + (x)(x) + (float)(x);
+  float v242 = (S)(x) + (x)(x) + (float)(x);
+  float v243 = (S)(x) + (x)(x) + (float)(x);
+  float v244 = (S)(x) + (x)(x) + (float)(x);
+  float v245 = (S)(x) + (x)(x) + (float)(x);
+  float v246 = (S)(x) + (x)(x) + (float)(x);
+  float v247 = (S)(x) + (x)(x) + (float)(x);
+  float v248 = (S)(x) + (x)(x) + (float)(x);
+  float v249 = (S)(x) + (x)(x) + (float)(x);
+  float v250 = (S)(x) + (x)(x) + (float)(x);
+  float v251 = (S)(x) + (x)(x) + (float)(x);
+  float v252 = (S)(x) + (x)(x) + (float)(x);
+  float v253 = (S)(x) + (x)(x) + (float)(x);
+  float v254 = (S)(x) + (x)(x) + (float)(x);
+  float v255 = (S)(x) + (x)(x) + (float)(x);
+  float v256 = (S)(x) + (x)(x) + (float)(x);
+  float v257 = (S)(x) + (x)(x) + (float)(x);
+  float v258 = (S)(x) + (x)(x) + (float)(x);
+  float v259 = (S)(x) + (x)(x) + (float)(x);
+  float v260 = (S)(x) + (x)(x) + (float)(x);
+  float v261 = (S)(x) + (x)(x) + (float)(x);
+  float v262 = (S)(x) + (x)(x) + (float)(x);
+  float v263 = (S)(x) + (x)(x) + (float)(x);
+  float v264 = (S)(x) + (x)(x) + (float)(x);
+  float v265 = (S)(x) + (x)(x) + (float)(x);
+  float v266 = (S)(x) + (x)(x) + (float)(x);
+  float v267 = (S)(x) + (x)(x) + (float)(x);
+  float v268 = (S)(x) + (x)(x) + (float)(x);
+  float v269 = (S)(x) + (x)(x) + (float)(x);
+  float v270 = (S)(x) + (x)(x) + (float)(x);
+  float v271 = (S)(x) + (x)(x) + (float)(x);
+  float v272 = (S)(x) + (x)(x) + (float)(x);
+  float v273 = (S)(x) + (x)(x) + (float)(x);
+  float v274 = (S)(x) + (x)(x) + (float)(x);
+  float v275 = (S)(x) + (x)(x) + (float)(x);
+  float v276 = (S)(x) + (x)(x) + (float)(x);
+  float v277 = (S)(x) + (x)(x) + (float)(x);
+  float v278 = (S)(x) + (x)(x) + (float)(x);
+  float v279 = (S)(x) + (x)(x) + (float)(x);
+  float v280 = (S)(x) + (x)(x) + (float)(x);
+  float v281 = (S)(x) + (x)(x) + (float)(x);
+  float v282 = (S)(x) + (x)(x) + (float)(x);
+  float v283 = (S)(x) + (x)(x) + (float)(x);
+  float v284 = (S)(x) + (x)(x) + (float)(x);
+  float v285 = (S)(x) + (x)(x) + (float)(x);
+  float v286 = (S)(x) + (x)(x) + (float)(x);
+  float v287 = (S)(x) + (x)(x) + (float)(x);
+  float v288 = (S)(x) + (x)(x) + (float)(x);
+  float v289 = (S)(x) + (x)(x) + (float)(x);
+  float v290 = (S)(x) + (x)(x) + (float)(x);
+  float v291 = (S)(x) + (x)(x) + (float)(x);
+  float v292 = (S)(x) + (x)(x) + (float)(x);
+  float v293 = (S)(x) + (x)(x) + (float)(x);
+  float v294 = (S)(x) + (x)(x) + (float)(x);
+  float v295 = (S)(x) + (x)(x) + (float)(x);
+  float v296 = (S)(x) + (x)(x) + (float)(x);
+  float v297 = (S)(x) + (x)(x) + (float)(x);
+  float v298 = (S)(x) + (x)(x) + (float)(x);
+  float v299 = (S)(x) + (x)(x) + (float)(x);
+  float v300 = (S)(x) + (x)(x) + (float)(x);
+  float v301 = (S)(x) + (x)(x) + (float)(x);
+  float v302 = (S)(x) + (x)(x) + (float)(x);
+  float v303 = (S)(x) + (x)(x) + (float)(x);
+  float v304 = (S)(x) + (x)(x) + (float)(x);
+  float v305 = (S)(x) + (x)(x) + (float)(x);
+  float v306 = (S)(x) + (x)(x) + (float)(x);
+  float v307 = (S)(x) + (x)(x) + (float)(x);
+  float v308 = (S)(x) + (x)(x) + (float)(x);
+  float v309 = (S)(x) + (x)(x) + (float)(x);
+  float v310 = (S)(x) + (x)(x) + (float)(x);
+  float v311 = (S)(x) + (x)(x) + (float)(x);
+  float v312 = (S)(x) + (x)(x) + (float)(x);
+  float v313 = (S)(x) + (x)(x) + (float)(x);
+  float v314 = (S)(x) + (x)(x) + (float)(x);
+  float v315 = (S)(x) + (x)(x) + (float)(x);
+  float v316 = (S)(x) + (x)(x) + (float)(x);
+  float v317 = (S)(x) + (x)(x) + (float)(x);
+  float v318 = (S)(x) + (x)(x) + (float)(x);
+  float v319 = (S)(x) + (x)(x) + (float)(x);
+  float v320 = (S)(x) + (x)(x) + (float)(x);
+  float v321 = (S)(x) + (x)(x) + (float)(x);
+  float v322 = (S)(x) + (x)(x) + (float)(x);
+  float v323 = (S)(x) + (x)(x) + (float)(x);
+  float v324 = (S)(x) + (x)(x) + (float)(x);
+  float v325 = (S)(x) + (x)(x) + (float)(x);
+  float v326 = (S)(x) + (x)(x) + (float)(x);
+  float v327 = (S)(x) + (x)(x) + (float)(x);
+  float v328 = (S)(x) + (x)(x) + (float)(x);
+  float v329 = (S)(x) + (x)(x) + (float)(x);
+  float v330 = (S)(x) + (x)(x) + (float)(x);
+  float v331 = (S)(x) + (x)(x) + (float)(x);
+  float v332 = (S)(x) + (x)(x) + (float)(x);
+  float v333 = (S)(x) + (x)(x) + (float)(x);
+  float v334 = (S)(x) + (x)(x) + (float)(x);
+  float v335 = (S)(x) + (x)(x) + (float)(x);
+  float v336 = (S)(x) + (x)(x) + (float)(x);
+  float v337 = (S)(x) + (x)(x) + (float)(x);
+  float v338 = (S)(x) + (x)(x) + (float)(x);
+  float v339 = (S)(x) + (x)(x) + (float)(x);
+  float v340 = (S)(x) + (x)(x) + (float)(x);
+  float v341 = (S)(x) + (x)(x) + (float)(x);
+  float v342 = (S)(x) + (x)(x) + (float)(x);
+  float v343 = (S)(x) + (x)(x) + (float)(x);
+  float v344 = (S)(x) + (x)(x) + (float)(x);
+  float v345 = (S)(x) + (x)(x) + (float)(x);
+  float v346 = (S)(x) + (x)(x) + (float)(x);
+  float v347 = (S)(x) + (x)(x) + (float)(x);
+  float v348 = (S)(x) + (x)(x) + (float)(x);
+  float v349 = (S)(x) + (x)(x) + (float)(x);
+  float v350 = (S)(x) + (x)(x) + (float)(x);
+  float v351 = (S)(x) + (x)(x) + (float)(x);
+  float v352 = (S)(x) + (x)(x) + (float)(x);
+  float v353 = (S)(x) + (x)(x) + (float)(x);
+  float v354 = (S)(x) + (x)(x) + (float)(x);
+  float v355 = (S)(x) + (x)(x) + (float)(x);
+  float v356 = (S)(x) + (x)(x) + (float)(x);
+  float v357 = (S)(x) + (x)(x) + (float)(x);
+  float v358 = (S)(x) + (x)(x) + (float)(x);
+  float v359 = (S)(x) + (x)(x) + (float)(x);
+  float v360 = (S)(x) + (x)(x) + (float)(x);
+  float v361 = (S)(x) + (x)(x) + (float)(x);
+  float v362 = (S)(x) + (x)(x) + (float)(x);
+  float v363 = (S)(x) + (x)(x) + (float)(x);
+  float v364 = (S)(x) + (x)(x) + (float)(x);
+  float v365 = (S)(x) + (x)(x) + (float)(x);
+  float v366 = (S)(x) + (x)(x) + (float)(x);
+  float v367 = (S)(x) + (x)(x) + (float)(x);
+  float v368 = (S)(x) + (x)(x) + (float)(x);
+  float v369 = (S)(x) + (x)(x) + (float)(x);
+  float v370 = (S)(x) + (x)(x) + (float)(x);
+  float v371 = (S)(x) + (x)(x) + (float)(x);
+  float v372 = (S)(x) + (x)(x) + (float)(x);
+  float v373 = (S)(x) + (x)(x) + (float)(x);
+  float v374 = (S)(x) + (x)(x) + (float)(x);
+  float v375 = (S)(x) + (x)(x) + (float)(x);
+  float v376 = (S)(x) + (x)(x) + (float)(x);
+  float v377 = (S)(x) + (x)(x) + (float)(x);
+  float v378 = (S)(x) + (x)(x) + (float)(x);
+  float v379 = (S)(x) + (x)(x) + (float)(x);
+  float v380 = (S)(x) + (x)(x) + (float)(x);
+  float v381 = (S)(x) + (x)(x) + (float)(x);
+  float v382 = (S)(x) + (x)(x) + (float)(x);
+  float v383 = (S)(x) + (x)(x) + (float)(x);
+  float v384 = (S)(x) + (x)(x) + (float)(x);
+  float v385 = (S)(x) + (x)(x) + (float)(x);
+  float v386 = (S)(x) + (x)(x) + (float)(x);
+  float v387 = (S)(x) + (x)(x) + (float)(x);
+  float v388 = (S)(x) + (x)(x) + (float)(x);
+  float v389 = (S)(x) + (x)(x) + (float)(x);
+  float v390 = (S)(x) + (x)(x) + (float)(x);
+  float v391 = (S)(x) + (x)(x) + (float)(x);
+  float v392 = (S)(x) + (x)(x) + (float)(x);
+  float v393 = (S)(x) + (x)(x) + (float)(x);
+  float v394 = (S)(x) + (x)(x) + (float)(x);
+  float v395 = (S)(x) + (x)(x) + (float)(x);
+  float v396 = (S)(x) + (x)(x) + (float)(x);
+  float v397 = (S)(x) + (x)(x) + (float)(x);
+  float v398 = (S)(x) + (x)(x) + (float)(x);
+  float v399 = (S)(x) + (x)(x) + (float)(x);
+  float v400 = (S)(x) + (x)(x) + (float)(x);
+  float v401 = (S)(x) + (x)(x) + (float)(x);
+  float v402 = (S)(x) + (x)(x) + (float)(x);
+  float v403 = (S)(x) + (x)(x) + (float)(x);
+  float v404 = (S)(x) + (x)(x) + (float)(x);
+  float v405 = (S)(x) + (x)(x) + (float)(x);
+  float v406 = (S)(x) + (x)(x) + (float)(x);
+  float v407 = (S)(x) + (x)(x) + (float)(x);
+  float v408 = (S)(x) + (x)(x) + (float)(x);
+  float v409 = (S)(x) + (x)(x) + (float)(x);
+  float v410 = (S)(x) + (x)(x) + (float)(x);
+  float v411 = (S)(x) + (x)(x) + (float)(x);
+  float v412 = (S)(x) + (x)(x) + (float)(x);
+  float v413 = (S)(x) + (x)(x) + (float)(x);
+  float v414 = (S)(x) + (x)(x) + (float)(x);
+  float v415 = (S)(x) + (x)(x) + (float)(x);
+  float v416 = (S)(x) + (x)(x) + (float)(x);
+  float v417 = (S)(x) + (x)(x) + (float)(x);
+  float v418 = (S)(x) + (x)(x) + (float)(x);
+  float v419 = (S)(x) + (x)(x) + (float)(x);
+  float v420 = (S)(x) + (x)(x) + (float)(x);
+  float v421 = (S)(x) + (x)(x) + (float)(x);
+  float v422 = (S)(x) + (x)(x) + (float)(x);
+  float v423 = (S)(x) + (x)(x) + (float)(x);
+  float v424 = (S)(x) + (x)(x) + (float)(x);
+  float v425 = (S)(x) + (x)(x) + (float)(x);
+  float v426 = (S)(x) + (x)(x) + (float)(x);
+  float v427 = (S)(x) + (x)(x) + (float)(x);
+  float v428 = (S)(x) + (x)(x) + (float)(x);
+  float v429 = (S)(x) + (x)(x) + (float)(x);
+  float v430 = (S)(x) + (x)(x) + (float)(x);
+  float v431 = (S)(x) + (x)(x) + (float)(x);
+  float v432 = (S)(x) + (x)(x) + (float)(x);
+  float v433 = (S)(x) + (x)(x) + (float)(x);
+  float v434 = (S)(x) + (x)(x) + (float)(x);
+  float v435 = (S)(x) + (x)(x) + (float)(x);
+  float v436 = (S)(x) + (x)(x) + (float)(x);
+  float v437 = (S)(x) + (x)(x) + (float)(x);
+  float v438 = (S)(x) + (x)(x) + (float)(x);
+  float v439 = (S)(x) + (x)(x) + (float)(x);
+  float v440 = (S)(x) + (x)(x) + (float)(x);
+  float v441 = (S)(x) + (x)(x) + (float)(x);
+  float v442 = (S)(x) + (x)(x) + (float)(x);
+  float v443 = (S)(x) + (x)(x) + (float)(x);
+  float v444 = (S)(x) + (x)(x) + (float)(x);
+  float v445 = (S)(x) + (x)(x) + (float)(x);
+  float v446 = (S)(x) + (x)(x) + (float)(x);
+  float v447 = (S)(x) + (x)(x) + (float)(x);
+  float v448 = (S)(x) + (x)(x) + (float)(x);
+  float v449 = (S)(x) + (x)(x) + (float)(x);
+  float v450 = (S)(x) + (x)(x) + (float)(x);
+  float v451 = (S)(x) + (x)(x) + (float)(x);
+  float v452 = (S)(x) + (x)(x) + (float)(x);
+  float v453 = (S)(x) + (x)(x) + (float)(x);
+  float v454 = (S)(x) + (x)(x) + (float)(x);
+  float v455 = (S)(x) + (x)(x) + (float)(x);
+  float v456 = (S)(x) + (x)(x) + (float)(x);
+  float v457 = (S)(x) + (x)(x) + (float)(x);
+  float v458 = (S)(x) + (x)(x) + (float)(x);
+  float v459 = (S)(x) + (x)(x) + (float)(x);
+  float v460 = (S)(x) + (x)(x) + (float)(x);
+  float v461 = (S)(x) + (x)(x) + (float)(x);
+  float v462 = (S)(x) + (x)(x) + (float)(x);
+  float v463 = (S)(x) + (x)(x) + (float)(x);
+  float v464 = (S)(x) + (x)(x) + (float)(x);
+  float v465 = (S)(x) + (x)(x) + (float)(x);
+  float v466 = (S)(x) + (x)(x) + (float)(x);
+  float v467 = (S)(x) + (x)(x) + (float)(x);
+  float v468 = (S)(x) + (x)(x) + (float)(x);
+  float v469 = (S)(x) + (x)(x) + (float)(x);
+  float v470 = (S)(x) + (x)(x) + (float)(x);
+  float v471 = (S)(x) + (x)(x) + (float)(x);
+  float v472 = (S)(x) + (x)(x) + (float)(x);
+  float v473 = (S)(x) + (x)(x) + (float)(x);
+  float v474 = (S)(x) + (x)(x) + (float)(x);
+  float v475 = (S)(x) + (x)(x) + (float)(x);
+  float v476 = (S)(x) + (x)(x) + (float)(x);
+  float v477 = (S)(x) + (x)(x) + (float)(x);
+  float v478 = (S)(x) + (x)(x) + (float)(x);
+  float v479 = (S)(x) + (x)(x) + (float)(x);
+  float v480 = (S)(x) + (x)(x) + (float)(x);
+  float v481 = (S)(x) + (x)(x) + (float)(x);
+  float v482 = (S)(x) + (x)(x) + (float)(x);
+  float v483 = (S)(x) + (x)(x) + (float)(x);
+  float v484 = (S)(x) + (x)(x) + (float)(x);
+  float v485 = (S)(x) + (x)(x) + (float)(x);
+  float v486 = (S)(x) + (x)(x) + (float)(x);
+  float v487 = (S)(x) + (x)(x) + (float)(x);
+  float v488 = (S)(x) + (x)(x) + (float)(x);
+  float v489 = (S)(x) + (x)(x) + (float)(x);
+  float v490 = (S)(x) + (x)(x) + (float)(x);
+  float v491 = (S)(x) + (x)(x) + (float)(x);
+  float v492 = (S)(x) + (x)(x) + (float)(x);
+  float v493 = (S)(x) + (x)(x) + (float)(x);
+  float v494 = (S)(x) + (x)(x) + (float)(x);
+  float v495 = (S)(x) + (x)(x) + (float)(x);
+  float v496 = (S)(x) + (x)(x) + (float)(x);
+  float v497 = (S)(x) + (x)(x) + (float)(x);
+  float v498 = (S)(x) + (x)(x) + (float)(x);
+  float v499 = (S)(x) + (x)(x) + (float)(x);
+  float v500 = (S)(x) + (x)(x) + (float)(x);
+  float v501 = (S)(x) + (x)(x) + (float)(x);
+  float v502 = (S)(x) + (x)(x) + (float)(x);
+  float v503 = (S)(x) + (x)(x) + (float)(x);
+  float v504 = (S)(x) + (x)(x) + (float)(x);
+  float v505 = (S)(x) + (x)(x) + (float)(x);
+  float v506 = (S)(x) + (x)(x) + (float)(x);
+  float v507 = (S)(x) + (x)(x) + (float)(x);
+  float v508 = (S)(x) + (x)(x) + (float)(x);
+  float v509 = (S)(x) + (x)(x) + (float)(x);
+  float v510 = (S)(x) + (x)(x) + (float)(x);
+  float v511 = (S)(x) + (x)(x) + (float)(x);
+  float v512 = (S)(x) + (x)(x) + (float)(x);
+  float v513 = (S)(x) + (x)(x) + (float)(x);
+  float v514 = (S)(x) + (x)(x) + (float)(x);
+  float v515 = (S)(x) + (x)(x) + (float)(x);
+  float v516 = (S)(x) + (x)(x) + (float)(x);
+  float v517 = (S)(x) + (x)(x) + (float)(x);
+  float v518 = (S)(x) + (x)(x) + (float)(x);
+  float v519 = (S)(x) + (x)(x) + (float)(x);
+  float v520 = (S)(x) + (x)(x) + (float)(x);
+  float v521 = (S)(x) + (x)(x) + (float)(x);
+  float v522 = (S)(x) + (x)(x) + (float)(x);
+  float v523 = (S)(x) + (x)(x) + (float)(x);
+  float v524 = (S)(x) + (x)(x) + (float)(x);
+  float v525 = (S)(x) + (x)(x) + (float)(x);
+  float v526 = (S)(x) + (x)(x) + (float)(x);
+  float v527 = (S)(x) + (x)(x) + (float)(x);
+  float v528 = (S)(x) + (x)(x) + (float)(x);
+  float v529 = (S)(x) + (x)(x) + (float)(x);
+  float v530 = (S)(x) + (x)(x) + (float)(x);
+  float v531 = (S)(x) + (x)(x) + (float)(x);
+  float v532 = (S)(x) + (x)(x) + (float)(x);
+  float v533 = (S)(x) + (x)(x) + (float)(x);
+  float v534 = (S)(x) + (x)(x) + (float)(x);
+  float v535 = (S)(x) + (x)(x) + (float)(x);
+  float v536 = (S)(x) + (x)(x) + (float)(x);
+  float v537 = (S)(x) + (x)(x) + (float)(x);
+  float v538 = (S)(x) + (x)(x) + (float)(x);
+  float v539 = (S)(x) + (x)(x) + (float)(x);
+  float v540 = (S)(x) + (x)(x) + (float)(x);
+  float v541 = (S)(x) + (x)(x) + (float)(x);
+  float v542 = (S)(x) + (x)(x) + (float)(x);
+  float v543 = (S)(x) + (x)(x) + (float)(x);
+  float v544 = (S)(x) + (x)(x) + (float)(x);
+  float v545 = (S)(x) + (x)(x) + (float)(x);
+  float v546 = (S)(x) + (x)(x) + (float)(x);
+  float v547 = (S)(x) + (x)(x) + (float)(x);
+  float v548 = (S)(x) + (x)(x) + (float)(x);
+  float v549 = (S)(x) + (x)(x) + (float)(x);
+  float v550 = (S)(x) + (x)(x) + (float)(x);
+  float v551 = (S)(x) + (x)(x) + (float)(x);
+  float v552 = (S)(x) + (x)(x) + (float)(x);
+  float v553 = (S)(x) + (x)(x) + (float)(x);
+  float v554 = (S)(x) + (x)(x) + (float)(x);
+  float v555 = (S)(x) + (x)(x) + (float)(x);
+  float v556 = (S)(x) + (x)(x) + (float)(x);
+  float v557 = (S)(x) + (x)(x) + (float)(x);
+  float v558 = (S)(x) + (x)(x) + (float)(x);
+  float v559 = (S)(x) + (x)(x) + (float)(x);
+  float v560 = (S)(x) + (x)(x) + (float)(x);
+  float v561 = (S)(x) + (x)(x) + (float)(x);
+  float v562 = (S)(x) + (x)(x) + (float)(x);
+  float v563 = (S)(x) + (x)(x) + (float)(x);
+  float v564 = (S)(x) + (x)(x) + (float)(x);
+  float v565 = (S)(x) + (x)(x) + (float)(x);
+  float v566 = (S)(x) + (x)(x) + (float)(x);
+  float v567 = (S)(x) + (x)(x) + (float)(x);
+  float v568 = (S)(x) + (x)(x) + (float)(x);
+  float v569 = (S)(x) + (x)(x) + (float)(x);
+  float v570 = (S)(x) + (x)(x) + (float)(x);
+  float v571 = (S)(x) + (x)(x) + (float)(x);
+  float v572 = (S)(x) + (x)(x) + (float)(x);
+  float v573 = (S)(x) + (x)(x) + (float)(x);
+  float v574 = (S)(x) + (x)(x) + (float)(x);
+  float v575 = (S)(x) + (x)(x) + (float)(x);
+  float v576 = (S)(x) + (x)(x) + (float)(x);
+  float v577 = (S)(x) + (x)(x) + (float)(x);
+  float v578 = (S)(x) + (x)(x) + (float)(x);
+  float v579 = (S)(x) + (x)(x) + (float)(x);
+  float v580 = (S)(x) + (x)(x) + (float)(x);
+  float v581 = (S)(x) + (x)(x) + (float)(x);
+  float v582 = (S)(x) + (x)(x) + (float)(x);
+  float v583 = (S)(x) + (x)(x) + (float)(x);
+  float v584 = (S)(x) + (x)(x) + (float)(x);
+  float v585 = (S)(x) + (x)(x) + (float)(x);
+  float v586 = (S)(x) + (x)(x) + (float)(x);
+  float v587 = (S)(x) + (x)(x) + (float)(x);
+  float v588 = (S)(x) + (x)(x) + (float)(x);
+  float v589 = (S)(x) + (x)(x) + (float)(x);
+  float v590 = (S)(x) + (x)(x) + (float)(x);
+  float v591 = (S)(x) + (x)(x) + (float)(x);
+  float v592 = (S)(x) + (x)(x) + (float)(x);
+  float v593 = (S)(x) + (x)(x) + (float)(x);
+  float v594 = (S)(x) + (x)(x) + (float)(x);
+  float v595 = (S)(x) + (x)(x) + (float)(x);
+  float v596 = (S)(x) + (x)(x) + (float)(x);
+  float v597 = (S)(x) + (x)(x) + (float)(x);
+  float v598 = (S)(x) + (x)(x) + (float)(x);
+  float v599 = (S)(x) + (x)(x) + (float)(x);
+  float v600 = (S)(x) + (x)(x) + (float)(x);
+  float v601 = (S)(x) + (x)(x) + (float)(x);
+  float v602 = (S)(x) + (x)(x) + (float)(x);
+  float v603 = (S)(x) + (x)(x) + (float)(x);
+  float v604 = (S)(x) + (x)(x) + (float)(x);
+  float v605 = (S)(x) + (x)(x) + (float)(x);
+  float v606 = (S)(x) + (x)(x) + (float)(x);
+  float v607 = (S)(x) + (x)(x) + (float)(x);
+  float v608 = (S)(x) + (x)(x) + (float)(x);
+  float v609 = (S)(x) + (x)(x) + (float)(x);
+  float v610 = (S)(x) + (x)(x) + (float)(x);
+  float v611 = (S)(x) + (x)(x) + (float)(x);
+  float v612 = (S)(x) + (x)(x) + (float)(x);
+  float v613 = (S)(x) + (x)(x) + (float)(x);
+  float v614 = (S)(x) + (x)(x) + (float)(x);
+  float v615 = (S)(x) + (x)(x) + (float)(x);
+  float v616 = (S)(x) + (x)(x) + (float)(x);
+  float v617 = (S)(x) + (x)(x) + (float)(x);
+  float v618 = (S)(x) + (x)(x) + (float)(x);
+  float v619 = (S)(x) + (x)(x) + (float)(x);
+  float v620 = (S)(x) + (x)(x) + (float)(x);
+  float v621 = (S)(x) + (x)(x) + (float)(x);
+  float v622 = (S)(x) + (x)(x) + (float)(x);
+  float v623 = (S)(x) + (x)(x) + (float)(x);
+  float v624 = (S)(x) + (x)(x) + (float)(x);
+  float v625 = (S)(x) + (x)(x) + (float)(x);
+  float v626 = (S)(x) + (x)(x) + (float)(x);
+  float v627 = (S)(x) + (x)(x) + (float)(x);
+  float v628 = (S)(x) + (x)(x) + (float)(x);
+  float v629 = (S)(x) + (x)(x) + (float)(x);
+  float v630 = (S)(x) + (x)(x) + (float)(x);
+  float v631 = (S)(x) + (x)(x) + (float)(x);
+  float v632 = (S)(x) + (x)(x) + (float)(x);
+  float v633 = (S)(x) + (x)(x) + (float)(x);
+  float v634 = (S)(x) + (x)(x) + (float)(x);
+  float v635 = (S)(x) + (x)(x) + (float)(x);
+  float v636 = (S)(x) + (x)(x) + (float)(x);
+  float v637 = (S)(x) + (x)(x) + (float)(x);
+  float v638 = (S)(x) + (x)(x) + (float)(x);
+  float v639 = (S)(x) + (x)(x) + (float)(x);
+  float v640 = (S)(x) + (x)(x) + (float)(x);
+  float v641 = (S)(x) + (x)(x) + (float)(x);
+  float v642 = (S)(x) + (x)(x) + (float)(x);
+  float v643 = (S)(x) + (x)(x) + (float)(x);
+  float v644 = (S)(x) + (x)(x) + (float)(x);
+  float v645 = (S)(x) + (x)(x) + (float)(x);
+  float v646 = (S)(x) + (x)(x) + (float)(x);
+  float v647 = (S)(x) + (x)(x) + (float)(x);
+  float v648 = (S)(x) + (x)(x) + (float)(x);
+  float v649 = (S)(x) + (x)(x) + (float)(x);
+  float v650 = (S)(x) + (x)(x) + (float)(x);
+  float v651 = (S)(x) + (x)(x) + (float)(x);
+  float v652 = (S)(x) + (x)(x) + (float)(x);
+  float v653 = (S)(x) + (x)(x) + (float)(x);
+  float v654 = (S)(x) + (x)(x) + (float)(x);
+  float v655 = (S)(x) + (x)(x) + (float)(x);
+  float v656 = (S)(x) + (x)(x) + (float)(x);
+  float v657 = (S)(x) + (x)(x) + (float)(x);
+  float v658 = (S)(x) + (x)(x) + (float)(x);
+  float v659 = (S)(x) + (x)(x) + (float)(x);
+  float v660 = (S)(x) + (x)(x) + (float)(x);
+  float v661 = (S)(x) + (x)(x) + (float)(x);
+  float v662 = (S)(x) + (x)(x) + (float)(x);
+  float v663 = (S)(x) + (x)(x) + (float)(x);
+  float v664 = (S)(x) + (x)(x) + (float)(x);
+  float v665 = (S)(x) + (x)(x) + (float)(x);
+  float v666 = (S)(x) + (x)(x) + (float)(x);
+  float v667 = (S)(x) + (x)(x) + (float)(x);
+  float v668 = (S)(x) + (x)(x) + (float)(x);
+  float v669 = (S)(x) + (x)(x) + (float)(x);
+  float v670 = (S)(x) + (x)(x) + (float)(x);
+  float v671 = (S)(x) + (x)(x) + (float)(x);
+  float v672 = (S)(x) + (x)(x) + (float)(x);
+  float v673 = (S)(x) + (x)(x) + (float)(x);
+  float v674 = (S)(x) + (x)(x) + (float)(x);
+  float v675 = (S)(x) + (x)(x) + (float)(x);
+  float v676 = (S)(x) + (x)(x) + (float)(x);
+  float v677 = (S)(x) + (x)(x) + (float)(x);
+  float v678 = (S)(x) + (x)(x) + (float)(x);
+  float v679 = (S)(x) + (x)(x) + (float)(x);
+  float v680 = (S)(x) + (x)(x) + (float)(x);
+  float v681 = (S)(x) + (x)(x) + (float)(x);
+  float v682 = (S)(x) + (x)(x) + (float)(x);
+  float v683 = (S)(x) + (x)(x) + (float)(x);
+  float v684 = (S)(x) + (x)(x) + (float)(x);
+  float v685 = (S)(x) + (x)(x) + (float)(x);
+  float v686 = (S)(x) + (x)(x) + (float)(x);
+  float v687 = (S)(x) + (x)(x) + (float)(x);
+  float v688 = (S)(x) + (x)(x) + (float)(x);
+  float v689 = (S)(x) + (x)(x) + (float)(x);
+  float v690 = (S)(x) + (x)(x) + (float)(x);
+  float v691 = (S)(x) + (x)(x) + (float)(x);
+  float v692 = (S)(x) + (x)(x) + (float)(x);
+  float v693 = (S)(x) + (x)(x) + (float)(x);
+  float v694 = (S)(x) + (x)(x) + (float)(x);
+  float v695 = (S)(x) + (x)(x) + (float)(x);
+  float v696 = (S)(x) + (x)(x) + (float)(x);
+  float v697 = (S)(x) + (x)(x) + (float)(x);
+  float v698 = (S)(x) + (x)(x) + (float)(x);
+  float v699 = (S)(x) + (x)(x) + (float)(x);
+  float v700 = (S)(x) + (x)(x) + (float)(x);
+  float v701 = (S)(x) + (x)(x) + (float)(x);
+  float v702 = (S)(x) + (x)(x) + (float)(x);
+  float v703 = (S)(x) + (x)(x) + (float)(x);
+  float v704 = (S)(x) + (x)(x) + (float)(x);
+  float v705 = (S)(x) + (x)(x) + (float)(x);
+  float v706 = (S)(x) + (x)(x) + (float)(x);
+  float v707 = (S)(x) + (x)(x) + (float)(x);
+  float v708 = (S)(x) + (x)(x) + (float)(x);
+  float v709 = (S)(x) + (x)(x) + (float)(x);
+  float v710 = (S)(x) + (x)(x) + (float)(x);
+  float v711 = (S)(x) + (x)(x) + (float)(x);
+  float v712 = (S)(x) + (x)(x) + (float)(x);
+  float v713 = (S)(x) + (x)(x) + (float)(x);
+  float v714 = (S)(x) + (x)(x) + (float)(x);
+  float v715 = (S)(x) + (x)(x) + (float)(x);
+  float v716 = (S)(x) + (x)(x) + (float)(x);
+  float v717 = (S)(x) + (x)(x) + (float)(x);
+  float v718 = (S)(x) + (x)(x) + (float)(x);
+  float v719 = (S)(x) + (x)(x) + (float)(x);
+  float v720 = (S)(x) + (x)(x) + (float)(x);
+  float v721 = (S)(x) + (x)(x) + (float)(x);
+  float v722 = (S)(x) + (x)(x) + (float)(x);
+  float v723 = (S)(x) + (x)(x) + (float)(x);
+  float v724 = (S)(x) + (x)(x) + (float)(x);
+  float v725 = (S)(x) + (x)(x) + (float)(x);
+  float v726 = (S)(x) + (x)(x) + (float)(x);
+  float v727 = (S)(x) + (x)(x) + (float)(x);
+  float v728 = (S)(x) + (x)(x) + (float)(x);
+  float v729 = (S)(x) + (x)(x) + (float)(x);
+  float v730 = (S)(x) + (x)(x) + (float)(x);
+  float v731 = (S)(x) + (x)(x) + (float)(x);
+  float v732 = (S)(x) + (x)(x) + (float)(x);
+  float v733 = (S)(x) + (x)(x) + (float)(x);
+  float v734 = (S)(x) + (x)(x) + (float)(x);
+  float v735 = (S)(x) + (x)(x) + (float)(x);
+  float v736 = (S)(x) + (x)(x) + (float)(x);
+  float v737 = (S)(x) + (x)(x) + (float)(x);
+  float v738 = (S)(x) + (x)(x) + (float)(x);
+  float v739 = (S)(x) + (x)(x) + (float)(x);
+  float v740 = (S)(x) + (x)(x) + (float)(x);
+  float v741 = (S)(x) + (x)(x) + (float)(x);
+  float v742 = (S)(x) + (x)(x) + (float)(x);
+  float v743 = (S)(x) + (x)(x) + (float)(x);
+  float v744 = (S)(x) + (x)(x) + (float)(x);
+  float v745 = (S)(x) + (x)(x) + (float)(x);
+  float v746 = (S)(x) + (x)(x) + (float)(x);
+  float v747 = (S)(x) + (x)(x) + (float)(x);
+  float v748 = (S)(x) + (x)(x) + (float)(x);
+  float v749 = (S)(x) + (x)(x) + (float)(x);
+  float v750 = (S)(x) + (x)(x) + (float)(x);
+  float v751 = (S)(x) + (x)(x) + (float)(x);
+  float v752 = (S)(x) + (x)(x) + (float)(x);
+  float v753 = (S)(x) + (x)(x) + (float)(x);
+  float v754 = (S)(x) + (x)(x) + (float)(x);
+  float v755 = (S)(x) + (x)(x) + (float)(x);
+  float v756 = (S)(x) + (x)(x) + (float)(x);
+  float v757 = (S)(x) + (x)(x) + (float)(x);
+  float v758 = (S)(x) + (x)(x) + (float)(x);
+  float v759 = (S)(x) + (x)(x) + (float)(x);
+  float v760 = (S)(x) + (x)(x) + (float)(x);
+  float v761 = (S)(x) + (x)(x) + (float)(x);
+  float v762 = (S)(x) + (x)(x) + (float)(x);
+  float v763 = (S)(x) + (x)(x) + (float)(x);
+  float v764 = (S)(x) + (x)(x) + (float)(x);
+  float v765 = (S)(x) + (x)(x) + (float)(x);
+  float v766 = (S)(x) + (x)(x) + (float)(x);
+  float v767 = (S)(x) + (x)(x) + (float)(x);
+  float v768 = (S)(x) + (x)(x) + (float)(x);
+  float v769 = (S)(x) + (x)(x) + (float)(x);
+  float v770 = (S)(x) + (x)(x) + (float)(x);
+  float v771 = (S)(x) + (x)(x) + (float)(x);
+  float v772 = (S)(x) + (x)(x) + (float)(x);
+  float v773 = (S)(x) + (x)(x) + (float)(x);
+  float v774 = (S)(x) + (x)(x) + (float)(x);
+  float v775 = (S)(x) + (x)(x) + (float)(x);
+  float v776 = (S)(x) + (x)(x) + (float)(x);
+  float v777 = (S)(x) + (x)(x) + (float)(x);
+  float v778 = (S)(x) + (x)(x) + (float)(x);
+  float v779 = (S)(x) + (x)(x) + (float)(x);
+  float v780 = (S)(x) + (x)(x) + (float)(x);
+  float v781 = (S)(x) + (x)(x) + (float)(x);
+  float v782 = (S)(x) + (x)(x) + (float)(x);
+  float v783 = (S)(x) + (x)(x) + (float)(x);
+  float v784 = (S)(x) + (x)(x) + (float)(x);
+  float v785 = (S)(x) + (x)(x) + (float)(x);
+  float v786 = (S)(x) + (x)(x) + (float)(x);
+  float v787 = (S)(x) + (x)(x) + (float)(x);
+  float v788 = (S)(x) + (x)(x) + (float)(x);
+  float v789 = (S)(x) + (x)(x) + (float)(x);
+  float v790 = (S)(x) + (x)(x) + (float)(x);
+  float v791 = (S)(x) + (x)(x) + (float)(x);
+  float v792 = (S)(x) + (x)(x) + (float)(x);
+  float v793 = (S)(x) + (x)(x) + (float)(x);
+  float v794 = (S)(x) + (x)(x) + (float)(x);
+  float v795 = (S)(x) + (x)(x) + (float)(x);
+  float v796 = (S)(x) + (x)(x) + (float)(x);
+  float v797 = (S)(x) + (x)(x) + (float)(x);
+  float v798 = (S)(x) + (x)(x) + (float)(x);
+  float v799 = (S)(x) + (x)(x) + (float)(x);
+  float v800 = (S)(x) + (x)(x) + (float)(x);
+  float v801 = (S)(x) + (x)(x) + (float)(x);
+  float v802 = (S)(x) + (x)(x) + (float)(x);
+  float v803 = (S)(x) + (x)(x) + (float)(x);
+  float v804 = (S)(x) + (x)(x) + (float)(x);
+  float v805 = (S)(x) + (x)(x) + (float)(x);
+  float v806 = (S)(x) + (x)(x) + (float)(x);
+  float v807 = (S)(x) + (x)(x) + (float)(x);
+  float v808 = (S)(x) + (x)(x) + (float)(x);
+  float v809 = (S)(x) + (x)(x) + (float)(x);
+  float v810 = (S)(x) + (x)(x) + (float)(x);
+  float v811 = (S)(x) + (x)(x) + (float)(x);
+  float v812 = (S)(x) + (x)(x) + (float)(x);
+  float v813 = (S)(x) + (x)(x) + (float)(x);
+  float v814 = (S)(x) + (x)(x) + (float)(x);
+  float v815 = (S)(x) + (x)(x) + (float)(x);
+  float v816 = (S)(x) + (x)(x) + (float)(x);
+  float v817 = (S)(x) + (x)(x) + (float)(x);
+  float v818 = (S)(x) + (x)(x) + (float)(x);
+  float v819 = (S)(x) + (x)(x) + (float)(x);
+  float v820 = (S)(x) + (x)(x) + (float)(x);
+  float v821 = (S)(x) + (x)(x) + (float)(x);
+  float v822 = (S)(x) + (x)(x) + (float)(x);
+  float v823 = (S)(x) + (x)(x) + (float)(x);
+  float v824 = (S)(x) + (x)(x) + (float)(x);
+  float v825 = (S)(x) + (x)(x) + (float)(x);
+  float v826 = (S)(x) + (x)(x) + (float)(x);
+  float v827 = (S)(x) + (x)(x) + (float)(x);
+  float v828 = (S)(x) + (x)(x) + (float)(x);
+  float v829 = (S)(x) + (x)(x) + (float)(x);
+  float v830 = (S)(x) + (x)(x) + (float)(x);
+  float v831 = (S)(x) + (x)(x) + (float)(x);
+  float v832 = (S)(x) + (x)(x) + (float)(x);
+  float v833 = (S)(x) + (x)(x) + (float)(x);
+  float v834 = (S)(x) + (x)(x) + (float)(x);
+  float v835 = (S)(x) + (x)(x) + (float)(x);
+  float v836 = (S)(x) + (x)(x) + (float)(x);
+  float v837 = (S)(x) + (x)(x) + (float)(x);
+  float v838 = (S)(x) + (x)(x) + (float)(x);
+  float v839 = (S)(x) + (x)(x) + (float)(x);
+  float v840 = (S)(x) + (x)(x) + (float)(x);
+  float v841 = (S)(x) + (x)(x) + (float)(x);
+  float v842 = (S)(x) + (x)(x) + (float)(x);
+  float v843 = (S)(x) + (x)(x) + (float)(x);
+  float v844 = (S)(x) + (x)(x) + (float)(x);
+  float v845 = (S)(x) + (x)(x) + (float)(x);
+  float v846 = (S)(x) + (x)(x) + (float)(x);
+  float v847 = (S)(x) + (x)(x) + (float)(x);
+  float v848 = (S)(x) + (x)(x) + (float)(x);
+  float v849 = (S)(x) + (x)(x) + (float)(x);
+  float v850 = (S)(x) + (x)(x) + (float)(x);
+  float v851 = (S)(x) + (x)(x) + (float)(x);
+  float v852 = (S)(x) + (x)(x) + (float)(x);
+  float v853 = (S)(x) + (x)(x) + (float)(x);
+  float v854 = (S)(x) + (x)(x) + (float)(x);
+  float v855 = (S)(x) + (x)(x) + (float)(x);
+  float v856 = (S)(x) + (x)(x) + (float)(x);
+  float v857 = (S)(x) + (x)(x) + (float)(x);
+  float v858 = (S)(x) + (x)(x) + (float)(x);
+  float v859 = (S)(x) + (x)(x) + (float)(x);
+  float v860 = (S)(x) + (x)(x) + (float)(x);
+  float v861 = (S)(x) + (x)(x) + (float)(x);
+  float v862 = (S)(x) + (x)(x) + (float)(x);
+  float v863 = (S)(x) + (x)(x) + (float)(x);
+  float v864 = (S)(x) + (x)(x) + (float)(x);
+  float v865 = (S)(x) + (x)(x) + (float)(x);
+  float v866 = (S)(x) + (x)(x) + (float)(x);
+  float v867 = (S)(x) + (x)(x) + (float)(x);
+  float v868 = (S)(x) + (x)(x) + (float)(x);
+  float v869 = (S)(x) + (x)(x) + (float)(x);
+  float v870 = (S)(x) + (x)(x) + (float)(x);
+  float v871 = (S)(x) + (x)(x) + (float)(x);
+  float v872 = (S)(x) + (x)(x) + (float)(x);
+  float v873 = (S)(x) + (x)(x) + (float)(x);
+  float v874 = (S)(x) + (x)(x) + (float)(x);
+  float v875 = (S)(x) + (x)(x) + (float)(x);
+  float v876 = (S)(x) + (x)(x) + (float)(x);
+  float v877 = (S)(x) + (x)(x) + (float)(x);
+  float v878 = (S)(x) + (x)(x) + (float)(x);
+  float v879 = (S)(x) + (x)(x) + (float)(x);
+  float v880 = (S)(x) + (x)(x) + (float)(x);
+  float v881 = (S)(x) + (x)(x) + (float)(x);
+  float v882 = (S)(x) + (x)(x) + (float)(x);
+  float v883 = (S)(x) + (x)(x) + (float)(x);
+  float v884 = (S)(x) + (x)(x) + (float)(x);
+  float v885 = (S)(x) + (x)(x) + (float)(x);
+  float v886 = (S)(x) + (x)(x) + (float)(x);
+  float v887 = (S)(x) + (x)(x) + (float)(x);
+  float v888 = (S)(x) + (x)(x) + (float)(x);
+  float v889 = (S)(x) + (x)(x) + (float)(x);
+  float v890 = (S)(x) + (x)(x) + (float)(x);
+  float v891 = (S)(x) + (x)(x) + (float)(x);
+  float v892 = (S)(x) + (x)(x) + (float)(x);
+  float v893 = (S)(x) + (x)(x) + (float)(x);
+  float v894 = (S)(x) + (x)(x) + (float)(x);
+  float v895 = (S)(x) + (x)(x) + (float)(x);
+  float v896 = (S)(x) + (x)(x) + (float)(x);
+  float v897 = (S)(x) + (x)(x) + (float)(x);
+  float v898 = (S)(x) + (x)(x) + (float)(x);
+  float v899 = (S)(x) + (x)(x) + (float)(x);
+  float v900 = (S)(x) + (x)(x) + (float)(x);
+  float v901 = (S)(x) + (x)(x) + (float)(x);
+  float v902 = (S)(x) + (x)(x) + (float)(x);
+  float v903 = (S)(x) + (x)(x) + (float)(x);
+  float v904 = (S)(x) + (x)(x) + (float)(x);
+  float v905 = (S)(x) + (x)(x) + (float)(x);
+  float v906 = (S)(x) + (x)(x) + (float)(x);
+  float v907 = (S)(x) + (x)(x) + (float)(x);
+  float v908 = (S)(x) + (x)(x) + (float)(x);
+  float v909 = (S)(x) + (x)(x) + (float)(x);
+  float v910 = (S)(x) + (x)(x) + (float)(x);
+  float v911 = (S)(x) + (x)(x) + (float)(x);
+  float v912 = (S)(x) + (x)(x) + (float)(x);
+  float v913 = (S)(x) + (x)(x) + (float)(x);
+  float v914 = (S)(x) + (x)(x) + (float)(x);
+  float v915 = (S)(x) + (x)(x) + (float)(x);
+  float v916 = (S)(x) + (x)(x) + (float)(x);
+  float v917 = (S)(x) + (x)(x) + (float)(x);
+  float v918 = (S)(x) + (x)(x) + (float)(x);
+  float v919 = (S)(x) + (x)(x) + (float)(x);
+  float v920 = (S)(x) + (x)(x) + (float)(x);
+  float v921 = (S)(x) + (x)(x) + (float)(x);
+  float v922 = (S)(x) + (x)(x) + (float)(x);
+  float v923 = (S)(x) + (x)(x) + (float)(x);
+  float v924 = (S)(x) + (x)(x) + (float)(x);
+  float v925 = (S)(x) + (x)(x) + (float)(x);
+  float v926 = (S)(x) + (x)(x) + (float)(x);
+  float v927 = (S)(x) + (x)(x) + (float)(x);
+  float v928 = (S)(x) + (x)(x) + (float)(x);
+  float v929 = (S)(x) + (x)(x) + (float)(x);
+  float v930 = (S)(x) + (x)(x) + (float)(x);
+  float v931 = (S)(x) + (x)(x) + (float)(x);
+  float v932 = (S)(x) + (x)(x) + (float)(x);
+  float v933 = (S)(x) + (x)(x) + (float)(x);
+  float v934 = (S)(x) + (x)(x) + (float)(x);
+  float v935 = (S)(x) + (x)(x) + (float)(x);
+  float v936 = (S)(x) + (x)(x) + (float)(x);
+  float v937 = (S)(x) + (x)(x) + (float)(x);
+  float v938 = (S)(x) + (x)(x) + (float)(x);
+  float v939 = (S)(x) + (x)(x) + (float)(x);
+  float v940 = (S)(x) + (x)(x) + (float)(x);
+  float v941 = (S)(x) + (x)(x) + (float)(x);
+  float v942 = (S)(x) + (x)(x) + (float)(x);
+  float v943 = (S)(x) + (x)(x) + (float)(x);
+  float v944 = (S)(x) + (x)(x) + (float)(x);
+  float v945 = (S)(x) + (x)(x) + (float)(x);
+  float v946 = (S)(x) + (x)(x) + (float)(x);
+  float v947 = (S)(x) + (x)(x) + (float)(x);
+  float v948 = (S)(x) + (x)(x) + (float)(x);
+  float v949 = (S)(x) + (x)(x) + (float)(x);
+  float v950 = (S)(x) + (x)(x) + (float)(x);
+  float v951 = (S)(x) + (x)(x) + (float)(x);
+  float v952 = (S)(x) + (x)(x) + (float)(x);
+  float v953 = (S)(x) + (x)(x) + (float)(x);
+  float v954 = (S)(x) + (x)(x) + (float)(x);
+  float v955 = (S)(x) + (x)(x) + (float)(x);
+  float v956 = (S)(x) + (x)(x) + (float)(x);
+  float v957 = (S)(x) + (x)(x) + (float)(x);
+  float v958 = (S)(x) + (x)(x) + (float)(x);
+  float v959 = (S)(x) + (x)(x) + (float)(x);
+  float v960 = (S)(x) + (x)(x) + (float)(x);
+  float v961 = (S)(x) + (x)(x) + (float)(x);
+  float v962 = (S)(x) + (x)(x) + (float)(x);
+  float v963 = (S)(x) + (x)(x) + (float)(x);
+  float v964 = (S)(x) + (x)(x) + (float)(x);
+  float v965 = (S)(x) + (x)(x) + (float)(x);
+  float v966 = (S)(x) + (x)(x) + (float)(x);
+  float v967 = (S)(x) + (x)(x) + (float)(x);
+  float v968 = (S)(x) + (x)(x) + (float)(x);
+  float v969 = (S)(x) + (x)(x) + (float)(x);
+  float v970 = (S)(x) + (x)(x) + (float)(x);
+  float v971 = (S)(x) + (x)(x) + (float)(x);
+  float v972 = (S)(x) + (x)(x) + (float)(x);
+  float v973 = (S)(x) + (x)(x) + (float)(x);
+  float v974 = (S)(x) + (x)(x) + (float)(x);
+  float v975 = (S)(x) + (x)(x) + (float)(x);
+  float v976 = (S)(x) + (x)(x) + (float)(x);
+  float v977 = (S)(x) + (x)(x) + (float)(x);
+  float v978 = (S)(x) + (x)(x) + (float)(x);
+  float v979 = (S)(x) + (x)(x) + (float)(x);
+  float v980 = (S)(x) + (x)(x) + (float)(x);
+  float v981 = (S)(x) + (x)(x) + (float)(x);
+  float v982 = (S)(x) + (x)(x) + (float)(x);
+  float v983 = (S)(x) + (x)(x) + (float)(x);
+  float v984 = (S)(x) + (x)(x) + (float)(x);
+  float v985 = (S)(x) + (x)(x) + (float)(x);
+  float v986 = (S)(x) + (x)(x) + (float)(x);
+  float v987 = (S)(x) + (x)(x) + (float)(x);
+  float v988 = (S)(x) + (x)(x) + (float)(x);
+  float v989 = (S)(x) + (x)(x) + (float)(x);
+  float v990 = (S)(x) + (x)(x) + (float)(x);
+  float v991 = (S)(x) + (x)(x) + (float)(x);
+  float v992 = (S)(x) + (x)(x) + (float)(x);
+  float v993 = (S)(x) + (x)(x) + (float)(x);
+  float v994 = (S)(x) + (x)(x) + (float)(x);
+  float v995 = (S)(x) + (x)(x) + (float)(x);
+  float v996 = (S)(x) + (x)(x) + (float)(x);
+  float v997 = (S)(x) + (x)(x) + (float)(x);
+  float v998 = (S)(x) + (x)(x) + (float)(x);
+  float v999 = (S)(x) + (x)(x) + (float)(x);
+  return x;
+}
@@ -0,0 +1,2006 @@
+cbuffer Params : register(b0) {
+  float4 field0;
+  float4 field1;
+  float4 field2;
+  float4 field3;
+  float4 field4;
+  float4 field5;
+  float4 field6;
+  float4 field7;
+  float4 field8;
+  float4 field9;
+  float4 field10;
+  float4 field11;
+  float4 field12;
+  float4 field13;
+  float4 field14;
+  float4 field15;
+  float4 field16;
+  float4 field17;
+  float4 field18;
+  float4 field19;
+  float4 field20;
+  float4 field21;
+  float4 field22;
+  float4 field23;
+  float4 field24;
+  float4 field25;
+  float4 field26;
+  float4 field27;
+  float4 field28;
+  float4 field29;
+  float4 field30;
+  float4 field31;
+  float4 field32;
+  float4 field33;
+  float4 field34;
+  float4 field35;
+  float4 field36;
+  float4 field37;
+  float4 field38;
+  float4 field39;
+  float4 field40;
+  float4 field41;
+  float4 field42;
+  float4 field43;
+  float4 field44;
+  float4 field45;
+  float4 field46;
+  float4 field47;
+  float4 field48;
+  float4 field49;
+  float4 field50;
+  float4 field51;
+  float4 field52;
+  float4 field53;
+  float4 field54;
+  float4 field55;
+  float4 field56;
+  float4 field57;
+  float4 field58;
+  float4 field59;
+  float4 field60;
+  float4 field61;
+  float4 field62;
+  float4 field63;
+  float4 field64;
+  float4 field65;
+  float4 field66;
+  float4 field67;
+  float4 field68;
+  float4 field69;
+  float4 field70;
+  float4 field71;
+  float4 field72;
+  float4 field73;
+  float4 field74;
+  float4 field75;
+  float4 field76;
+  float4 field77;
+  float4 field78;
+  float4 field79;
+  float4 field80;
+  float4 field81;
+  float4 field82;
+  float4 field83;
+  float4 field84;
+  float4 field85;
+  float4 field86;
+  float4 field87;
+  float4 field88;
+  float4 field89;
+  float4 field90;
+  float4 field91;
+  float4 field92;
+  float4 field93;
+  float4 field94;
+  float4 field95;
+  float4 field96;
+  float4 field97;
+  float4 field98;
+  float4 field99;
+  float4 field100;
+  float4 field101;
+  float4 field102;
+  float4 field103;
+  float4 field104;
+  float4 field105;
+  float4 field106;
+  float4 field107;
+  float4 field108;
+  float4 field109;
+  float4 field110;
+  float4 field111;
+  float4 field112;
+  float4 field113;
+  float4 field114;
+  float4 field115;
+  float4 field116;
+  float4 field117;
+  float4 field118;
+  float4 field119;
+  float4 field120;
+  float4 field121;
+  float4 field122;
+  float4 field123;
+  float4 field124;
+  float4 field125;
+  float4 field126;
+  float4 field127;
+  float4 field128;
+  float4 field129;
+  float4 field130;
+  float4 field131;
+  float4 field132;
+  float4 field133;
+  float4 field134;
+  float4 field135;
+  float4 field136;
+  float4 field137;
+  float4 field138;
+  float4 field139;
+  float4 field140;
+  float4 field141;
+  float4 field142;
+  float4 field143;
+  float4 field144;
+  float4 field145;
+  float4 field146;
+  float4 field147;
+  float4 field148;
+  float4 field149;
+  float4 field150;
+  float4 field151;
+  float4 field152;
+  float4 field153;
+  float4 field154;
+  float4 field155;
+  float4 field156;
+  float4 field157;
+  float4 field158;
+  float4 field159;
+  float4 field160;
+  float4 field161;
+  float4 field162;
+  float4 field163;
+  float4 field164;
+  float4 field165;
+  float4 field166;
+  float4 field167;
+  float4 field168;
+  float4 field169;
+  float4 field170;
+  float4 field171;
+  float4 field172;
+  float4 field173;
+  float4 field174;
+  float4 field175;
+  float4 field176;
+  float4 field177;
+  float4 field178;
+  float4 field179;
+  float4 field180;
+  float4 field181;
+  float4 field182;
+  float4 field183;
+  float4 field184;
+  float4 field185;
+  float4 field186;
+  float4 field187;
+  float4 field188;
+  float4 field189;
+  float4 field190;
+  float4 field191;
+  float4 field192;
+  float4 field193;
+  float4 field194;
+  float4 field195;
+  float4 field196;
+  float4 field197;
+  float4 field198;
+  float4 field199;
+  float4 field200;
+  float4 field201;
+  float4 field202;
+  float4 field203;
+  float4 field204;
+  float4 field205;
+  float4 field206;
+  float4 field207;
+  float4 field208;
+  float4 field209;
+  float4 field210;
+  float4 field211;
+  float4 field212;
+  float4 field213;
+  float4 field214;
+  float4 field215;
+  float4 field216;
+  float4 field217;
+  float4 field218;
+  float4 field219;
+  float4 field220;
+  float4 field221;
+  float4 field222;
+  float4 field223;
+  float4 field224;
+  float4 field225;
+  float4 field226;
+  float4 field227;
+  float4 field228;
+  float4 field229;
+  float4 field230;
+  float4 field231;
+  float4 field232;
+  float4 field233;
+  float4 field234;
+  float4 field235;
+  float4 field236;
+  float4 field237;
+  float4 field238;
+  float4 field239;
+  float4 field240;
+  float4 field241;
+  float4 field242;
+  float4 field243;
+  float4 field244;
+  float4 field245;
+  float4 field246;
+  float4 field247;
+  float4 field248;
+  float4 field249;
+  float4 field250;
+  float4 field251;
+  float4 field252;
+  float4 field253;
+  float4 field254;
+  float4 field255;
+  float4 field256;
+  float4 field257;
+  float4 field258;
+  float4 field259;
+  float4 field260;
+  float4 field261;
+  float4 field262;
+  float4 field263;
+  float4 field264;
+  float4 field265;
+  float4 field266;
+  float4 field267;
+  float4 field268;
+  float4 field269;
+  float4 field270;
+  float4 field271;
+  float4 field272;
+  float4 field273;
+  float4 field274;
+  float4 field275;
+  float4 field276;
+  float4 field277;
+  float4 field278;
+  float4 field279;
+  float4 field280;
+  float4 field281;
+  float4 field282;
+  float4 field283;
+  float4 field284;
+  float4 field285;
+  float4 field286;
+  float4 field287;
+  float4 field288;
+  float4 field289;
+  float4 field290;
+  float4 field291;
+  float4 field292;
+  float4 field293;
+  float4 field294;
+  float4 field295;
+  float4 field296;
+  float4 field297;
+  float4 field298;
+  float4 field299;
+  float4 field300;
+  float4 field301;
+  float4 field302;
+  float4 field303;
+  float4 field304;
+  float4 field305;
+  float4 field306;
+  float4 field307;
+  float4 field308;
+  float4 field309;
+  float4 field310;
+  float4 field311;
+  float4 field312;
+  float4 field313;
+  float4 field314;
+  float4 field315;
+  float4 field316;
+  float4 field317;
+  float4 field318;
+  float4 field319;
+  float4 field320;
+  float4 field321;
+  float4 field322;
+  float4 field323;
+  float4 field324;
+  float4 field325;
+  float4 field326;
+  float4 field327;
+  float4 field328;
+  float4 field329;
+  float4 field330;
+  float4 field331;
+  float4 field332;
+  float4 field333;
+  float4 field334;
+  float4 field335;
+  float4 field336;
+  float4 field337;
+  float4 field338;
+  float4 field339;
+  float4 field340;
+  float4 field341;
+  float4 field342;
+  float4 field343;
+  float4 field344;
+  float4 field345;
+  float4 field346;
+  float4 field347;
+  float4 field348;
+  float4 field349;
+  float4 field350;
+  float4 field351;
+  float4 field352;
+  float4 field353;
+  float4 field354;
+  float4 field355;
+  float4 field356;
+  float4 field357;
+  float4 field358;
+  float4 field359;
+  float4 field360;
+  float4 field361;
+  float4 field362;
+  float4 field363;
+  float4 field364;
+  float4 field365;
+  float4 field366;
+  float4 field367;
+  float4 field368;
+  float4 field369;
+  float4 field370;
+  float4 field371;
+  float4 field372;
+  float4 field373;
+  float4 field374;
+  float4 field375;
+  float4 field376;
+  float4 field377;
+  float4 field378;
+  float4 field379;
+  float4 field380;
+  float4 field381;
+  float4 field382;
+  float4 field383;
+  float4 field384;
+  float4 field385;
+  float4 field386;
+  float4 field387;
+  float4 field388;
+  float4 field389;
+  float4 field390;
+  float4 field391;
+  float4 field392;
+  float4 field393;
+  float4 field394;
+  float4 field395;
+  float4 field396;
+  float4 field397;
+  float4 field398;
+  float4 field399;
+  float4 field400;
+  float4 field401;
+  float4 field402;
+  float4 field403;
+  float4 field404;
+  float4 field405;
+  float4 field406;
+  float4 field407;
+  float4 field408;
+  float4 field409;
+  float4 field410;
+  float4 field411;
+  float4 field412;
+  float4 field413;
+  float4 field414;
+  float4 field415;
+  float4 field416;
+  float4 field417;
+  float4 field418;
+  float4 field419;
+  float4 field420;
+  float4 field421;
+  float4 field422;
+  float4 field423;
+  float4 field424;
+  float4 field425;
+  float4 field426;
+  float4 field427;
+  float4 field428;
+  float4 field429;
+  float4 field430;
+  float4 field431;
+  float4 field432;
+  float4 field433;
+  float4 field434;
+  float4 field435;
+  float4 field436;
+  float4 field437;
+  float4 field438;
+  float4 field439;
+  float4 field440;
+  float4 field441;
+  float4 field442;
+  float4 field443;
+  float4 field444;
+  float4 field445;
+  float4 field446;
+  float4 field447;
+  float4 field448;
+  float4 field449;
+  float4 field450;
+  float4 field451;
+  float4 field452;
+  float4 field453;
+  float4 field454;
+  float4 field455;
+  float4 field456;
+  float4 field457;
+  float4 field458;
+  float4 field459;
+  float4 field460;
+  float4 field461;
+  float4 field462;
+  float4 field463;
+  float4 field464;
+  float4 field465;
+  float4 field466;
+  float4 field467;
+  float4 field468;
+  float4 field469;
+  float4 field470;
+  float4 field471;
+  float4 field472;
+  float4 field473;
+  float4 field474;
+  float4 field475;
+  float4 field476;
+  float4 field477;
+  float4 field478;
+  float4 field479;
+  float4 field480;
+  float4 field481;
+  float4 field482;
+  float4 field483;
+  float4 field484;
+  float4 field485;
+  float4 field486;
+  float4 field487;
+  float4 field488;
+  float4 field489;
+  float4 field490;
+  float4 field491;
+  float4 field492;
+  float4 field493;
+  float4 field494;
+  float4 field495;
+  float4 field496;
+  float4 field497;
+  float4 field498;
+  float4 field499;
+  float4 field500;
+  float4 field501;
+  float4 field502;
+  float4 field503;
+  float4 field504;
+  float4 field505;
+  float4 field506;
+  float4 field507;
+  float4 field508;
+  float4 field509;
+  float4 field510;
+  float4 field511;
+  float4 field512;
+  float4 field513;
+  float4 field514;
+  float4 field515;
+  float4 field516;
+  float4 field517;
+  float4 field518;
+  float4 field519;
+  float4 field520;
+  float4 field521;
+  float4 field522;
+  float4 field523;
+  float4 field524;
+  float4 field525;
+  float4 field526;
+  float4 field527;
+  float4 field528;
+  float4 field529;
+  float4 field530;
+  float4 field531;
+  float4 field532;
+  float4 field533;
+  float4 field534;
+  float4 field535;
+  float4 field536;
+  float4 field537;
+  float4 field538;
+  float4 field539;
+  float4 field540;
+  float4 field541;
+  float4 field542;
+  float4 field543;
+  float4 field544;
+  float4 field545;
+  float4 field546;
+  float4 field547;
+  float4 field548;
+  float4 field549;
+  float4 field550;
+  float4 field551;
+  float4 field552;
+  float4 field553;
+  float4 field554;
+  float4 field555;
+  float4 field556;
+  float4 field557;
+  float4 field558;
+  float4 field559;
+  float4 field560;
+  float4 field561;
+  float4 field562;
+  float4 field563;
+  float4 field564;
+  float4 field565;
+  float4 field566;
+  float4 field567;
+  float4 field568;
+  float4 field569;
+  float4 field570;
+  float4 field571;
+  float4 field572;
+  float4 field573;
+  float4 field574;
+  float4 field575;
+  float4 field576;
+  float4 field577;
+  float4 field578;
+  float4 field579;
+  float4 field580;
+  float4 field581;
+  float4 field582;
+  float4 field583;
+  float4 field584;
+  float4 field585;
+  float4 field586;
+  float4 field587;
+  float4 field588;
+  float4 field589;
+  float4 field590;
+  float4 field591;
+  float4 field592;
+  float4 field593;
+  float4 field594;
+  float4 field595;
+  float4 field596;
+  float4 field597;
+  float4 field598;
+  float4 field599;
+  float4 field600;
+  float4 field601;
+  float4 field602;
+  float4 field603;
+  float4 field604;
+  float4 field605;
+  float4 field606;
+  float4 field607;
+  float4 field608;
+  float4 field609;
+  float4 field610;
+  float4 field611;
+  float4 field612;
+  float4 field613;
+  float4 field614;
+  float4 field615;
+  float4 field616;
+  float4 field617;
+  float4 field618;
+  float4 field619;
+  float4 field620;
+  float4 field621;
+  float4 field622;
+  float4 field623;
+  float4 field624;
+  float4 field625;
+  float4 field626;
+  float4 field627;
+  float4 field628;
+  float4 field629;
+  float4 field630;
+  float4 field631;
+  float4 field632;
+  float4 field633;
+  float4 field634;
+  float4 field635;
+  float4 field636;
+  float4 field637;
+  float4 field638;
+  float4 field639;
+  float4 field640;
+  float4 field641;
+  float4 field642;
+  float4 field643;
+  float4 field644;
+  float4 field645;
+  float4 field646;
+  float4 field647;
+  float4 field648;
+  float4 field649;
+  float4 field650;
+  float4 field651;
+  float4 field652;
+  float4 field653;
+  float4 field654;
+  float4 field655;
+  float4 field656;
+  float4 field657;
+  float4 field658;
+  float4 field659;
+  float4 field660;
+  float4 field661;
+  float4 field662;
+  float4 field663;
+  float4 field664;
+  float4 field665;
+  float4 field666;
+  float4 field667;
+  float4 field668;
+  float4 field669;
+  float4 field670;
+  float4 field671;
+  float4 field672;
+  float4 field673;
+  float4 field674;
+  float4 field675;
+  float4 field676;
+  float4 field677;
+  float4 field678;
+  float4 field679;
+  float4 field680;
+  float4 field681;
+  float4 field682;
+  float4 field683;
+  float4 field684;
+  float4 field685;
+  float4 field686;
+  float4 field687;
+  float4 field688;
+  float4 field689;
+  float4 field690;
+  float4 field691;
+  float4 field692;
+  float4 field693;
+  float4 field694;
+  float4 field695;
+  float4 field696;
+  float4 field697;
+  float4 field698;
+  float4 field699;
+  float4 field700;
+  float4 field701;
+  float4 field702;
+  float4 field703;
+  float4 field704;
+  float4 field705;
+  float4 field706;
+  float4 field707;
+  float4 field708;
+  float4 field709;
+  float4 field710;
+  float4 field711;
+  float4 field712;
+  float4 field713;
+  float4 field714;
+  float4 field715;
+  float4 field716;
+  float4 field717;
+  float4 field718;
+  float4 field719;
+  float4 field720;
+  float4 field721;
+  float4 field722;
+  float4 field723;
+  float4 field724;
+  float4 field725;
+  float4 field726;
+  float4 field727;
+  float4 field728;
+  float4 field729;
+  float4 field730;
+  float4 field731;
+  float4 field732;
+  float4 field733;
+  float4 field734;
+  float4 field735;
+  float4 field736;
+  float4 field737;
+  float4 field738;
+  float4 field739;
+  float4 field740;
+  float4 field741;
+  float4 field742;
+  float4 field743;
+  float4 field744;
+  float4 field745;
+  float4 field746;
+  float4 field747;
+  float4 field748;
+  float4 field749;
+  float4 field750;
+  float4 field751;
+  float4 field752;
+  float4 field753;
+  float4 field754;
+  float4 field755;
+  float4 field756;
+  float4 field757;
+  float4 field758;
+  float4 field759;
+  float4 field760;
+  float4 field761;
+  float4 field762;
+  float4 field763;
+  float4 field764;
+  float4 field765;
+  float4 field766;
+  float4 field767;
+  float4 field768;
+  float4 field769;
+  float4 field770;
+  float4 field771;
+  float4 field772;
+  float4 field773;
+  float4 field774;
+  float4 field775;
+  float4 field776;
+  float4 field777;
+  float4 field778;
+  float4 field779;
+  float4 field780;
+  float4 field781;
+  float4 field782;
+  float4 field783;
+  float4 field784;
+  float4 field785;
+  float4 field786;
+  float4 field787;
+  float4 field788;
+  float4 field789;
+  float4 field790;
+  float4 field791;
+  float4 field792;
+  float4 field793;
+  float4 field794;
+  float4 field795;
+  float4 field796;
+  float4 field797;
+  float4 field798;
+  float4 field799;
+  float4 field800;
+  float4 field801;
+  float4 field802;
+  float4 field803;
+  float4 field804;
+  float4 field805;
+  float4 field806;
+  float4 field807;
+  float4 field808;
+  float4 field809;
+  float4 field810;
+  float4 field811;
+  float4 field812;
+  float4 field813;
+  float4 field814;
+  float4 field815;
+  float4 field816;
+  float4 field817;
+  float4 field818;
+  float4 field819;
+  float4 field820;
+  float4 field821;
+  float4 field822;
+  float4 field823;
+  float4 field824;
+  float4 field825;
+  float4 field826;
+  float4 field827;
+  float4 field828;
+  float4 field829;
+  float4 field830;
+  float4 field831;
+  float4 field832;
+  float4 field833;
+  float4 field834;
+  float4 field835;
+  float4 field836;
+  float4 field837;
+  float4 field838;
+  float4 field839;
+  float4 field840;
+  float4 field841;
+  float4 field842;
+  float4 field843;
+  float4 field844;
+  float4 field845;
+  float4 field846;
+  float4 field847;
+  float4 field848;
+  float4 field849;
+  float4 field850;
+  float4 field851;
+  float4 field852;
+  float4 field853;
+  float4 field854;
+  float4 field855;
+  float4 field856;
+  float4 field857;
+  float4 field858;
+  float4 field859;
+  float4 field860;
+  float4 field861;
+  float4 field862;
+  float4 field863;
+  float4 field864;
+  float4 field865;
+  float4 field866;
+  float4 field867;
+  float4 field868;
+  float4 field869;
+  float4 field870;
+  float4 field871;
+  float4 field872;
+  float4 field873;
+  float4 field874;
+  float4 field875;
+  float4 field876;
+  float4 field877;
+  float4 field878;
+  float4 field879;
+  float4 field880;
+  float4 field881;
+  float4 field882;
+  float4 field883;
+  float4 field884;
+  float4 field885;
+  float4 field886;
+  float4 field887;
+  float4 field888;
+  float4 field889;
+  float4 field890;
+  float4 field891;
+  float4 field892;
+  float4 field893;
+  float4 field894;
+  float4 field895;
+  float4 field896;
+  float4 field897;
+  float4 field898;
+  float4 field899;
+  float4 field900;
+  float4 field901;
+  float4 field902;
+  float4 field903;
+  float4 field904;
+  float4 field905;
+  float4 field906;
+  float4 field907;
+  float4 field908;
+  float4 field909;
+  float4 field910;
+  float4 field911;
+  float4 field912;
+  float4 field913;
+  float4 field914;
+  float4 field915;
+  float4 field916;
+  float4 field917;
+  float4 field918;
+  float4 field919;
+  float4 field920;
+  float4 field921;
+  float4 field922;
+  float4 field923;
+  float4 field924;
+  float4 field925;
+  float4 field926;
+  float4 field927;
+  float4 field928;
+  float4 field929;
+  float4 field930;
+  float4 field931;
+  float4 field932;
+  float4 field933;
+  float4 field934;
+  float4 field935;
+  float4 field936;
+  float4 field937;
+  float4 field938;
+  float4 field939;
+  float4 field940;
+  float4 field941;
+  float4 field942;
+  float4 field943;
+  float4 field944;
+  float4 field945;
+  float4 field946;
+  float4 field947;
+  float4 field948;
+  float4 field949;
+  float4 field950;
+  float4 field951;
+  float4 field952;
+  float4 field953;
+  float4 field954;
+  float4 field955;
+  float4 field956;
+  float4 field957;
+  float4 field958;
+  float4 field959;
+  float4 field960;
+  float4 field961;
+  float4 field962;
+  float4 field963;
+  float4 field964;
+  float4 field965;
+  float4 field966;
+  float4 field967;
+  float4 field968;
+  float4 field969;
+  float4 field970;
+  float4 field971;
+  float4 field972;
+  float4 field973;
+  float4 field974;
+  float4 field975;
+  float4 field976;
+  float4 field977;
+  float4 field978;
+  float4 field979;
+  float4 field980;
+  float4 field981;
+  float4 field982;
+  float4 field983;
+  float4 field984;
+  float4 field985;
+  float4 field986;
+  float4 field987;
+  float4 field988;
+  float4 field989;
+  float4 field990;
+  float4 field991;
+  float4 field992;
+  float4 field993;
+  float4 field994;
+  float4 field995;
+  float4 field996;
+  float4 field997;
+  float4 field998;
+  float4 field999;
+  float4 field1000;
+  float4 field1001;
+  float4 field1002;
+  float4 field1003;
+  float4 field1004;
+  float4 field1005;
+  float4 field1006;
+  float4 field1007;
+  float4 field1008;
+  float4 field1009;
+  float4 field1010;
+  float4 field1011;
+  float4 field1012;
+  float4 field1013;
+  float4 field1014;
+  float4 field1015;
+  float4 field1016;
+  float4 field1017;
+  float4 field1018;
+  float4 field1019;
+  float4 field1020;
+  float4 field1021;
+  float4 field1022;
+  float4 field1023;
+  float4 field1024;
+  float4 field1025;
+  float4 field1026;
+  float4 field1027;
+  float4 field1028;
+  float4 field1029;
+  float4 field1030;
+  float4 field1031;
+  float4 field1032;
+  float4 field1033;
+  float4 field1034;
+  float4 field1035;
+  float4 field1036;
+  float4 field1037;
+  float4 field1038;
+  float4 field1039;
+  float4 field1040;
+  float4 field1041;
+  float4 field1042;
+  float4 field1043;
+  float4 field1044;
+  float4 field1045;
+  float4 field1046;
+  float4 field1047;
+  float4 field1048;
+  float4 field1049;
+  float4 field1050;
+  float4 field1051;
+  float4 field1052;
+  float4 field1053;
+  float4 field1054;
+  float4 field1055;
+  float4 field1056;
+  float4 field1057;
+  float4 field1058;
+  float4 field1059;
+  float4 field1060;
+  float4 field1061;
+  float4 field1062;
+  float4 field1063;
+  float4 field1064;
+  float4 field1065;
+  float4 field1066;
+  float4 field1067;
+  float4 field1068;
+  float4 field1069;
+  float4 field1070;
+  float4 field1071;
+  float4 field1072;
+  float4 field1073;
+  float4 field1074;
+  float4 field1075;
+  float4 field1076;
+  float4 field1077;
+  float4 field1078;
+  float4 field1079;
+  float4 field1080;
+  float4 field1081;
+  float4 field1082;
+  float4 field1083;
+  float4 field1084;
+  float4 field1085;
+  float4 field1086;
+  float4 field1087;
+  float4 field1088;
+  float4 field1089;
+  float4 field1090;
+  float4 field1091;
+  float4 field1092;
+  float4 field1093;
+  float4 field1094;
+  float4 field1095;
+  float4 field1096;
+  float4 field1097;
+  float4 field1098;
+  float4 field1099;
+  float4 field1100;
+  float4 field1101;
+  float4 field1102;
+  float4 field1103;
+  float4 field1104;
+  float4 field1105;
+  float4 field1106;
+  float4 field1107;
+  float4 field1108;
+  float4 field1109;
+  float4 field1110;
+  float4 field1111;
+  float4 field1112;
+  float4 field1113;
+  float4 field1114;
+  float4 field1115;
+  float4 field1116;
+  float4 field1117;
+  float4 field1118;
+  float4 field1119;
+  float4 field1120;
+  float4 field1121;
+  float4 field1122;
+  float4 field1123;
+  float4 field1124;
+  float4 field1125;
+  float4 field1126;
+  float4 field1127;
+  float4 field1128;
+  float4 field1129;
+  float4 field1130;
+  float4 field1131;
+  float4 field1132;
+  float4 field1133;
+  float4 field1134;
+  float4 field1135;
+  float4 field1136;
+  float4 field1137;
+  float4 field1138;
+  float4 field1139;
+  float4 field1140;
+  float4 field1141;
+  float4 field1142;
+  float4 field1143;
+  float4 field1144;
+  float4 field1145;
+  float4 field1146;
+  float4 field1147;
+  float4 field1148;
+  float4 field1149;
+  float4 field1150;
+  float4 field1151;
+  float4 field1152;
+  float4 field1153;
+  float4 field1154;
+  float4 field1155;
+  float4 field1156;
+  float4 field1157;
+  float4 field1158;
+  float4 field1159;
+  float4 field1160;
+  float4 field1161;
+  float4 field1162;
+  float4 field1163;
+  float4 field1164;
+  float4 field1165;
+  float4 field1166;
+  float4 field1167;
+  float4 field1168;
+  float4 field1169;
+  float4 field1170;
+  float4 field1171;
+  float4 field1172;
+  float4 field1173;
+  float4 field1174;
+  float4 field1175;
+  float4 field1176;
+  float4 field1177;
+  float4 field1178;
+  float4 field1179;
+  float4 field1180;
+  float4 field1181;
+  float4 field1182;
+  float4 field1183;
+  float4 field1184;
+  float4 field1185;
+  float4 field1186;
+  float4 field1187;
+  float4 field1188;
+  float4 field1189;
+  float4 field1190;
+  float4 field1191;
+  float4 field1192;
+  float4 field1193;
+  float4 field1194;
+  float4 field1195;
+  float4 field1196;
+  float4 field1197;
+  float4 field1198;
+  float4 field1199;
+  float4 field1200;
+  float4 field1201;
+  float4 field1202;
+  float4 field1203;
+  float4 field1204;
+  float4 field1205;
+  float4 field1206;
+  float4 field1207;
+  float4 field1208;
+  float4 field1209;
+  float4 field1210;
+  float4 field1211;
+  float4 field1212;
+  float4 field1213;
+  float4 field1214;
+  float4 field1215;
+  float4 field1216;
+  float4 field1217;
+  float4 field1218;
+  float4 field1219;
+  float4 field1220;
+  float4 field1221;
+  float4 field1222;
+  float4 field1223;
+  float4 field1224;
+  float4 field1225;
+  float4 field1226;
+  float4 field1227;
+  float4 field1228;
+  float4 field1229;
+  float4 field1230;
+  float4 field1231;
+  float4 field1232;
+  float4 field1233;
+  float4 field1234;
+  float4 field1235;
+  float4 field1236;
+  float4 field1237;
+  float4 field1238;
+  float4 field1239;
+  float4 field1240;
+  float4 field1241;
+  float4 field1242;
+  float4 field1243;
+  float4 field1244;
+  float4 field1245;
+  float4 field1246;
+  float4 field1247;
+  float4 field1248;
+  float4 field1249;
+  float4 field1250;
+  float4 field1251;
+  float4 field1252;
+  float4 field1253;
+  float4 field1254;
+  float4 field1255;
+  float4 field1256;
+  float4 field1257;
+  float4 field1258;
+  float4 field1259;
+  float4 field1260;
+  float4 field1261;
+  float4 field1262;
+  float4 field1263;
+  float4 field1264;
+  float4 field1265;
+  float4 field1266;
+  float4 field1267;
+  float4 field1268;
+  float4 field1269;
+  float4 field1270;
+  float4 field1271;
+  float4 field1272;
+  float4 field1273;
+  float4 field1274;
+  float4 field1275;
+  float4 field1276;
+  float4 field1277;
+  float4 field1278;
+  float4 field1279;
+  float4 field1280;
+  float4 field1281;
+  float4 field1282;
+  float4 field1283;
+  float4 field1284;
+  float4 field1285;
+  float4 field1286;
+  float4 field1287;
+  float4 field1288;
+  float4 field1289;
+  float4 field1290;
+  float4 field1291;
+  float4 field1292;
+  float4 field1293;
+  float4 field1294;
+  float4 field1295;
+  float4 field1296;
+  float4 field1297;
+  float4 field1298;
+  float4 field1299;
+  float4 field1300;
+  float4 field1301;
+  float4 field1302;
+  float4 field1303;
+  float4 field1304;
+  float4 field1305;
+  float4 field1306;
+  float4 field1307;
+  float4 field1308;
+  float4 field1309;
+  float4 field1310;
+  float4 field1311;
+  float4 field1312;
+  float4 field1313;
+  float4 field1314;
+  float4 field1315;
+  float4 field1316;
+  float4 field1317;
+  float4 field1318;
+  float4 field1319;
+  float4 field1320;
+  float4 field1321;
+  float4 field1322;
+  float4 field1323;
+  float4 field1324;
+  float4 field1325;
+  float4 field1326;
+  float4 field1327;
+  float4 field1328;
+  float4 field1329;
+  float4 field1330;
+  float4 field1331;
+  float4 field1332;
+  float4 field1333;
+  float4 field1334;
+  float4 field1335;
+  float4 field1336;
+  float4 field1337;
+  float4 field1338;
+  float4 field1339;
+  float4 field1340;
+  float4 field1341;
+  float4 field1342;
+  float4 field1343;
+  float4 field1344;
+  float4 field1345;
+  float4 field1346;
+  float4 field1347;
+  float4 field1348;
+  float4 field1349;
+  float4 field1350;
+  float4 field1351;
+  float4 field1352;
+  float4 field1353;
+  float4 field1354;
+  float4 field1355;
+  float4 field1356;
+  float4 field1357;
+  float4 field1358;
+  float4 field1359;
+  float4 field1360;
+  float4 field1361;
+  float4 field1362;
+  float4 field1363;
+  float4 field1364;
+  float4 field1365;
+  float4 field1366;
+  float4 field1367;
+  float4 field1368;
+  float4 field1369;
+  float4 field1370;
+  float4 field1371;
+  float4 field1372;
+  float4 field1373;
+  float4 field1374;
+  float4 field1375;
+  float4 field1376;
+  float4 field1377;
+  float4 field1378;
+  float4 field1379;
+  float4 field1380;
+  float4 field1381;
+  float4 field1382;
+  float4 field1383;
+  float4 field1384;
+  float4 field1385;
+  float4 field1386;
+  float4 field1387;
+  float4 field1388;
+  float4 field1389;
+  float4 field1390;
+  float4 field1391;
+  float4 field1392;
+  float4 field1393;
+  float4 field1394;
+  float4 field1395;
+  float4 field1396;
+  float4 field1397;
+  float4 field1398;
+  float4 field1399;
+  float4 field1400;
+  float4 field1401;
+  float4 field1402;
+  float4 field1403;
+  float4 field1404;
+  float4 field1405;
+  float4 field1406;
+  float4 field1407;
+  float4 field1408;
+  float4 field1409;
+  float4 field1410;
+  float4 field1411;
+  float4 field1412;
+  float4 field1413;
+  float4 field1414;
+  float4 field1415;
+  float4 field1416;
+  float4 field1417;
+  float4 field1418;
+  float4 field1419;
+  float4 field1420;
+  float4 field1421;
+  float4 field1422;
+  float4 field1423;
+  float4 field1424;
+  float4 field1425;
+  float4 field1426;
+  float4 field1427;
+  float4 field1428;
+  float4 field1429;
+  float4 field1430;
+  float4 field1431;
+  float4 field1432;
+  float4 field1433;
+  float4 field1434;
+  float4 field1435;
+  float4 field1436;
+  float4 field1437;
+  float4 field1438;
+  float4 field1439;
+  float4 field1440;
+  float4 field1441;
+  float4 field1442;
+  float4 field1443;
+  float4 field1444;
+  float4 field1445;
+  float4 field1446;
+  float4 field1447;
+  float4 field1448;
+  float4 field1449;
+  float4 field1450;
+  float4 field1451;
+  float4 field1452;
+  float4 field1453;
+  float4 field1454;
+  float4 field1455;
+  float4 field1456;
+  float4 field1457;
+  float4 field1458;
+  float4 field1459;
+  float4 field1460;
+  float4 field1461;
+  float4 field1462;
+  float4 field1463;
+  float4 field1464;
+  float4 field1465;
+  float4 field1466;
+  float4 field1467;
+  float4 field1468;
+  float4 field1469;
+  float4 field1470;
+  float4 field1471;
+  float4 field1472;
+  float4 field1473;
+  float4 field1474;
+  float4 field1475;
+  float4 field1476;
+  float4 field1477;
+  float4 field1478;
+  float4 field1479;
+  float4 field1480;
+  float4 field1481;
+  float4 field1482;
+  float4 field1483;
+  float4 field1484;
+  float4 field1485;
+  float4 field1486;
+  float4 field1487;
+  float4 field1488;
+  float4 field1489;
+  float4 field1490;
+  float4 field1491;
+  float4 field1492;
+  float4 field1493;
+  float4 field1494;
+  float4 field1495;
+  float4 field1496;
+  float4 field1497;
+  float4 field1498;
+  float4 field1499;
+  float4 field1500;
+  float4 field1501;
+  float4 field1502;
+  float4 field1503;
+  float4 field1504;
+  float4 field1505;
+  float4 field1506;
+  float4 field1507;
+  float4 field1508;
+  float4 field1509;
+  float4 field1510;
+  float4 field1511;
+  float4 field1512;
+  float4 field1513;
+  float4 field1514;
+  float4 field1515;
+  float4 field1516;
+  float4 field1517;
+  float4 field1518;
+  float4 field1519;
+  float4 field1520;
+  float4 field1521;
+  float4 field1522;
+  float4 field1523;
+  float4 field1524;
+  float4 field1525;
+  float4 field1526;
+  float4 field1527;
+  float4 field1528;
+  float4 field1529;
+  float4 field1530;
+  float4 field1531;
+  float4 field1532;
+  float4 field1533;
+  float4 field1534;
+  float4 field1535;
+  float4 field1536;
+  float4 field1537;
+  float4 field1538;
+  float4 field1539;
+  float4 field1540;
+  float4 field1541;
+  float4 field1542;
+  float4 field1543;
+  float4 field1544;
+  float4 field1545;
+  float4 field1546;
+  float4 field1547;
+  float4 field1548;
+  float4 field1549;
+  float4 field1550;
+  float4 field1551;
+  float4 field1552;
+  float4 field1553;
+  float4 field1554;
+  float4 field1555;
+  float4 field1556;
+  float4 field1557;
+  float4 field1558;
+  float4 field1559;
+  float4 field1560;
+  float4 field1561;
+  float4 field1562;
+  float4 field1563;
+  float4 field1564;
+  float4 field1565;
+  float4 field1566;
+  float4 field1567;
+  float4 field1568;
+  float4 field1569;
+  float4 field1570;
+  float4 field1571;
+  float4 field1572;
+  float4 field1573;
+  float4 field1574;
+  float4 field1575;
+  float4 field1576;
+  float4 field1577;
+  float4 field1578;
+  float4 field1579;
+  float4 field1580;
+  float4 field1581;
+  float4 field1582;
+  float4 field1583;
+  float4 field1584;
+  float4 field1585;
+  float4 field1586;
+  float4 field1587;
+  float4 field1588;
+  float4 field1589;
+  float4 field1590;
+  float4 field1591;
+  float4 field1592;
+  float4 field1593;
+  float4 field1594;
+  float4 field1595;
+  float4 field1596;
+  float4 field1597;
+  float4 field1598;
+  float4 field1599;
+  float4 field1600;
+  float4 field1601;
+  float4 field1602;
+  float4 field1603;
+  float4 field1604;
+  float4 field1605;
+  float4 field1606;
+  float4 field1607;
+  float4 field1608;
+  float4 field1609;
+  float4 field1610;
+  float4 field1611;
+  float4 field1612;
+  float4 field1613;
+  float4 field1614;
+  float4 field1615;
+  float4 field1616;
+  float4 field1617;
+  float4 field1618;
+  float4 field1619;
+  float4 field1620;
+  float4 field1621;
+  float4 field1622;
+  float4 field1623;
+  float4 field1624;
+  float4 field1625;
+  float4 field1626;
+  float4 field1627;
+  float4 field1628;
+  float4 field1629;
+  float4 field1630;
+  float4 field1631;
+  float4 field1632;
+  float4 field1633;
+  float4 field1634;
+  float4 field1635;
+  float4 field1636;
+  float4 field1637;
+  float4 field1638;
+  float4 field1639;
+  float4 field1640;
+  float4 field1641;
+  float4 field1642;
+  float4 field1643;
+  float4 field1644;
+  float4 field1645;
+  float4 field1646;
+  float4 field1647;
+  float4 field1648;
+  float4 field1649;
+  float4 field1650;
+  float4 field1651;
+  float4 field1652;
+  float4 field1653;
+  float4 field1654;
+  float4 field1655;
+  float4 field1656;
+  float4 field1657;
+  float4 field1658;
+  float4 field1659;
+  float4 field1660;
+  float4 field1661;
+  float4 field1662;
+  float4 field1663;
+  float4 field1664;
+  float4 field1665;
+  float4 field1666;
+  float4 field1667;
+  float4 field1668;
+  float4 field1669;
+  float4 field1670;
+  float4 field1671;
+  float4 field1672;
+  float4 field1673;
+  float4 field1674;
+  float4 field1675;
+  float4 field1676;
+  float4 field1677;
+  float4 field1678;
+  float4 field1679;
+  float4 field1680;
+  float4 field1681;
+  float4 field1682;
+  float4 field1683;
+  float4 field1684;
+  float4 field1685;
+  float4 field1686;
+  float4 field1687;
+  float4 field1688;
+  float4 field1689;
+  float4 field1690;
+  float4 field1691;
+  float4 field1692;
+  float4 field1693;
+  float4 field1694;
+  float4 field1695;
+  float4 field1696;
+  float4 field1697;
+  float4 field1698;
+  float4 field1699;
+  float4 field1700;
+  float4 field1701;
+  float4 field1702;
+  float4 field1703;
+  float4 field1704;
+  float4 field1705;
+  float4 field1706;
+  float4 field1707;
+  float4 field1708;
+  float4 field1709;
+  float4 field1710;
+  float4 field1711;
+  float4 field1712;
+  float4 field1713;
+  float4 field1714;
+  float4 field1715;
+  float4 field1716;
+  float4 field1717;
+  float4 field1718;
+  float4 field1719;
+  float4 field1720;
+  float4 field1721;
+  float4 field1722;
+  float4 field1723;
+  float4 field1724;
+  float4 field1725;
+  float4 field1726;
+  float4 field1727;
+  float4 field1728;
+  float4 field1729;
+  float4 field1730;
+  float4 field1731;
+  float4 field1732;
+  float4 field1733;
+  float4 field1734;
+  float4 field1735;
+  float4 field1736;
+  float4 field1737;
+  float4 field1738;
+  float4 field1739;
+  float4 field1740;
+  float4 field1741;
+  float4 field1742;
+  float4 field1743;
+  float4 field1744;
+  float4 field1745;
+  float4 field1746;
+  float4 field1747;
+  float4 field1748;
+  float4 field1749;
+  float4 field1750;
+  float4 field1751;
+  float4 field1752;
+  float4 field1753;
+  float4 field1754;
+  float4 field1755;
+  float4 field1756;
+  float4 field1757;
+  float4 field1758;
+  float4 field1759;
+  float4 field1760;
+  float4 field1761;
+  float4 field1762;
+  float4 field1763;
+  float4 field1764;
+  float4 field1765;
+  float4 field1766;
+  float4 field1767;
+  float4 field1768;
+  float4 field1769;
+  float4 field1770;
+  float4 field1771;
+  float4 field1772;
+  float4 field1773;
+  float4 field1774;
+  float4 field1775;
+  float4 field1776;
+  float4 field1777;
+  float4 field1778;
+  float4 field1779;
+  float4 field1780;
+  float4 field1781;
+  float4 field1782;
+  float4 field1783;
+  float4 field1784;
+  float4 field1785;
+  float4 field1786;
+  float4 field1787;
+  float4 field1788;
+  float4 field1789;
+  float4 field1790;
+  float4 field1791;
+  float4 field1792;
+  float4 field1793;
+  float4 field1794;
+  float4 field1795;
+  float4 field1796;
+  float4 field1797;
+  float4 field1798;
+  float4 field1799;
+  float4 field1800;
+  float4 field1801;
+  float4 field1802;
+  float4 field1803;
+  float4 field1804;
+  float4 field1805;
+  float4 field1806;
+  float4 field1807;
+  float4 field1808;
+  float4 field1809;
+  float4 field1810;
+  float4 field1811;
+  float4 field1812;
+  float4 field1813;
+  float4 field1814;
+  float4 field1815;
+  float4 field1816;
+  float4 field1817;
+  float4 field1818;
+  float4 field1819;
+  float4 field1820;
+  float4 field1821;
+  float4 field1822;
+  float4 field1823;
+  float4 field1824;
+  float4 field1825;
+  float4 field1826;
+  float4 field1827;
+  float4 field1828;
+  float4 field1829;
+  float4 field1830;
+  float4 field1831;
+  float4 field1832;
+  float4 field1833;
+  float4 field1834;
+  float4 field1835;
+  float4 field1836;
+  float4 field1837;
+  float4 field1838;
+  float4 field1839;
+  float4 field1840;
+  float4 field1841;
+  float4 field1842;
+  float4 field1843;
+  float4 field1844;
+  float4 field1845;
+  float4 field1846;
+  float4 field1847;
+  float4 field1848;
+  float4 field1849;
+  float4 field1850;
+  float4 field1851;
+  float4 field1852;
+  float4 field1853;
+  float4 field1854;
+  float4 field1855;
+  float4 field1856;
+  float4 field1857;
+  float4 field1858;
+  float4 field1859;
+  float4 field1860;
+  float4 field1861;
+  float4 field1862;
+  float4 field1863;
+  float4 field1864;
+  float4 field1865;
+  float4 field1866;
+  float4 field1867;
+  float4 field1868;
+  float4 field1869;
+  float4 field1870;
+  float4 field1871;
+  float4 field1872;
+  float4 field1873;
+  float4 field1874;
+  float4 field1875;
+  float4 field1876;
+  float4 field1877;
+  float4 field1878;
+  float4 field1879;
+  float4 field1880;
+  float4 field1881;
+  float4 field1882;
+  float4 field1883;
+  float4 field1884;
+  float4 field1885;
+  float4 field1886;
+  float4 field1887;
+  float4 field1888;
+  float4 field1889;
+  float4 field1890;
+  float4 field1891;
+  float4 field1892;
+  float4 field1893;
+  float4 field1894;
+  float4 field1895;
+  float4 field1896;
+  float4 field1897;
+  float4 field1898;
+  float4 field1899;
+  float4 field1900;
+  float4 field1901;
+  float4 field1902;
+  float4 field1903;
+  float4 field1904;
+  float4 field1905;
+  float4 field1906;
+  float4 field1907;
+  float4 field1908;
+  float4 field1909;
+  float4 field1910;
+  float4 field1911;
+  float4 field1912;
+  float4 field1913;
+  float4 field1914;
+  float4 field1915;
+  float4 field1916;
+  float4 field1917;
+  float4 field1918;
+  float4 field1919;
+  float4 field1920;
+  float4 field1921;
+  float4 field1922;
+  float4 field1923;
+  float4 field1924;
+  float4 field1925;
+  float4 field1926;
+  float4 field1927;
+  float4 field1928;
+  float4 field1929;
+  float4 field1930;
+  float4 field1931;
+  float4 field1932;
+  float4 field1933;
+  float4 field1934;
+  float4 field1935;
+  float4 field1936;
+  float4 field1937;
+  float4 field1938;
+  float4 field1939;
+  float4 field1940;
+  float4 field1941;
+  float4 field1942;
+  float4 field1943;
+  float4 field1944;
+  float4 field1945;
+  float4 field1946;
+  float4 field1947;
+  float4 field1948;
+  float4 field1949;
+  float4 field1950;
+  float4 field1951;
+  float4 field1952;
+  float4 field1953;
+  float4 field1954;
+  float4 field1955;
+  float4 field1956;
+  float4 field1957;
+  float4 field1958;
+  float4 field1959;
+  float4 field1960;
+  float4 field1961;
+  float4 field1962;
+  float4 field1963;
+  float4 field1964;
+  float4 field1965;
+  float4 field1966;
+  float4 field1967;
+  float4 field1968;
+  float4 field1969;
+  float4 field1970;
+  float4 field1971;
+  float4 field1972;
+  float4 field1973;
+  float4 field1974;
+  float4 field1975;
+  float4 field1976;
+  float4 field1977;
+  float4 field1978;
+  float4 field1979;
+  float4 field1980;
+  float4 field1981;
+  float4 field1982;
+  float4 field1983;
+  float4 field1984;
+  float4 field1985;
+  float4 field1986;
+  float4 field1987;
+  float4 field1988;
+  float4 field1989;
+  float4 field1990;
+  float4 field1991;
+  float4 field1992;
+  float4 field1993;
+  float4 field1994;
+  float4 field1995;
+  float4 field1996;
+  float4 field1997;
+  float4 field1998;
+  float4 field1999;
+};
+
+float4 main() : SV_Target {
+  return field0;
+}
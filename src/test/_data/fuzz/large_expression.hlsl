@@ -0,0 +1,4003 @@
+float main(float x) {
+  return x * 0 + 
+    x * 1 + 
+    x * 2 + 
+    x * 3 + 
+    x * 4 + 
+    x * 5 + 
+    x * 6 + 
+    x * 7 + 
+    x * 8 + 
+    x * 9 + 
+    x * 10 + 
+    x * 11 + 
+    x * 12 + 
+    x * 13 + 
+    x * 14 + 
+    x * 15 + 
+    x * 16 + 
+    x * 17 + 
+    x * 18 + 
+    x * 19 + 
+    x * 20 + 
+    x * 21 + 
+    x * 22 + 
+    x * 23 + 
+    x * 24 + 
+    x * 25 + 
+    x * 26 + 
+    x * 27 + 
+    x * 28 + 
+    x * 29 + 
+    x * 30 + 
+    x * 31 + 
+    x * 32 + 
+    x * 33 + 
+    x * 34 + 
+    x * 35 + 
+    x * 36 + 
+    x * 37 + 
+    x * 38 + 
+    x * 39 + 
+    x * 40 + 
+    x * 41 + 
+    x * 42 + 
+    x * 43 + 
+    x * 44 + 
+    x * 45 + 
+    x * 46 + 
+    x * 47 + 
+    x * 48 + 
+    x * 49 + 
+    x * 50 + 
+    x * 51 + 
+    x * 52 + 
+    x * 53 + 
+    x * 54 + 
+    x * 55 + 
+    x * 56 + 
+    x * 57 + 
+    x * 58 + 
+    x * 59 + 
+    x * 60 + 
+    x * 61 + 
+    x * 62 + 
+    x * 63 + 
+    x * 64 + 
+    x * 65 + 
+    x * 66 + 
+    x * 67 + 
+    x * 68 + 
+    x * 69 + 
+    x * 70 + 
+    x * 71 + 
+    x * 72 + 
+    x * 73 + 
+    x * 74 + 
+    x * 75 + 
+    x * 76 + 
+    x * 77 + 
+    x * 78 + 
+    x * 79 + 
+    x * 80 + 
+    x * 81 + 
+    x * 82 + 
+    x * 83 + 
+    x * 84 + 
+    x * 85 + 
+    x * 86 + 
+    x * 87 + 
+    x * 88 + 
+    x * 89 + 
+    x * 90 + 
+    x * 91 + 
+    x * 92 + 
+    x * 93 + 
+    x * 94 + 
+    x * 95 + 
+    x * 96 + 
+    x * 97 + 
+    x * 98 + 
+    x * 99 + 
+    x * 100 + 
+    x * 101 + 
+    x * 102 + 
+    x * 103 + 
+    x * 104 + 
+    x * 105 + 
+    x * 106 + 
+    x * 107 + 
+    x * 108 + 
+    x * 109 + 
+    x * 110 + 
+    x * 111 + 
+    x * 112 + 
+    x * 113 + 
+    x * 114 + 
+    x * 115 + 
+    x * 116 + 
+    x * 117 + 
+    x * 118 + 
+    x * 119 + 
+    x * 120 + 
+    x * 121 + 
+    x * 122 + 
+    x * 123 + 
+    x * 124 + 
+    x * 125 + 
+    x * 126 + 
+    x * 127 + 
+    x * 128 + 
+    x * 129 + 
+    x * 130 + 
+    x * 131 + 
+    x * 132 + 
+    x * 133 + 
+    x * 134 + 
+    x * 135 + 
+    x * 136 + 
+    x * 137 + 
+    x * 138 + 
+    x * 139 + 
+    x * 140 + 
+    x * 141 + 
+    x * 142 + 
+    x * 143 + 
+    x * 144 + 
+    x * 145 + 
+    x * 146 + 
+    x * 147 + 
+    x * 148 + 
+    x * 149 + 
+    x * 150 + 
+    x * 151 + 
+    x * 152 + 
+    x * 153 + 
+    x * 154 + 
+    x * 155 + 
+    x * 156 + 
+    x * 157 + 
+    x * 158 + 
+    x * 159 + 
+    x * 160 + 
+    x * 161 + 
+    x * 162 + 
+    x * 163 + 
+    x * 164 + 
+    x * 165 + 
+    x * 166 + 
+    x * 167 + 
+    x * 168 + 
+    x * 169 + 
+    x * 170 + 
+    x * 171 + 
+    x * 172 + 
+    x * 173 + 
+    x * 174 + 
+    x * 175 + 
+    x * 176 + 
+    x * 177 + 
+    x * 178 + 
+    x * 179 + 
+    x * 180 + 
+    x * 181 + 
+    x * 182 + 
+    x * 183 + 
+    x * 184 + 
+    x * 185 + 
+    x * 186 + 
+    x * 187 + 
+    x * 188 + 
+    x * 189 + 
+    x * 190 + 
+    x * 191 + 
+    x * 192 + 
+    x * 193 + 
+    x * 194 + 
+    x * 195 + 
+    x * 196 + 
+    x * 197 + 
+    x * 198 + 
+    x * 199 + 
+    x * 200 + 
+    x * 201 + 
+    x * 202 + 
+    x * 203 + 
+    x * 204 + 
+    x * 205 + 
+    x * 206 + 
+    x * 207 + 
+    x * 208 + 
+    x * 209 + 
+    x * 210 + 
+    x * 211 + 
+    x * 212 + 
+    x * 213 + 
+    x * 214 + 
+    x * 215 + 
+    x * 216 + 
+    x * 217 + 
+    x * 218 + 
+    x * 219 + 
+    x * 220 + 
+    x * 221 + 
+    x * 222 + 
+    x * 223 + 
+    x * 224 + 
+    x * 225 + 
+    x * 226 + 
+    x * 227 + 
+    x * 228 + 
+    x * 229 + 
+    x * 230 + 
+    x * 231 + 
+    x * 232 + 
+    x * 233 + 
+    x * 234 + 
+    x * 235 + 
+    x * 236 + 
+    x * 237 + 
+    x * 238 + 
+    x * 239 + 
+    x * 240 + 
+    x * 241 + 
+    x * 242 + 
+    x * 243 + 
+    x * 244 + 
+    x * 245 + 
+    x * 246 + 
+    x * 247 + 
+    x * 248 + 
+    x * 249 + 
+    x * 250 + 
+    x * 251 + 
+    x * 252 + 
+    x * 253 + 
+    x * 254 + 
+    x * 255 + 
+    x * 256 + 
+    x * 257 + 
+    x * 258 + 
+    x * 259 + 
+    x * 260 + 
+    x * 261 + 
+    x * 262 + 
+    x * 263 + 
+    x * 264 + 
+    x * 265 + 
+    x * 266 + 
+    x * 267 + 
+    x * 268 + 
+    x * 269 + 
+    x * 270 + 
+    x * 271 + 
+    x * 272 + 
+    x * 273 + 
+    x * 274 + 
+    x * 275 + 
+    x * 276 + 
+    x * 277 + 
+    x * 278 + 
+    x * 279 + 
+    x * 280 + 
+    x * 281 + 
+    x * 282 + 
+    x * 283 + 
+    x * 284 + 
+    x * 285 + 
+    x * 286 + 
+    x * 287 + 
+    x * 288 + 
+    x * 289 + 
+    x * 290 + 
+    x * 291 + 
+    x * 292 + 
+    x * 293 + 
+    x * 294 + 
+    x * 295 + 
+    x * 296 + 
+    x * 297 + 
+    x * 298 + 
+    x * 299 + 
+    x * 300 + 
+    x * 301 + 
+    x * 302 + 
+    x * 303 + 
+    x * 304 + 
+    x * 305 + 
+    x * 306 + 
+    x * 307 + 
+    x * 308 + 
+    x * 309 + 
+    x * 310 + 
+    x * 311 + 
+    x * 312 + 
+    x * 313 + 
+    x * 314 + 
+    x * 315 + 
+    x * 316 + 
+    x * 317 + 
+    x * 318 + 
+    x * 319 + 
+    x * 320 + 
+    x * 321 + 
+    x * 322 + 
+    x * 323 + 
+    x * 324 + 
+    x * 325 + 
+    x * 326 + 
+    x * 327 + 
+    x * 328 + 
+    x * 329 + 
+    x * 330 + 
+    x * 331 + 
+    x * 332 + 
+    x * 333 + 
+    x * 334 + 
+    x * 335 + 
+    x * 336 + 
+    x * 337 + 
+    x * 338 + 
+    x * 339 + 
+    x * 340 + 
+    x * 341 + 
+    x * 342 + 
+    x * 343 + 
+    x * 344 + 
+    x * 345 + 
+    x * 346 + 
+    x * 347 + 
+    x * 348 + 
+    x * 349 + 
+    x * 350 + 
+    x * 351 + 
+    x * 352 + 
+    x * 353 + 
+    x * 354 + 
+    x * 355 + 
+    x * 356 + 
+    x * 357 + 
+    x * 358 + 
+    x * 359 + 
+    x * 360 + 
+    x * 361 + 
+    x * 362 + 
+    x * 363 + 
+    x * 364 + 
+    x * 365 + 
+    x * 366 + 
+    x * 367 + 
+    x * 368 + 
+    x * 369 + 
+    x * 370 + 
+    x * 371 + 
+    x * 372 + 
+    x * 373 + 
+    x * 374 + 
+    x * 375 + 
+    x * 376 + 
+    x * 377 + 
+    x * 378 + 
+    x * 379 + 
+    x * 380 + 
+    x * 381 + 
+    x * 382 + 
+    x * 383 + 
+    x * 384 + 
+    x * 385 + 
+    x * 386 + 
+    x * 387 + 
+    x * 388 + 
+    x * 389 + 
+    x * 390 + 
+    x * 391 + 
+    x * 392 + 
+    x * 393 + 
+    x * 394 + 
+    x * 395 + 
+    x * 396 + 
+    x * 397 + 
+    x * 398 + 
+    x * 399 + 
+    x * 400 + 
+    x * 401 + 
+    x * 402 + 
+    x * 403 + 
+    x * 404 + 
+    x * 405 + 
+    x * 406 + 
+    x * 407 + 
+    x * 408 + 
+    x * 409 + 
+    x * 410 + 
+    x * 411 + 
+    x * 412 + 
+    x * 413 + 
+    x * 414 + 
+    x * 415 + 
+    x * 416 + 
+    x * 417 + 
+    x * 418 + 
+    x * 419 + 
+    x * 420 + 
+    x * 421 + 
+    x * 422 + 
+    x * 423 + 
+    x * 424 + 
+    x * 425 + 
+    x * 426 + 
+    x * 427 + 
+    x * 428 + 
+    x * 429 + 
+    x * 430 + 
+    x * 431 + 
+    x * 432 + 
+    x * 433 + 
+    x * 434 + 
+    x * 435 + 
+    x * 436 + 
+    x * 437 + 
+    x * 438 + 
+    x * 439 + 
+    x * 440 + 
+    x * 441 + 
+    x * 442 + 
+    x * 443 + 
+    x * 444 + 
+    x * 445 + 
+    x * 446 + 
+    x * 447 + 
+    x * 448 + 
+    x * 449 + 
+    x * 450 + 
+    x * 451 + 
+    x * 452 + 
+    x * 453 + 
+    x * 454 + 
+    x * 455 + 
+    x * 456 + 
+    x * 457 + 
+    x * 458 + 
+    x * 459 + 
+    x * 460 + 
+    x * 461 + 
+    x * 462 + 
+    x * 463 + 
+    x * 464 + 
+    x * 465 + 
+    x * 466 + 
+    x * 467 + 
+    x * 468 + 
+    x * 469 + 
+    x * 470 + 
+    x * 471 + 
+    x * 472 + 
+    x * 473 + 
+    x * 474 + 
+    x * 475 + 
+    x * 476 + 
+    x * 477 + 
+    x * 478 + 
+    x * 479 + 
+    x * 480 + 
+    x * 481 + 
+    x * 482 + 
+    x * 483 + 
+    x * 484 + 
+    x * 485 + 
+    x * 486 + 
+    x * 487 + 
+    x * 488 + 
+    x * 489 + 
+    x * 490 + 
+    x * 491 + 
+    x * 492 + 
+    x * 493 + 
+    x * 494 + 
+    x * 495 + 
+    x * 496 + 
+    x * 497 + 
+    x * 498 + 
+    x * 499 + 
+    x * 500 + 
+    x * 501 + 
+    x * 502 + 
+    x * 503 + 
+    x * 504 + 
+    x * 505 + 
+    x * 506 + 
+    x * 507 + 
+    x * 508 + 
+    x * 509 + 
+    x * 510 + 
+    x * 511 + 
+    x * 512 + 
+    x * 513 + 
+    x * 514 + 
+    x * 515 + 
+    x * 516 + 
+    x * 517 + 
+    x * 518 + 
+    x * 519 + 
+    x * 520 + 
+    x * 521 + 
+    x * 522 + 
+    x * 523 + 
+    x * 524 + 
+    x * 525 + 
+    x * 526 + 
+    x * 527 + 
+    x * 528 + 
+    x * 529 + 
+    x * 530 + 
+    x * 531 + 
+    x * 532 + 
+    x * 533 + 
+    x * 534 + 
+    x * 535 + 
+    x * 536 + 
+    x * 537 + 
+    x * 538 + 
+    x * 539 + 
+    x * 540 + 
+    x * 541 + 
+    x * 542 + 
+    x * 543 + 
+    x * 544 + 
+    x * 545 + 
+    x * 546 + 
+    x * 547 + 
+    x * 548 + 
+    x * 549 + 
+    x * 550 + 
+    x * 551 + 
+    x * 552 + 
+    x * 553 + 
+    x * 554 + 
+    x * 555 + 
+    x * 556 + 
+    x * 557 + 
+    x * 558 + 
+    x * 559 + 
+    x * 560 + 
+    x * 561 + 
+    x * 562 + 
+    x * 563 + 
+    x * 564 + 
+    x * 565 + 
+    x * 566 + 
+    x * 567 + 
+    x * 568 + 
+    x * 569 + 
+    x * 570 + 
+    x * 571 + 
+    x * 572 + 
+    x * 573 + 
+    x * 574 + 
+    x * 575 + 
+    x * 576 + 
+    x * 577 + 
+    x * 578 + 
+    x * 579 + 
+    x * 580 + 
+    x * 581 + 
+    x * 582 + 
+    x * 583 + 
+    x * 584 + 
+    x * 585 + 
+    x * 586 + 
+    x * 587 + 
+    x * 588 + 
+    x * 589 + 
+    x * 590 + 
+    x * 591 + 
+    x * 592 + 
+    x * 593 + 
+    x * 594 + 
+    x * 595 + 
+    x * 596 + 
+    x * 597 + 
+    x * 598 + 
+    x * 599 + 
+    x * 600 + 
+    x * 601 + 
+    x * 602 + 
+    x * 603 + 
+    x * 604 + 
+    x * 605 + 
+    x * 606 + 
+    x * 607 + 
+    x * 608 + 
+    x * 609 + 
+    x * 610 + 
+    x * 611 + 
+    x * 612 + 
+    x * 613 + 
+    x * 614 + 
+    x * 615 + 
+    x * 616 + 
+    x * 617 + 
+    x * 618 + 
+    x * 619 + 
+    x * 620 + 
+    x * 621 + 
+    x * 622 + 
+    x * 623 + 
+    x * 624 + 
+    x * 625 + 
+    x * 626 + 
+    x * 627 + 
+    x * 628 + 
+    x * 629 + 
+    x * 630 + 
+    x * 631 + 
+    x * 632 + 
+    x * 633 + 
+    x * 634 + 
+    x * 635 + 
+    x * 636 + 
+    x * 637 + 
+    x * 638 + 
+    x * 639 + 
+    x * 640 + 
+    x * 641 + 
+    x * 642 + 
+    x * 643 + 
+    x * 644 + 
+    x * 645 + 
+    x * 646 + 
+    x * 647 + 
+    x * 648 + 
+    x * 649 + 
+    x * 650 + 
+    x * 651 + 
+    x * 652 + 
+    x * 653 + 
+    x * 654 + 
+    x * 655 + 
+    x * 656 + 
+    x * 657 + 
+    x * 658 + 
+    x * 659 + 
+    x * 660 + 
+    x * 661 + 
+    x * 662 + 
+    x * 663 + 
+    x * 664 + 
+    x * 665 + 
+    x * 666 + 
+    x * 667 + 
+    x * 668 + 
+    x * 669 + 
+    x * 670 + 
+    x * 671 + 
+    x * 672 + 
+    x * 673 + 
+    x * 674 + 
+    x * 675 + 
+    x * 676 + 
+    x * 677 + 
+    x * 678 + 
+    x * 679 + 
+    x * 680 + 
+    x * 681 + 
+    x * 682 + 
+    x * 683 + 
+    x * 684 + 
+    x * 685 + 
+    x * 686 + 
+    x * 687 + 
+    x * 688 + 
+    x * 689 + 
+    x * 690 + 
+    x * 691 + 
+    x * 692 + 
+    x * 693 + 
+    x * 694 + 
+    x * 695 + 
+    x * 696 + 
+    x * 697 + 
+    x * 698 + 
+    x * 699 + 
+    x * 700 + 
+    x * 701 + 
+    x * 702 + 
+    x * 703 + 
+    x * 704 + 
+    x * 705 + 
+    x * 706 + 
+    x * 707 + 
+    x * 708 + 
+    x * 709 + 
+    x * 710 + 
+    x * 711 + 
+    x * 712 + 
+    x * 713 + 
+    x * 714 + 
+    x * 715 + 
+    x * 716 + 
+    x * 717 + 
+    x * 718 + 
+    x * 719 + 
+    x * 720 + 
+    x * 721 + 
+    x * 722 + 
+    x * 723 + 
+    x * 724 + 
+    x * 725 + 
+    x * 726 + 
+    x * 727 + 
+    x * 728 + 
+    x * 729 + 
+    x * 730 + 
+    x * 731 + 
+    x * 732 + 
+    x * 733 + 
+    x * 734 + 
+    x * 735 + 
+    x * 736 + 
+    x * 737 + 
+    x * 738 + 
+    x * 739 + 
+    x * 740 + 
+    x * 741 + 
+    x * 742 + 
+    x * 743 + 
+    x * 744 + 
+    x * 745 + 
+    x * 746 + 
+    x * 747 + 
+    x * 748 + 
+    x * 749 + 
+    x * 750 + 
+    x * 751 + 
+    x * 752 + 
+    x * 753 + 
+    x * 754 + 
+    x * 755 + 
+    x * 756 + 
+    x * 757 + 
+    x * 758 + 
+    x * 759 + 
+    x * 760 + 
+    x * 761 + 
+    x * 762 + 
+    x * 763 + 
+    x * 764 + 
+    x * 765 + 
+    x * 766 + 
+    x * 767 + 
+    x * 768 + 
+    x * 769 + 
+    x * 770 + 
+    x * 771 + 
+    x * 772 + 
+    x * 773 + 
+    x * 774 + 
+    x * 775 + 
+    x * 776 + 
+    x * 777 + 
+    x * 778 + 
+    x * 779 + 
+    x * 780 + 
+    x * 781 + 
+    x * 782 + 
+    x * 783 + 
+    x * 784 + 
+    x * 785 + 
+    x * 786 + 
+    x * 787 + 
+    x * 788 + 
+    x * 789 + 
+    x * 790 + 
+    x * 791 + 
+    x * 792 + 
+    x * 793 + 
+    x * 794 + 
+    x * 795 + 
+    x * 796 + 
+    x * 797 + 
+    x * 798 + 
+    x * 799 + 
+    x * 800 + 
+    x * 801 + 
+    x * 802 + 
+    x * 803 + 
+    x * 804 + 
+    x * 805 + 
+    x * 806 + 
+    x * 807 + 
+    x * 808 + 
+    x * 809 + 
+    x * 810 + 
+    x * 811 + 
+    x * 812 + 
+    x * 813 + 
+    x * 814 + 
+    x * 815 + 
+    x * 816 + 
+    x * 817 + 
+    x * 818 + 
+    x * 819 + 
+    x * 820 + 
+    x * 821 + 
+    x * 822 + 
+    x * 823 + 
+    x * 824 + 
+    x * 825 + 
+    x * 826 + 
+    x * 827 + 
+    x * 828 + 
+    x * 829 + 
+    x * 830 + 
+    x * 831 + 
+    x * 832 + 
+    x * 833 + 
+    x * 834 + 
+    x * 835 + 
+    x * 836 + 
+    x * 837 + 
+    x * 838 + 
+    x * 839 + 
+    x * 840 + 
+    x * 841 + 
+    x * 842 + 
+    x * 843 + 
+    x * 844 + 
+    x * 845 + 
+    x * 846 + 
+    x * 847 + 
+    x * 848 + 
+    x * 849 + 
+    x * 850 + 
+    x * 851 + 
+    x * 852 + 
+    x * 853 + 
+    x * 854 + 
+    x * 855 + 
+    x * 856 + 
+    x * 857 + 
+    x * 858 + 
+    x * 859 + 
+    x * 860 + 
+    x * 861 + 
+    x * 862 + 
+    x * 863 + 
+    x * 864 + 
+    x * 865 + 
+    x * 866 + 
+    x * 867 + 
+    x * 868 + 
+    x * 869 + 
+    x * 870 + 
+    x * 871 + 
+    x * 872 + 
+    x * 873 + 
+    x * 874 + 
+    x * 875 + 
+    x * 876 + 
+    x * 877 + 
+    x * 878 + 
+    x * 879 + 
+    x * 880 + 
+    x * 881 + 
+    x * 882 + 
+    x * 883 + 
+    x * 884 + 
+    x * 885 + 
+    x * 886 + 
+    x * 887 + 
+    x * 888 + 
+    x * 889 + 
+    x * 890 + 
+    x * 891 + 
+    x * 892 + 
+    x * 893 + 
+    x * 894 + 
+    x * 895 + 
+    x * 896 + 
+    x * 897 + 
+    x * 898 + 
+    x * 899 + 
+    x * 900 + 
+    x * 901 + 
+    x * 902 + 
+    x * 903 + 
+    x * 904 + 
+    x * 905 + 
+    x * 906 + 
+    x * 907 + 
+    x * 908 + 
+    x * 909 + 
+    x * 910 + 
+    x * 911 + 
+    x * 912 + 
+    x * 913 + 
+    x * 914 + 
+    x * 915 + 
+    x * 916 + 
+    x * 917 + 
+    x * 918 + 
+    x * 919 + 
+    x * 920 + 
+    x * 921 + 
+    x * 922 + 
+    x * 923 + 
+    x * 924 + 
+    x * 925 + 
+    x * 926 + 
+    x * 927 + 
+    x * 928 + 
+    x * 929 + 
+    x * 930 + 
+    x * 931 + 
+    x * 932 + 
+    x * 933 + 
+    x * 934 + 
+    x * 935 + 
+    x * 936 + 
+    x * 937 + 
+    x * 938 + 
+    x * 939 + 
+    x * 940 + 
+    x * 941 + 
+    x * 942 + 
+    x * 943 + 
+    x * 944 + 
+    x * 945 + 
+    x * 946 + 
+    x * 947 + 
+    x * 948 + 
+    x * 949 + 
+    x * 950 + 
+    x * 951 + 
+    x * 952 + 
+    x * 953 + 
+    x * 954 + 
+    x * 955 + 
+    x * 956 + 
+    x * 957 + 
+    x * 958 + 
+    x * 959 + 
+    x * 960 + 
+    x * 961 + 
+    x * 962 + 
+    x * 963 + 
+    x * 964 + 
+    x * 965 + 
+    x * 966 + 
+    x * 967 + 
+    x * 968 + 
+    x * 969 + 
+    x * 970 + 
+    x * 971 + 
+    x * 972 + 
+    x * 973 + 
+    x * 974 + 
+    x * 975 + 
+    x * 976 + 
+    x * 977 + 
+    x * 978 + 
+    x * 979 + 
+    x * 980 + 
+    x * 981 + 
+    x * 982 + 
+    x * 983 + 
+    x * 984 + 
+    x * 985 + 
+    x * 986 + 
+    x * 987 + 
+    x * 988 + 
+    x * 989 + 
+    x * 990 + 
+    x * 991 + 
+    x * 992 + 
+    x * 993 + 
+    x * 994 + 
+    x * 995 + 
+    x * 996 + 
+    x * 997 + 
+    x * 998 + 
+    x * 999 + 
+    x * 1000 + 
+    x * 1001 + 
+    x * 1002 + 
+    x * 1003 + 
+    x * 1004 + 
+    x * 1005 + 
+    x * 1006 + 
+    x * 1007 + 
+    x * 1008 + 
+    x * 1009 + 
+    x * 1010 + 
+    x * 1011 + 
+    x * 1012 + 
+    x * 1013 + 
+    x * 1014 + 
+    x * 1015 + 
+    x * 1016 + 
+    x * 1017 + 
+    x * 1018 + 
+    x * 1019 + 
+    x * 1020 + 
+    x * 1021 + 
+    x * 1022 + 
+    x * 1023 + 
+    x * 1024 + 
+    x * 1025 + 
+    x * 1026 + 
+    x * 1027 + 
+    x * 1028 + 
+    x * 1029 + 
+    x * 1030 + 
+    x * 1031 + 
+    x * 1032 + 
+    x * 1033 + 
+    x * 1034 + 
+    x * 1035 + 
+    x * 1036 + 
+    x * 1037 + 
+    x * 1038 + 
+    x * 1039 + 
+    x * 1040 + 
+    x * 1041 + 
+    x * 1042 + 
+    x * 1043 + 
+    x * 1044 + 
+    x * 1045 + 
+    x * 1046 + 
+    x * 1047 + 
+    x * 1048 + 
+    x * 1049 + 
+    x * 1050 + 
+    x * 1051 + 
+    x * 1052 + 
+    x * 1053 + 
+    x * 1054 + 
+    x * 1055 + 
+    x * 1056 + 
+    x * 1057 + 
+    x * 1058 + 
+    x * 1059 + 
+    x * 1060 + 
+    x * 1061 + 
+    x * 1062 + 
+    x * 1063 + 
+    x * 1064 + 
+    x * 1065 + 
+    x * 1066 + 
+    x * 1067 + 
+    x * 1068 + 
+    x * 1069 + 
+    x * 1070 + 
+    x * 1071 + 
+    x * 1072 + 
+    x * 1073 + 
+    x * 1074 + 
+    x * 1075 + 
+    x * 1076 + 
+    x * 1077 + 
+    x * 1078 + 
+    x * 1079 + 
+    x * 1080 + 
+    x * 1081 + 
+    x * 1082 + 
+    x * 1083 + 
+    x * 1084 + 
+    x * 1085 + 
+    x * 1086 + 
+    x * 1087 + 
+    x * 1088 + 
+    x * 1089 + 
+    x * 1090 + 
+    x * 1091 + 
+    x * 1092 + 
+    x * 1093 + 
+    x * 1094 + 
+    x * 1095 + 
+    x * 1096 + 
+    x * 1097 + 
+    x * 1098 + 
+    x * 1099 + 
+    x * 1100 + 
+    x * 1101 + 
+    x * 1102 + 
+    x * 1103 + 
+    x * 1104 + 
+    x * 1105 + 
+    x * 1106 + 
+    x * 1107 + 
+    x * 1108 + 
+    x * 1109 + 
+    x * 1110 + 
+    x * 1111 + 
+    x * 1112 + 
+    x * 1113 + 
+    x * 1114 + 
+    x * 1115 + 
+    x * 1116 + 
+    x * 1117 + 
+    x * 1118 + 
+    x * 1119 + 
+    x * 1120 + 
+    x * 1121 + 
+    x * 1122 + 
+    x * 1123 + 
+    x * 1124 + 
+    x * 1125 + 
+    x * 1126 + 
+    x * 1127 + 
+    x * 1128 + 
+    x * 1129 + 
+    x * 1130 + 
+    x * 1131 + 
+    x * 1132 + 
+    x * 1133 + 
+    x * 1134 + 
+    x * 1135 + 
+    x * 1136 + 
+    x * 1137 + 
+    x * 1138 + 
+    x * 1139 + 
+    x * 1140 + 
+    x * 1141 + 
+    x * 1142 + 
+    x * 1143 + 
+    x * 1144 + 
+    x * 1145 + 
+    x * 1146 + 
+    x * 1147 + 
+    x * 1148 + 
+    x * 1149 + 
+    x * 1150 + 
+    x * 1151 + 
+    x * 1152 + 
+    x * 1153 + 
+    x * 1154 + 
+    x * 1155 + 
+    x * 1156 + 
+    x * 1157 + 
+    x * 1158 + 
+    x * 1159 + 
+    x * 1160 + 
+    x * 1161 + 
+    x * 1162 + 
+    x * 1163 + 
+    x * 1164 + 
+    x * 1165 + 
+    x * 1166 + 
+    x * 1167 + 
+    x * 1168 + 
+    x * 1169 + 
+    x * 1170 + 
+    x * 1171 + 
+    x * 1172 + 
+    x * 1173 + 
+    x * 1174 + 
+    x * 1175 + 
+    x * 1176 + 
+    x * 1177 + 
+    x * 1178 + 
+    x * 1179 + 
+    x * 1180 + 
+    x * 1181 + 
+    x * 1182 + 
+    x * 1183 + 
+    x * 1184 + 
+    x * 1185 + 
+    x * 1186 + 
+    x * 1187 + 
+    x * 1188 + 
+    x * 1189 + 
+    x * 1190 + 
+    x * 1191 + 
+    x * 1192 + 
+    x * 1193 + 
+    x * 1194 + 
+    x * 1195 + 
+    x * 1196 + 
+    x * 1197 + 
+    x * 1198 + 
+    x * 1199 + 
+    x * 1200 + 
+    x * 1201 + 
+    x * 1202 + 
+    x * 1203 + 
+    x * 1204 + 
+    x * 1205 + 
+    x * 1206 + 
+    x * 1207 + 
+    x * 1208 + 
+    x * 1209 + 
+    x * 1210 + 
+    x * 1211 + 
+    x * 1212 + 
+    x * 1213 + 
+    x * 1214 + 
+    x * 1215 + 
+    x * 1216 + 
+    x * 1217 + 
+    x * 1218 + 
+    x * 1219 + 
+    x * 1220 + 
+    x * 1221 + 
+    x * 1222 + 
+    x * 1223 + 
+    x * 1224 + 
+    x * 1225 + 
+    x * 1226 + 
+    x * 1227 + 
+    x * 1228 + 
+    x * 1229 + 
+    x * 1230 + 
+    x * 1231 + 
+    x * 1232 + 
+    x * 1233 + 
+    x * 1234 + 
+    x * 1235 + 
+    x * 1236 + 
+    x * 1237 + 
+    x * 1238 + 
+    x * 1239 + 
+    x * 1240 + 
+    x * 1241 + 
+    x * 1242 + 
+    x * 1243 + 
+    x * 1244 + 
+    x * 1245 + 
+    x * 1246 + 
+    x * 1247 + 
+    x * 1248 + 
+    x * 1249 + 
+    x * 1250 + 
+    x * 1251 + 
+    x * 1252 + 
+    x * 1253 + 
+    x * 1254 + 
+    x * 1255 + 
+    x * 1256 + 
+    x * 1257 + 
+    x * 1258 + 
+    x * 1259 + 
+    x * 1260 + 
+    x * 1261 + 
+    x * 1262 + 
+    x * 1263 + 
+    x * 1264 + 
+    x * 1265 + 
+    x * 1266 + 
+    x * 1267 + 
+    x * 1268 + 
+    x * 1269 + 
+    x * 1270 + 
+    x * 1271 + 
+    x * 1272 + 
+    x * 1273 + 
+    x * 1274 + 
+    x * 1275 + 
+    x * 1276 + 
+    x * 1277 + 
+    x * 1278 + 
+    x * 1279 + 
+    x * 1280 + 
+    x * 1281 + 
+    x * 1282 + 
+    x * 1283 + 
+    x * 1284 + 
+    x * 1285 + 
+    x * 1286 + 
+    x * 1287 + 
+    x * 1288 + 
+    x * 1289 + 
+    x * 1290 + 
+    x * 1291 + 
+    x * 1292 + 
+    x * 1293 + 
+    x * 1294 + 
+    x * 1295 + 
+    x * 1296 + 
+    x * 1297 + 
+    x * 1298 + 
+    x * 1299 + 
+    x * 1300 + 
+    x * 1301 + 
+    x * 1302 + 
+    x * 1303 + 
+    x * 1304 + 
+    x * 1305 + 
+    x * 1306 + 
+    x * 1307 + 
+    x * 1308 + 
+    x * 1309 + 
+    x * 1310 + 
+    x * 1311 + 
+    x * 1312 + 
+    x * 1313 + 
+    x * 1314 + 
+    x * 1315 + 
+    x * 1316 + 
+    x * 1317 + 
+    x * 1318 + 
+    x * 1319 + 
+    x * 1320 + 
+    x * 1321 + 
+    x * 1322 + 
+    x * 1323 + 
+    x * 1324 + 
+    x * 1325 + 
+    x * 1326 + 
+    x * 1327 + 
+    x * 1328 + 
+    x * 1329 + 
+    x * 1330 + 
+    x * 1331 + 
+    x * 1332 + 
+    x * 1333 + 
+    x * 1334 + 
+    x * 1335 + 
+    x * 1336 + 
+    x * 1337 + 
+    x * 1338 + 
+    x * 1339 + 
+    x * 1340 + 
+    x * 1341 + 
+    x * 1342 + 
+    x * 1343 + 
+    x * 1344 + 
+    x * 1345 + 
+    x * 1346 + 
+    x * 1347 + 
+    x * 1348 + 
+    x * 1349 + 
+    x * 1350 + 
+    x * 1351 + 
+    x * 1352 + 
+    x * 1353 + 
+    x * 1354 + 
+    x * 1355 + 
+    x * 1356 + 
+    x * 1357 + 
+    x * 1358 + 
+    x * 1359 + 
+    x * 1360 + 
+    x * 1361 + 
+    x * 1362 + 
+    x * 1363 + 
+    x * 1364 + 
+    x * 1365 + 
+    x * 1366 + 
+    x * 1367 + 
+    x * 1368 + 
+    x * 1369 + 
+    x * 1370 + 
+    x * 1371 + 
+    x * 1372 + 
+    x * 1373 + 
+    x * 1374 + 
+    x * 1375 + 
+    x * 1376 + 
+    x * 1377 + 
+    x * 1378 + 
+    x * 1379 + 
+    x * 1380 + 
+    x * 1381 + 
+    x * 1382 + 
+    x * 1383 + 
+    x * 1384 + 
+    x * 1385 + 
+    x * 1386 + 
+    x * 1387 + 
+    x * 1388 + 
+    x * 1389 + 
+    x * 1390 + 
+    x * 1391 + 
+    x * 1392 + 
+    x * 1393 + 
+    x * 1394 + 
+    x * 1395 + 
+    x * 1396 + 
+    x * 1397 + 
+    x * 1398 + 
+    x * 1399 + 
+    x * 1400 + 
+    x * 1401 + 
+    x * 1402 + 
+    x * 1403 + 
+    x * 1404 + 
+    x * 1405 + 
+    x * 1406 + 
+    x * 1407 + 
+    x * 1408 + 
+    x * 1409 + 
+    x * 1410 + 
+    x * 1411 + 
+    x * 1412 + 
+    x * 1413 + 
+    x * 1414 + 
+    x * 1415 + 
+    x * 1416 + 
+    x * 1417 + 
+    x * 1418 + 
+    x * 1419 + 
+    x * 1420 + 
+    x * 1421 + 
+    x * 1422 + 
+    x * 1423 + 
+    x * 1424 + 
+    x * 1425 + 
+    x * 1426 + 
+    x * 1427 + 
+    x * 1428 + 
+    x * 1429 + 
+    x * 1430 + 
+    x * 1431 + 
+    x * 1432 + 
+    x * 1433 + 
+    x * 1434 + 
+    x * 1435 + 
+    x * 1436 + 
+    x * 1437 + 
+    x * 1438 + 
+    x * 1439 + 
+    x * 1440 + 
+    x * 1441 + 
+    x * 1442 + 
+    x * 1443 + 
+    x * 1444 + 
+    x * 1445 + 
+    x * 1446 + 
+    x * 1447 + 
+    x * 1448 + 
+    x * 1449 + 
+    x * 1450 + 
+    x * 1451 + 
+    x * 1452 + 
+    x * 1453 + 
+    x * 1454 + 
+    x * 1455 + 
+    x * 1456 + 
+    x * 1457 + 
+    x * 1458 + 
+    x * 1459 + 
+    x * 1460 + 
+    x * 1461 + 
+    x * 1462 + 
+    x * 1463 + 
+    x * 1464 + 
+    x * 1465 + 
+    x * 1466 + 
+    x * 1467 + 
+    x * 1468 + 
+    x * 1469 + 
+    x * 1470 + 
+    x * 1471 + 
+    x * 1472 + 
+    x * 1473 + 
+    x * 1474 + 
+    x * 1475 + 
+    x * 1476 + 
+    x * 1477 + 
+    x * 1478 + 
+    x * 1479 + 
+    x * 1480 + 
+    x * 1481 + 
+    x * 1482 + 
+    x * 1483 + 
+    x * 1484 + 
+    x * 1485 + 
+    x * 1486 + 
+    x * 1487 + 
+    x * 1488 + 
+    x * 1489 + 
+    x * 1490 + 
+    x * 1491 + 
+    x * 1492 + 
+    x * 1493 + 
+    x * 1494 + 
+    x * 1495 + 
+    x * 1496 + 
+    x * 1497 + 
+    x * 1498 + 
+    x * 1499 + 
+    x * 1500 + 
+    x * 1501 + 
+    x * 1502 + 
+    x * 1503 + 
+    x * 1504 + 
+    x * 1505 + 
+    x * 1506 + 
+    x * 1507 + 
+    x * 1508 + 
+    x * 1509 + 
+    x * 1510 + 
+    x * 1511 + 
+    x * 1512 + 
+    x * 1513 + 
+    x * 1514 + 
+    x * 1515 + 
+    x * 1516 + 
+    x * 1517 + 
+    x * 1518 + 
+    x * 1519 + 
+    x * 1520 + 
+    x * 1521 + 
+    x * 1522 + 
+    x * 1523 + 
+    x * 1524 + 
+    x * 1525 + 
+    x * 1526 + 
+    x * 1527 + 
+    x * 1528 + 
+    x * 1529 + 
+    x * 1530 + 
+    x * 1531 + 
+    x * 1532 + 
+    x * 1533 + 
+    x * 1534 + 
+    x * 1535 + 
+    x * 1536 + 
+    x * 1537 + 
+    x * 1538 + 
+    x * 1539 + 
+    x * 1540 + 
+    x * 1541 + 
+    x * 1542 + 
+    x * 1543 + 
+    x * 1544 + 
+    x * 1545 + 
+    x * 1546 + 
+    x * 1547 + 
+    x * 1548 + 
+    x * 1549 + 
+    x * 1550 + 
+    x * 1551 + 
+    x * 1552 + 
+    x * 1553 + 
+    x * 1554 + 
+    x * 1555 + 
+    x * 1556 + 
+    x * 1557 + 
+    x * 1558 + 
+    x * 1559 + 
+    x * 1560 + 
+    x * 1561 + 
+    x * 1562 + 
+    x * 1563 + 
+    x * 1564 + 
+    x * 1565 + 
+    x * 1566 + 
+    x * 1567 + 
+    x * 1568 + 
+    x * 1569 + 
+    x * 1570 + 
+    x * 1571 + 
+    x * 1572 + 
+    x * 1573 + 
+    x * 1574 + 
+    x * 1575 + 
+    x * 1576 + 
+    x * 1577 + 
+    x * 1578 + 
+    x * 1579 + 
+    x * 1580 + 
+    x * 1581 + 
+    x * 1582 + 
+    x * 1583 + 
+    x * 1584 + 
+    x * 1585 + 
+    x * 1586 + 
+    x * 1587 + 
+    x * 1588 + 
+    x * 1589 + 
+    x * 1590 + 
+    x * 1591 + 
+    x * 1592 + 
+    x * 1593 + 
+    x * 1594 + 
+    x * 1595 + 
+    x * 1596 + 
+    x * 1597 + 
+    x * 1598 + 
+    x * 1599 + 
+    x * 1600 + 
+    x * 1601 + 
+    x * 1602 + 
+    x * 1603 + 
+    x * 1604 + 
+    x * 1605 + 
+    x * 1606 + 
+    x * 1607 + 
+    x * 1608 + 
+    x * 1609 + 
+    x * 1610 + 
+    x * 1611 + 
+    x * 1612 + 
+    x * 1613 + 
+    x * 1614 + 
+    x * 1615 + 
+    x * 1616 + 
+    x * 1617 + 
+    x * 1618 + 
+    x * 1619 + 
+    x * 1620 + 
+    x * 1621 + 
+    x * 1622 + 
+    x * 1623 + 
+    x * 1624 + 
+    x * 1625 + 
+    x * 1626 + 
+    x * 1627 + 
+    x * 1628 + 
+    x * 1629 + 
+    x * 1630 + 
+    x * 1631 + 
+    x * 1632 + 
+    x * 1633 + 
+    x * 1634 + 
+    x * 1635 + 
+    x * 1636 + 
+    x * 1637 + 
+    x * 1638 + 
+    x * 1639 + 
+    x * 1640 + 
+    x * 1641 + 
+    x * 1642 + 
+    x * 1643 + 
+    x * 1644 + 
+    x * 1645 + 
+    x * 1646 + 
+    x * 1647 + 
+    x * 1648 + 
+    x * 1649 + 
+    x * 1650 + 
+    x * 1651 + 
+    x * 1652 + 
+    x * 1653 + 
+    x * 1654 + 
+    x * 1655 + 
+    x * 1656 + 
+    x * 1657 + 
+    x * 1658 + 
+    x * 1659 + 
+    x * 1660 + 
+    x * 1661 + 
+    x * 1662 + 
+    x * 1663 + 
+    x * 1664 + 
+    x * 1665 + 
+    x * 1666 + 
+    x * 1667 + 
+    x * 1668 + 
+    x * 1669 + 
+    x * 1670 + 
+    x * 1671 + 
+    x * 1672 + 
+    x * 1673 + 
+    x * 1674 + 
+    x * 1675 + 
+    x * 1676 + 
+    x * 1677 + 
+    x * 1678 + 
+    x * 1679 + 
+    x * 1680 + 
+    x * 1681 + 
+    x * 1682 + 
+    x * 1683 + 
+    x * 1684 + 
+    x * 1685 + 
+    x * 1686 + 
+    x * 1687 + 
+    x * 1688 + 
+    x * 1689 + 
+    x * 1690 + 
+    x * 1691 + 
+    x * 1692 + 
+    x * 1693 + 
+    x * 1694 + 
+    x * 1695 + 
+    x * 1696 + 
+    x * 1697 + 
+    x * 1698 + 
+    x * 1699 + 
+    x * 1700 + 
+    x * 1701 + 
+    x * 1702 + 
+    x * 1703 + 
+    x * 1704 + 
+    x * 1705 + 
+    x * 1706 + 
+    x * 1707 + 
+    x * 1708 + 
+    x * 1709 + 
+    x * 1710 + 
+    x * 1711 + 
+    x * 1712 + 
+    x * 1713 + 
+    x * 1714 + 
+    x * 1715 + 
+    x * 1716 + 
+    x * 1717 + 
+    x * 1718 + 
+    x * 1719 + 
+    x * 1720 + 
+    x * 1721 + 
+    x * 1722 + 
+    x * 1723 + 
+    x * 1724 + 
+    x * 1725 + 
+    x * 1726 + 
+    x * 1727 + 
+    x * 1728 + 
+    x * 1729 + 
+    x * 1730 + 
+    x * 1731 + 
+    x * 1732 + 
+    x * 1733 + 
+    x * 1734 + 
+    x * 1735 + 
+    x * 1736 + 
+    x * 1737 + 
+    x * 1738 + 
+    x * 1739 + 
+    x * 1740 + 
+    x * 1741 + 
+    x * 1742 + 
+    x * 1743 + 
+    x * 1744 + 
+    x * 1745 + 
+    x * 1746 + 
+    x * 1747 + 
+    x * 1748 + 
+    x * 1749 + 
+    x * 1750 + 
+    x * 1751 + 
+    x * 1752 + 
+    x * 1753 + 
+    x * 1754 + 
+    x * 1755 + 
+    x * 1756 + 
+    x * 1757 + 
+    x * 1758 + 
+    x * 1759 + 
+    x * 1760 + 
+    x * 1761 + 
+    x * 1762 + 
+    x * 1763 + 
+    x * 1764 + 
+    x * 1765 + 
+    x * 1766 + 
+    x * 1767 + 
+    x * 1768 + 
+    x * 1769 + 
+    x * 1770 + 
+    x * 1771 + 
+    x * 1772 + 
+    x * 1773 + 
+    x * 1774 + 
+    x * 1775 + 
+    x * 1776 + 
+    x * 1777 + 
+    x * 1778 + 
+    x * 1779 + 
+    x * 1780 + 
+    x * 1781 + 
+    x * 1782 + 
+    x * 1783 + 
+    x * 1784 + 
+    x * 1785 + 
+    x * 1786 + 
+    x * 1787 + 
+    x * 1788 + 
+    x * 1789 + 
+    x * 1790 + 
+    x * 1791 + 
+    x * 1792 + 
+    x * 1793 + 
+    x * 1794 + 
+    x * 1795 + 
+    x * 1796 + 
+    x * 1797 + 
+    x * 1798 + 
+    x * 1799 + 
+    x * 1800 + 
+    x * 1801 + 
+    x * 1802 + 
+    x * 1803 + 
+    x * 1804 + 
+    x * 1805 + 
+    x * 1806 + 
+    x * 1807 + 
+    x * 1808 + 
+    x * 1809 + 
+    x * 1810 + 
+    x * 1811 + 
+    x * 1812 + 
+    x * 1813 + 
+    x * 1814 + 
+    x * 1815 + 
+    x * 1816 + 
+    x * 1817 + 
+    x * 1818 + 
+    x * 1819 + 
+    x * 1820 + 
+    x * 1821 + 
+    x * 1822 + 
+    x * 1823 + 
+    x * 1824 + 
+    x * 1825 + 
+    x * 1826 + 
+    x * 1827 + 
+    x * 1828 + 
+    x * 1829 + 
+    x * 1830 + 
+    x * 1831 + 
+    x * 1832 + 
+    x * 1833 + 
+    x * 1834 + 
+    x * 1835 + 
+    x * 1836 + 
+    x * 1837 + 
+    x * 1838 + 
+    x * 1839 + 
+    x * 1840 + 
+    x * 1841 + 
+    x * 1842 + 
+    x * 1843 + 
+    x * 1844 + 
+    x * 1845 + 
+    x * 1846 + 
+    x * 1847 + 
+    x * 1848 + 
+    x * 1849 + 
+    x * 1850 + 
+    x * 1851 + 
+    x * 1852 + 
+    x * 1853 + 
+    x * 1854 + 
+    x * 1855 + 
+    x * 1856 + 
+    x * 1857 + 
+    x * 1858 + 
+    x * 1859 + 
+    x * 1860 + 
+    x * 1861 + 
+    x * 1862 + 
+    x * 1863 + 
+    x * 1864 + 
+    x * 1865 + 
+    x * 1866 + 
+    x * 1867 + 
+    x * 1868 + 
+    x * 1869 + 
+    x * 1870 + 
+    x * 1871 + 
+    x * 1872 + 
+    x * 1873 + 
+    x * 1874 + 
+    x * 1875 + 
+    x * 1876 + 
+    x * 1877 + 
+    x * 1878 + 
+    x * 1879 + 
+    x * 1880 + 
+    x * 1881 + 
+    x * 1882 + 
+    x * 1883 + 
+    x * 1884 + 
+    x * 1885 + 
+    x * 1886 + 
+    x * 1887 + 
+    x * 1888 + 
+    x * 1889 + 
+    x * 1890 + 
+    x * 1891 + 
+    x * 1892 + 
+    x * 1893 + 
+    x * 1894 + 
+    x * 1895 + 
+    x * 1896 + 
+    x * 1897 + 
+    x * 1898 + 
+    x * 1899 + 
+    x * 1900 + 
+    x * 1901 + 
+    x * 1902 + 
+    x * 1903 + 
+    x * 1904 + 
+    x * 1905 + 
+    x * 1906 + 
+    x * 1907 + 
+    x * 1908 + 
+    x * 1909 + 
+    x * 1910 + 
+    x * 1911 + 
+    x * 1912 + 
+    x * 1913 + 
+    x * 1914 + 
+    x * 1915 + 
+    x * 1916 + 
+    x * 1917 + 
+    x * 1918 + 
+    x * 1919 + 
+    x * 1920 + 
+    x * 1921 + 
+    x * 1922 + 
+    x * 1923 + 
+    x * 1924 + 
+    x * 1925 + 
+    x * 1926 + 
+    x * 1927 + 
+    x * 1928 + 
+    x * 1929 + 
+    x * 1930 + 
+    x * 1931 + 
+    x * 1932 + 
+    x * 1933 + 
+    x * 1934 + 
+    x * 1935 + 
+    x * 1936 + 
+    x * 1937 + 
+    x * 1938 + 
+    x * 1939 + 
+    x * 1940 + 
+    x * 1941 + 
+    x * 1942 + 
+    x * 1943 + 
+    x * 1944 + 
+    x * 1945 + 
+    x * 1946 + 
+    x * 1947 + 
+    x * 1948 + 
+    x * 1949 + 
+    x * 1950 + 
+    x * 1951 + 
+    x * 1952 + 
+    x * 1953 + 
+    x * 1954 + 
+    x * 1955 + 
+    x * 1956 + 
+    x * 1957 + 
+    x * 1958 + 
+    x * 1959 + 
+    x * 1960 + 
+    x * 1961 + 
+    x * 1962 + 
+    x * 1963 + 
+    x * 1964 + 
+    x * 1965 + 
+    x * 1966 + 
+    x * 1967 + 
+    x * 1968 + 
+    x * 1969 + 
+    x * 1970 + 
+    x * 1971 + 
+    x * 1972 + 
+    x * 1973 + 
+    x * 1974 + 
+    x * 1975 + 
+    x * 1976 + 
+    x * 1977 + 
+    x * 1978 + 
+    x * 1979 + 
+    x * 1980 + 
+    x * 1981 + 
+    x * 1982 + 
+    x * 1983 + 
+    x * 1984 + 
+    x * 1985 + 
+    x * 1986 + 
+    x * 1987 + 
+    x * 1988 + 
+    x * 1989 + 
+    x * 1990 + 
+    x * 1991 + 
+    x * 1992 + 
+    x * 1993 + 
+    x * 1994 + 
+    x * 1995 + 
+    x * 1996 + 
+    x * 1997 + 
+    x * 1998 + 
+    x * 1999 + 
+    x * 2000 + 
+    x * 2001 + 
+    x * 2002 + 
+    x * 2003 + 
+    x * 2004 + 
+    x * 2005 + 
+    x * 2006 + 
+    x * 2007 + 
+    x * 2008 + 
+    x * 2009 + 
+    x * 2010 + 
+    x * 2011 + 
+    x * 2012 + 
+    x * 2013 + 
+    x * 2014 + 
+    x * 2015 + 
+    x * 2016 + 
+    x * 2017 + 
+    x * 2018 + 
+    x * 2019 + 
+    x * 2020 + 
+    x * 2021 + 
+    x * 2022 + 
+    x * 2023 + 
+    x * 2024 + 
+    x * 2025 + 
+    x * 2026 + 
+    x * 2027 + 
+    x * 2028 + 
+    x * 2029 + 
+    x * 2030 + 
+    x * 2031 + 
+    x * 2032 + 
+    x * 2033 + 
+    x * 2034 + 
+    x * 2035 + 
+    x * 2036 + 
+    x * 2037 + 
+    x * 2038 + 
+    x * 2039 + 
+    x * 2040 + 
+    x * 2041 + 
+    x * 2042 + 
+    x * 2043 + 
+    x * 2044 + 
+    x * 2045 + 
+    x * 2046 + 
+    x * 2047 + 
+    x * 2048 + 
+    x * 2049 + 
+    x * 2050 + 
+    x * 2051 + 
+    x * 2052 + 
+    x * 2053 + 
+    x * 2054 + 
+    x * 2055 + 
+    x * 2056 + 
+    x * 2057 + 
+    x * 2058 + 
+    x * 2059 + 
+    x * 2060 + 
+    x * 2061 + 
+    x * 2062 + 
+    x * 2063 + 
+    x * 2064 + 
+    x * 2065 + 
+    x * 2066 + 
+    x * 2067 + 
+    x * 2068 + 
+    x * 2069 + 
+    x * 2070 + 
+    x * 2071 + 
+    x * 2072 + 
+    x * 2073 + 
+    x * 2074 + 
+    x * 2075 + 
+    x * 2076 + 
+    x * 2077 + 
+    x * 2078 + 
+    x * 2079 + 
+    x * 2080 + 
+    x * 2081 + 
+    x * 2082 + 
+    x * 2083 + 
+    x * 2084 + 
+    x * 2085 + 
+    x * 2086 + 
+    x * 2087 + 
+    x * 2088 + 
+    x * 2089 + 
+    x * 2090 + 
+    x * 2091 + 
+    x * 2092 + 
+    x * 2093 + 
+    x * 2094 + 
+    x * 2095 + 
+    x * 2096 + 
+    x * 2097 + 
+    x * 2098 + 
+    x * 2099 + 
+    x * 2100 + 
+    x * 2101 + 
+    x * 2102 + 
+    x * 2103 + 
+    x * 2104 + 
+    x * 2105 + 
+    x * 2106 + 
+    x * 2107 + 
+    x * 2108 + 
+    x * 2109 + 
+    x * 2110 + 
+    x * 2111 + 
+    x * 2112 + 
+    x * 2113 + 
+    x * 2114 + 
+    x * 2115 + 
+    x * 2116 + 
+    x * 2117 + 
+    x * 2118 + 
+    x * 2119 + 
+    x * 2120 + 
+    x * 2121 + 
+    x * 2122 + 
+    x * 2123 + 
+    x * 2124 + 
+    x * 2125 + 
+    x * 2126 + 
+    x * 2127 + 
+    x * 2128 + 
+    x * 2129 + 
+    x * 2130 + 
+    x * 2131 + 
+    x * 2132 + 
+    x * 2133 + 
+    x * 2134 + 
+    x * 2135 + 
+    x * 2136 + 
+    x * 2137 + 
+    x * 2138 + 
+    x * 2139 + 
+    x * 2140 + 
+    x * 2141 + 
+    x * 2142 + 
+    x * 2143 + 
+    x * 2144 + 
+    x * 2145 + 
+    x * 2146 + 
+    x * 2147 + 
+    x * 2148 + 
+    x * 2149 + 
+    x * 2150 + 
+    x * 2151 + 
+    x * 2152 + 
+    x * 2153 + 
+    x * 2154 + 
+    x * 2155 + 
+    x * 2156 + 
+    x * 2157 + 
+    x * 2158 + 
+    x * 2159 + 
+    x * 2160 + 
+    x * 2161 + 
+    x * 2162 + 
+    x * 2163 + 
+    x * 2164 + 
+    x * 2165 + 
+    x * 2166 + 
+    x * 2167 + 
+    x * 2168 + 
+    x * 2169 + 
+    x * 2170 + 
+    x * 2171 + 
+    x * 2172 + 
+    x * 2173 + 
+    x * 2174 + 
+    x * 2175 + 
+    x * 2176 + 
+    x * 2177 + 
+    x * 2178 + 
+    x * 2179 + 
+    x * 2180 + 
+    x * 2181 + 
+    x * 2182 + 
+    x * 2183 + 
+    x * 2184 + 
+    x * 2185 + 
+    x * 2186 + 
+    x * 2187 + 
+    x * 2188 + 
+    x * 2189 + 
+    x * 2190 + 
+    x * 2191 + 
+    x * 2192 + 
+    x * 2193 + 
+    x * 2194 + 
+    x * 2195 + 
+    x * 2196 + 
+    x * 2197 + 
+    x * 2198 + 
+    x * 2199 + 
+    x * 2200 + 
+    x * 2201 + 
+    x * 2202 + 
+    x * 2203 + 
+    x * 2204 + 
+    x * 2205 + 
+    x * 2206 + 
+    x * 2207 + 
+    x * 2208 + 
+    x * 2209 + 
+    x * 2210 + 
+    x * 2211 + 
+    x * 2212 + 
+    x * 2213 + 
+    x * 2214 + 
+    x * 2215 + 
+    x * 2216 + 
+    x * 2217 + 
+    x * 2218 + 
+    x * 2219 + 
+    x * 2220 + 
+    x * 2221 + 
+    x * 2222 + 
+    x * 2223 + 
+    x * 2224 + 
+    x * 2225 + 
+    x * 2226 + 
+    x * 2227 + 
+    x * 2228 + 
+    x * 2229 + 
+    x * 2230 + 
+    x * 2231 + 
+    x * 2232 + 
+    x * 2233 + 
+    x * 2234 + 
+    x * 2235 + 
+    x * 2236 + 
+    x * 2237 + 
+    x * 2238 + 
+    x * 2239 + 
+    x * 2240 + 
+    x * 2241 + 
+    x * 2242 + 
+    x * 2243 + 
+    x * 2244 + 
+    x * 2245 + 
+    x * 2246 + 
+    x * 2247 + 
+    x * 2248 + 
+    x * 2249 + 
+    x * 2250 + 
+    x * 2251 + 
+    x * 2252 + 
+    x * 2253 + 
+    x * 2254 + 
+    x * 2255 + 
+    x * 2256 + 
+    x * 2257 + 
+    x * 2258 + 
+    x * 2259 + 
+    x * 2260 + 
+    x * 2261 + 
+    x * 2262 + 
+    x * 2263 + 
+    x * 2264 + 
+    x * 2265 + 
+    x * 2266 + 
+    x * 2267 + 
+    x * 2268 + 
+    x * 2269 + 
+    x * 2270 + 
+    x * 2271 + 
+    x * 2272 + 
+    x * 2273 + 
+    x * 2274 + 
+    x * 2275 + 
+    x * 2276 + 
+    x * 2277 + 
+    x * 2278 + 
+    x * 2279 + 
+    x * 2280 + 
+    x * 2281 + 
+    x * 2282 + 
+    x * 2283 + 
+    x * 2284 + 
+    x * 2285 + 
+    x * 2286 + 
+    x * 2287 + 
+    x * 2288 + 
+    x * 2289 + 
+    x * 2290 + 
+    x * 2291 + 
+    x * 2292 + 
+    x * 2293 + 
+    x * 2294 + 
+    x * 2295 + 
+    x * 2296 + 
+    x * 2297 + 
+    x * 2298 + 
+    x * 2299 + 
+    x * 2300 + 
+    x * 2301 + 
+    x * 2302 + 
+    x * 2303 + 
+    x * 2304 + 
+    x * 2305 + 
+    x * 2306 + 
+    x * 2307 + 
+    x * 2308 + 
+    x * 2309 + 
+    x * 2310 + 
+    x * 2311 + 
+    x * 2312 + 
+    x * 2313 + 
+    x * 2314 + 
+    x * 2315 + 
+    x * 2316 + 
+    x * 2317 + 
+    x * 2318 + 
+    x * 2319 + 
+    x * 2320 + 
+    x * 2321 + 
+    x * 2322 + 
+    x * 2323 + 
+    x * 2324 + 
+    x * 2325 + 
+    x * 2326 + 
+    x * 2327 + 
+    x * 2328 + 
+    x * 2329 + 
+    x * 2330 + 
+    x * 2331 + 
+    x * 2332 + 
+    x * 2333 + 
+    x * 2334 + 
+    x * 2335 + 
+    x * 2336 + 
+    x * 2337 + 
+    x * 2338 + 
+    x * 2339 + 
+    x * 2340 + 
+    x * 2341 + 
+    x * 2342 + 
+    x * 2343 + 
+    x * 2344 + 
+    x * 2345 + 
+    x * 2346 + 
+    x * 2347 + 
+    x * 2348 + 
+    x * 2349 + 
+    x * 2350 + 
+    x * 2351 + 
+    x * 2352 + 
+    x * 2353 + 
+    x * 2354 + 
+    x * 2355 + 
+    x * 2356 + 
+    x * 2357 + 
+    x * 2358 + 
+    x * 2359 + 
+    x * 2360 + 
+    x * 2361 + 
+    x * 2362 + 
+    x * 2363 + 
+    x * 2364 + 
+    x * 2365 + 
+    x * 2366 + 
+    x * 2367 + 
+    x * 2368 + 
+    x * 2369 + 
+    x * 2370 + 
+    x * 2371 + 
+    x * 2372 + 
+    x * 2373 + 
+    x * 2374 + 
+    x * 2375 + 
+    x * 2376 + 
+    x * 2377 + 
+    x * 2378 + 
+    x * 2379 + 
+    x * 2380 + 
+    x * 2381 + 
+    x * 2382 + 
+    x * 2383 + 
+    x * 2384 + 
+    x * 2385 + 
+    x * 2386 + 
+    x * 2387 + 
+    x * 2388 + 
+    x * 2389 + 
+    x * 2390 + 
+    x * 2391 + 
+    x * 2392 + 
+    x * 2393 + 
+    x * 2394 + 
+    x * 2395 + 
+    x * 2396 + 
+    x * 2397 + 
+    x * 2398 + 
+    x * 2399 + 
+    x * 2400 + 
+    x * 2401 + 
+    x * 2402 + 
+    x * 2403 + 
+    x * 2404 + 
+    x * 2405 + 
+    x * 2406 + 
+    x * 2407 + 
+    x * 2408 + 
+    x * 2409 + 
+    x * 2410 + 
+    x * 2411 + 
+    x * 2412 + 
+    x * 2413 + 
+    x * 2414 + 
+    x * 2415 + 
+    x * 2416 + 
+    x * 2417 + 
+    x * 2418 + 
+    x * 2419 + 
+    x * 2420 + 
+    x * 2421 + 
+    x * 2422 + 
+    x * 2423 + 
+    x * 2424 + 
+    x * 2425 + 
+    x * 2426 + 
+    x * 2427 + 
+    x * 2428 + 
+    x * 2429 + 
+    x * 2430 + 
+    x * 2431 + 
+    x * 2432 + 
+    x * 2433 + 
+    x * 2434 + 
+    x * 2435 + 
+    x * 2436 + 
+    x * 2437 + 
+    x * 2438 + 
+    x * 2439 + 
+    x * 2440 + 
+    x * 2441 + 
+    x * 2442 + 
+    x * 2443 + 
+    x * 2444 + 
+    x * 2445 + 
+    x * 2446 + 
+    x * 2447 + 
+    x * 2448 + 
+    x * 2449 + 
+    x * 2450 + 
+    x * 2451 + 
+    x * 2452 + 
+    x * 2453 + 
+    x * 2454 + 
+    x * 2455 + 
+    x * 2456 + 
+    x * 2457 + 
+    x * 2458 + 
+    x * 2459 + 
+    x * 2460 + 
+    x * 2461 + 
+    x * 2462 + 
+    x * 2463 + 
+    x * 2464 + 
+    x * 2465 + 
+    x * 2466 + 
+    x * 2467 + 
+    x * 2468 + 
+    x * 2469 + 
+    x * 2470 + 
+    x * 2471 + 
+    x * 2472 + 
+    x * 2473 + 
+    x * 2474 + 
+    x * 2475 + 
+    x * 2476 + 
+    x * 2477 + 
+    x * 2478 + 
+    x * 2479 + 
+    x * 2480 + 
+    x * 2481 + 
+    x * 2482 + 
+    x * 2483 + 
+    x * 2484 + 
+    x * 2485 + 
+    x * 2486 + 
+    x * 2487 + 
+    x * 2488 + 
+    x * 2489 + 
+    x * 2490 + 
+    x * 2491 + 
+    x * 2492 + 
+    x * 2493 + 
+    x * 2494 + 
+    x * 2495 + 
+    x * 2496 + 
+    x * 2497 + 
+    x * 2498 + 
+    x * 2499 + 
+    x * 2500 + 
+    x * 2501 + 
+    x * 2502 + 
+    x * 2503 + 
+    x * 2504 + 
+    x * 2505 + 
+    x * 2506 + 
+    x * 2507 + 
+    x * 2508 + 
+    x * 2509 + 
+    x * 2510 + 
+    x * 2511 + 
+    x * 2512 + 
+    x * 2513 + 
+    x * 2514 + 
+    x * 2515 + 
+    x * 2516 + 
+    x * 2517 + 
+    x * 2518 + 
+    x * 2519 + 
+    x * 2520 + 
+    x * 2521 + 
+    x * 2522 + 
+    x * 2523 + 
+    x * 2524 + 
+    x * 2525 + 
+    x * 2526 + 
+    x * 2527 + 
+    x * 2528 + 
+    x * 2529 + 
+    x * 2530 + 
+    x * 2531 + 
+    x * 2532 + 
+    x * 2533 + 
+    x * 2534 + 
+    x * 2535 + 
+    x * 2536 + 
+    x * 2537 + 
+    x * 2538 + 
+    x * 2539 + 
+    x * 2540 + 
+    x * 2541 + 
+    x * 2542 + 
+    x * 2543 + 
+    x * 2544 + 
+    x * 2545 + 
+    x * 2546 + 
+    x * 2547 + 
+    x * 2548 + 
+    x * 2549 + 
+    x * 2550 + 
+    x * 2551 + 
+    x * 2552 + 
+    x * 2553 + 
+    x * 2554 + 
+    x * 2555 + 
+    x * 2556 + 
+    x * 2557 + 
+    x * 2558 + 
+    x * 2559 + 
+    x * 2560 + 
+    x * 2561 + 
+    x * 2562 + 
+    x * 2563 + 
+    x * 2564 + 
+    x * 2565 + 
+    x * 2566 + 
+    x * 2567 + 
+    x * 2568 + 
+    x * 2569 + 
+    x * 2570 + 
+    x * 2571 + 
+    x * 2572 + 
+    x * 2573 + 
+    x * 2574 + 
+    x * 2575 + 
+    x * 2576 + 
+    x * 2577 + 
+    x * 2578 + 
+    x * 2579 + 
+    x * 2580 + 
+    x * 2581 + 
+    x * 2582 + 
+    x * 2583 + 
+    x * 2584 + 
+    x * 2585 + 
+    x * 2586 + 
+    x * 2587 + 
+    x * 2588 + 
+    x * 2589 + 
+    x * 2590 + 
+    x * 2591 + 
+    x * 2592 + 
+    x * 2593 + 
+    x * 2594 + 
+    x * 2595 + 
+    x * 2596 + 
+    x * 2597 + 
+    x * 2598 + 
+    x * 2599 + 
+    x * 2600 + 
+    x * 2601 + 
+    x * 2602 + 
+    x * 2603 + 
+    x * 2604 + 
+    x * 2605 + 
+    x * 2606 + 
+    x * 2607 + 
+    x * 2608 + 
+    x * 2609 + 
+    x * 2610 + 
+    x * 2611 + 
+    x * 2612 + 
+    x * 2613 + 
+    x * 2614 + 
+    x * 2615 + 
+    x * 2616 + 
+    x * 2617 + 
+    x * 2618 + 
+    x * 2619 + 
+    x * 2620 + 
+    x * 2621 + 
+    x * 2622 + 
+    x * 2623 + 
+    x * 2624 + 
+    x * 2625 + 
+    x * 2626 + 
+    x * 2627 + 
+    x * 2628 + 
+    x * 2629 + 
+    x * 2630 + 
+    x * 2631 + 
+    x * 2632 + 
+    x * 2633 + 
+    x * 2634 + 
+    x * 2635 + 
+    x * 2636 + 
+    x * 2637 + 
+    x * 2638 + 
+    x * 2639 + 
+    x * 2640 + 
+    x * 2641 + 
+    x * 2642 + 
+    x * 2643 + 
+    x * 2644 + 
+    x * 2645 + 
+    x * 2646 + 
+    x * 2647 + 
+    x * 2648 + 
+    x * 2649 + 
+    x * 2650 + 
+    x * 2651 + 
+    x * 2652 + 
+    x * 2653 + 
+    x * 2654 + 
+    x * 2655 + 
+    x * 2656 + 
+    x * 2657 + 
+    x * 2658 + 
+    x * 2659 + 
+    x * 2660 + 
+    x * 2661 + 
+    x * 2662 + 
+    x * 2663 + 
+    x * 2664 + 
+    x * 2665 + 
+    x * 2666 + 
+    x * 2667 + 
+    x * 2668 + 
+    x * 2669 + 
+    x * 2670 + 
+    x * 2671 + 
+    x * 2672 + 
+    x * 2673 + 
+    x * 2674 + 
+    x * 2675 + 
+    x * 2676 + 
+    x * 2677 + 
+    x * 2678 + 
+    x * 2679 + 
+    x * 2680 + 
+    x * 2681 + 
+    x * 2682 + 
+    x * 2683 + 
+    x * 2684 + 
+    x * 2685 + 
+    x * 2686 + 
+    x * 2687 + 
+    x * 2688 + 
+    x * 2689 + 
+    x * 2690 + 
+    x * 2691 + 
+    x * 2692 + 
+    x * 2693 + 
+    x * 2694 + 
+    x * 2695 + 
+    x * 2696 + 
+    x * 2697 + 
+    x * 2698 + 
+    x * 2699 + 
+    x * 2700 + 
+    x * 2701 + 
+    x * 2702 + 
+    x * 2703 + 
+    x * 2704 + 
+    x * 2705 + 
+    x * 2706 + 
+    x * 2707 + 
+    x * 2708 + 
+    x * 2709 + 
+    x * 2710 + 
+    x * 2711 + 
+    x * 2712 + 
+    x * 2713 + 
+    x * 2714 + 
+    x * 2715 + 
+    x * 2716 + 
+    x * 2717 + 
+    x * 2718 + 
+    x * 2719 + 
+    x * 2720 + 
+    x * 2721 + 
+    x * 2722 + 
+    x * 2723 + 
+    x * 2724 + 
+    x * 2725 + 
+    x * 2726 + 
+    x * 2727 + 
+    x * 2728 + 
+    x * 2729 + 
+    x * 2730 + 
+    x * 2731 + 
+    x * 2732 + 
+    x * 2733 + 
+    x * 2734 + 
+    x * 2735 + 
+    x * 2736 + 
+    x * 2737 + 
+    x * 2738 + 
+    x * 2739 + 
+    x * 2740 + 
+    x * 2741 + 
+    x * 2742 + 
+    x * 2743 + 
+    x * 2744 + 
+    x * 2745 + 
+    x * 2746 + 
+    x * 2747 + 
+    x * 2748 + 
+    x * 2749 + 
+    x * 2750 + 
+    x * 2751 + 
+    x * 2752 + 
+    x * 2753 + 
+    x * 2754 + 
+    x * 2755 + 
+    x * 2756 + 
+    x * 2757 + 
+    x * 2758 + 
+    x * 2759 + 
+    x * 2760 + 
+    x * 2761 + 
+    x * 2762 + 
+    x * 2763 + 
+    x * 2764 + 
+    x * 2765 + 
+    x * 2766 + 
+    x * 2767 + 
+    x * 2768 + 
+    x * 2769 + 
+    x * 2770 + 
+    x * 2771 + 
+    x * 2772 + 
+    x * 2773 + 
+    x * 2774 + 
+    x * 2775 + 
+    x * 2776 + 
+    x * 2777 + 
+    x * 2778 + 
+    x * 2779 + 
+    x * 2780 + 
+    x * 2781 + 
+    x * 2782 + 
+    x * 2783 + 
+    x * 2784 + 
+    x * 2785 + 
+    x * 2786 + 
+    x * 2787 + 
+    x * 2788 + 
+    x * 2789 + 
+    x * 2790 + 
+    x * 2791 + 
+    x * 2792 + 
+    x * 2793 + 
+    x * 2794 + 
+    x * 2795 + 
+    x * 2796 + 
+    x * 2797 + 
+    x * 2798 + 
+    x * 2799 + 
+    x * 2800 + 
+    x * 2801 + 
+    x * 2802 + 
+    x * 2803 + 
+    x * 2804 + 
+    x * 2805 + 
+    x * 2806 + 
+    x * 2807 + 
+    x * 2808 + 
+    x * 2809 + 
+    x * 2810 + 
+    x * 2811 + 
+    x * 2812 + 
+    x * 2813 + 
+    x * 2814 + 
+    x * 2815 + 
+    x * 2816 + 
+    x * 2817 + 
+    x * 2818 + 
+    x * 2819 + 
+    x * 2820 + 
+    x * 2821 + 
+    x * 2822 + 
+    x * 2823 + 
+    x * 2824 + 
+    x * 2825 + 
+    x * 2826 + 
+    x * 2827 + 
+    x * 2828 + 
+    x * 2829 + 
+    x * 2830 + 
+    x * 2831 + 
+    x * 2832 + 
+    x * 2833 + 
+    x * 2834 + 
+    x * 2835 + 
+    x * 2836 + 
+    x * 2837 + 
+    x * 2838 + 
+    x * 2839 + 
+    x * 2840 + 
+    x * 2841 + 
+    x * 2842 + 
+    x * 2843 + 
+    x * 2844 + 
+    x * 2845 + 
+    x * 2846 + 
+    x * 2847 + 
+    x * 2848 + 
+    x * 2849 + 
+    x * 2850 + 
+    x * 2851 + 
+    x * 2852 + 
+    x * 2853 + 
+    x * 2854 + 
+    x * 2855 + 
+    x * 2856 + 
+    x * 2857 + 
+    x * 2858 + 
+    x * 2859 + 
+    x * 2860 + 
+    x * 2861 + 
+    x * 2862 + 
+    x * 2863 + 
+    x * 2864 + 
+    x * 2865 + 
+    x * 2866 + 
+    x * 2867 + 
+    x * 2868 + 
+    x * 2869 + 
+    x * 2870 + 
+    x * 2871 + 
+    x * 2872 + 
+    x * 2873 + 
+    x * 2874 + 
+    x * 2875 + 
+    x * 2876 + 
+    x * 2877 + 
+    x * 2878 + 
+    x * 2879 + 
+    x * 2880 + 
+    x * 2881 + 
+    x * 2882 + 
+    x * 2883 + 
+    x * 2884 + 
+    x * 2885 + 
+    x * 2886 + 
+    x * 2887 + 
+    x * 2888 + 
+    x * 2889 + 
+    x * 2890 + 
+    x * 2891 + 
+    x * 2892 + 
+    x * 2893 + 
+    x * 2894 + 
+    x * 2895 + 
+    x * 2896 + 
+    x * 2897 + 
+    x * 2898 + 
+    x * 2899 + 
+    x * 2900 + 
+    x * 2901 + 
+    x * 2902 + 
+    x * 2903 + 
+    x * 2904 + 
+    x * 2905 + 
+    x * 2906 + 
+    x * 2907 + 
+    x * 2908 + 
+    x * 2909 + 
+    x * 2910 + 
+    x * 2911 + 
+    x * 2912 + 
+    x * 2913 + 
+    x * 2914 + 
+    x * 2915 + 
+    x * 2916 + 
+    x * 2917 + 
+    x * 2918 + 
+    x * 2919 + 
+    x * 2920 + 
+    x * 2921 + 
+    x * 2922 + 
+    x * 2923 + 
+    x * 2924 + 
+    x * 2925 + 
+    x * 2926 + 
+    x * 2927 + 
+    x * 2928 + 
+    x * 2929 + 
+    x * 2930 + 
+    x * 2931 + 
+    x * 2932 + 
+    x * 2933 + 
+    x * 2934 + 
+    x * 2935 + 
+    x * 2936 + 
+    x * 2937 + 
+    x * 2938 + 
+    x * 2939 + 
+    x * 2940 + 
+    x * 2941 + 
+    x * 2942 + 
+    x * 2943 + 
+    x * 2944 + 
+    x * 2945 + 
+    x * 2946 + 
+    x * 2947 + 
+    x * 2948 + 
+    x * 2949 + 
+    x * 2950 + 
+    x * 2951 + 
+    x * 2952 + 
+    x * 2953 + 
+    x * 2954 + 
+    x * 2955 + 
+    x * 2956 + 
+    x * 2957 + 
+    x * 2958 + 
+    x * 2959 + 
+    x * 2960 + 
+    x * 2961 + 
+    x * 2962 + 
+    x * 2963 + 
+    x * 2964 + 
+    x * 2965 + 
+    x * 2966 + 
+    x * 2967 + 
+    x * 2968 + 
+    x * 2969 + 
+    x * 2970 + 
+    x * 2971 + 
+    x * 2972 + 
+    x * 2973 + 
+    x * 2974 + 
+    x * 2975 + 
+    x * 2976 + 
+    x * 2977 + 
+    x * 2978 + 
+    x * 2979 + 
+    x * 2980 + 
+    x * 2981 + 
+    x * 2982 + 
+    x * 2983 + 
+    x * 2984 + 
+    x * 2985 + 
+    x * 2986 + 
+    x * 2987 + 
+    x * 2988 + 
+    x * 2989 + 
+    x * 2990 + 
+    x * 2991 + 
+    x * 2992 + 
+    x * 2993 + 
+    x * 2994 + 
+    x * 2995 + 
+    x * 2996 + 
+    x * 2997 + 
+    x * 2998 + 
+    x * 2999 + 
+    x * 3000 + 
+    x * 3001 + 
+    x * 3002 + 
+    x * 3003 + 
+    x * 3004 + 
+    x * 3005 + 
+    x * 3006 + 
+    x * 3007 + 
+    x * 3008 + 
+    x * 3009 + 
+    x * 3010 + 
+    x * 3011 + 
+    x * 3012 + 
+    x * 3013 + 
+    x * 3014 + 
+    x * 3015 + 
+    x * 3016 + 
+    x * 3017 + 
+    x * 3018 + 
+    x * 3019 + 
+    x * 3020 + 
+    x * 3021 + 
+    x * 3022 + 
+    x * 3023 + 
+    x * 3024 + 
+    x * 3025 + 
+    x * 3026 + 
+    x * 3027 + 
+    x * 3028 + 
+    x * 3029 + 
+    x * 3030 + 
+    x * 3031 + 
+    x * 3032 + 
+    x * 3033 + 
+    x * 3034 + 
+    x * 3035 + 
+    x * 3036 + 
+    x * 3037 + 
+    x * 3038 + 
+    x * 3039 + 
+    x * 3040 + 
+    x * 3041 + 
+    x * 3042 + 
+    x * 3043 + 
+    x * 3044 + 
+    x * 3045 + 
+    x * 3046 + 
+    x * 3047 + 
+    x * 3048 + 
+    x * 3049 + 
+    x * 3050 + 
+    x * 3051 + 
+    x * 3052 + 
+    x * 3053 + 
+    x * 3054 + 
+    x * 3055 + 
+    x * 3056 + 
+    x * 3057 + 
+    x * 3058 + 
+    x * 3059 + 
+    x * 3060 + 
+    x * 3061 + 
+    x * 3062 + 
+    x * 3063 + 
+    x * 3064 + 
+    x * 3065 + 
+    x * 3066 + 
+    x * 3067 + 
+    x * 3068 + 
+    x * 3069 + 
+    x * 3070 + 
+    x * 3071 + 
+    x * 3072 + 
+    x * 3073 + 
+    x * 3074 + 
+    x * 3075 + 
+    x * 3076 + 
+    x * 3077 + 
+    x * 3078 + 
+    x * 3079 + 
+    x * 3080 + 
+    x * 3081 + 
+    x * 3082 + 
+    x * 3083 + 
+    x * 3084 + 
+    x * 3085 + 
+    x * 3086 + 
+    x * 3087 + 
+    x * 3088 + 
+    x * 3089 + 
+    x * 3090 + 
+    x * 3091 + 
+    x * 3092 + 
+    x * 3093 + 
+    x * 3094 + 
+    x * 3095 + 
+    x * 3096 + 
+    x * 3097 + 
+    x * 3098 + 
+    x * 3099 + 
+    x * 3100 + 
+    x * 3101 + 
+    x * 3102 + 
+    x * 3103 + 
+    x * 3104 + 
+    x * 3105 + 
+    x * 3106 + 
+    x * 3107 + 
+    x * 3108 + 
+    x * 3109 + 
+    x * 3110 + 
+    x * 3111 + 
+    x * 3112 + 
+    x * 3113 + 
+    x * 3114 + 
+    x * 3115 + 
+    x * 3116 + 
+    x * 3117 + 
+    x * 3118 + 
+    x * 3119 + 
+    x * 3120 + 
+    x * 3121 + 
+    x * 3122 + 
+    x * 3123 + 
+    x * 3124 + 
+    x * 3125 + 
+    x * 3126 + 
+    x * 3127 + 
+    x * 3128 + 
+    x * 3129 + 
+    x * 3130 + 
+    x * 3131 + 
+    x * 3132 + 
+    x * 3133 + 
+    x * 3134 + 
+    x * 3135 + 
+    x * 3136 + 
+    x * 3137 + 
+    x * 3138 + 
+    x * 3139 + 
+    x * 3140 + 
+    x * 3141 + 
+    x * 3142 + 
+    x * 3143 + 
+    x * 3144 + 
+    x * 3145 + 
+    x * 3146 + 
+    x * 3147 + 
+    x * 3148 + 
+    x * 3149 + 
+    x * 3150 + 
+    x * 3151 + 
+    x * 3152 + 
+    x * 3153 + 
+    x * 3154 + 
+    x * 3155 + 
+    x * 3156 + 
+    x * 3157 + 
+    x * 3158 + 
+    x * 3159 + 
+    x * 3160 + 
+    x * 3161 + 
+    x * 3162 + 
+    x * 3163 + 
+    x * 3164 + 
+    x * 3165 + 
+    x * 3166 + 
+    x * 3167 + 
+    x * 3168 + 
+    x * 3169 + 
+    x * 3170 + 
+    x * 3171 + 
+    x * 3172 + 
+    x * 3173 + 
+    x * 3174 + 
+    x * 3175 + 
+    x * 3176 + 
+    x * 3177 + 
+    x * 3178 + 
+    x * 3179 + 
+    x * 3180 + 
+    x * 3181 + 
+    x * 3182 + 
+    x * 3183 + 
+    x * 3184 + 
+    x * 3185 + 
+    x * 3186 + 
+    x * 3187 + 
+    x * 3188 + 
+    x * 3189 + 
+    x * 3190 + 
+    x * 3191 + 
+    x * 3192 + 
+    x * 3193 + 
+    x * 3194 + 
+    x * 3195 + 
+    x * 3196 + 
+    x * 3197 + 
+    x * 3198 + 
+    x * 3199 + 
+    x * 3200 + 
+    x * 3201 + 
+    x * 3202 + 
+    x * 3203 + 
+    x * 3204 + 
+    x * 3205 + 
+    x * 3206 + 
+    x * 3207 + 
+    x * 3208 + 
+    x * 3209 + 
+    x * 3210 + 
+    x * 3211 + 
+    x * 3212 + 
+    x * 3213 + 
+    x * 3214 + 
+    x * 3215 + 
+    x * 3216 + 
+    x * 3217 + 
+    x * 3218 + 
+    x * 3219 + 
+    x * 3220 + 
+    x * 3221 + 
+    x * 3222 + 
+    x * 3223 + 
+    x * 3224 + 
+    x * 3225 + 
+    x * 3226 + 
+    x * 3227 + 
+    x * 3228 + 
+    x * 3229 + 
+    x * 3230 + 
+    x * 3231 + 
+    x * 3232 + 
+    x * 3233 + 
+    x * 3234 + 
+    x * 3235 + 
+    x * 3236 + 
+    x * 3237 + 
+    x * 3238 + 
+    x * 3239 + 
+    x * 3240 + 
+    x * 3241 + 
+    x * 3242 + 
+    x * 3243 + 
+    x * 3244 + 
+    x * 3245 + 
+    x * 3246 + 
+    x * 3247 + 
+    x * 3248 + 
+    x * 3249 + 
+    x * 3250 + 
+    x * 3251 + 
+    x * 3252 + 
+    x * 3253 + 
+    x * 3254 + 
+    x * 3255 + 
+    x * 3256 + 
+    x * 3257 + 
+    x * 3258 + 
+    x * 3259 + 
+    x * 3260 + 
+    x * 3261 + 
+    x * 3262 + 
+    x * 3263 + 
+    x * 3264 + 
+    x * 3265 + 
+    x * 3266 + 
+    x * 3267 + 
+    x * 3268 + 
+    x * 3269 + 
+    x * 3270 + 
+    x * 3271 + 
+    x * 3272 + 
+    x * 3273 + 
+    x * 3274 + 
+    x * 3275 + 
+    x * 3276 + 
+    x * 3277 + 
+    x * 3278 + 
+    x * 3279 + 
+    x * 3280 + 
+    x * 3281 + 
+    x * 3282 + 
+    x * 3283 + 
+    x * 3284 + 
+    x * 3285 + 
+    x * 3286 + 
+    x * 3287 + 
+    x * 3288 + 
+    x * 3289 + 
+    x * 3290 + 
+    x * 3291 + 
+    x * 3292 + 
+    x * 3293 + 
+    x * 3294 + 
+    x * 3295 + 
+    x * 3296 + 
+    x * 3297 + 
+    x * 3298 + 
+    x * 3299 + 
+    x * 3300 + 
+    x * 3301 + 
+    x * 3302 + 
+    x * 3303 + 
+    x * 3304 + 
+    x * 3305 + 
+    x * 3306 + 
+    x * 3307 + 
+    x * 3308 + 
+    x * 3309 + 
+    x * 3310 + 
+    x * 3311 + 
+    x * 3312 + 
+    x * 3313 + 
+    x * 3314 + 
+    x * 3315 + 
+    x * 3316 + 
+    x * 3317 + 
+    x * 3318 + 
+    x * 3319 + 
+    x * 3320 + 
+    x * 3321 + 
+    x * 3322 + 
+    x * 3323 + 
+    x * 3324 + 
+    x * 3325 + 
+    x * 3326 + 
+    x * 3327 + 
+    x * 3328 + 
+    x * 3329 + 
+    x * 3330 + 
+    x * 3331 + 
+    x * 3332 + 
+    x * 3333 + 
+    x * 3334 + 
+    x * 3335 + 
+    x * 3336 + 
+    x * 3337 + 
+    x * 3338 + 
+    x * 3339 + 
+    x * 3340 + 
+    x * 3341 + 
+    x * 3342 + 
+    x * 3343 + 
+    x * 3344 + 
+    x * 3345 + 
+    x * 3346 + 
+    x * 3347 + 
+    x * 3348 + 
+    x * 3349 + 
+    x * 3350 + 
+    x * 3351 + 
+    x * 3352 + 
+    x * 3353 + 
+    x * 3354 + 
+    x * 3355 + 
+    x * 3356 + 
+    x * 3357 + 
+    x * 3358 + 
+    x * 3359 + 
+    x * 3360 + 
+    x * 3361 + 
+    x * 3362 + 
+    x * 3363 + 
+    x * 3364 + 
+    x * 3365 + 
+    x * 3366 + 
+    x * 3367 + 
+    x * 3368 + 
+    x * 3369 + 
+    x * 3370 + 
+    x * 3371 + 
+    x * 3372 + 
+    x * 3373 + 
+    x * 3374 + 
+    x * 3375 + 
+    x * 3376 + 
+    x * 3377 + 
+    x * 3378 + 
+    x * 3379 + 
+    x * 3380 + 
+    x * 3381 + 
+    x * 3382 + 
+    x * 3383 + 
+    x * 3384 + 
+    x * 3385 + 
+    x * 3386 + 
+    x * 3387 + 
+    x * 3388 + 
+    x * 3389 + 
+    x * 3390 + 
+    x * 3391 + 
+    x * 3392 + 
+    x * 3393 + 
+    x * 3394 + 
+    x * 3395 + 
+    x * 3396 + 
+    x * 3397 + 
+    x * 3398 + 
+    x * 3399 + 
+    x * 3400 + 
+    x * 3401 + 
+    x * 3402 + 
+    x * 3403 + 
+    x * 3404 + 
+    x * 3405 + 
+    x * 3406 + 
+    x * 3407 + 
+    x * 3408 + 
+    x * 3409 + 
+    x * 3410 + 
+    x * 3411 + 
+    x * 3412 + 
+    x * 3413 + 
+    x * 3414 + 
+    x * 3415 + 
+    x * 3416 + 
+    x * 3417 + 
+    x * 3418 + 
+    x * 3419 + 
+    x * 3420 + 
+    x * 3421 + 
+    x * 3422 + 
+    x * 3423 + 
+    x * 3424 + 
+    x * 3425 + 
+    x * 3426 + 
+    x * 3427 + 
+    x * 3428 + 
+    x * 3429 + 
+    x * 3430 + 
+    x * 3431 + 
+    x * 3432 + 
+    x * 3433 + 
+    x * 3434 + 
+    x * 3435 + 
+    x * 3436 + 
+    x * 3437 + 
+    x * 3438 + 
+    x * 3439 + 
+    x * 3440 + 
+    x * 3441 + 
+    x * 3442 + 
+    x * 3443 + 
+    x * 3444 + 
+    x * 3445 + 
+    x * 3446 + 
+    x * 3447 + 
+    x * 3448 + 
+    x * 3449 + 
+    x * 3450 + 
+    x * 3451 + 
+    x * 3452 + 
+    x * 3453 + 
+    x * 3454 + 
+    x * 3455 + 
+    x * 3456 + 
+    x * 3457 + 
+    x * 3458 + 
+    x * 3459 + 
+    x * 3460 + 
+    x * 3461 + 
+    x * 3462 + 
+    x * 3463 + 
+    x * 3464 + 
+    x * 3465 + 
+    x * 3466 + 
+    x * 3467 + 
+    x * 3468 + 
+    x * 3469 + 
+    x * 3470 + 
+    x * 3471 + 
+    x * 3472 + 
+    x * 3473 + 
+    x * 3474 + 
+    x * 3475 + 
+    x * 3476 + 
+    x * 3477 + 
+    x * 3478 + 
+    x * 3479 + 
+    x * 3480 + 
+    x * 3481 + 
+    x * 3482 + 
+    x * 3483 + 
+    x * 3484 + 
+    x * 3485 + 
+    x * 3486 + 
+    x * 3487 + 
+    x * 3488 + 
+    x * 3489 + 
+    x * 3490 + 
+    x * 3491 + 
+    x * 3492 + 
+    x * 3493 + 
+    x * 3494 + 
+    x * 3495 + 
+    x * 3496 + 
+    x * 3497 + 
+    x * 3498 + 
+    x * 3499 + 
+    x * 3500 + 
+    x * 3501 + 
+    x * 3502 + 
+    x * 3503 + 
+    x * 3504 + 
+    x * 3505 + 
+    x * 3506 + 
+    x * 3507 + 
+    x * 3508 + 
+    x * 3509 + 
+    x * 3510 + 
+    x * 3511 + 
+    x * 3512 + 
+    x * 3513 + 
+    x * 3514 + 
+    x * 3515 + 
+    x * 3516 + 
+    x * 3517 + 
+    x * 3518 + 
+    x * 3519 + 
+    x * 3520 + 
+    x * 3521 + 
+    x * 3522 + 
+    x * 3523 + 
+    x * 3524 + 
+    x * 3525 + 
+    x * 3526 + 
+    x * 3527 + 
+    x * 3528 + 
+    x * 3529 + 
+    x * 3530 + 
+    x * 3531 + 
+    x * 3532 + 
+    x * 3533 + 
+    x * 3534 + 
+    x * 3535 + 
+    x * 3536 + 
+    x * 3537 + 
+    x * 3538 + 
+    x * 3539 + 
+    x * 3540 + 
+    x * 3541 + 
+    x * 3542 + 
+    x * 3543 + 
+    x * 3544 + 
+    x * 3545 + 
+    x * 3546 + 
+    x * 3547 + 
+    x * 3548 + 
+    x * 3549 + 
+    x * 3550 + 
+    x * 3551 + 
+    x * 3552 + 
+    x * 3553 + 
+    x * 3554 + 
+    x * 3555 + 
+    x * 3556 + 
+    x * 3557 + 
+    x * 3558 + 
+    x * 3559 + 
+    x * 3560 + 
+    x * 3561 + 
+    x * 3562 + 
+    x * 3563 + 
+    x * 3564 + 
+    x * 3565 + 
+    x * 3566 + 
+    x * 3567 + 
+    x * 3568 + 
+    x * 3569 + 
+    x * 3570 + 
+    x * 3571 + 
+    x * 3572 + 
+    x * 3573 + 
+    x * 3574 + 
+    x * 3575 + 
+    x * 3576 + 
+    x * 3577 + 
+    x * 3578 + 
+    x * 3579 + 
+    x * 3580 + 
+    x * 3581 + 
+    x * 3582 + 
+    x * 3583 + 
+    x * 3584 + 
+    x * 3585 + 
+    x * 3586 + 
+    x * 3587 + 
+    x * 3588 + 
+    x * 3589 + 
+    x * 3590 + 
+    x * 3591 + 
+    x * 3592 + 
+    x * 3593 + 
+    x * 3594 + 
+    x * 3595 + 
+    x * 3596 + 
+    x * 3597 + 
+    x * 3598 + 
+    x * 3599 + 
+    x * 3600 + 
+    x * 3601 + 
+    x * 3602 + 
+    x * 3603 + 
+    x * 3604 + 
+    x * 3605 + 
+    x * 3606 + 
+    x * 3607 + 
+    x * 3608 + 
+    x * 3609 + 
+    x * 3610 + 
+    x * 3611 + 
+    x * 3612 + 
+    x * 3613 + 
+    x * 3614 + 
+    x * 3615 + 
+    x * 3616 + 
+    x * 3617 + 
+    x * 3618 + 
+    x * 3619 + 
+    x * 3620 + 
+    x * 3621 + 
+    x * 3622 + 
+    x * 3623 + 
+    x * 3624 + 
+    x * 3625 + 
+    x * 3626 + 
+    x * 3627 + 
+    x * 3628 + 
+    x * 3629 + 
+    x * 3630 + 
+    x * 3631 + 
+    x * 3632 + 
+    x * 3633 + 
+    x * 3634 + 
+    x * 3635 + 
+    x * 3636 + 
+    x * 3637 + 
+    x * 3638 + 
+    x * 3639 + 
+    x * 3640 + 
+    x * 3641 + 
+    x * 3642 + 
+    x * 3643 + 
+    x * 3644 + 
+    x * 3645 + 
+    x * 3646 + 
+    x * 3647 + 
+    x * 3648 + 
+    x * 3649 + 
+    x * 3650 + 
+    x * 3651 + 
+    x * 3652 + 
+    x * 3653 + 
+    x * 3654 + 
+    x * 3655 + 
+    x * 3656 + 
+    x * 3657 + 
+    x * 3658 + 
+    x * 3659 + 
+    x * 3660 + 
+    x * 3661 + 
+    x * 3662 + 
+    x * 3663 + 
+    x * 3664 + 
+    x * 3665 + 
+    x * 3666 + 
+    x * 3667 + 
+    x * 3668 + 
+    x * 3669 + 
+    x * 3670 + 
+    x * 3671 + 
+    x * 3672 + 
+    x * 3673 + 
+    x * 3674 + 
+    x * 3675 + 
+    x * 3676 + 
+    x * 3677 + 
+    x * 3678 + 
+    x * 3679 + 
+    x * 3680 + 
+    x * 3681 + 
+    x * 3682 + 
+    x * 3683 + 
+    x * 3684 + 
+    x * 3685 + 
+    x * 3686 + 
+    x * 3687 + 
+    x * 3688 + 
+    x * 3689 + 
+    x * 3690 + 
+    x * 3691 + 
+    x * 3692 + 
+    x * 3693 + 
+    x * 3694 + 
+    x * 3695 + 
+    x * 3696 + 
+    x * 3697 + 
+    x * 3698 + 
+    x * 3699 + 
+    x * 3700 + 
+    x * 3701 + 
+    x * 3702 + 
+    x * 3703 + 
+    x * 3704 + 
+    x * 3705 + 
+    x * 3706 + 
+    x * 3707 + 
+    x * 3708 + 
+    x * 3709 + 
+    x * 3710 + 
+    x * 3711 + 
+    x * 3712 + 
+    x * 3713 + 
+    x * 3714 + 
+    x * 3715 + 
+    x * 3716 + 
+    x * 3717 + 
+    x * 3718 + 
+    x * 3719 + 
+    x * 3720 + 
+    x * 3721 + 
+    x * 3722 + 
+    x * 3723 + 
+    x * 3724 + 
+    x * 3725 + 
+    x * 3726 + 
+    x * 3727 + 
+    x * 3728 + 
+    x * 3729 + 
+    x * 3730 + 
+    x * 3731 + 
+    x * 3732 + 
+    x * 3733 + 
+    x * 3734 + 
+    x * 3735 + 
+    x * 3736 + 
+    x * 3737 + 
+    x * 3738 + 
+    x * 3739 + 
+    x * 3740 + 
+    x * 3741 + 
+    x * 3742 + 
+    x * 3743 + 
+    x * 3744 + 
+    x * 3745 + 
+    x * 3746 + 
+    x * 3747 + 
+    x * 3748 + 
+    x * 3749 + 
+    x * 3750 + 
+    x * 3751 + 
+    x * 3752 + 
+    x * 3753 + 
+    x * 3754 + 
+    x * 3755 + 
+    x * 3756 + 
+    x * 3757 + 
+    x * 3758 + 
+    x * 3759 + 
+    x * 3760 + 
+    x * 3761 + 
+    x * 3762 + 
+    x * 3763 + 
+    x * 3764 + 
+    x * 3765 + 
+    x * 3766 + 
+    x * 3767 + 
+    x * 3768 + 
+    x * 3769 + 
+    x * 3770 + 
+    x * 3771 + 
+    x * 3772 + 
+    x * 3773 + 
+    x * 3774 + 
+    x * 3775 + 
+    x * 3776 + 
+    x * 3777 + 
+    x * 3778 + 
+    x * 3779 + 
+    x * 3780 + 
+    x * 3781 + 
+    x * 3782 + 
+    x * 3783 + 
+    x * 3784 + 
+    x * 3785 + 
+    x * 3786 + 
+    x * 3787 + 
+    x * 3788 + 
+    x * 3789 + 
+    x * 3790 + 
+    x * 3791 + 
+    x * 3792 + 
+    x * 3793 + 
+    x * 3794 + 
+    x * 3795 + 
+    x * 3796 + 
+    x * 3797 + 
+    x * 3798 + 
+    x * 3799 + 
+    x * 3800 + 
+    x * 3801 + 
+    x * 3802 + 
+    x * 3803 + 
+    x * 3804 + 
+    x * 3805 + 
+    x * 3806 + 
+    x * 3807 + 
+    x * 3808 + 
+    x * 3809 + 
+    x * 3810 + 
+    x * 3811 + 
+    x * 3812 + 
+    x * 3813 + 
+    x * 3814 + 
+    x * 3815 + 
+    x * 3816 + 
+    x * 3817 + 
+    x * 3818 + 
+    x * 3819 + 
+    x * 3820 + 
+    x * 3821 + 
+    x * 3822 + 
+    x * 3823 + 
+    x * 3824 + 
+    x * 3825 + 
+    x * 3826 + 
+    x * 3827 + 
+    x * 3828 + 
+    x * 3829 + 
+    x * 3830 + 
+    x * 3831 + 
+    x * 3832 + 
+    x * 3833 + 
+    x * 3834 + 
+    x * 3835 + 
+    x * 3836 + 
+    x * 3837 + 
+    x * 3838 + 
+    x * 3839 + 
+    x * 3840 + 
+    x * 3841 + 
+    x * 3842 + 
+    x * 3843 + 
+    x * 3844 + 
+    x * 3845 + 
+    x * 3846 + 
+    x * 3847 + 
+    x * 3848 + 
+    x * 3849 + 
+    x * 3850 + 
+    x * 3851 + 
+    x * 3852 + 
+    x * 3853 + 
+    x * 3854 + 
+    x * 3855 + 
+    x * 3856 + 
+    x * 3857 + 
+    x * 3858 + 
+    x * 3859 + 
+    x * 3860 + 
+    x * 3861 + 
+    x * 3862 + 
+    x * 3863 + 
+    x * 3864 + 
+    x * 3865 + 
+    x * 3866 + 
+    x * 3867 + 
+    x * 3868 + 
+    x * 3869 + 
+    x * 3870 + 
+    x * 3871 + 
+    x * 3872 + 
+    x * 3873 + 
+    x * 3874 + 
+    x * 3875 + 
+    x * 3876 + 
+    x * 3877 + 
+    x * 3878 + 
+    x * 3879 + 
+    x * 3880 + 
+    x * 3881 + 
+    x * 3882 + 
+    x * 3883 + 
+    x * 3884 + 
+    x * 3885 + 
+    x * 3886 + 
+    x * 3887 + 
+    x * 3888 + 
+    x * 3889 + 
+    x * 3890 + 
+    x * 3891 + 
+    x * 3892 + 
+    x * 3893 + 
+    x * 3894 + 
+    x * 3895 + 
+    x * 3896 + 
+    x * 3897 + 
+    x * 3898 + 
+    x * 3899 + 
+    x * 3900 + 
+    x * 3901 + 
+    x * 3902 + 
+    x * 3903 + 
+    x * 3904 + 
+    x * 3905 + 
+    x * 3906 + 
+    x * 3907 + 
+    x * 3908 + 
+    x * 3909 + 
+    x * 3910 + 
+    x * 3911 + 
+    x * 3912 + 
+    x * 3913 + 
+    x * 3914 + 
+    x * 3915 + 
+    x * 3916 + 
+    x * 3917 + 
+    x * 3918 + 
+    x * 3919 + 
+    x * 3920 + 
+    x * 3921 + 
+    x * 3922 + 
+    x * 3923 + 
+    x * 3924 + 
+    x * 3925 + 
+    x * 3926 + 
+    x * 3927 + 
+    x * 3928 + 
+    x * 3929 + 
+    x * 3930 + 
+    x * 3931 + 
+    x * 3932 + 
+    x * 3933 + 
+    x * 3934 + 
+    x * 3935 + 
+    x * 3936 + 
+    x * 3937 + 
+    x * 3938 + 
+    x * 3939 + 
+    x * 3940 + 
+    x * 3941 + 
+    x * 3942 + 
+    x * 3943 + 
+    x * 3944 + 
+    x * 3945 + 
+    x * 3946 + 
+    x * 3947 + 
+    x * 3948 + 
+    x * 3949 + 
+    x * 3950 + 
+    x * 3951 + 
+    x * 3952 + 
+    x * 3953 + 
+    x * 3954 + 
+    x * 3955 + 
+    x * 3956 + 
+    x * 3957 + 
+    x * 3958 + 
+    x * 3959 + 
+    x * 3960 + 
+    x * 3961 + 
+    x * 3962 + 
+    x * 3963 + 
+    x * 3964 + 
+    x * 3965 + 
+    x * 3966 + 
+    x * 3967 + 
+    x * 3968 + 
+    x * 3969 + 
+    x * 3970 + 
+    x * 3971 + 
+    x * 3972 + 
+    x * 3973 + 
+    x * 3974 + 
+    x * 3975 + 
+    x * 3976 + 
+    x * 3977 + 
+    x * 3978 + 
+    x * 3979 + 
+    x * 3980 + 
+    x * 3981 + 
+    x * 3982 + 
+    x * 3983 + 
+    x * 3984 + 
+    x * 3985 + 
+    x * 3986 + 
+    x * 3987 + 
+    x * 3988 + 
+    x * 3989 + 
+    x * 3990 + 
+    x * 3991 + 
+    x * 3992 + 
+    x * 3993 + 
+    x * 3994 + 
+    x * 3995 + 
+    x * 3996 + 
+    x * 3997 + 
+    x * 3998 + 
+    x * 3999 + 
+    x;
+}
@@ -0,0 +1,2 @@
+#line 93654435769 "a.hlsl"
+float x;
@@ -0,0 +1,4 @@
+float x = 0;
+void foo() {
+  x. = 1;
+}
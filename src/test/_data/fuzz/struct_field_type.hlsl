@@ -0,0 +1,2 @@
+struct S { 1 a; };
+float y = (1);
@@ -0,0 +1,2 @@
+typedef unknown_t y;
+float z = (
@@ -0,0 +1,144 @@
+static const int _BLOOM_HQ = 1;
+static const int _USE_RGBM = 0;
+static const int _DISTORTION = 0;
+static const int _CHROMATIC_ABERRATION = 0;
+static const int _FILM_GRAIN = 0;
+static const int _DITHERING = 1;
+static const bool _LINEAR_TO_SRGB_CONVERSION = _DITHERING != 0 && !_USE_RGBM;
+
+struct Attributes
+{
+    float4 positionOS : POSITION;
+    float2 uv : TEXCOORD0;
+};
+
+struct Varyings
+{
+    float4 positionCS : SV_POSITION;
+    float2 texcoord : TEXCOORD0;
+};
+
+cbuffer UnityPerMaterial
+{
+    float4 _Lut_Params;
+    float4 _Bloom_Params;
+    float4 _Distortion_Params1;
+    float4 _Distortion_Params2;
+    float _Chroma_Params;
+    float2 _Grain_Params;
+    float4 _Grain_TilingParams;
+    float4 _Dithering_Params;
+};
+
+Texture2D _BlitTexture;
+Texture2D _Bloom_Texture;
+Texture2D _Grain_Texture;
+Texture2D _BlueNoise_Texture;
+SamplerState sampler_LinearClamp;
+SamplerState sampler_PointRepeat;
+
+half4 EncodeRGBM(half3 color)
+{
+    color *= 1.0 / 8.0;
+    half m = max(max(color.x, color.y), max(color.z, 1e-5));
+    m = ceil(m * 255) / 255;
+    return half4(color / m, m);
+}
+
+half3 DecodeRGBM(half4 data)
+{
+    return data.xyz * data.w * 8.0;
+}
+
+half3 SampleBloom(float2 uv)
+{
+    half4 bloom;
+    if (_BLOOM_HQ)
+    {
+        bloom = _Bloom_Texture.Sample(sampler_LinearClamp, uv);
+    }
+    else
+    {
+        bloom = _Bloom_Texture.SampleLevel(sampler_LinearClamp, uv, 0);
+    }
+    if (_USE_RGBM)
+    {
+        return DecodeRGBM(bloom);
+    }
+    return bloom.xyz;
+}
+
+float2 DistortUV(float2 uv)
+{
+    uv = (uv - 0.5) * _Distortion_Params2.z + 0.5;
+    float2 ruv = _Distortion_Params1.zw * (uv - 0.5 - _Distortion_Params1.xy);
+    float ru = length(float2(ruv));
+    float wu = ru * _Distortion_Params2.y;
+    ru = tan(wu) * (1.0 / (ru * _Distortion_Params2.x));
+    return uv + ruv * (ru - 1.0);
+}
+
+half3 ApplyGrain(half3 input, float2 uv)
+{
+    half grain = _Grain_Texture.Sample(sampler_PointRepeat, uv * _Grain_TilingParams.xy + _Grain_TilingParams.zw).w;
+    grain = (grain - 0.5) * 2.0;
+    half lum = 1.0 - sqrt(dot(input, half3(0.2126729, 0.7151522, 0.0721750)));
+    return input + input * grain * _Grain_Params.x * lerp(1.0, lum, _Grain_Params.y);
+}
+
+half3 ApplyDithering(half3 input, float2 uv)
+{
+    half noise = _BlueNoise_Texture.Sample(sampler_PointRepeat, uv * _Dithering_Params.xy + _Dithering_Params.zw).w;
+    noise = noise * 2.0 - 1.0;
+    return input + noise / 255.0;
+}
+
+half3 LinearToSRGB(half3 c)
+{
+    return pow(abs(c), 1.0 / 2.2);
+}
+
+Varyings Vert(Attributes input)
+{
+    Varyings output;
+    output.positionCS = input.positionOS;
+    output.texcoord = input.uv;
+    return output;
+}
+
+half4 FragUberPost(Varyings input) : SV_Target
+{
+    float2 uv = input.texcoord;
+    float2 uvDistorted = _DISTORTION ? DistortUV(uv) : uv;
+    half3 color = _BlitTexture.Sample(sampler_LinearClamp, uvDistorted).xyz;
+
+    float2 end = uv - uvDistorted;
+    float2 delta = end / 3.0 * _Chroma_Params;
+    if (_CHROMATIC_ABERRATION)
+    {
+        half r = _BlitTexture.Sample(sampler_LinearClamp, uvDistorted).x;
+        half g = _BlitTexture.Sample(sampler_LinearClamp, DistortUV(delta + uv)).y;
+        half b = _BlitTexture.Sample(sampler_LinearClamp, DistortUV(delta * 2.0 + uv)).z;
+        color = half3(r, g, b);
+    }
+
+    half3 bloom = SampleBloom(uvDistorted);
+    bloom *= _Bloom_Params.x;
+    color += bloom * _Bloom_Params.yzw;
+
+    half lutScale = _Lut_Params.x;
+    half lutOffset = lutScale * 0.5;
+    if (_FILM_GRAIN)
+    {
+        color = ApplyGrain(color, uv);
+    }
+    if (_LINEAR_TO_SRGB_CONVERSION)
+    {
+        color = LinearToSRGB(color);
+    }
+    if (_DITHERING)
+    {
+        color = ApplyDithering(color, uv);
+    }
+    return half4(color, 1.0);
+}
@@ -0,0 +1,147 @@
+#include "allocation_counter.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <cxxabi.h>
+#include <execinfo.h>
+#define HAS_BACKTRACE 1
+#else
+#define HAS_BACKTRACE 0
+#endif
+
+namespace {
+
+thread_local AllocationCounter* activeCounter = nullptr;
+// Set while recording an allocation, so allocations made by the recording aren't counted.
+thread_local bool inCounter = false;
+
+#if HAS_BACKTRACE
+// Demangle the function name of a glibc backtrace symbol, "binary(function+offset) [address]".
+// Other formats are returned as they are.
+std::string demangle(const char* symbol) {
+  const char* begin = strchr(symbol, '(');
+  const char* end = begin != nullptr ? strchr(begin, '+') : nullptr;
+  if (end == nullptr || end == begin + 1) {
+    return symbol;
+  }
+  const std::string name(begin + 1, end);
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+  if (demangled == nullptr) {
+    return symbol;
+  }
+  const std::string result = demangled;
+  free(demangled);
+  return result;
+}
+#endif
+
+} // namespace
+
+void* operator new(size_t size) {
+  if (activeCounter != nullptr && !inCounter) {
+    AllocationCounter::onAllocation();
+  }
+  void* p = malloc(size == 0 ? 1 : size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  free(p);
+}
+
+AllocationCounter::AllocationCounter(bool recordCallSites)
+  : _previous(activeCounter)
+  , _recordCallSites(recordCallSites && HAS_BACKTRACE)
+  , _frames(nullptr) {
+  if (_recordCallSites) {
+    _frames = static_cast<void* (*)[maxFrames]>(calloc(maxRecorded, sizeof(*_frames)));
+  }
+  activeCounter = this;
+}
+
+AllocationCounter::~AllocationCounter() {
+  activeCounter = _previous;
+  free(_frames);
+}
+
+void AllocationCounter::onAllocation() {
+  AllocationCounter* counter = activeCounter;
+  counter->_count++;
+#if HAS_BACKTRACE
+  if (counter->_recordCallSites && counter->_numRecorded < maxRecorded) {
+    inCounter = true;
+    void* frames[maxFrames + 2];
+    const int numFrames = backtrace(frames, maxFrames + 2);
+    // Skip onAllocation and operator new.
+    for (int i = 2; i < numFrames; ++i) {
+      counter->_frames[counter->_numRecorded][i - 2] = frames[i];
+    }
+    counter->_numRecorded++;
+    inCounter = false;
+  }
+#endif
+}
+
+void AllocationCounter::printCallSites(std::ostream& out, size_t maxCallSites) const {
+#if HAS_BACKTRACE
+  inCounter = true;
+  // Group identical call stacks.
+  std::map<std::vector<void*>, size_t> callSites;
+  for (size_t i = 0; i < _numRecorded; ++i) {
+    std::vector<void*> frames;
+    for (size_t f = 0; f < maxFrames && _frames[i][f] != nullptr; ++f) {
+      frames.push_back(_frames[i][f]);
+    }
+    callSites[frames]++;
+  }
+
+  std::multimap<size_t, const std::vector<void*>*, std::greater<size_t>> sorted;
+  for (const auto& it : callSites) {
+    sorted.emplace(it.second, &it.first);
+  }
+
+  out << _count << " allocations, " << _numRecorded << " recorded" << std::endl;
+  size_t numPrinted = 0;
+  for (const auto& it : sorted) {
+    if (numPrinted++ == maxCallSites) {
+      break;
+    }
+    out << it.first << " allocations from:" << std::endl;
+    const std::vector<void*>& frames = *it.second;
+    char** symbols = backtrace_symbols(frames.data(), static_cast<int>(frames.size()));
+    for (size_t f = 0; f < frames.size(); ++f) {
+      out << "    " << (symbols != nullptr ? demangle(symbols[f]) : "?") << std::endl;
+    }
+    free(symbols);
+  }
+  inCounter = false;
+#else
+  out << _count << " allocations, call sites aren't available on this platform" << std::endl;
+#endif
+}
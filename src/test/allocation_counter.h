@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+/// Counts the heap allocations made through operator new on the calling thread while it's in
+/// scope, for tests that check a hot loop doesn't allocate. The test target replaces the global
+/// operator new to do the counting. Memory taken directly with malloc, such as Ast node pages,
+/// isn't counted.
+class AllocationCounter {
+public:
+  /// Start counting.
+  /// @param recordCallSites Record the call stack of each allocation, up to a limit, so
+  /// printCallSites() can report where they came from. Call stacks are only available with
+  /// glibc and on macOS.
+  explicit AllocationCounter(bool recordCallSites = false);
+
+  ~AllocationCounter();
+
+  /// The number of allocations counted so far.
+  size_t count() const { return _count; }
+
+  /// Print the most frequent call stacks of the allocations counted.
+  void printCallSites(std::ostream& out, size_t maxCallSites = 8) const;
+
+  // Called by operator new.
+  static void onAllocation();
+
+private:
+  static const size_t maxRecorded = 4096;
+  static const size_t maxFrames = 16;
+
+  AllocationCounter* _previous;
+  bool _recordCallSites;
+  size_t _count = 0;
+  size_t _numRecorded = 0;
+  // The recorded call stacks. Fixed size, so recording doesn't allocate.
+  void* (*_frames)[maxFrames];
+};
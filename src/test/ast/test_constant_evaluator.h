@@ -0,0 +1,158 @@
+#pragma once
+
+#include <string>
+
+#include "../../lib/ast/constant_evaluator.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/resolve_symbols.h"
+#include "../test.h"
+
+using namespace reader::hlsl;
+
+namespace constant_evaluator_tests {
+
+inline ast::ConstantValue valueOf(ast::Ast* ast, const char* name) {
+  return ast::ConstantEvaluator(ast).evaluateVariable(ast->findGlobalVariable(name));
+}
+
+static Test test_constant_evaluator("Constant Evaluator", []() {
+  Parser parser(R"(
+    static const int A = 3;
+    static const int B = A * 4 + 1;
+    static const uint U = 0xFFFFFFFFu;
+    static const uint WRAP = U + 2;
+    static const int NEG = -A << 2;
+    static const float F = B / 2.0;
+    static const int TRUNC = (int)F;
+    static const bool FLAG = B > 10 && !(A == 4);
+    static const int CHOSEN = FLAG ? 7 : runtimeValue;
+    static const float3 V = float3(1, 2, A) * 2;
+    static const float4 W = float4(V, 1);
+    static const float2 T = (float2)V;
+    static const bool3 CMP = V > 3;
+    static const float3 SEL = CMP ? V : 0;
+    static const int3 I3 = {1, 2, 3};
+    static const half H = 1.5h;
+    static const uint HEX = 0x10 | 010;
+    const float UNIFORM = 1;
+    static const int DIVIDE = A / 0;
+    static const float3x3 M = float3x3(1, 0, 0, 0, 1, 0, 0, 0, 1);
+    float runtimeValue;
+    int Scale() {
+      const int k = A + 1;
+      return k * 2;
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  visitor::ResolveSymbols(ast).resolve();
+
+  TEST_EQUALS(valueOf(ast, "B").asInt(), 13);
+  TEST_TRUE(valueOf(ast, "WRAP").type == ast::BaseType::Uint);
+  TEST_EQUALS(valueOf(ast, "WRAP").asUint(), 1u);
+  TEST_EQUALS(valueOf(ast, "NEG").asInt(), -12);
+  TEST_EQUALS(valueOf(ast, "F").asFloat(), 6.5f);
+  TEST_EQUALS(valueOf(ast, "TRUNC").asInt(), 6);
+  TEST_TRUE(valueOf(ast, "FLAG").asBool());
+  // Only the value a ternary chooses needs to be constant.
+  TEST_EQUALS(valueOf(ast, "CHOSEN").asInt(), 7);
+  TEST_EQUALS(valueOf(ast, "HEX").asUint(), 24u);
+
+  const ast::ConstantValue v = valueOf(ast, "V");
+  TEST_TRUE(v.baseType() == ast::BaseType::Float3);
+  TEST_EQUALS(v.asFloat(2), 6.0f);
+  const ast::ConstantValue w = valueOf(ast, "W");
+  TEST_EQUALS(w.size, 4u);
+  TEST_EQUALS(w.asFloat(1), 4.0f);
+  TEST_EQUALS(w.asFloat(3), 1.0f);
+  TEST_EQUALS(valueOf(ast, "T").size, 2u);
+  const ast::ConstantValue cmp = valueOf(ast, "CMP");
+  TEST_TRUE(cmp.baseType() == ast::BaseType::Bool3);
+  TEST_FALSE(cmp.asBool(0));
+  TEST_TRUE(cmp.asBool(1));
+  const ast::ConstantValue sel = valueOf(ast, "SEL");
+  TEST_EQUALS(sel.asFloat(0), 0.0f);
+  TEST_EQUALS(sel.asFloat(1), 4.0f);
+  TEST_TRUE(valueOf(ast, "I3").baseType() == ast::BaseType::Int3);
+  TEST_TRUE(valueOf(ast, "H").type == ast::BaseType::Half);
+
+  // A const global that isn't static is a uniform, so its value isn't known.
+  TEST_FALSE(valueOf(ast, "UNIFORM").isConstant());
+  TEST_FALSE(valueOf(ast, "DIVIDE").isConstant());
+  TEST_FALSE(valueOf(ast, "M").isConstant());
+
+  // A local const is constant, and the values are cached on the expressions.
+  ast::Statement* stmt = ast->findFunction("Scale")->body->statements->next;
+  ast::Expression* returned = static_cast<ast::ReturnStmt*>(stmt)->value;
+  ast::ConstantEvaluator evaluator(ast);
+  const ast::ConstantValue& value = evaluator.evaluate(returned);
+  TEST_EQUALS(value.asInt(), 8);
+  TEST_TRUE(returned->constant == &value);
+  TEST_TRUE(&evaluator.evaluate(returned) == &value);
+
+  delete ast;
+});
+
+static Test test_constant_evaluator_depth("Constant Evaluator nesting depth", []() {
+  // A chain of operators deeper than the evaluator recurses isn't constant, rather than
+  // overflowing the stack, and one that fits is.
+  std::string deep = "static const int DEEP = 1";
+  for (int i = 0; i < ast::ConstantEvaluator::maxDepth + 10; ++i) {
+    deep += " + 1";
+  }
+  deep += "; static const int SHALLOW = 1 + 1 + 1;";
+  Parser parser(deep);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  visitor::ResolveSymbols(ast).resolve();
+
+  TEST_FALSE(valueOf(ast, "DEEP").isConstant());
+  // The expressions too deep to evaluate aren't cached as not constant.
+  TEST_TRUE(ast->findGlobalVariable("DEEP")->initializer->constant == nullptr);
+  TEST_EQUALS(valueOf(ast, "SHALLOW").asInt(), 3);
+
+  delete ast;
+});
+
+static Test test_constant_array_sizes("Constant Evaluator array sizes", []() {
+  Parser parser(R"(
+    static const int N = 4;
+    const int G = 2;
+    float a[N * 2];
+    float b[N][N];
+    float g[G];
+    cbuffer Params { float4 c[N + 1]; };
+    float d[] = { 1, 2 };
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  // The sizes are evaluated while parsing, and cached on the expressions.
+  ast::VariableStmt* a = ast->findGlobalVariable("a");
+  TEST_NOT_NULL(a->arraySize->constant);
+  TEST_EQUALS(a->arraySize->constant->asInt(), 8);
+  ast::VariableStmt* b = ast->findGlobalVariable("b");
+  TEST_EQUALS(b->arraySize->constant->asInt(), 4);
+  TEST_EQUALS(b->arraySize->next->constant->asInt(), 4);
+  TEST_TRUE(b->arraySize->next->next == nullptr);
+  TEST_EQUALS(ast->findGlobalVariable("g")->arraySize->constant->asInt(), 2);
+  ast::VariableStmt* d = ast->findGlobalVariable("d");
+  TEST_TRUE(d->isArray);
+  TEST_TRUE(d->arraySize == nullptr);
+  delete ast;
+
+  const char* invalid[] = {
+    "float runtime; float a[runtime];",
+    "float a[1.5];",
+    "float a[0];",
+    "float a[unknown];",
+  };
+  for (const char* source : invalid) {
+    Parser invalidParser(source);
+    ast::Ast* invalidAst = invalidParser.parse();
+    TEST_TRUE(invalidParser.hasErrors());
+    delete invalidAst;
+  }
+});
+
+} // namespace constant_evaluator_tests
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../lib/ast/flat_ast.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+
+namespace flat_ast_tests {
+
+// Check the parent, child, sibling and subtree indices of every node agree with each other, and
+// that no node is included twice.
+inline void checkStructure(const ast::FlatAst& flat) {
+  TEST_FALSE(flat.empty());
+  TEST_TRUE(flat[0].nodeType == ast::NodeType::Root);
+  TEST_TRUE(flat[0].parent == ast::FlatNode::none);
+  TEST_EQUALS(size_t(flat[0].subtreeSize), flat.size());
+
+  std::set<const ast::Node*> nodes;
+  bool valid = true;
+  for (uint32_t i = 0; i < flat.size(); ++i) {
+    const ast::FlatNode& node = flat[i];
+    nodes.insert(node.node);
+    valid = valid && node.nodeType == node.node->nodeType;
+    if (i > 0) {
+      const ast::FlatNode& parent = flat[node.parent];
+      // The node must be inside its parent's subtree.
+      valid = valid && node.parent < i && i < node.parent + parent.subtreeSize;
+    }
+    // The children must fill the subtree exactly.
+    uint32_t size = 1;
+    for (uint32_t child = node.firstChild; child != ast::FlatNode::none;
+         child = flat[child].nextSibling) {
+      valid = valid && flat[child].parent == i && child == i + size;
+      size += flat[child].subtreeSize;
+    }
+    valid = valid && size == node.subtreeSize;
+  }
+  TEST_TRUE(valid);
+  TEST_EQUALS(nodes.size(), flat.size());
+}
+
+static Test test_flat_ast("Flat Ast", []() {
+  Parser parser(R"(
+    float x = 0, y = 1;
+    float add(float a, float b) {
+      return a + b;
+    }
+    float main(float c) {
+      return add(x, c) * add(y, 2);
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  ast::FlatAst flat(ast);
+  checkStructure(flat);
+
+  // The top-level statements are the children of the root, in order.
+  std::vector<ast::NodeType> statements;
+  for (uint32_t i = flat[0].firstChild; i != ast::FlatNode::none; i = flat[i].nextSibling) {
+    statements.push_back(flat[i].nodeType);
+  }
+  const std::vector<ast::NodeType> expected = { ast::NodeType::VariableStmt,
+      ast::NodeType::VariableStmt, ast::NodeType::FunctionStmt, ast::NodeType::FunctionStmt };
+  TEST_TRUE(statements == expected);
+
+  // The two variables share a Type, which belongs to the first.
+  size_t numTypes = 0;
+  flat.forEach(ast::NodeType::Type, [&](uint32_t) { numTypes++; });
+  TEST_EQUALS(numTypes, 6ull);
+
+  // Find the calls made by main by scanning its subtree.
+  uint32_t main = ast::FlatNode::none;
+  flat.forEach(ast::NodeType::FunctionStmt, [&](uint32_t i) {
+    if (static_cast<ast::FunctionStmt*>(flat[i].node)->name == "main") {
+      main = i;
+    }
+  });
+  TEST_TRUE(main != ast::FlatNode::none);
+  std::vector<std::string_view> calls;
+  std::vector<std::string_view> variables;
+  flat.forEachInSubtree(main, ast::NodeType::CallExpr, [&](uint32_t i) {
+    calls.push_back(static_cast<ast::CallExpr*>(flat[i].node)->name);
+  });
+  flat.forEachInSubtree(main, ast::NodeType::VariableExpr, [&](uint32_t i) {
+    variables.push_back(static_cast<ast::VariableExpr*>(flat[i].node)->name);
+  });
+  const std::vector<std::string_view> expectedCalls = { "add", "add" };
+  const std::vector<std::string_view> expectedVariables = { "x", "c", "y" };
+  TEST_TRUE(calls == expectedCalls);
+  TEST_TRUE(variables == expectedVariables);
+
+  delete ast;
+});
+
+static Test test_flat_ast_corpus("Flat Ast corpus", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  ast::FlatAst flat(ast);
+  checkStructure(flat);
+  // Nodes dropped when the parser backtracks are still counted by the Ast, but aren't reachable.
+  TEST_TRUE(flat.size() <= ast->numNodes());
+  TEST_TRUE(flat.size() > ast->numNodes() / 2);
+
+  // Flattening again reuses the storage and gives the same result.
+  const std::vector<ast::FlatNode> first = flat.nodes();
+  flat.flatten(ast);
+  TEST_EQUALS(flat.size(), first.size());
+  TEST_TRUE(flat[flat.size() - 1].node == first.back().node);
+
+  delete ast;
+});
+
+static Test test_flat_ast_long_chain("Flat Ast long binary chain", []() {
+  const size_t length = 200000;
+  std::string source = "float f(float a) { return a";
+  for (size_t i = 0; i < length; ++i) {
+    source += " + a";
+  }
+  source += "; }";
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ast::FlatAst flat(ast);
+  size_t numVariables = 0;
+  flat.forEach(ast::NodeType::VariableExpr, [&](uint32_t) { numVariables++; });
+  TEST_EQUALS(numVariables, length + 1);
+  delete ast;
+});
+
+} // namespace flat_ast_tests
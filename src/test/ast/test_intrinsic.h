@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../../lib/ast/intrinsic.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/resolve_symbols.h"
+#include "../test.h"
+
+using namespace reader::hlsl;
+
+namespace intrinsic_tests {
+
+static Test test_intrinsic_lookup("Intrinsic lookup", []() {
+  // Every intrinsic is found by its name, each in a slot of its own.
+  TEST_TRUE(ast::numIntrinsics > 100);
+  for (size_t i = 1; i < ast::numIntrinsics; ++i) {
+    const ast::Intrinsic intrinsic = static_cast<ast::Intrinsic>(i);
+    const ast::IntrinsicInfo& info = ast::intrinsicInfo(intrinsic);
+    TEST_TRUE(ast::findIntrinsic(info.name) == intrinsic);
+    TEST_TRUE(info.minArguments <= info.maxArguments);
+  }
+
+  TEST_TRUE(ast::findIntrinsic("lerp") == ast::Intrinsic::Lerp);
+  TEST_TRUE(ast::findIntrinsic("ddx_coarse") == ast::Intrinsic::DdxCoarse);
+  TEST_TRUE(ast::intrinsicInfo(ast::Intrinsic::Tex2D).returnType == ast::BaseType::Float4);
+  TEST_TRUE(ast::intrinsicInfo(ast::Intrinsic::SampleLevel).method);
+  TEST_EQUALS(ast::intrinsicInfo(ast::Intrinsic::Lerp).minArguments, 3);
+  TEST_TRUE(ast::findIntrinsic("") == ast::Intrinsic::None);
+  TEST_TRUE(ast::findIntrinsic("Lerp") == ast::Intrinsic::None);
+  TEST_TRUE(ast::findIntrinsic("lerp2") == ast::Intrinsic::None);
+  TEST_TRUE(ast::findIntrinsic("main") == ast::Intrinsic::None);
+});
+
+static Test test_intrinsic_parse("Intrinsic calls tagged by the parser", []() {
+  Parser parser(R"(
+    Texture2D tex;
+    SamplerState samp;
+    float3 Shade(float3 a, float3 b) { return lerp(a, b, 0.5); }
+    float4 main(float2 uv : TEXCOORD0) : SV_Target {
+      clip(uv.x);
+      return tex.SampleLevel(samp, uv, 0) * float4(Shade(1, 0), 1);
+    }
+  )");
+  parser.setIndexNodes(true);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  TEST_FALSE(ast->declaresIntrinsic());
+
+  ast::Intrinsic intrinsics[3] = {};
+  size_t numCalls = 0;
+  for (ast::Node* node : ast->nodesOfType(ast::NodeType::CallExpr)) {
+    if (numCalls < 3) {
+      intrinsics[numCalls] = static_cast<ast::CallExpr*>(node)->intrinsic;
+    }
+    numCalls++;
+  }
+  TEST_EQUALS(numCalls, 3ull);
+  TEST_TRUE(intrinsics[0] == ast::Intrinsic::Lerp);
+  TEST_TRUE(intrinsics[1] == ast::Intrinsic::SampleLevel);
+  TEST_TRUE(intrinsics[2] == ast::Intrinsic::None);
+  const std::vector<ast::Node*>& statements = ast->nodesOfType(ast::NodeType::CallStmt);
+  TEST_EQUALS(statements.size(), 1ull);
+  TEST_TRUE(static_cast<ast::CallStmt*>(statements[0])->intrinsic == ast::Intrinsic::Clip);
+  delete ast;
+
+  // A function with the name of an intrinsic is called instead of it.
+  Parser shadowed(R"(
+    float3 lerp(float3 a, float3 b, float t) { return a; }
+    float3 main(float3 a : COLOR) : SV_Target { return lerp(a, a, 0.5); }
+  )");
+  ast = shadowed.parse();
+  TEST_FALSE(shadowed.hasErrors());
+  TEST_TRUE(ast->declaresIntrinsic());
+  visitor::ResolveSymbols(ast).resolve();
+  ast::Statement* body = ast->findFunction("main")->body->statements;
+  ast::CallExpr* call = static_cast<ast::CallExpr*>(static_cast<ast::ReturnStmt*>(body)->value);
+  TEST_TRUE(call->intrinsic == ast::Intrinsic::Lerp);
+  TEST_TRUE(call->function == ast->findFunction("lerp"));
+  delete ast;
+});
+
+} // namespace intrinsic_tests
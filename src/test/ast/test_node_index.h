@@ -0,0 +1,170 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../lib/ast/flat_ast.h"
+#include "../../lib/reader/hlsl/parallel_parser.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+
+namespace node_index_tests {
+
+// Returns true if the nodes the Ast indexed are exactly the nodes in its tree, apart from the
+// root and the shared empty statement, which aren't indexed.
+inline bool indexMatchesTree(ast::Ast* ast) {
+  ast::FlatAst flat(ast);
+  for (size_t t = 0; t < ast::numNodeTypes; ++t) {
+    const ast::NodeType type = static_cast<ast::NodeType>(t);
+    if (type == ast::NodeType::Root || type == ast::NodeType::EmptyStmt) {
+      continue;
+    }
+    std::set<ast::Node*> tree;
+    flat.forEach(type, [&](uint32_t i) { tree.insert(flat[i].node); });
+    const std::vector<ast::Node*>& indexed = ast->nodesOfType(type);
+    const std::set<ast::Node*> indexedSet(indexed.begin(), indexed.end());
+    if (indexedSet != tree || indexed.size() != tree.size()) {
+      std::cout << "Index mismatch for " << ast::nodeTypeToString(type) << ": " << indexed.size()
+                << " indexed, " << tree.size() << " in the tree" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+inline std::vector<std::string_view> callNames(ast::Ast* ast, const std::string_view& function) {
+  std::vector<std::string_view> names;
+  for (ast::Node* call : ast->callsFrom(ast->findFunction(function))) {
+    if (call->nodeType == ast::NodeType::CallExpr) {
+      names.push_back(static_cast<ast::CallExpr*>(call)->name);
+    } else {
+      names.push_back(static_cast<ast::CallStmt*>(call)->name);
+    }
+  }
+  return names;
+}
+
+static const char* source = R"(
+  cbuffer Params { float4 color; float scale; };
+  float add(float a, float b) { return a + b; }
+  float twice(float a) { return add(a, a); }
+  float4 main(float4 p) : SV_Target {
+    float x = (float)p.x;
+    float y = (p.y) * scale;
+    if (x > 0) { x = twice(add(x, y)); }
+    return color * max(x, 0);
+  }
+)";
+
+static Test test_node_index("Ast node index", []() {
+  Parser parser(source);
+  parser.setIndexNodes(true);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  TEST_TRUE(ast->indexNodes());
+  TEST_TRUE(indexMatchesTree(ast));
+
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::FunctionStmt).size(), 3ull);
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::BufferStmt).size(), 1ull);
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::CallExpr).size(), 4ull);
+
+  TEST_TRUE(callNames(ast, "add").empty());
+  TEST_TRUE(callNames(ast, "twice") == std::vector<std::string_view>({ "add" }));
+  // Calls are recorded as they're created, which is before their arguments.
+  TEST_TRUE(callNames(ast, "main") == std::vector<std::string_view>({ "twice", "add", "max" }));
+  delete ast;
+});
+
+static Test test_node_index_disabled("Ast node index disabled", []() {
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(ast->indexNodes());
+  TEST_TRUE(ast->nodesOfType(ast::NodeType::CallExpr).empty());
+  TEST_TRUE(ast->callsFrom(ast->findFunction("main")).empty());
+  delete ast;
+});
+
+static Test test_node_index_errors("Ast node index errors", []() {
+  // The statements with errors are dropped, along with the calls in them.
+  Parser parser(R"(
+    float f(float a) { return a; }
+    float main(float a) {
+      float x = f(a) * (;
+      float y = f(f(a));
+      return f(y) ];
+    }
+    float g( { return f(1); }
+  )");
+  parser.setIndexNodes(true);
+  ast::Ast* ast = parser.parse();
+  TEST_TRUE(parser.hasErrors());
+  TEST_TRUE(indexMatchesTree(ast));
+  TEST_EQUALS(callNames(ast, "main").size(), 2ull);
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::FunctionStmt).size(), 2ull);
+  delete ast;
+});
+
+static Test test_node_index_declaration_lists("Ast node index declaration lists", []() {
+  // Every declaration of a list stays in the block or case body it's in, every case stays in its
+  // switch and attribute arguments stay with their attribute, so all of them are in the tree.
+  Parser parser(R"(
+    struct S { float x; float get() { return x; } } s;
+    [numthreads(8, 8, 1)]
+    float main(int i) {
+      float a = 1, b = 2, c = 3;
+      switch (i) {
+        case 0:
+          float d = 4, e = 5;
+          return d + e;
+        case 1:
+          return s.get();
+        default:
+          break;
+      }
+      return a + b + c;
+    }
+  )");
+  parser.setIndexNodes(true);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  TEST_TRUE(indexMatchesTree(ast));
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::VariableStmt).size(), 6ull);
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::SwitchCase).size(), 3ull);
+  // A method isn't also a field.
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::Field).size(), 1ull);
+  TEST_EQUALS(ast->nodesOfType(ast::NodeType::LiteralExpr).size(), 10ull);
+  delete ast;
+});
+
+static Test test_node_index_corpus("Ast node index corpus", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+
+  Parser parser(source);
+  parser.setIndexNodes(true);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  TEST_TRUE(indexMatchesTree(ast));
+
+  ParallelParser parallelParser(source, 4);
+  parallelParser.setIndexNodes(true);
+  ast::Ast* parallelAst = parallelParser.parse();
+  TEST_FALSE(parallelParser.hasErrors());
+  TEST_TRUE(indexMatchesTree(parallelAst));
+
+  // Both parsers record the same calls for each function.
+  bool sameCalls = true;
+  for (ast::Node* node : ast->nodesOfType(ast::NodeType::FunctionStmt)) {
+    const std::string_view name = static_cast<ast::FunctionStmt*>(node)->name;
+    sameCalls = sameCalls && callNames(ast, name) == callNames(parallelAst, name);
+  }
+  TEST_TRUE(sameCalls);
+
+  delete parallelAst;
+  delete ast;
+});
+
+} // namespace node_index_tests
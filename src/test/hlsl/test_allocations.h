@@ -0,0 +1,100 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/prune_tree.h"
+#include "../allocation_counter.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+
+namespace allocation_tests {
+
+// A token allocating would be at least one allocation per token, so allowing one per this many
+// tokens leaves room for the per-declaration allocations of the Ast's lookup tables, while
+// catching any allocation in the scanner or parser's per-token loop.
+const size_t tokensPerAllocation = 16;
+
+inline size_t countTokens(const std::string& source) {
+  return Scanner(source).scan().size();
+}
+
+// Check the allocations counted are within the budget, printing where they came from if not.
+inline void checkBudget(const AllocationCounter& counter, size_t budget, const char* stage) {
+  TEST_TRUE(counter.count() <= budget);
+  if (counter.count() > budget) {
+    std::cout << "Steady-state " << stage << " allocated more than " << budget << " times"
+              << std::endl;
+    counter.printCallSites(std::cout);
+  }
+}
+
+// Parse and prune the source twice, checking the second time stays within the allocation budget.
+// The first time warms up anything initialized on first use. Parsing and pruning each have the
+// budget, as pruning resolves the symbols, which allocates for each declaration too.
+inline void testSteadyStateParse(const std::string& source, const char* entryPoint) {
+  const size_t budget = countTokens(source) / tokensPerAllocation;
+  for (int pass = 0; pass < 2; ++pass) {
+    ast::Ast* ast = nullptr;
+    {
+      AllocationCounter counter(pass == 1);
+      Parser parser(source);
+      ast = parser.parse();
+      TEST_FALSE(parser.hasErrors());
+      if (pass == 1) {
+        checkBudget(counter, budget, "parse");
+      }
+    }
+    {
+      AllocationCounter counter(pass == 1);
+      visitor::PruneTree(ast).prune(entryPoint);
+      if (pass == 1) {
+        checkBudget(counter, budget, "prune");
+      }
+    }
+    delete ast;
+  }
+}
+
+// Allocate once through operator new. A new-expression whose result isn't used may be removed
+// by the optimizer, but a call of operator new through a volatile pointer can't be.
+inline void allocateOnce() {
+  void* volatile p = ::operator new(16);
+  ::operator delete(p);
+}
+
+static Test test_allocation_counter("AllocationCounter", []() {
+  AllocationCounter counter;
+  {
+    AllocationCounter inner;
+    allocateOnce();
+    TEST_EQUALS(inner.count(), 1ull);
+  }
+  allocateOnce();
+  TEST_EQUALS(counter.count(), 1ull);
+});
+
+static Test test_steady_state_scan("Scanner steady-state allocations", []() {
+  const std::string source = loadFile(TEST_DATA_PATH("/hlsl/urp_bloom.hlsl"));
+  const size_t budget = countTokens(source) / tokensPerAllocation;
+  Scanner scanner(source);
+  scanner.scanNext();
+  // Streaming reuses the token buffer, only directives such as #define allocate.
+  AllocationCounter counter(true);
+  while (scanner.scanNext().type() != TokenType::EndOfFile) {
+  }
+  TEST_TRUE(counter.count() <= budget);
+  if (counter.count() > budget) {
+    counter.printCallSites(std::cout);
+  }
+});
+
+static Test test_steady_state_parse("Parser steady-state allocations", []() {
+  testSteadyStateParse(loadFile(TEST_DATA_PATH("/hlsl/urp_bloom.hlsl")),
+                       "FragPrefilter");
+});
+
+} // namespace allocation_tests
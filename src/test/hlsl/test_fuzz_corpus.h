@@ -0,0 +1,39 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "../../fuzz/fuzz_pipeline.h"
+#include "../test.h"
+#include "../test_util.h"
+
+namespace fuzz_corpus_tests {
+
+// The time each corpus input may take to go through the pipeline. The inputs are small, so this
+// only fails if one of them hits something quadratic or worse, not on a slow machine.
+const double budgetMs = 1000.0;
+
+// Inputs found by fuzzing that crashed or hung the scanner, parser or visitors, and large inputs
+// that would show up anything quadratic, each of which must run within the budget.
+static Test test_fuzz_corpus("Fuzz corpus", []() {
+  size_t numInputs = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(Test::dataPath("/fuzz"))) {
+    const std::string source = loadFile(entry.path());
+
+    const auto start = std::chrono::steady_clock::now();
+    fuzz::runParserPipeline(source);
+    const auto end = std::chrono::steady_clock::now();
+
+    const double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    if (ms > budgetMs) {
+      std::cout << entry.path().filename().string() << ": " << ms << " ms" << std::endl;
+    }
+    TEST_TRUE(ms <= budgetMs);
+    numInputs++;
+  }
+  TEST_TRUE(numInputs > 0);
+});
+
+} // namespace fuzz_corpus_tests
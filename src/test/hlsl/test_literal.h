@@ -0,0 +1,119 @@
+#pragma once
+
+#include <vector>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/reader/hlsl/scanner.h"
+#include "../../lib/reader/hlsl/scanner/literal.h"
+#include "../test.h"
+
+using namespace reader::hlsl;
+
+namespace literal_tests {
+
+static Test test_literal_match("Literal negative numbers", []() {
+  TEST_TRUE(matchLiteral("-1") == TokenType::IntLiteral);
+  TEST_TRUE(matchLiteral("-1u") == TokenType::IntLiteral);
+  TEST_TRUE(matchLiteral("-.5") == TokenType::FloatLiteral);
+  // A - followed by a suffix or exponent, rather than a number, isn't a literal.
+  TEST_TRUE(matchLiteral("-L") == TokenType::Undefined);
+  TEST_TRUE(matchLiteral("-u") == TokenType::Undefined);
+  TEST_TRUE(matchLiteral("-f") == TokenType::Undefined);
+  TEST_TRUE(matchLiteral("-e5") == TokenType::Undefined);
+  TEST_TRUE(matchLiteral("-.") == TokenType::Undefined);
+});
+
+static Test test_literal_hex("Literal hex prefixes", []() {
+  TEST_TRUE(matchLiteral("0x1F") == TokenType::IntLiteral);
+  TEST_TRUE(matchLiteral("0X1F") == TokenType::IntLiteral);
+  TEST_TRUE(matchLiteral("0X") == TokenType::Undefined);
+  // An uppercase prefix scans as one literal, not 0 followed by the name X1F.
+  const std::vector<Token> tokens = Scanner("0X1Fu").scan();
+  TEST_EQUALS(tokens.size(), 1ull);
+  if (tokens.size() == 1) {
+    TEST_TRUE(tokens[0].type() == TokenType::IntLiteral);
+    TEST_TRUE(tokens[0].lexeme() == "0X1Fu");
+  }
+});
+
+static Test test_literal_decode("Literal values", []() {
+  LiteralValue value = decodeLiteral("123");
+  TEST_TRUE(value.tokenType == TokenType::IntLiteral);
+  TEST_TRUE(value.type == ast::BaseType::Int);
+  TEST_EQUALS(value.intValue, 123ll);
+  TEST_EQUALS(decodeLiteral("-42").intValue, -42ll);
+  TEST_EQUALS(decodeLiteral("0x1F").intValue, 31ll);
+  TEST_EQUALS(decodeLiteral("0X1F").intValue, 31ll);
+  TEST_EQUALS(decodeLiteral("-0X10").intValue, -16ll);
+  TEST_EQUALS(decodeLiteral("017").intValue, 15ll);
+  TEST_EQUALS(decodeLiteral("0").intValue, 0ll);
+  TEST_EQUALS(decodeLiteral("12L").intValue, 12ll);
+
+  value = decodeLiteral("0xFFu");
+  TEST_TRUE(value.type == ast::BaseType::Uint);
+  TEST_EQUALS(value.uintValue, 255ull);
+  value = decodeLiteral("0XffU");
+  TEST_TRUE(value.type == ast::BaseType::Uint);
+  TEST_EQUALS(value.uintValue, 255ull);
+  TEST_EQUALS(decodeLiteral("4294967295U").uintValue, 4294967295ull);
+
+  value = decodeLiteral("1.5f");
+  TEST_TRUE(value.tokenType == TokenType::FloatLiteral);
+  TEST_TRUE(value.type == ast::BaseType::Float);
+  TEST_EQUALS(value.floatValue, 1.5);
+  value = decodeLiteral("-2.5h");
+  TEST_TRUE(value.type == ast::BaseType::Half);
+  TEST_EQUALS(value.floatValue, -2.5);
+  TEST_EQUALS(decodeLiteral("1.").floatValue, 1.0);
+  TEST_EQUALS(decodeLiteral("4.8828125e-4").floatValue, 4.8828125e-4);
+  TEST_EQUALS(decodeLiteral("-.25").floatValue, -0.25);
+
+  TEST_TRUE(decodeLiteral("abc").tokenType == TokenType::Undefined);
+  TEST_TRUE(decodeLiteral("").tokenType == TokenType::Undefined);
+});
+
+static Test test_literal_parse("Literal values parsed", []() {
+  Parser parser(R"(
+    float factor;
+    float4 main() : SV_Target {
+      float x = -factor * 2u + 0x10 + 1.5h + 017;
+      bool b = true;
+      return x;
+    }
+    cbuffer Params {
+      sampler s = SamplerState { MaxAnisotropy = 0x10; MipMapLodBias = -0.5f; };
+    };
+  )");
+  parser.setIndexNodes(true);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  // The literals are decoded while parsing, in the order they're written.
+  std::vector<ast::LiteralExpr*> literals;
+  for (ast::Node* node : ast->nodesOfType(ast::NodeType::LiteralExpr)) {
+    literals.push_back(static_cast<ast::LiteralExpr*>(node));
+  }
+  TEST_EQUALS(literals.size(), 5ull);
+  if (literals.size() == 5) {
+    TEST_TRUE(literals[0]->type == ast::BaseType::Uint);
+    TEST_EQUALS(literals[0]->uintValue, 2ull);
+    TEST_TRUE(literals[1]->type == ast::BaseType::Int);
+    TEST_EQUALS(literals[1]->intValue, 16ll);
+    TEST_TRUE(literals[2]->type == ast::BaseType::Half);
+    TEST_EQUALS(literals[2]->floatValue, 1.5);
+    TEST_EQUALS(literals[3]->intValue, 15ll);
+    TEST_TRUE(literals[4]->type == ast::BaseType::Bool);
+    TEST_EQUALS(literals[4]->intValue, 1ll);
+  }
+
+  // State assignments read hex numbers and suffixes too.
+  const std::vector<ast::Node*>& states = ast->nodesOfType(ast::NodeType::StateAssignment);
+  TEST_EQUALS(states.size(), 2ull);
+  if (states.size() == 2) {
+    TEST_EQUALS(static_cast<ast::StateAssignment*>(states[0])->intValue, 16);
+    TEST_EQUALS(static_cast<ast::StateAssignment*>(states[1])->floatValue, -0.5f);
+  }
+  delete ast;
+});
+
+} // namespace literal_tests
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "../../lib/ast/flat_ast.h"
+#include "../../lib/reader/hlsl/parallel_parser.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+
+namespace parallel_parser_tests {
+
+inline size_t countStatements(ast::Ast* ast) {
+  size_t count = 0;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    count++;
+  }
+  return count;
+}
+
+static Test test_parallel_split("ParallelParser split", []() {
+  ParallelParser parser(R"(
+    struct Foo { float x; };
+    typedef float4 Color;
+    struct Bar { int y; } bar0, bar1;
+    cbuffer Globals { float4 _Color; };
+    static const float weights[2] = { 1.0, 2.0 };
+    Color tint(Foo f) { return Color(f.x, 0, 0, 1); }
+    float get(Bar b) { if (b.y > 0) { return 1; } return 0; }
+  )", 4);
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_EQUALS(parser.numChunks(), 7ull);
+  TEST_NOT_NULL(ast->findFunction("tint"));
+  TEST_NOT_NULL(ast->findFunction("get"));
+  TEST_NOT_NULL(ast->findGlobalVariable("weights"));
+  TEST_NOT_NULL(ast->findGlobalVariable("bar1"));
+  delete ast;
+});
+
+static Test test_parallel_split_default("ParallelParser split default parameter", []() {
+  // The '=' of a default parameter doesn't make the function end at a ';'.
+  ParallelParser parser(R"(
+    float scale(float x, float s = 2.0) { return x * s; }
+    float offset(float x) { return x + 1; }
+    float apply(float x) { return offset(scale(x)); }
+  )", 4);
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
+  TEST_EQUALS(parser.numChunks(), 3ull);
+  TEST_EQUALS(countStatements(ast), 3ull);
+  delete ast;
+});
+
+static Test test_parallel_context("ParallelParser statement context", []() {
+  // Array sizes using const variables and struct initializers depend on earlier statements.
+  ParallelParser parser(R"(
+    static const int count = 4;
+    struct Foo { float x; float y; };
+    float values[count];
+    static const Foo foo = { 1, 2 };
+  )", 4);
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_EQUALS(countStatements(ast), 4ull);
+  delete ast;
+});
+
+static Test test_parallel_error("ParallelParser error", []() {
+  ParallelParser parser(R"(
+    float foo() { return 1; }
+    float bar( { }
+  )", 2);
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_TRUE(parser.hasErrors());
+  TEST_NOT_NULL(ast->findFunction("foo"));
+  delete ast;
+});
+
+static Test test_parallel_error_location("ParallelParser error location", []() {
+  // An error at the end of a chunk is reported where the serial parser reports it.
+  const char* source = "float a;\nfloat b;\nfloat c;\nfloat d;\nvoid f() { x = 1;\n";
+  Parser serial(source);
+  delete serial.parse();
+  ParallelParser parallel(source, 4);
+  delete parallel.parse();
+  TEST_EQUALS(serial.diagnostics().size(), 1ull);
+  TEST_EQUALS(parallel.diagnostics().size(), 1ull);
+  const SourceLocation& expected = serial.diagnostics()[0].location;
+  const SourceLocation& location = parallel.diagnostics()[0].location;
+  TEST_EQUALS(expected.line, 6);
+  TEST_EQUALS(expected.column, 1);
+  TEST_EQUALS(location.offset, expected.offset);
+  TEST_EQUALS(location.line, expected.line);
+  TEST_EQUALS(location.column, expected.column);
+});
+
+static Test test_parallel_urp("ParallelParser urp_bloom", []() {
+  std::string source = loadFile(TEST_DATA_PATH("/hlsl/urp_bloom.hlsl"));
+  TEST_FALSE(source.empty());
+
+  ast::Ast* serialAst = Parser(source).parse();
+  ParallelParser parser(source, 4);
+  ast::Ast* parallelAst = parser.parse();
+  TEST_NOT_NULL(serialAst);
+  TEST_NOT_NULL(parallelAst);
+
+  // The parallel parse should produce the same tree, node for node, from the same tokens.
+  TEST_EQUALS(countStatements(parallelAst), countStatements(serialAst));
+  ast::FlatAst serialFlat(serialAst);
+  ast::FlatAst parallelFlat(parallelAst);
+  TEST_EQUALS(parallelFlat.size(), serialFlat.size());
+  size_t mismatches = 0;
+  for (uint32_t i = 0; i < serialFlat.size() && i < parallelFlat.size(); ++i) {
+    const ast::FlatNode& a = serialFlat[i];
+    const ast::FlatNode& b = parallelFlat[i];
+    if (a.nodeType != b.nodeType || a.node->offset != b.node->offset || a.parent != b.parent) {
+      mismatches++;
+    }
+  }
+  TEST_EQUALS(mismatches, 0ull);
+
+  delete serialAst;
+  delete parallelAst;
+});
+
+} // namespace parallel_parser_tests
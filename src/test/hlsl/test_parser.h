@@ -21,6 +21,7 @@ static Test test_empty("Parser empty", []() {
   Parser parser("");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   delete ast;
 });
 
@@ -28,6 +29,7 @@ static Test test_static_const_int("Parser const int", []() {
   Parser parser(R"(static const int _USE_RGBM = 0;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -36,6 +38,7 @@ static Test test_float3("Parser float3", []() {
   Parser parser(R"(const float3 magic = float3(0.0f, 0.0, 0);)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -44,6 +47,7 @@ static Test test_array_init("Parser array init", []() {
   Parser parser(R"(const float3 magic = {0.0f, 0.0, 0};)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -52,6 +56,7 @@ static Test test_array_init_trailing_comma("Parser array init trailing comma", [
   Parser parser(R"(const float3 magic = {0.0f, 0.0, 0,};)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -60,6 +65,7 @@ static Test test_array_multi_array("Parser multi array", []() {
   Parser parser(R"(static const float foo[2][2] = {{1,2},{3,4}};)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -68,6 +74,7 @@ static Test test_const_init_expression("Parser const init expression", []() {
   Parser parser(R"(const float y = (x * 2654435769u);)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -76,6 +83,7 @@ static Test test_cast_1("Parser cast 1", []() {
   Parser parser(R"(const float y = float(0);)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -84,6 +92,7 @@ static Test test_cast_2("Parser cast 2", []() {
   Parser parser(R"(const float y = (float)0;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -92,6 +101,7 @@ static Test test_struct_cast("Parser struct cast", []() {
   Parser parser(R"(struct foo { }; const foo y = (foo)0;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -100,6 +110,7 @@ static Test test_multi_variable("Parser multi variable", []() {
   Parser parser(R"(float x = 0, y = 1;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -113,6 +124,7 @@ static Test test_multi_variable_assignment("Parser multi variable assignment", [
   )");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -121,6 +133,7 @@ static Test test_multi_variable_array("Parser multi variable array", []() {
   Parser parser(R"(float2 weights[2], offsets[2];)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -132,6 +145,7 @@ static Test test_empty_statement("Parser empty statement", []() {
   })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -143,6 +157,7 @@ void foo() {
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -151,6 +166,7 @@ static Test test_multiply_assign("Parser call method 2", []() {
   Parser parser(R"(void foo() { n *= 1e-6; })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -159,6 +175,7 @@ static Test test_postfix_increment("Parser postfix increment", []() {
   Parser parser(R"(float y = x++;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -167,6 +184,7 @@ static Test test_prefix_increment("Parser prefix increment", []() {
   Parser parser(R"(float y = ++x;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -175,6 +193,7 @@ static Test test_member_access("Parser member access", []() {
   Parser parser(R"(float y = x.y;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -183,6 +202,7 @@ static Test test_ternary_expr("Parser ternary expr", []() {
   Parser parser(R"(float y = x < 0.0 ? 1 + x : x;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -191,6 +211,7 @@ static Test test_ternary_expr_2("Parser ternary expr 2", []() {
   Parser parser(R"(float y = (x < 0.0) ? 1 + x : x;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -199,14 +220,30 @@ static Test test_ternary_expr_3("Parser ternary expr 3", []() {
   Parser parser(R"(float foo() { f = (x < 0.0) ? 1 + x : x; })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
 
+static Test test_ternary_precedence("Parser ternary precedence", []() {
+  Parser parser(R"(float y = a + b >= 0.0 ? 1 : 2;)");
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
+  // The condition is the whole binary expression before the '?'.
+  ast::VariableStmt* y = static_cast<ast::VariableStmt*>(ast->root()->statements);
+  TEST_TRUE(y->initializer->nodeType == ast::NodeType::TernaryExpr);
+  ast::TernaryExpr* ternary = static_cast<ast::TernaryExpr*>(y->initializer);
+  TEST_TRUE(ternary->condition->nodeType == ast::NodeType::BinaryExpr);
+  TEST_TRUE(static_cast<ast::BinaryExpr*>(ternary->condition)->op == ast::Operator::GreaterEqual);
+  delete ast;
+});
+
 static Test test_Parser_struct("Parser struct", []() {
   Parser parser("struct foo { };");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -215,6 +252,7 @@ static Test test_Parser_struct_var("Parser struct var", []() {
   Parser parser("struct { } foo;");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -223,6 +261,7 @@ static Test test_Parser_cbuffer_struct_var("Parser cbuffer struct var", []() {
   Parser parser("cbuffer foo { struct { } bar; };");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -235,6 +274,7 @@ static Test test_Parser_struct_fields("Parser struct fields", []() {
   };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -243,6 +283,7 @@ static Test test_Parser_struct_field_semantic("Parser struct field semantic", []
   Parser parser(R"(struct foo { uint vertexID : SV_VertexID; };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -251,6 +292,7 @@ static Test test_Parser_struct_member_multi_decl("Parser struct field multi-decl
   Parser parser(R"(struct foo { int a, b, c; };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -260,6 +302,7 @@ static Test test_Parser_struct_init("Parser struct init", []() {
   foo x = { {1, 2}, 3 };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -273,6 +316,7 @@ static Test test_Parser_attributes("Parser attributes", []() {
   };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -286,6 +330,7 @@ static Test test_Parser_attributes2("Parser attributes2", []() {
   };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -299,6 +344,7 @@ static Test test_Parser_attributes3("Parser attributes3", []() {
   };)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -308,6 +354,7 @@ static Test test_function("Parser function", []() {
 float Hash(uint s) {})");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -325,6 +372,7 @@ return float(s) * rcp(4294967296.0);
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -353,6 +401,7 @@ return x ;
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -371,6 +420,7 @@ return f - 1;
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -381,6 +431,7 @@ struct MyStruct { float3 f3; };
 MyStruct Foo() {})");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -389,6 +440,7 @@ static Test test_assignment_return("Parser assignment return", []() {
   Parser parser(R"(float foo() { float a; return a *= 1 + 2; })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -397,6 +449,7 @@ static Test test_function_semantic("Parser function semantic", []() {
   Parser parser(R"(float4 foo(): SV_Target {})");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -405,6 +458,7 @@ static Test test_function_5("Parser inout", []() {
   Parser parser(R"(uint XorShift(inout uint rngState) { })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -413,6 +467,7 @@ static Test test_const_array_size("Parser const array size", []() {
   Parser parser(R"(const int stepCount = 2; const int gWeights[stepCount] = {0, 1};)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -421,6 +476,7 @@ static Test test_function_array_params("Parser function array parameters", []()
   Parser parser(R"(void foo(out float2 bar[2]) { bar[0] = 42; })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -432,6 +488,7 @@ void LODDitheringTransition(uint3 fadeMaskSeed, float ditherFactor) {
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -441,6 +498,7 @@ static Test test_shader_2("Parser block statement", []() {
 void foo() { {} })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -452,6 +510,7 @@ float CubeMapFaceID(float3 dir) {
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -466,6 +525,7 @@ void foo() {
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -477,6 +537,7 @@ float SanitizeFinite(float x) {
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -487,6 +548,7 @@ static Test test_nested_calls("Parser nested calls", []() {
 )");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -498,6 +560,7 @@ half SafePositivePow_half(half base, half power) {
 })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -506,6 +569,7 @@ static Test test_bool("Parser bool", []() {
   Parser parser(R"(bool b = true;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -514,6 +578,7 @@ static Test test_param_init("Parser param init", []() {
   Parser parser(R"(void foo(float a = 1.0) { })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -522,6 +587,7 @@ static Test test_array_index("Parser array index", []() {
   Parser parser(R"(float m12 = m[1][2];)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -530,6 +596,7 @@ static Test test_for_loop("Parser for loop", []() {
   Parser parser(R"(void foo() { for (uint b = 1U << firstbithigh(n - 1); b != 0; b >>= 1) {} })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -538,6 +605,7 @@ static Test test_for_loop_2("Parser for loop 2", []() {
   Parser parser(R"(void foo() { for (int i = 0, j = 0; i < 5; ++i, j++) {} })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -547,6 +615,7 @@ static Test test_rw_structure_buffer("Parser rw structure buffer", []() {
   sampler<float> g_fogDensitySampler;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -556,6 +625,7 @@ static Test test_switch_case_block("Parser switch", []() {
   void foo() { switch (bar) { case 1: sampleCount = 21; break; default: {} } })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -564,6 +634,7 @@ static Test test_parameter_semantic("Parser parameter semantic", []() {
   Parser parser(R"(void SplatmapFragment(float IN, out half4 outColor : SV_Target0) { })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -572,6 +643,7 @@ static Test test_parameter_default_value("Parser parameter default value", []()
   Parser parser(R"(void UnpackNormalAG(float4 packedNormal, float scale = 1.0) { })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -581,6 +653,7 @@ static Test test_multi_statement("Parser multi statement", []() {
     surface.occlusion = surfaceDescription.Occlusion; })");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -589,6 +662,7 @@ static Test test_texture2dms("Parser Texture2DMS", []() {
   Parser parser(R"(Texture2DMS<float, 4> _CameraDepthAttachment;)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
@@ -597,10 +671,73 @@ static Test test_array_const_expr_size("Parser Array const expr size", []() {
   Parser parser(R"(float4 _TextureInfo[8 * 2];)");
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   printAst(parser.source(), ast);
   delete ast;
 });
 
+static Test test_binary_precedence("Parser binary precedence", []() {
+  Parser parser(R"(static const int x = 1 + 2 * 3 - 4 << 1 == 5 || 6 && 7;)");
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
+  // ((((1 + (2 * 3)) - 4) << 1) == 5) || (6 && 7)
+  ast::BinaryExpr* orExpr = (ast::BinaryExpr*)ast->findGlobalVariable("x")->initializer;
+  TEST_TRUE(orExpr->op == ast::Operator::OrOr);
+  TEST_TRUE(((ast::BinaryExpr*)orExpr->right)->op == ast::Operator::AndAnd);
+  ast::BinaryExpr* equal = (ast::BinaryExpr*)orExpr->left;
+  TEST_TRUE(equal->op == ast::Operator::EqualEqual);
+  ast::BinaryExpr* shift = (ast::BinaryExpr*)equal->left;
+  TEST_TRUE(shift->op == ast::Operator::LeftShift);
+  ast::BinaryExpr* sub = (ast::BinaryExpr*)shift->left;
+  TEST_TRUE(sub->op == ast::Operator::Subtract);
+  ast::BinaryExpr* add = (ast::BinaryExpr*)sub->left;
+  TEST_TRUE(add->op == ast::Operator::Add);
+  TEST_TRUE(((ast::BinaryExpr*)add->right)->op == ast::Operator::Multiply);
+  delete ast;
+});
+
+#if HLSL_REFLECT_STATS
+static Test test_Parse_stats("Parse stats", []() {
+  Parser parser(R"(
+    #define SCALE 2.0
+    float foo(float a) { return a * SCALE; }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  const ParseStats& stats = parser.stats();
+  TEST_EQUALS(stats.scanner.defineExpansions, 1ull);
+  TEST_EQUALS(stats.scanner.tokens, 13ull);
+  TEST_EQUALS(stats.parser.errors, 0ull);
+  TEST_EQUALS(stats.ast.pages, 1ull);
+  TEST_EQUALS(stats.ast.nodes[(size_t)ast::NodeType::FunctionStmt], 1ull);
+  TEST_EQUALS(stats.ast.nodes[(size_t)ast::NodeType::BinaryExpr], 1ull);
+  TEST_EQUALS(stats.ast.nodes[(size_t)ast::NodeType::Root], 1ull);
+  delete ast;
+});
+
+static Test test_Parse_stats_depth("Parse stats depth", []() {
+  // A long chain of binary operators is parsed as deep as a single operator.
+  std::string chain = "float x = a";
+  for (int i = 0; i < 1000; ++i) {
+    chain += i % 2 == 0 ? " + a" : " * a";
+  }
+  chain += ";";
+  Parser chainParser(chain);
+  delete chainParser.parse();
+  TEST_FALSE(chainParser.hasErrors());
+  Parser singleParser("float x = a + a;");
+  delete singleParser.parse();
+  TEST_TRUE(chainParser.stats().parser.maxDepth > 0);
+  TEST_EQUALS(chainParser.stats().parser.maxDepth, singleParser.stats().parser.maxDepth);
+
+  // Parentheses nest.
+  Parser groupParser("float x = ((a + a) * a);");
+  delete groupParser.parse();
+  TEST_TRUE(groupParser.stats().parser.maxDepth > singleParser.stats().parser.maxDepth);
+});
+#endif
+
 static Test test_Parse_urp("Parse urp_bloom", []() {
   FILE* fp = fopen(TEST_DATA_PATH("/hlsl/urp_bloom.hlsl"), "rb");
   fseek(fp, 0, SEEK_END);
@@ -614,6 +751,7 @@ static Test test_Parse_urp("Parse urp_bloom", []() {
   Parser parser(hlsl);
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
   //printAst(parser.source(), ast);
   delete ast;
   free(hlsl);
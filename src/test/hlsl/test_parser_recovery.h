@@ -0,0 +1,162 @@
+#pragma once
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../test.h"
+
+using namespace reader::hlsl;
+
+namespace parser_recovery_tests {
+
+inline std::string repeat(const char* text, size_t count) {
+  std::string result;
+  for (size_t i = 0; i < count; ++i) {
+    result += text;
+  }
+  return result;
+}
+
+inline size_t countStatements(ast::Statement* stmt) {
+  size_t count = 0;
+  for (; stmt != nullptr; stmt = stmt->next) {
+    count++;
+  }
+  return count;
+}
+
+static Test test_recover_top_level("Parser recover top-level statement", []() {
+  Parser parser(R"(
+    float a = (1;
+    float b = 2;
+    float bar( { }
+    float foo() { return b; }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_EQUALS(parser.diagnostics().size(), 2ull);
+  TEST_IS_NULL(ast->findGlobalVariable("a"));
+  TEST_NOT_NULL(ast->findGlobalVariable("b"));
+  TEST_NOT_NULL(ast->findFunction("foo"));
+  delete ast;
+});
+
+static Test test_recover_block("Parser recover block statement", []() {
+  Parser parser(R"(
+    float foo(float x) {
+      float y = (x + 1;
+      if (x > 0) { y = max(x,; }
+      return y;
+    }
+    float bar() { return 1; }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_EQUALS(parser.diagnostics().size(), 2ull);
+  ast::FunctionStmt* foo = ast->findFunction("foo");
+  TEST_NOT_NULL(foo);
+  // The if statement is kept with its failed statement dropped, the variable is dropped.
+  TEST_EQUALS(countStatements(foo->body->statements), 2ull);
+  TEST_NOT_NULL(ast->findFunction("bar"));
+  delete ast;
+});
+
+static Test test_recover_line("Parser diagnostic line", []() {
+  Parser parser("float a = 1;\nfloat b = 2;\nfloat c = );\n");
+  ast::Ast* ast = parser.parse();
+  TEST_EQUALS(parser.diagnostics().size(), 1ull);
+  TEST_EQUALS(parser.diagnostics()[0].location.line, 3);
+  TEST_EQUALS(parser.diagnostics()[0].location.column, 11);
+  TEST_EQUALS(parser.diagnostics()[0].location.offset, 36u);
+  TEST_TRUE(parser.diagnostics()[0].token.lexeme() == ")");
+  delete ast;
+});
+
+static Test test_recover_unclosed("Parser recover unclosed block", []() {
+  Parser parser(R"(
+    float foo() { return 1;
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_NOT_NULL(ast);
+  TEST_TRUE(parser.hasErrors());
+  delete ast;
+});
+
+static Test test_recover_missing_operand("Parser recover missing operand", []() {
+  // Each of these once left a null node in the Ast without reporting an error.
+  const char* sources[] = {
+    "float f = max(, 1);",
+    "float x = 0; void foo() { x. = 1; }",
+    "void foo() { if (1) ; else }",
+    "float a[] = { , 1 };",
+    "struct S { 1 a; };",
+  };
+  for (const char* source : sources) {
+    Parser parser(source);
+    ast::Ast* ast = parser.parse();
+    TEST_EQUALS(parser.diagnostics().size(), 1ull);
+    delete ast;
+  }
+});
+
+static Test test_recover_typedef("Parser recover typedef of unknown type", []() {
+  Parser parser("typedef unknown_t y;\nfloat z = (1);\n");
+  ast::Ast* ast = parser.parse();
+  TEST_EQUALS(parser.diagnostics().size(), 1ull);
+  TEST_NOT_NULL(ast->findGlobalVariable("z"));
+  delete ast;
+});
+
+static Test test_recover_depth("Parser depth limit", []() {
+  // Each of these nests far deeper than the limit, so reports an error rather than overflowing
+  // the stack.
+  const size_t depth = 100000;
+  const std::string sources[] = {
+    "float a = " + repeat("(", depth) + "1" + repeat(")", depth) + ";",
+    "float a = " + repeat("x.", depth) + "x;",
+    "float a[] = " + repeat("{", depth) + "1" + repeat("}", depth) + ";",
+    "void f() " + repeat("{", depth) + repeat("}", depth),
+    "void f(int x) { " + repeat("if (x) ", depth) + "x = 1; }",
+  };
+  for (const std::string& source : sources) {
+    Parser parser(source);
+    ast::Ast* ast = parser.parse();
+    TEST_EQUALS(parser.diagnostics().size(), 1ull);
+    TEST_TRUE(parser.diagnostics()[0].message.find("Nested too deeply") == 0);
+    delete ast;
+  }
+
+  // Prefix operators don't nest.
+  const std::string prefixSource = "float a = " + repeat("-", depth) + "1;";
+  Parser prefix(prefixSource);
+  delete prefix.parse();
+  TEST_FALSE(prefix.hasErrors());
+});
+
+static Test test_recover_max_depth("Parser max depth", []() {
+  Parser shallow("float a = (((1)));");
+  shallow.setMaxDepth(4);
+  delete shallow.parse();
+  TEST_FALSE(shallow.hasErrors());
+
+  Parser deep("float a = ((((1))));\nfloat b = 2;\n");
+  deep.setMaxDepth(4);
+  ast::Ast* ast = deep.parse();
+  TEST_EQUALS(deep.diagnostics().size(), 1ull);
+  TEST_NOT_NULL(ast->findGlobalVariable("b"));
+  delete ast;
+});
+
+static Test test_node_offset("Parser node offset", []() {
+  Parser parser("float foo(float a) {\n  return a * 2.0 + a;\n}\n");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ast::FunctionStmt* foo = ast->findFunction("foo");
+  TEST_EQUALS(foo->offset, 0u);
+  TEST_EQUALS(foo->parameters->offset, 10u);
+  ast::ReturnStmt* ret = (ast::ReturnStmt*)foo->body->statements;
+  TEST_EQUALS(ret->offset, 23u);
+  // The binary expression starts at its left operand.
+  TEST_EQUALS(ret->value->offset, 30u);
+  delete ast;
+});
+
+} // namespace parser_recovery_tests
@@ -132,4 +132,50 @@ static Test test_Shader("Scanner Shader", []() {
   free(hlsl);
 });
 
+static Test test_Scanner_offset("Scanner offset", []() {
+  Scanner scanner("#define N 4\nint x;\n  x = N;");
+  auto tokens = scanner.scan();
+  TEST_EQUALS(tokens.size(), 7ull);
+  auto tIter = tokens.begin();
+  TEST_EQUALS((*tIter).offset(), 12u); // int
+  tIter++;
+  TEST_EQUALS((*tIter).offset(), 16u); // x
+  std::advance(tIter, 4);
+  TEST_EQUALS((*tIter).type(), TokenType::IntLiteral);
+  TEST_EQUALS((*tIter).offset(), 25u); // N, expanded to 4
+  SourceLocation location = scanner.location((*tIter).offset());
+  TEST_EQUALS(location.line, 3);
+  TEST_EQUALS(location.column, 7);
+});
+
+static Test test_Scanner_line_directive("Scanner #line location", []() {
+  Scanner scanner("int a;\n#line 10 \"foo.hlsl\"\nint b;\n#line 20\n\nint c;", "main.hlsl");
+  auto tokens = scanner.scan();
+  TEST_EQUALS(tokens.size(), 9ull);
+  auto tIter = tokens.begin();
+  SourceLocation a = scanner.location((*tIter).offset());
+  TEST_TRUE(a.filename == "main.hlsl");
+  TEST_EQUALS(a.line, 1);
+  std::advance(tIter, 3);
+  SourceLocation b = scanner.location((*tIter).offset());
+  TEST_TRUE(b.filename == "foo.hlsl");
+  TEST_EQUALS(b.line, 10);
+  TEST_EQUALS(b.column, 1);
+  std::advance(tIter, 3);
+  SourceLocation c = scanner.location((*tIter).offset());
+  TEST_TRUE(c.filename == "foo.hlsl");
+  TEST_EQUALS(c.line, 21);
+});
+
+static Test test_Scanner_comment_lines("Scanner comment lines", []() {
+  Scanner scanner("/* a\n b */\n// c\n  int x;\n/* d /* e\n */ */ float y;");
+  auto tokens = scanner.scan();
+  TEST_EQUALS(tokens.size(), 6ull);
+  TEST_EQUALS(scanner.location(tokens.front().offset()).line, 4);
+  TEST_EQUALS(scanner.location(tokens.front().offset()).column, 3);
+  TEST_EQUALS(scanner.location(tokens.back().offset()).line, 6);
+  TEST_EQUALS(scanner.absoluteLine(tokens.back().offset()), 6);
+  TEST_EQUALS(scanner.absoluteLine(), 6);
+});
+
 } // namespace scanner_tests
@@ -1,8 +1,25 @@
 #include "test.h"
+#include "ast/test_constant_evaluator.h"
+#include "ast/test_flat_ast.h"
+#include "ast/test_intrinsic.h"
+#include "ast/test_node_index.h"
 //#include "hlsl/test_token_type.h"
-//#include "hlsl/test_scanner.h"
-//#include "hlsl/test_parser.h"
+#include "hlsl/test_scanner.h"
+#include "hlsl/test_parser.h"
+#include "hlsl/test_allocations.h"
+#include "hlsl/test_fuzz_corpus.h"
+#include "hlsl/test_literal.h"
+#include "hlsl/test_parallel_parser.h"
+#include "hlsl/test_parser_recovery.h"
+#include "util/test_trace.h"
 #include "visitor/test_prune_tree.h"
+#include "visitor/test_resolve_symbols.h"
+#include "visitor/test_reachability.h"
+#include "visitor/test_eliminate_dead_code.h"
+#include "visitor/test_fold_constants.h"
+#include "visitor/test_infer_types.h"
+#include "visitor/test_reflect_bindings.h"
+#include "visitor/test_visitor.h"
 #include <iostream>
 #include <chrono>
 
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../lib/ast/ast.h"
+#include "../lib/visitor/glsl_generator.h"
+
+// Helpers shared by the tests.
+
+/// Load a file into a string, returning an empty string if the file couldn't be read.
+inline std::string loadFile(const std::string& path) {
+  std::ifstream fp(path, std::ios::binary);
+  if (!fp) {
+    return std::string();
+  }
+  std::ostringstream ss;
+  ss << fp.rdbuf();
+  return ss.str();
+}
+
+/// The GLSL generated for the visible nodes of the Ast.
+inline std::string generateGlsl(ast::Ast* ast) {
+  std::ostringstream out;
+  visitor::GlslGenerator generator(out);
+  generator.visitRoot(ast->root());
+  return out.str();
+}
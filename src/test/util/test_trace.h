@@ -0,0 +1,46 @@
+#pragma once
+
+#include <sstream>
+#include <thread>
+
+#include "../../lib/util/trace.h"
+#include "../test.h"
+
+namespace trace_tests {
+
+static Test test_trace_disabled("Trace disabled", []() {
+  util::Trace::enable();
+  util::Trace::disable();
+  {
+    HLSL_TRACE_SCOPE("ignored");
+  }
+  std::ostringstream out;
+  util::Trace::write(out);
+  TEST_TRUE(out.str().find("ignored") == std::string::npos);
+});
+
+static Test test_trace_threads("Trace threads", []() {
+  util::Trace::enable(4);
+  const char* names[] = { "e0", "e1", "e2", "e3", "e4", "e5" };
+  for (const char* name : names) {
+    HLSL_TRACE_SCOPE(name, "detail \"quoted\"");
+  }
+  std::thread thread([]() {
+    HLSL_TRACE_SCOPE("worker");
+  });
+  thread.join();
+  util::Trace::disable();
+
+  std::ostringstream out;
+  util::Trace::write(out);
+  const std::string json = out.str();
+  // The ring buffer only holds the last 4 events of each thread.
+  TEST_TRUE(json.find("\"e0\"") == std::string::npos);
+  TEST_TRUE(json.find("\"e1\"") == std::string::npos);
+  TEST_TRUE(json.find("\"e2\"") < json.find("\"e5\""));
+  TEST_TRUE(json.find("\"worker\"") != std::string::npos);
+  TEST_TRUE(json.find("\"tid\": 2") != std::string::npos);
+  TEST_TRUE(json.find("detail \\\"quoted\\\"") != std::string::npos);
+});
+
+} // namespace trace_tests
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <string>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/eliminate_dead_code.h"
+#include "../../lib/visitor/prune_tree.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace eliminate_dead_code_tests {
+
+static Test test_eliminate_dead_code("Eliminate Dead Code", []() {
+  Parser parser(R"(
+    static const int _USE_RGBM = 0;
+    static const int _BLOOM_HQ = 1;
+    static const bool USE_FOG = _USE_RGBM != 0 || !_BLOOM_HQ;
+    static const uint MODE = 0x2u;
+    Texture2D mainTex;
+    SamplerState linearSampler;
+    float4 EncodeRGBM(float3 color) { return float4(color, 1); }
+    float4 SampleHQ(float2 uv) { return mainTex.Sample(linearSampler, uv); }
+    float4 SampleLQ(float2 uv) { return mainTex.Sample(linearSampler, uv) * 0.5; }
+    float4 ApplyFog(float4 color) { return color * 0.5; }
+    float4 main(float2 uv : TEXCOORD0) : SV_Target {
+      float unused = uv.x * 2;
+      float alsoUnused = unused + 1;
+      float4 color;
+      if (_BLOOM_HQ) {
+        color = SampleHQ(uv);
+      } else {
+        color = SampleLQ(uv);
+      }
+      if (_USE_RGBM) {
+        float4 rgbm = EncodeRGBM(color.rgb);
+        color = rgbm;
+      }
+      if (USE_FOG) color = ApplyFog(color);
+      while (MODE == 3) { color *= 2; }
+      float scale = (MODE & 2) ? 2.0 : ApplyFog(color).x;
+      return color * scale;
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  EliminateDeadCode pass(ast);
+  pass.eliminate("main");
+  TEST_EQUALS(pass.branchesRemoved, 4ull);
+  TEST_EQUALS(pass.ternariesFolded, 1ull);
+  TEST_EQUALS(pass.localsRemoved, 2ull);
+
+  // The functions only called from the dead code, and the flags, are pruned.
+  TEST_TRUE(ast->findFunction("SampleHQ")->visible);
+  TEST_FALSE(ast->findFunction("SampleLQ")->visible);
+  TEST_FALSE(ast->findFunction("EncodeRGBM")->visible);
+  TEST_FALSE(ast->findFunction("ApplyFog")->visible);
+  TEST_FALSE(ast->findGlobalVariable("_USE_RGBM")->visible);
+  TEST_FALSE(ast->findGlobalVariable("MODE")->visible);
+
+  const std::string glsl = generateGlsl(ast);
+  TEST_TRUE(glsl.find("unused") == std::string::npos);
+  TEST_TRUE(glsl.find("rgbm") == std::string::npos);
+  TEST_TRUE(glsl.find("SampleHQ(uv)") != std::string::npos);
+  TEST_TRUE(glsl.find("while") == std::string::npos);
+
+  delete ast;
+});
+
+static Test test_eliminate_dead_code_kept("Eliminate Dead Code keeps live code", []() {
+  Parser parser(R"(
+    static const int FLAG = 1;
+    cbuffer Params { int runtimeFlag; };
+    RWStructuredBuffer<uint> counter;
+    int shadowed(int FLAG) {
+      if (FLAG) { return 1; }
+      return 0;
+    }
+    void main() {
+      uint previous;
+      InterlockedAdd(counter[0], 1, previous);
+      int sideEffect = shadowed(runtimeFlag);
+      if (runtimeFlag) { counter[1] = 2; }
+      if (FLAG) if (runtimeFlag) { counter[2] = 3; } else { float dead = 1; }
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  EliminateDeadCode pass(ast);
+  pass.eliminate("main");
+  // Only the if on FLAG in main is constant; the parameter hides it in shadowed.
+  TEST_EQUALS(pass.branchesRemoved, 1ull);
+  // The unused local with a call is kept, as is the one passed to InterlockedAdd.
+  TEST_EQUALS(pass.localsRemoved, 1ull);
+  TEST_TRUE(ast->findFunction("shadowed")->visible);
+
+  const std::string glsl = generateGlsl(ast);
+  TEST_TRUE(glsl.find("sideEffect") != std::string::npos);
+  TEST_TRUE(glsl.find("previous") != std::string::npos);
+  TEST_TRUE(glsl.find("dead") == std::string::npos);
+
+  delete ast;
+});
+
+static Test test_eliminate_dead_code_corpus("Eliminate Dead Code corpus", []() {
+  // A post-processing shader with the static const keyword flags and unused locals of the
+  // shaders Unity exports.
+  const std::string source = loadFile(Test::dataPath("/hlsl/uber_post.hlsl"));
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  PruneTree(ast).prune("FragUberPost");
+  const size_t prunedSize = generateGlsl(ast).size();
+
+  EliminateDeadCode pass(ast);
+  pass.eliminate("FragUberPost");
+  TEST_EQUALS(pass.branchesRemoved, 6ull);
+  TEST_EQUALS(pass.ternariesFolded, 1ull);
+  TEST_EQUALS(pass.localsRemoved, 4ull);
+  TEST_TRUE(generateGlsl(ast).size() < prunedSize);
+
+  TEST_TRUE(ast->findFunction("FragUberPost")->visible);
+  TEST_TRUE(ast->findFunction("SampleBloom")->visible);
+  TEST_TRUE(ast->findFunction("ApplyDithering")->visible);
+  TEST_TRUE(ast->findFunction("LinearToSRGB")->visible);
+  TEST_FALSE(ast->findFunction("DecodeRGBM")->visible);
+  TEST_FALSE(ast->findFunction("DistortUV")->visible);
+  TEST_FALSE(ast->findFunction("ApplyGrain")->visible);
+
+  delete ast;
+});
+
+} // namespace eliminate_dead_code_tests
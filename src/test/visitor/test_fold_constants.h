@@ -0,0 +1,92 @@
+#pragma once
+
+#include <string>
+
+#include "../../lib/ast/constant_evaluator.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/fold_constants.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace fold_constants_tests {
+
+static Test test_fold_constants("Fold Constants", []() {
+  Parser parser(R"(
+    static const int COUNT = 4;
+    static const float SCALE = 0.5;
+    static const float3 TINT = float3(1, 0.5, 0.25);
+    cbuffer Params { float4 lightColors[COUNT * 2]; float runtime; };
+    float4 main(float2 uv : TEXCOORD0) : SV_Target {
+      const int k = COUNT - 1;
+      float3 color = TINT * (SCALE * 4) + runtime;
+      float x = uv.x * (1 << k) + TINT.y;
+      half h = (half)SCALE;
+      int negative = -COUNT;
+      return float4(color, -1) * float4(1, 2, 3, 4);
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  FoldConstants pass(ast);
+  pass.fold();
+  const std::string glsl = generateGlsl(ast);
+  TEST_TRUE(glsl.find("k=3") != std::string::npos);
+  TEST_TRUE(glsl.find("float3(2.0, 1.0, 0.5) + runtime") != std::string::npos);
+  TEST_TRUE(glsl.find("uv.x * 8") != std::string::npos);
+  // A swizzle of a const vector is kept.
+  TEST_TRUE(glsl.find("TINT.y") != std::string::npos);
+  TEST_TRUE(glsl.find("half(0.5)") != std::string::npos);
+  TEST_TRUE(glsl.find("negative=-4") != std::string::npos);
+  // A constructor of literals is already its value.
+  TEST_TRUE(glsl.find("float4(1, 2, 3, 4)") != std::string::npos);
+
+  // The folded expressions keep their values, and folding again changes nothing.
+  const size_t folded = pass.expressionsFolded;
+  TEST_TRUE(folded > 0);
+  FoldConstants again(ast);
+  again.fold();
+  TEST_EQUALS(again.expressionsFolded, 0ull);
+  TEST_TRUE(generateGlsl(ast) == glsl);
+  ast::Statement* params = ast->root()->statements->next->next->next;
+  TEST_NOT_NULL(params);
+  TEST_TRUE(params->nodeType == ast::NodeType::BufferStmt);
+  // The array size of a buffer field, which is on its type, is folded too.
+  ast::Expression* size = static_cast<ast::BufferStmt*>(params)->field->type->arraySize;
+  TEST_NOT_NULL(size);
+  TEST_TRUE(size->nodeType == ast::NodeType::LiteralExpr);
+  TEST_EQUALS(ast::ConstantEvaluator(ast).evaluate(size).asInt(), 8);
+
+  delete ast;
+});
+
+static Test test_fold_constants_corpus("Fold Constants corpus", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  FoldConstants pass(ast);
+  pass.fold();
+
+  // The static consts and constant expressions of the Core RP library are folded into the
+  // functions that use them, and a ternary with a condition that isn't constant is kept.
+  const std::string glsl = generateGlsl(ast);
+  TEST_TRUE(glsl.find("m &= 8388607;") != std::string::npos);
+  TEST_TRUE(glsl.find("return deg * 0.017453292;") != std::string::npos);
+  TEST_TRUE(glsl.find("return rgbm.xyz * rgbm.w * 8.0;") != std::string::npos);
+  TEST_TRUE(glsl.find("y >= 0.0 ? 3.14159265358979323846 : ") != std::string::npos);
+
+  // Folding again finds nothing more to fold.
+  FoldConstants again(ast);
+  again.fold();
+  TEST_EQUALS(again.expressionsFolded, 0ull);
+  TEST_TRUE(generateGlsl(ast) == glsl);
+
+  delete ast;
+});
+
+} // namespace fold_constants_tests
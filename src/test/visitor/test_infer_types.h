@@ -0,0 +1,144 @@
+#pragma once
+
+#include <string>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/infer_types.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace infer_types_tests {
+
+// The type of the initializer of the local variable of the function.
+inline ast::BaseType initializerType(ast::FunctionStmt* function, const std::string_view& name) {
+  for (ast::Statement* stmt = function->body->statements; stmt != nullptr; stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::VariableStmt) {
+      ast::VariableStmt* variable = static_cast<ast::VariableStmt*>(stmt);
+      if (variable->name == name && variable->initializer != nullptr) {
+        return variable->initializer->resolvedType.base();
+      }
+    }
+  }
+  return ast::BaseType::Undefined;
+}
+
+static Test test_infer_types("Infer Types", []() {
+  Parser parser(R"(
+    typedef float3 Color;
+    struct Light {
+      float3 direction; Color color; float4x4 transform;
+      float Intensity() { return 1; }
+    };
+    struct Scene { Light lights[2]; Light sun; };
+    cbuffer Params { Scene scene; float4x4 world; float3x4 affine; int count; };
+    Texture2D<float> depth;
+    Texture2D albedo;
+    SamplerState linearSampler;
+    RWByteAddressBuffer bytes;
+    float4 main(float2 uv : TEXCOORD0, int i : INDEX) : SV_Target {
+      float a = uv.x * count;
+      float2 b = uv.yx + i;
+      int3 c = int3(1, 2, 3) * true;
+      bool3 d = c > 1;
+      float3 e = scene.sun.direction;
+      float3 f = scene.lights[i].color * 2.0h;
+      float g = scene.sun.Intensity();
+      float3 h = scene.lights[0].transform._m00_m11_m22;
+      float4 k = mul(world, float4(e, 1));
+      float3 l = mul(float4(e, 1), affine);
+      float m = dot(e, f);
+      float3 n = normalize(uint3(1, 2, 3));
+      float o = depth.Sample(linearSampler, uv);
+      float4 p = albedo.Sample(linearSampler, uv);
+      float4 q = depth.GatherRed(linearSampler, uv);
+      uint2 r = bytes.Load2(0);
+      float4 s = world[1];
+      float t = s[2];
+      bool u = !a;
+      float v = (i > 0) ? a : count;
+      float4x3 w = transpose(affine);
+      float2 x = (float2)f;
+      float y = unknown(a) + a;
+      return float4(e, 1);
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  InferTypes pass(ast);
+  pass.infer();
+  ast::FunctionStmt* main = ast->findFunction("main");
+  TEST_TRUE(initializerType(main, "a") == ast::BaseType::Float);
+  TEST_TRUE(initializerType(main, "b") == ast::BaseType::Float2);
+  TEST_TRUE(initializerType(main, "c") == ast::BaseType::Int3);
+  TEST_TRUE(initializerType(main, "d") == ast::BaseType::Bool3);
+  // Members of structs, through arrays, typedefs and methods.
+  TEST_TRUE(initializerType(main, "e") == ast::BaseType::Float3);
+  TEST_TRUE(initializerType(main, "f") == ast::BaseType::Float3);
+  TEST_TRUE(initializerType(main, "g") == ast::BaseType::Float);
+  TEST_TRUE(initializerType(main, "h") == ast::BaseType::Float3);
+  // Intrinsics.
+  TEST_TRUE(initializerType(main, "k") == ast::BaseType::Float4);
+  TEST_TRUE(initializerType(main, "l") == ast::BaseType::Float4);
+  TEST_TRUE(initializerType(main, "m") == ast::BaseType::Float);
+  TEST_TRUE(initializerType(main, "n") == ast::BaseType::Float3);
+  TEST_TRUE(initializerType(main, "w") == ast::BaseType::Float4x3);
+  // Texture and buffer methods, by the template argument of the resource.
+  TEST_TRUE(initializerType(main, "o") == ast::BaseType::Float);
+  TEST_TRUE(initializerType(main, "p") == ast::BaseType::Float4);
+  TEST_TRUE(initializerType(main, "q") == ast::BaseType::Float4);
+  TEST_TRUE(initializerType(main, "r") == ast::BaseType::Uint2);
+  // Indexing a matrix gives a row, and a vector a component.
+  TEST_TRUE(initializerType(main, "s") == ast::BaseType::Float4);
+  TEST_TRUE(initializerType(main, "t") == ast::BaseType::Float);
+  TEST_TRUE(initializerType(main, "u") == ast::BaseType::Bool);
+  TEST_TRUE(initializerType(main, "v") == ast::BaseType::Float);
+  TEST_TRUE(initializerType(main, "x") == ast::BaseType::Float2);
+  // A call of an unknown function is unknown, and so is what uses it.
+  TEST_TRUE(initializerType(main, "y") == ast::BaseType::Undefined);
+  TEST_TRUE(pass.expressionsUnknown > 0);
+  TEST_TRUE(pass.expressionsUnknown < pass.expressionsTyped);
+
+  // A struct is referred to by its index.
+  ast::Statement* stmt = main->body->statements->next->next->next->next;
+  ast::Expression* sun = static_cast<ast::VariableStmt*>(stmt)->initializer;
+  TEST_TRUE(sun->nodeType == ast::NodeType::MemberExpr);
+  ast::Expression* sceneExpr = static_cast<ast::MemberExpr*>(sun)->object;
+  TEST_TRUE(sceneExpr->resolvedType.base() == ast::BaseType::Struct);
+  TEST_TRUE(ast->typeStruct(sceneExpr->resolvedType.structIndex) == ast->findStruct("Scene"));
+
+  delete ast;
+});
+
+static Test test_infer_types_corpus("Infer Types corpus", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  InferTypes pass(ast);
+  pass.infer();
+
+  // A field of the input struct, and a swizzle of a texture sample.
+  ast::FunctionStmt* prefilter = ast->findFunction("FragPrefilter");
+  TEST_TRUE(initializerType(prefilter, "uv") == ast::BaseType::Float2);
+  TEST_TRUE(initializerType(prefilter, "color") == ast::BaseType::Float3);
+  // A half mixed with the floats of a cbuffer is promoted to a float.
+  TEST_TRUE(initializerType(prefilter, "softness") == ast::BaseType::Float);
+  // A call of a function of the source has its return type.
+  ast::FunctionStmt* blur = ast->findFunction("FragBlurH");
+  TEST_TRUE(initializerType(blur, "c0") == ast::BaseType::Half3);
+
+  // Inferring again gives the same types.
+  InferTypes again(ast);
+  again.infer();
+  TEST_EQUALS(again.expressionsTyped, pass.expressionsTyped);
+  TEST_EQUALS(again.expressionsUnknown, pass.expressionsUnknown);
+
+  delete ast;
+});
+
+} // namespace infer_types_tests
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <map>
+
 #include "../../lib/reader/hlsl/parser.h"
 #include "../../lib/visitor/glsl_generator.h"
 #include "../../lib/visitor/prune_tree.h"
@@ -36,6 +38,7 @@ static Test test_prune_tree("Test Prune Tree", []() {
 
   ast::Ast* ast = parser.parse();
   TEST_NOT_NULL(ast);
+  TEST_FALSE(parser.hasErrors());
 
   VisibilityVisitor reset(false);
   reset.visitRoot(ast->root());
@@ -58,4 +61,126 @@ static Test test_prune_tree("Test Prune Tree", []() {
   delete ast;
 });
   
+static Test test_prune_tree_types("Test Prune Tree types and buffers", []() {
+  Parser parser(R"(
+    struct Light { float3 color; float intensity; };
+    struct Material { float4 albedo; };
+    struct Unused { float x; };
+    typedef float3 Color;
+    typedef float4 Unused4;
+    static const int NUM_LIGHTS = 4;
+    static const float UNUSED_CONST = 1;
+    cbuffer PerFrame { float4x4 viewProj; float time; float unusedTime; };
+    cbuffer PerDraw { float4x4 world; };
+    StructuredBuffer<Light> lights;
+    Texture2D albedoMap;
+    SamplerState linearSampler;
+    Texture2D unusedMap;
+    Color shade(Material m, float2 uv) {
+      Color c = albedoMap.Sample(linearSampler, uv).rgb * m.albedo.rgb;
+      [unroll] for (int i = 0; i < NUM_LIGHTS; ++i) { c += lights[i].color * time; }
+      return c;
+    }
+    float4 main(float2 uv : TEXCOORD0) : SV_Target {
+      Material m;
+      m.albedo = mul(viewProj, float4(uv, 0, 1));
+      return float4(shade(m, uv), 1);
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  PruneTree prune(ast);
+  prune.prune("main");
+
+  // Every statement is either visible or hidden, so this doesn't need a VisibilityVisitor first.
+  std::map<std::string_view, bool> visible;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::StructStmt) {
+      visible[static_cast<ast::StructStmt*>(stmt)->name] = stmt->visible;
+    } else if (stmt->nodeType == ast::NodeType::TypedefStmt) {
+      visible[static_cast<ast::TypedefStmt*>(stmt)->name] = stmt->visible;
+    } else if (stmt->nodeType == ast::NodeType::BufferStmt) {
+      ast::BufferStmt* buffer = static_cast<ast::BufferStmt*>(stmt);
+      visible[buffer->name] = stmt->visible;
+      for (ast::Field* field = buffer->field; field != nullptr; field = field->next) {
+        visible[field->name] = field->visible;
+      }
+    } else if (stmt->nodeType == ast::NodeType::VariableStmt) {
+      visible[static_cast<ast::VariableStmt*>(stmt)->name] = stmt->visible;
+    } else if (stmt->nodeType == ast::NodeType::FunctionStmt) {
+      visible[static_cast<ast::FunctionStmt*>(stmt)->name] = stmt->visible;
+    }
+  }
+  TEST_TRUE(visible["Light"]);
+  TEST_TRUE(visible["Material"]);
+  TEST_FALSE(visible["Unused"]);
+  TEST_TRUE(visible["Color"]);
+  TEST_FALSE(visible["Unused4"]);
+  TEST_TRUE(visible["NUM_LIGHTS"]);
+  TEST_FALSE(visible["UNUSED_CONST"]);
+  TEST_TRUE(visible["PerFrame"]);
+  TEST_TRUE(visible["viewProj"]);
+  TEST_TRUE(visible["time"]);
+  TEST_FALSE(visible["unusedTime"]);
+  TEST_FALSE(visible["PerDraw"]);
+  TEST_FALSE(visible["world"]);
+  TEST_TRUE(visible["lights"]);
+  TEST_TRUE(visible["albedoMap"]);
+  TEST_TRUE(visible["linearSampler"]);
+  TEST_FALSE(visible["unusedMap"]);
+  TEST_TRUE(visible["shade"]);
+
+  // Only the fields of the buffers that are kept are reported as unused.
+  TEST_EQUALS(prune.unusedFields.size(), 1ull);
+  TEST_TRUE(prune.unusedFields[0]->name == "unusedTime");
+
+  // Pruning for an entry point that doesn't exist hides everything.
+  prune.prune("missing");
+  TEST_FALSE(ast->findFunction("main")->visible);
+  TEST_TRUE(prune.unusedFields.empty());
+
+  delete ast;
+});
+
+static Test test_prune_tree_overloads("Test Prune Tree overloads", []() {
+  Parser parser(R"(
+    float foo(float a) { return a; }
+    float2 foo(float2 a) { return a; }
+    float main(float x : TEXCOORD0) : SV_Target {
+      float r = foo(1.0);
+      return r;
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  const std::vector<ast::FunctionStmt*>& overloads = ast->findOverloads("foo");
+  TEST_EQUALS(overloads.size(), 2ull);
+
+  // The calls are resolved by prune(), so only the overload called is kept.
+  PruneTree prune(ast);
+  prune.prune("main");
+  TEST_TRUE(overloads[0]->visible);
+  TEST_FALSE(overloads[1]->visible);
+  delete ast;
+
+  // A call that can't be resolved keeps every overload with its name.
+  Parser unresolved(R"(
+    float foo(float a) { return a; }
+    float2 foo(float2 a) { return a; }
+    float main(float x : TEXCOORD0) : SV_Target {
+      foo(x);
+      return x;
+    }
+  )");
+  ast = unresolved.parse();
+  TEST_FALSE(unresolved.hasErrors());
+  Reachability reachability(ast);
+  reachability.compute({ "main" });
+  const ReachableSet reachable = reachability.reachableSet(0);
+  TEST_TRUE(reachable.contains(ast->findOverloads("foo")[0]));
+  TEST_TRUE(reachable.contains(ast->findOverloads("foo")[1]));
+  delete ast;
+});
+
 } // namespace prune_tree_tests
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/glsl_generator.h"
+#include "../../lib/visitor/prune_tree.h"
+#include "../../lib/visitor/reachability.h"
+#include "../../lib/visitor/resolve_symbols.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace reachability_tests {
+
+// The field of a cbuffer with the given name.
+inline ast::Field* findBufferField(ast::Ast* ast, const std::string_view& name) {
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::BufferStmt) {
+      for (ast::Field* field = static_cast<ast::BufferStmt*>(stmt)->field; field != nullptr;
+           field = field->next) {
+        if (field->name == name) {
+          return field;
+        }
+      }
+    }
+  }
+  return nullptr;
+}
+
+static Test test_reachability("Reachability", []() {
+  Parser parser(R"(
+    cbuffer PerFrame { float4x4 viewProj; float time; float unusedField; };
+    Texture2D albedo;
+    SamplerState linearSampler;
+    RWTexture2D<float4> output;
+    float scale = 2;
+    float helper(float x) { return x * scale; }
+    float unused(float x) { return x; }
+    float4 VSMain(float4 p : POSITION) : SV_Position { return mul(viewProj, p) * helper(time); }
+    float4 PSMain(float2 uv : TEXCOORD0) : SV_Target { return albedo.Sample(linearSampler, uv); }
+    [numthreads(8, 8, 1)]
+    void CSMain(uint3 id : SV_DispatchThreadID) { output[id.xy] = float4(helper(1), 0, 0, 1); }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols(ast).resolve();
+
+  Reachability reachability(ast);
+  reachability.compute({ "VSMain", "PSMain", "CSMain", "missing" });
+  TEST_EQUALS(reachability.numEntryPoints(), 4ull);
+  // The statements and the three cbuffer fields.
+  TEST_EQUALS(reachability.numSymbols(), 13ull);
+
+  const ReachableSet vertex = reachability.reachableSet(0);
+  const ReachableSet fragment = reachability.reachableSet(1);
+  const ReachableSet compute = reachability.reachableSet(2);
+  const ReachableSet missing = reachability.reachableSet(3);
+
+  ast::Node* perFrame = ast->root()->statements;
+  ast::Node* helper = ast->findFunction("helper");
+  ast::Node* scale = ast->findGlobalVariable("scale");
+  ast::Node* albedo = ast->findGlobalVariable("albedo");
+  ast::Node* sampler = ast->findGlobalVariable("linearSampler");
+  ast::Node* output = ast->findGlobalVariable("output");
+
+  TEST_TRUE(vertex.contains(ast->findFunction("VSMain")));
+  TEST_TRUE(vertex.contains(perFrame));
+  TEST_TRUE(vertex.contains(findBufferField(ast, "viewProj")));
+  TEST_TRUE(vertex.contains(findBufferField(ast, "time")));
+  TEST_FALSE(vertex.contains(findBufferField(ast, "unusedField")));
+  TEST_TRUE(vertex.contains(helper));
+  TEST_TRUE(vertex.contains(scale));
+  TEST_FALSE(vertex.contains(albedo));
+  TEST_FALSE(vertex.contains(ast->findFunction("PSMain")));
+
+  TEST_TRUE(fragment.contains(albedo));
+  TEST_TRUE(fragment.contains(sampler));
+  TEST_FALSE(fragment.contains(perFrame));
+  TEST_FALSE(fragment.contains(helper));
+
+  TEST_TRUE(compute.contains(output));
+  TEST_TRUE(compute.contains(helper));
+  TEST_TRUE(compute.contains(scale));
+  TEST_FALSE(compute.contains(sampler));
+
+  TEST_FALSE(missing.contains(helper));
+  TEST_FALSE(vertex.contains(ast->findFunction("unused")));
+  TEST_FALSE(compute.contains(ast->findFunction("unused")));
+
+  // The Ast isn't changed.
+  bool allVisible = true;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    allVisible = allVisible && stmt->visible;
+  }
+  TEST_TRUE(allVisible);
+
+  // A set stays valid after the Reachability it was taken from is destroyed.
+  std::unique_ptr<Reachability> temporary = std::make_unique<Reachability>(ast);
+  temporary->compute({ "PSMain" });
+  const ReachableSet kept = temporary->reachableSet(0);
+  temporary.reset();
+  TEST_TRUE(kept.contains(albedo));
+  TEST_FALSE(kept.contains(helper));
+
+  delete ast;
+});
+
+static Test test_reachability_corpus("Reachability corpus", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols(ast).resolve();
+
+  // Use every function as an entry point, which needs more than one word of bits.
+  std::vector<std::string_view> entryPoints;
+  std::vector<ast::FunctionStmt*> functions;
+  for (ast::Statement* stmt = ast->root()->statements; stmt != nullptr; stmt = stmt->next) {
+    if (stmt->nodeType == ast::NodeType::FunctionStmt &&
+        ast->findFunction(static_cast<ast::FunctionStmt*>(stmt)->name) == stmt) {
+      functions.push_back(static_cast<ast::FunctionStmt*>(stmt));
+      entryPoints.push_back(functions.back()->name);
+    }
+  }
+  TEST_TRUE(entryPoints.size() > 64);
+
+  Reachability reachability(ast);
+  reachability.compute(entryPoints);
+
+  // Computing all of the entry points at once finds the same symbols as one at a time.
+  bool same = true;
+  Reachability single(ast);
+  for (size_t i = 0; i < entryPoints.size(); ++i) {
+    single.compute({ entryPoints[i] });
+    for (uint32_t id = 0; id < reachability.numSymbols(); ++id) {
+      same = same && reachability.isReachable(id, i) == single.isReachable(id, 0);
+    }
+  }
+  TEST_TRUE(same);
+
+  // The default of a parameter after the first is reachable.
+  const uint32_t identity = reachability.symbolId(ast->findGlobalVariable("k_identity4x4"));
+  const size_t clipSpace = std::find(entryPoints.begin(), entryPoints.end(),
+                                     "ComputeClipSpacePosition") - entryPoints.begin();
+  TEST_TRUE(clipSpace < entryPoints.size());
+  TEST_TRUE(reachability.isReachable(identity, clipSpace));
+
+  delete ast;
+});
+
+static Test test_reachability_threads("Reachability visible sets across threads", []() {
+  Parser parser(R"(
+    float4x4 viewProj;
+    float time;
+    Texture2D albedo;
+    SamplerState linearSampler;
+    float scale = 2;
+    float helper(float x) { return x * scale; }
+    float4 VSMain(float4 p : POSITION) : SV_Position { return mul(viewProj, p) * helper(time); }
+    float4 PSMain(float2 uv : TEXCOORD0) : SV_Target { return albedo.Sample(linearSampler, uv); }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols(ast).resolve();
+
+  const std::vector<std::string_view> entryPoints = { "VSMain", "PSMain" };
+  Reachability reachability(ast);
+  reachability.compute(entryPoints);
+
+  // Generate the code for each entry point on its own thread from the same Ast.
+  std::string generated[2];
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < entryPoints.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      const ReachableSet visible = reachability.reachableSet(i);
+      std::ostringstream out;
+      GlslGenerator generator(out);
+      generator.setVisibleSet(&visible);
+      generator.visitRoot(ast->root());
+      generated[i] = out.str();
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  // It's the code generated after pruning the Ast for each entry point in turn.
+  bool same = true;
+  VisibilityVisitor reset(false);
+  for (size_t i = 0; i < entryPoints.size(); ++i) {
+    reset.visitRoot(ast->root());
+    PruneTree(ast).prune(entryPoints[i]);
+    same = same && generateGlsl(ast) == generated[i];
+  }
+  TEST_TRUE(same);
+  TEST_TRUE(generated[0].find("helper") != std::string::npos);
+  TEST_TRUE(generated[1].find("helper") == std::string::npos);
+  TEST_TRUE(generated[1].find("albedo") != std::string::npos);
+
+  delete ast;
+});
+
+} // namespace reachability_tests
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/prune_tree.h"
+#include "../../lib/visitor/reflect_bindings.h"
+#include "../../lib/visitor/resolve_symbols.h"
+#include "../test.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace reflect_bindings_tests {
+
+static const char* source = R"(
+  static const int NUM_SHADOWS = 2;
+  struct Light { float3 direction; float3 color; };
+  cbuffer PerFrame : register(b0) { float4x4 viewProjection; float time; };
+  cbuffer PerMaterial : register(b1, space2) { float4 tint; };
+  Texture2D<float4> albedo : register(t0);
+  Texture2D shadows[NUM_SHADOWS * 2] : register(t1, space1);
+  TextureCube<float> unused : register(t8);
+  SamplerState linearSampler : register(s0);
+  SamplerComparisonState shadowSampler;
+  StructuredBuffer<Light> lights : register(t5);
+  RWTexture2D<float4> output : register(u0), history : register(u1);
+  float4 globalColor;
+  float4 main(float2 uv : TEXCOORD0) : SV_Target {
+    float4 color = albedo.Sample(linearSampler, uv) * tint;
+    color.rgb *= lights[0].color * shadows[1].SampleCmp(shadowSampler, uv, 0.5);
+    output[uint2(uv)] = color;
+    return color;
+  }
+)";
+
+static Test test_reflect_bindings("Reflect Bindings", []() {
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols(ast).resolve();
+  PruneTree(ast).prune("main");
+
+  ReflectBindings reflect(ast);
+  reflect.reflect();
+  TEST_EQUALS(reflect.bindings.size(), 10ull);
+
+  const Binding& perFrame = reflect.bindings[0];
+  TEST_TRUE(perFrame.name == "PerFrame");
+  TEST_TRUE(perFrame.kind == BindingKind::ConstantBuffer);
+  TEST_EQUALS(perFrame.registerClass, 'b');
+  TEST_EQUALS(perFrame.registerIndex, 0);
+  TEST_FALSE(perFrame.used);
+  const Binding& perMaterial = reflect.bindings[1];
+  TEST_EQUALS(perMaterial.registerIndex, 1);
+  TEST_EQUALS(perMaterial.space, 2u);
+  TEST_TRUE(perMaterial.used);
+
+  const Binding& albedo = reflect.bindings[2];
+  TEST_TRUE(albedo.kind == BindingKind::Texture);
+  TEST_TRUE(albedo.dimension == BindingDimension::Texture2D);
+  TEST_TRUE(albedo.elementType == ast::BaseType::Float4);
+  TEST_EQUALS(albedo.registerClass, 't');
+  TEST_EQUALS(albedo.arrayCount, 1u);
+  TEST_TRUE(albedo.used);
+
+  // The size of an array is evaluated from constants.
+  const Binding& shadows = reflect.bindings[3];
+  TEST_EQUALS(shadows.arrayCount, 4u);
+  TEST_EQUALS(shadows.registerIndex, 1);
+  TEST_EQUALS(shadows.space, 1u);
+  TEST_TRUE(shadows.elementType == ast::BaseType::Float4);
+
+  const Binding& unused = reflect.bindings[4];
+  TEST_TRUE(unused.dimension == BindingDimension::TextureCube);
+  TEST_TRUE(unused.elementType == ast::BaseType::Float);
+  TEST_FALSE(unused.used);
+
+  TEST_TRUE(reflect.bindings[5].kind == BindingKind::Sampler);
+  TEST_EQUALS(reflect.bindings[5].registerClass, 's');
+  // A resource without a register is left for the runtime to bind.
+  const Binding& shadowSampler = reflect.bindings[6];
+  TEST_EQUALS(shadowSampler.registerClass, 0);
+  TEST_EQUALS(shadowSampler.registerIndex, -1);
+  TEST_TRUE(shadowSampler.used);
+
+  const Binding& lights = reflect.bindings[7];
+  TEST_TRUE(lights.kind == BindingKind::StructuredBuffer);
+  TEST_TRUE(lights.elementType == ast::BaseType::Struct);
+  TEST_TRUE(lights.elementName == "Light");
+
+  // Each variable of a list has its own register.
+  TEST_TRUE(reflect.bindings[8].kind == BindingKind::UnorderedAccess);
+  TEST_TRUE(reflect.bindings[8].used);
+  TEST_TRUE(reflect.bindings[9].name == "history");
+  TEST_EQUALS(reflect.bindings[9].registerIndex, 1);
+  TEST_FALSE(reflect.bindings[9].used);
+
+  std::ostringstream json;
+  reflect.writeJson(json);
+  TEST_TRUE(json.str().find(
+      "{\"name\": \"shadows\", \"kind\": \"texture\", \"dimension\": \"2d\", \"type\": "
+      "\"Texture2D\", \"elementType\": \"float4\", \"register\": \"t\", \"index\": 1, "
+      "\"space\": 1, \"arrayCount\": 4, \"used\": true}") != std::string::npos);
+
+  delete ast;
+});
+
+static Test test_reflect_bindings_binary("Reflect Bindings binary", []() {
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  // Reflected with a ReachableSet, the Ast isn't pruned.
+  Reachability reachability(ast);
+  reachability.compute({ "main" });
+  const ReachableSet used = reachability.reachableSet(0);
+  ReflectBindings reflect(ast);
+  reflect.reflect(&used);
+  TEST_EQUALS(reflect.bindings.size(), 10ull);
+  TEST_FALSE(reflect.bindings[4].used);
+  TEST_TRUE(ast->findGlobalVariable("unused")->visible);
+
+  const std::vector<uint8_t> blob = reflect.writeBinary();
+  TEST_EQUALS(blob.size() % 4, 0ull);
+  PackedBindingHeader header;
+  memcpy(&header, blob.data(), sizeof(header));
+  TEST_EQUALS(header.magic, packedBindingMagic);
+  TEST_EQUALS(header.version, packedBindingVersion);
+  TEST_EQUALS(header.bindingSize, sizeof(PackedBinding));
+  TEST_EQUALS(header.numBindings, 10u);
+  TEST_EQUALS(header.stringsOffset, sizeof(PackedBindingHeader) + 10 * sizeof(PackedBinding));
+
+  const char* strings = reinterpret_cast<const char*>(blob.data() + header.stringsOffset);
+  for (uint32_t i = 0; i < header.numBindings; ++i) {
+    const Binding& binding = reflect.bindings[i];
+    PackedBinding packed;
+    memcpy(&packed, blob.data() + sizeof(header) + i * sizeof(PackedBinding), sizeof(packed));
+    TEST_TRUE(binding.name == strings + packed.name);
+    TEST_TRUE(binding.elementName == strings + packed.elementName);
+    TEST_EQUALS(packed.kind, static_cast<uint8_t>(binding.kind));
+    TEST_EQUALS(packed.dimension, static_cast<uint8_t>(binding.dimension));
+    TEST_EQUALS(packed.registerClass, static_cast<uint8_t>(binding.registerClass));
+    TEST_EQUALS(packed.flags, binding.used ? packedBindingUsed : 0);
+    TEST_EQUALS(packed.elementType, static_cast<uint16_t>(binding.elementType));
+    TEST_EQUALS(packed.registerIndex, binding.registerIndex);
+    TEST_EQUALS(packed.space, binding.space);
+    TEST_EQUALS(packed.arrayCount, binding.arrayCount);
+  }
+
+  delete ast;
+});
+
+} // namespace reflect_bindings_tests
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../lib/ast/flat_ast.h"
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/prune_tree.h"
+#include "../../lib/visitor/resolve_symbols.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace resolve_symbols_tests {
+
+// The nodes of the given type in the subtree of the function, in pre-order.
+template<typename T>
+inline std::vector<T*> nodesIn(const ast::FlatAst& flat, ast::FunctionStmt* function) {
+  std::vector<T*> nodes;
+  for (uint32_t i = 0; i < flat.size(); ++i) {
+    if (flat[i].node == function) {
+      flat.forEachInSubtree(i, T::astType, [&](uint32_t n) {
+        nodes.push_back(static_cast<T*>(flat[n].node));
+      });
+    }
+  }
+  return nodes;
+}
+
+// The call that initializes the variable declared by the statement.
+inline ast::CallExpr* initializerCall(ast::Statement* stmt) {
+  return static_cast<ast::CallExpr*>(static_cast<ast::VariableStmt*>(stmt)->initializer);
+}
+
+// The number of parameters of a function.
+inline size_t numParameters(const ast::FunctionStmt* function) {
+  size_t count = 0;
+  for (const ast::Parameter* p = function->parameters; p != nullptr; p = p->next) {
+    count++;
+  }
+  return count;
+}
+
+static Test test_resolve_symbols("Resolve Symbols", []() {
+  Parser parser(R"(
+    cbuffer Params { float4 tint; float scale; };
+    float g = 1;
+    float f(float a);
+    float f(float a) { return a * scale; }
+    float f(int a) { return a; }
+    float f(float a, float b = 1) { return a + b; }
+    struct S {
+      float x;
+      float get() { return x; }
+      float twice() { return get() * 2; }
+    };
+    float4 main(float4 p, int i) : SV_Target {
+      float g = f(i);
+      S s;
+      float y = f(g) + f(g, scale) + s.twice() + s.x;
+      for (int j = 0; j < 2; ++j) { float k = j; y += k; }
+      return tint * y * g * p;
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+
+  // The definition of f(float) replaces its forward declaration.
+  const std::vector<ast::FunctionStmt*>& overloads = ast->findOverloads("f");
+  TEST_EQUALS(overloads.size(), 3ull);
+  TEST_TRUE(ast->findFunction("f") == overloads[2]);
+  ast::FunctionStmt* fFloat = overloads[0];
+  ast::FunctionStmt* fInt = overloads[1];
+  ast::FunctionStmt* fTwo = overloads[2];
+  TEST_TRUE(fFloat->body->statements != nullptr);
+  TEST_TRUE(fInt->parameters->type->baseType == ast::BaseType::Int);
+
+  ResolveSymbols resolver(ast);
+  resolver.resolve();
+
+  ast::FlatAst flat(ast);
+  ast::FunctionStmt* main = ast->findFunction("main");
+  const std::vector<ast::CallExpr*> calls = nodesIn<ast::CallExpr>(flat, main);
+  TEST_EQUALS(calls.size(), 4ull);
+  TEST_TRUE(calls[0]->function == fInt);
+  TEST_TRUE(calls[1]->function == fFloat);
+  TEST_TRUE(calls[2]->function == fTwo);
+  TEST_TRUE(calls[3]->function != nullptr && calls[3]->function->name == "twice");
+
+  ast::FunctionStmt* twice = calls[3]->function;
+  TEST_EQUALS(resolver.callees(main).size(), 4ull);
+  TEST_EQUALS(resolver.callees(twice).size(), 1ull);
+  TEST_TRUE(resolver.callees(twice)[0]->name == "get");
+  TEST_TRUE(resolver.callees(fInt).empty());
+
+  // The local g hides the global, the cbuffer fields and parameters are found, and the member
+  // x is the field of S.
+  bool resolved = true;
+  for (ast::VariableExpr* variable : nodesIn<ast::VariableExpr>(flat, main)) {
+    ast::Node* declaration = variable->declaration;
+    resolved = resolved && declaration != nullptr;
+    if (declaration == nullptr) {
+      std::cout << "Unresolved " << variable->name << std::endl;
+      continue;
+    }
+    if (variable->name == "g") {
+      resolved = resolved && declaration != ast->findGlobalVariable("g");
+      resolved = resolved && declaration->nodeType == ast::NodeType::VariableStmt;
+    } else if (variable->name == "tint" || variable->name == "scale" || variable->name == "x") {
+      resolved = resolved && declaration->nodeType == ast::NodeType::Field;
+    } else if (variable->name == "p") {
+      resolved = resolved && declaration->nodeType == ast::NodeType::Parameter;
+    } else if (variable->name == "j" || variable->name == "k" || variable->name == "y" ||
+               variable->name == "s") {
+      resolved = resolved && declaration->nodeType == ast::NodeType::VariableStmt;
+    }
+  }
+  TEST_TRUE(resolved);
+
+  // In a method, the fields of the struct are in scope.
+  const std::vector<ast::VariableExpr*> getVariables =
+      nodesIn<ast::VariableExpr>(flat, static_cast<ast::FunctionStmt*>(resolver.callees(twice)[0]));
+  TEST_TRUE(getVariables.empty() ||
+            getVariables[0]->declaration->nodeType == ast::NodeType::Field);
+
+  // Pruning follows the resolved overloads, so only the ones main calls are kept.
+  VisibilityVisitor reset(false);
+  reset.visitRoot(ast->root());
+  PruneTree(ast).prune("main");
+  TEST_TRUE(fFloat->visible);
+  TEST_TRUE(fInt->visible);
+  TEST_TRUE(fTwo->visible);
+  TEST_FALSE(ast->findGlobalVariable("g")->visible);
+
+  delete ast;
+});
+
+static Test test_resolve_symbols_overload_count("Resolve Symbols overload by count", []() {
+  Parser parser(R"(
+    float h(float a) { return a; }
+    float h(float a, float b) { return a * b; }
+    float unused(float a, float b, float c) { return a; }
+    float main(float v) { return h(v, v); }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols resolver(ast);
+  resolver.resolve();
+
+  ast::FunctionStmt* main = ast->findFunction("main");
+  TEST_EQUALS(resolver.callees(main).size(), 1ull);
+  TEST_EQUALS(numParameters(resolver.callees(main)[0]), 2ull);
+
+  // Pruning keeps the overload that's called and drops the one-parameter overload.
+  VisibilityVisitor reset(false);
+  reset.visitRoot(ast->root());
+  PruneTree(ast).prune("main");
+  TEST_FALSE(ast->findOverloads("h")[0]->visible);
+  TEST_TRUE(ast->findOverloads("h")[1]->visible);
+  TEST_FALSE(ast->findFunction("unused")->visible);
+  delete ast;
+});
+
+static Test test_resolve_symbols_overload_swizzle("Resolve Symbols overload by swizzle", []() {
+  Parser parser(R"(
+    float foo(float a) { return a; }
+    float2 foo(float2 a) { return a; }
+    float bar(float a) { return a; }
+    float bar(int a) { return a; }
+    float2 main(float4 a : TEXCOORD0, float4x4 m : TEXCOORD1) : SV_Target {
+      float2 r = foo(a.xy);
+      float s = foo(m._m00);
+      float t = bar(unknown);
+      return r * s * t;
+    }
+  )");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols resolver(ast);
+  resolver.resolve();
+
+  ast::FunctionStmt* main = ast->findFunction("main");
+  ast::Statement* stmt = main->body->statements;
+  TEST_TRUE(initializerCall(stmt)->function == ast->findOverloads("foo")[1]);
+  TEST_TRUE(initializerCall(stmt->next)->function == ast->findOverloads("foo")[0]);
+  // An argument of unknown type matches both overloads equally, so neither is chosen.
+  TEST_TRUE(initializerCall(stmt->next->next)->function == nullptr);
+
+  // Pruning keeps both overloads of foo, which are both called, and both of bar, either of
+  // which may be.
+  PruneTree(ast).prune("main");
+  TEST_TRUE(ast->findOverloads("foo")[0]->visible);
+  TEST_TRUE(ast->findOverloads("foo")[1]->visible);
+  TEST_TRUE(ast->findOverloads("bar")[0]->visible);
+  TEST_TRUE(ast->findOverloads("bar")[1]->visible);
+  delete ast;
+});
+
+static Test test_resolve_symbols_corpus("Resolve Symbols corpus", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ResolveSymbols resolver(ast);
+  resolver.resolve();
+
+  // FragPrefilter returns EncodeHDR(color), of its local color.
+  ast::Statement* last = ast->findFunction("FragPrefilter")->body->statements;
+  while (last->next != nullptr) {
+    last = last->next;
+  }
+  TEST_TRUE(last->nodeType == ast::NodeType::ReturnStmt);
+  ast::CallExpr* encode = static_cast<ast::CallExpr*>(static_cast<ast::ReturnStmt*>(last)->value);
+  TEST_TRUE(encode->function == ast->findFunction("EncodeHDR"));
+  ast::VariableExpr* color = static_cast<ast::VariableExpr*>(encode->arguments);
+  TEST_NOT_NULL(color->declaration);
+  TEST_TRUE(color->declaration->nodeType == ast::NodeType::VariableStmt);
+
+  // Every call of a function declared in the source is resolved, unless it matches several of
+  // the overloads equally well, and every other call is to an intrinsic or a method of a
+  // built-in type.
+  ast::FlatAst flat(ast);
+  size_t numCalls = 0;
+  size_t numResolved = 0;
+  size_t numAmbiguous = 0;
+  bool callsResolved = true;
+  flat.forEach(ast::NodeType::CallExpr, [&](uint32_t i) {
+    ast::CallExpr* call = static_cast<ast::CallExpr*>(flat[i].node);
+    const bool member = flat[flat[i].parent].nodeType == ast::NodeType::MemberExpr;
+    numCalls++;
+    numResolved += call->function != nullptr ? 1 : 0;
+    const size_t numOverloads = member ? 0 : ast->findOverloads(call->name).size();
+    if (call->function != nullptr) {
+      callsResolved = callsResolved && call->function->name == call->name;
+    } else if (numOverloads != 0) {
+      // Only a call that matches several overloads equally well is left unresolved.
+      callsResolved = callsResolved && numOverloads > 1;
+      numAmbiguous++;
+    }
+  });
+  TEST_TRUE(callsResolved);
+  TEST_TRUE(numResolved > 0);
+  TEST_TRUE(numResolved < numCalls);
+  TEST_TRUE(numAmbiguous < numResolved);
+  delete ast;
+});
+
+} // namespace resolve_symbols_tests
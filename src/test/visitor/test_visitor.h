@@ -0,0 +1,115 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../lib/reader/hlsl/parser.h"
+#include "../../lib/visitor/static_visitor.h"
+#include "../../lib/visitor/visitor.h"
+#include "../test.h"
+#include "../test_util.h"
+
+using namespace reader::hlsl;
+using namespace visitor;
+
+namespace visitor_tests {
+
+// Records the expressions the base Visitor walk reaches, in the order it reaches them.
+class ExpressionRecorder : public Visitor {
+public:
+  std::vector<ast::NodeType> types;
+  std::vector<std::string_view> names;
+
+  void visitBinaryExpr(ast::BinaryExpr* node) override {
+    types.push_back(node->nodeType);
+    Visitor::visitBinaryExpr(node);
+  }
+
+  void visitCallExpr(ast::CallExpr* node) override {
+    types.push_back(node->nodeType);
+    names.push_back(node->name);
+    Visitor::visitCallExpr(node);
+  }
+
+  void visitVariableExpr(ast::VariableExpr* node) override {
+    types.push_back(node->nodeType);
+    names.push_back(node->name);
+  }
+};
+
+// Records the same expressions as ExpressionRecorder through StaticVisitor.
+class StaticExpressionRecorder : public StaticVisitor<StaticExpressionRecorder> {
+public:
+  std::vector<ast::NodeType> types;
+  std::vector<std::string_view> names;
+
+  void visitBinaryExpr(ast::BinaryExpr* node) {
+    types.push_back(node->nodeType);
+    StaticVisitor::visitBinaryExpr(node);
+  }
+
+  void visitCallExpr(ast::CallExpr* node) {
+    types.push_back(node->nodeType);
+    names.push_back(node->name);
+    StaticVisitor::visitCallExpr(node);
+  }
+
+  void visitVariableExpr(ast::VariableExpr* node) {
+    types.push_back(node->nodeType);
+    names.push_back(node->name);
+  }
+};
+
+static Test test_visitor_order("Visitor expression order", []() {
+  Parser parser("float f(float a, float b, float c) { return a + max(b, -c) * a; }");
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ExpressionRecorder recorder;
+  recorder.visitRoot(ast->root());
+  // The walk is pre-order, visiting the operands of each expression from left to right.
+  const std::vector<std::string_view> names = { "a", "max", "b", "c", "a" };
+  TEST_TRUE(recorder.names == names);
+  TEST_EQUALS(recorder.types.size(), 7ull);
+  TEST_TRUE(recorder.types[0] == ast::NodeType::BinaryExpr);
+  TEST_TRUE(recorder.types[2] == ast::NodeType::BinaryExpr);
+  delete ast;
+});
+
+static Test test_visitor_long_chain("Visitor long binary chain", []() {
+  // A chain of operators nests as deeply as it is long, which would overflow the stack of a
+  // recursive parser or visitor.
+  const size_t length = 200000;
+  std::string source = "float f(float a) { return a";
+  for (size_t i = 0; i < length; ++i) {
+    source += " + a";
+  }
+  source += "; }";
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ExpressionRecorder recorder;
+  recorder.visitRoot(ast->root());
+  TEST_EQUALS(recorder.names.size(), length + 1);
+  TEST_EQUALS(recorder.types.size(), length * 2 + 1);
+  delete ast;
+});
+
+static Test test_static_visitor_order("StaticVisitor matches Visitor", []() {
+  const std::string source = loadFile(Test::dataPath("/hlsl/urp_bloom.hlsl"));
+  TEST_FALSE(source.empty());
+
+  Parser parser(source);
+  ast::Ast* ast = parser.parse();
+  TEST_FALSE(parser.hasErrors());
+  ExpressionRecorder recorder;
+  recorder.visitRoot(ast->root());
+  StaticExpressionRecorder staticRecorder;
+  staticRecorder.visitRoot(ast->root());
+  TEST_FALSE(recorder.names.empty());
+  TEST_TRUE(staticRecorder.names == recorder.names);
+  TEST_TRUE(staticRecorder.types == recorder.types);
+  delete ast;
+});
+
+} // namespace visitor_tests
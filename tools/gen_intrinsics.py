@@ -0,0 +1,223 @@
+def enumName(s):
+    # ddx_coarse becomes DdxCoarse.
+    parts = s.split('_')
+    return ''.join(p[0].upper() + p[1:] for p in parts)
+
+# Each line of intrinsics.txt is the name of an intrinsic, the number of arguments it takes, as
+# a count or a range such as 2-4, and what it returns: either a rule for working out the type
+# from the arguments, such as common, or a type, such as float4. A name starting with '.' is a
+# method of a texture or buffer, such as Sample.
+fp = open('intrinsics.txt', 'rt')
+intrinsics = []
+for l in fp.readlines():
+    fields = l.strip().split(' ')
+    if len(fields) != 3:
+        continue
+    name, arguments, returns = fields
+    method = name.startswith('.')
+    if method:
+        name = name[1:]
+    if '-' in arguments:
+        minArguments, maxArguments = arguments.split('-')
+    else:
+        minArguments = maxArguments = arguments
+    intrinsics.append((name, int(minArguments), int(maxArguments), method, returns))
+fp.close()
+
+rules = [
+    'float_of_first',
+    'float_scalar',
+    'common',
+    'common_scalar',
+    'bool_of_first',
+    'int_of_first',
+    'uint_of_first',
+    'as_float',
+    'transpose',
+    'mul',
+    'element',
+    'gather',
+]
+
+####################################################################################################
+# The perfect hash
+#
+# The names are hashed into buckets, and each bucket is given a seed so that hashing its names
+# again with the seed puts each in a slot of its own. Looking a name up hashes it twice and
+# compares it with the one name in its slot.
+####################################################################################################
+def fnv1a(seed, s):
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for c in s.encode('ascii'):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+numSlots = len(intrinsics)
+numBuckets = (len(intrinsics) + 1) // 2
+buckets = [[] for _ in range(numBuckets)]
+for i, intrinsic in enumerate(intrinsics):
+    buckets[fnv1a(0, intrinsic[0]) % numBuckets].append(i)
+
+seeds = [0] * numBuckets
+slots = [None] * numSlots
+for b in sorted(range(numBuckets), key=lambda b: -len(buckets[b])):
+    if not buckets[b]:
+        continue
+    seed = 1
+    while True:
+        taken = [fnv1a(seed, intrinsics[i][0]) % numSlots for i in buckets[b]]
+        if len(set(taken)) == len(taken) and all(slots[s] is None for s in taken):
+            break
+        seed += 1
+    seeds[b] = seed
+    for i, s in zip(buckets[b], taken):
+        slots[s] = i
+
+####################################################################################################
+# ast/intrinsic.h
+####################################################################################################
+fp = open('../src/lib/ast/intrinsic.h', 'wt')
+fp.write('''#pragma once
+// Generated by tools/gen_intrinsics.py
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "base_type.h"
+
+namespace ast {
+
+/// The intrinsic functions of HLSL, such as mul and lerp, and the methods of textures and
+/// buffers, such as Sample.
+enum class Intrinsic : uint16_t {
+  None,
+''')
+for intrinsic in intrinsics:
+    fp.write('  {0},\n'.format(enumName(intrinsic[0])))
+fp.write('''};
+
+''')
+fp.write('/// The number of Intrinsic values, including None.\n')
+fp.write('const size_t numIntrinsics = static_cast<size_t>(Intrinsic::{0}) + 1;\n'.format(
+    enumName(intrinsics[-1][0])))
+fp.write('''
+/// How the return type of an intrinsic follows from the types of its arguments.
+enum class IntrinsicReturn : uint8_t {
+  /// The type given by IntrinsicInfo::returnType, such as float4 for tex2D.
+  Type,
+  /// The shape of the first argument, of float if it isn't already floating point, as sin.
+  FloatOfFirst,
+  /// A scalar of the float type of the first argument, as length.
+  FloatScalar,
+  /// The type all the arguments combine to, as lerp.
+  Common,
+  /// A scalar of the type all the arguments combine to, as dot.
+  CommonScalar,
+  /// The shape of the first argument, of bool, int or uint, as isnan, sign and countbits.
+  BoolOfFirst,
+  IntOfFirst,
+  UintOfFirst,
+  /// The shape of the first argument, of float, as asfloat.
+  AsFloat,
+  /// The matrix with the rows and columns of the argument swapped.
+  Transpose,
+  /// The product of a matrix or vector with a matrix or vector.
+  Mul,
+  /// The element type of the texture or buffer, as Sample.
+  Element,
+  /// A 4 component vector of the element type of the texture, as Gather.
+  Gather,
+};
+
+/// The signature of an intrinsic.
+struct IntrinsicInfo {
+  std::string_view name;
+  /// The fewest and most arguments it takes.
+  uint8_t minArguments;
+  uint8_t maxArguments;
+  /// Whether it's a method of a texture or buffer, rather than a function.
+  bool method;
+  IntrinsicReturn returns;
+  /// The type returned, if returns is IntrinsicReturn::Type.
+  BaseType returnType;
+};
+
+/// The intrinsic with the name, or Intrinsic::None if there isn't one, found with a perfect
+/// hash in constant time.
+Intrinsic findIntrinsic(const std::string_view& name);
+
+/// The signature of the intrinsic. The name of Intrinsic::None is empty.
+const IntrinsicInfo& intrinsicInfo(Intrinsic intrinsic);
+
+} // namespace ast
+''')
+fp.close()
+
+####################################################################################################
+# ast/intrinsic.cpp
+####################################################################################################
+fp = open('../src/lib/ast/intrinsic.cpp', 'wt')
+fp.write('''// Generated by tools/gen_intrinsics.py
+#include "intrinsic.h"
+
+#include <cstddef>
+
+namespace ast {
+
+static const IntrinsicInfo _intrinsics[] = {
+  {"", 0, 0, false, IntrinsicReturn::Type, BaseType::Undefined},
+''')
+for name, minArguments, maxArguments, method, returns in intrinsics:
+    if returns in rules:
+        returnRule = enumName(returns)
+        returnType = 'Undefined'
+    else:
+        returnRule = 'Type'
+        returnType = enumName(returns)
+    fp.write('  {{"{0}", {1}, {2}, {3}, IntrinsicReturn::{4}, BaseType::{5}}},\n'.format(
+        name, minArguments, maxArguments, 'true' if method else 'false', returnRule, returnType))
+fp.write('''};
+
+// The seed of each bucket of the perfect hash.
+static const uint16_t _seeds[] = {
+''')
+for i in range(0, numBuckets, 16):
+    fp.write('  {0},\n'.format(', '.join(str(s) for s in seeds[i:i + 16])))
+fp.write('''};
+
+// The intrinsic in each slot of the perfect hash.
+static const Intrinsic _slots[] = {
+''')
+for i in slots:
+    fp.write('  Intrinsic::{0},\n'.format(enumName(intrinsics[i][0])))
+fp.write('''};
+
+// FNV-1a, starting from the seed.
+static uint32_t _hash(uint32_t seed, const std::string_view& name) {
+  uint32_t h = 2166136261u ^ seed;
+  for (const char c : name) {
+    h = (h ^ static_cast<uint8_t>(c)) * 16777619u;
+  }
+  return h;
+}
+
+Intrinsic findIntrinsic(const std::string_view& name) {
+''')
+fp.write('  if (name.size() < {0} || name.size() > {1}) {{\n'.format(
+    min(len(i[0]) for i in intrinsics), max(len(i[0]) for i in intrinsics)))
+fp.write('''    return Intrinsic::None;
+  }
+''')
+fp.write('  const uint32_t seed = _seeds[_hash(0, name) % {0}];\n'.format(numBuckets))
+fp.write('  const Intrinsic intrinsic = _slots[_hash(seed, name) % {0}];\n'.format(numSlots))
+fp.write('''  return _intrinsics[static_cast<size_t>(intrinsic)].name == name ? intrinsic : Intrinsic::None;
+}
+
+const IntrinsicInfo& intrinsicInfo(Intrinsic intrinsic) {
+  return _intrinsics[static_cast<size_t>(intrinsic)];
+}
+
+} // namespace ast
+''')
+fp.close()
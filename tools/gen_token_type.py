@@ -251,6 +251,7 @@ fp = open('../src/lib/ast/base_type.h', 'wt')
 fp.write('''#pragma once
 // Generated by tools/gen_token_type.py
 
+#include <iterator>
 #include <string_view>
 
 namespace ast {
@@ -277,6 +278,94 @@ inline bool isSamplerBaseType(BaseType t) {
       t == BaseType::SamplerComparisonState;
 }
 
+/// Whether the type is a scalar type, such as float or min16uint.
+inline bool isScalarBaseType(BaseType t) {
+  return t >= BaseType::Float && t <= BaseType::Min16uint;
+}
+
+// The scalar types of the vector and matrix types, in the order they're declared. Each has 20
+// vector and matrix types: S1, S1x1 to S1x4, S2, S2x1 to S2x4, and so on to S4x4.
+static const BaseType _vectorScalarTypes[] = {
+''')
+
+for k in vectorMatrixTypes:
+    fp.write('  BaseType::{0},\n'.format(enumName(k)))
+
+fp.write('''};
+
+/// The scalar type of a vector or matrix type, such as Float for float3 and float4x4. Any other
+/// type is returned as it is.
+inline BaseType scalarBaseType(BaseType t) {
+  if (t < BaseType::Float1) {
+    return t;
+  }
+  return _vectorScalarTypes[(static_cast<int>(t) - static_cast<int>(BaseType::Float1)) / 20];
+}
+
+/// The number of components of a vector type, such as 3 for float3. It's 1 for a scalar type,
+/// and 0 for a matrix or any other type.
+inline int vectorSize(BaseType t) {
+  if (t < BaseType::Float1) {
+    return isScalarBaseType(t) ? 1 : 0;
+  }
+  const int index = (static_cast<int>(t) - static_cast<int>(BaseType::Float1)) % 20;
+  return index % 5 == 0 ? index / 5 + 1 : 0;
+}
+
+/// The number of rows of a matrix type, such as 3 for float3x4. It's 0 for any other type.
+inline int matrixRows(BaseType t) {
+  if (t < BaseType::Float1) {
+    return 0;
+  }
+  const int index = (static_cast<int>(t) - static_cast<int>(BaseType::Float1)) % 20;
+  return index % 5 != 0 ? index / 5 + 1 : 0;
+}
+
+/// The number of columns of a matrix type, such as 4 for float3x4. It's 0 for any other type.
+inline int matrixColumns(BaseType t) {
+  if (t < BaseType::Float1) {
+    return 0;
+  }
+  return (static_cast<int>(t) - static_cast<int>(BaseType::Float1)) % 20 % 5;
+}
+
+// The first of the 20 vector and matrix types of the scalar type, or Undefined if it has none.
+inline BaseType _firstVectorBaseType(BaseType scalar) {
+  for (int i = 0; i < static_cast<int>(std::size(_vectorScalarTypes)); ++i) {
+    if (_vectorScalarTypes[i] == scalar) {
+      return static_cast<BaseType>(static_cast<int>(BaseType::Float1) + i * 20);
+    }
+  }
+  return BaseType::Undefined;
+}
+
+/// The vector type with the scalar type and number of components, such as Float3 for Float and
+/// 3. A size of 1 gives the scalar type itself. It's Undefined if there is no such type.
+inline BaseType vectorBaseType(BaseType scalar, int size) {
+  if (!isScalarBaseType(scalar) || size < 1 || size > 4) {
+    return BaseType::Undefined;
+  }
+  if (size == 1) {
+    return scalar;
+  }
+  const BaseType first = _firstVectorBaseType(scalar);
+  return static_cast<BaseType>(static_cast<int>(first) + (size - 1) * 5);
+}
+
+/// The matrix type with the scalar type, rows and columns, such as Float3x4 for Float, 3 and 4.
+/// It's Undefined if there is no such type.
+inline BaseType matrixBaseType(BaseType scalar, int rows, int columns) {
+  if (!isScalarBaseType(scalar) || rows < 1 || rows > 4 || columns < 1 || columns > 4) {
+    return BaseType::Undefined;
+  }
+  const BaseType first = _firstVectorBaseType(scalar);
+  return static_cast<BaseType>(static_cast<int>(first) + (rows - 1) * 5 + columns);
+}
+
+/// The type of a swizzle of a scalar, vector or matrix of the type, such as Float2 for the xy
+/// of a float4 or the _m00_m11 of a float4x4. It's Undefined if the name isn't a swizzle of it.
+BaseType swizzleBaseType(BaseType t, const std::string_view& name);
+
 } // namespace ast
 ''')
 fp.close()
@@ -316,6 +405,68 @@ const std::string_view& baseTypeToString(BaseType t) {
   return (*ti).second;
 }
 
+// The number of components named by the swizzle of a vector of the size, such as 2 for xy, or
+// 0 if the name isn't a swizzle of it.
+static int _vectorSwizzle(const std::string_view& name, int size) {
+  if (name.empty() || name.size() > 4) {
+    return 0;
+  }
+  for (const std::string_view components : {std::string_view("xyzw"), std::string_view("rgba")}) {
+    bool matches = true;
+    for (const char c : name) {
+      const size_t index = components.find(c);
+      if (index == std::string_view::npos || static_cast<int>(index) >= size) {
+        matches = false;
+        break;
+      }
+    }
+    if (matches) {
+      return static_cast<int>(name.size());
+    }
+  }
+  return 0;
+}
+
+// The number of components named by the swizzle of a matrix, such as 2 for _m00_m11 or _11_22,
+// or 0 if the name isn't a swizzle of it.
+static int _matrixSwizzle(const std::string_view& name, int rows, int columns) {
+  int count = 0;
+  size_t i = 0;
+  while (i < name.size()) {
+    if (name[i] != '_' || count == 4) {
+      return 0;
+    }
+    i++;
+    // _mRC counts from 0, and _RC from 1.
+    int first = 1;
+    if (i < name.size() && name[i] == 'm') {
+      first = 0;
+      i++;
+    }
+    if (i + 2 > name.size()) {
+      return 0;
+    }
+    const int row = name[i] - '0' - first;
+    const int column = name[i + 1] - '0' - first;
+    if (row < 0 || row >= rows || column < 0 || column >= columns) {
+      return 0;
+    }
+    i += 2;
+    count++;
+  }
+  return count;
+}
+
+BaseType swizzleBaseType(BaseType t, const std::string_view& name) {
+  if (!isScalarBaseType(t) && t < BaseType::Float1) {
+    return BaseType::Undefined;
+  }
+  const int size = vectorSize(t);
+  const int count = size != 0 ? _vectorSwizzle(name, size)
+                              : _matrixSwizzle(name, matrixRows(t), matrixColumns(t));
+  return count != 0 ? vectorBaseType(scalarBaseType(t), count) : BaseType::Undefined;
+}
+
 } // namespace ast
 ''')
 fp.close()